@@ -43,6 +43,7 @@ JReactInstance::JReactInstance(
   auto timerRegistry =
       std::make_unique<JavaTimerRegistry>(jni::make_global(javaTimerManager));
   auto timerManager = std::make_shared<TimerManager>(std::move(timerRegistry));
+  timerManager->enableTimerWheel();
   jsTimerExecutor->cthis()->setTimerManager(timerManager);
 
   jReactExceptionManager_ = jni::make_global(jReactExceptionManager);
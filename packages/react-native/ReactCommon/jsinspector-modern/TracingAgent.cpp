@@ -10,6 +10,9 @@
 #include <jsinspector-modern/tracing/PerformanceTracer.h>
 #include <jsinspector-modern/tracing/RuntimeSamplingProfileTraceEventSerializer.h>
 
+#include <string>
+#include <string_view>
+
 namespace facebook::react::jsinspector_modern {
 
 namespace {
@@ -87,12 +90,17 @@ bool TracingAgent::handleRequest(const cdp::PreparsedRequest& req) {
     // Send response to Tracing.end request.
     frontendChannel_(cdp::jsonResult(req.id));
 
-    auto dataCollectedCallback = [this](const folly::dynamic& eventsChunk) {
-      frontendChannel_(cdp::jsonNotification(
-          "Tracing.dataCollected",
-          folly::dynamic::object("value", eventsChunk)));
+    // Trace Events are serialized straight into the notification, without
+    // building a folly::dynamic for each of them.
+    std::string notification;
+    auto dataCollectedCallback = [&](std::string_view eventsChunkJson) {
+      notification.assign(
+          R"({"method":"Tracing.dataCollected","params":{"value":)");
+      notification.append(eventsChunkJson);
+      notification.append("}}");
+      frontendChannel_(notification);
     };
-    performanceTracer.collectEvents(
+    performanceTracer.collectEventsAsJson(
         dataCollectedCallback, TRACE_EVENT_CHUNK_SIZE);
 
     tracing::RuntimeSamplingProfileTraceEventSerializer serializer(
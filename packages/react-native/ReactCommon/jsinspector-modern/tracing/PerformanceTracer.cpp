@@ -6,13 +6,15 @@
  */
 
 #include "PerformanceTracer.h"
+#include "TraceEventSerializer.h"
 
 #include <oscompat/OSCompat.h>
 
 #include <folly/json.h>
 
-#include <array>
+#include <algorithm>
 #include <mutex>
+#include <string>
 
 namespace facebook::react::jsinspector_modern {
 
@@ -35,36 +37,34 @@ PerformanceTracer::PerformanceTracer()
     : processId_(oscompat::getCurrentProcessId()) {}
 
 bool PerformanceTracer::startTracing() {
-  {
-    std::lock_guard lock(mutex_);
-    if (tracing_) {
-      return false;
-    }
-
-    tracing_ = true;
+  std::lock_guard lock(mutex_);
+  if (tracingSession_ != 0) {
+    return false;
   }
 
+  // Never 0, which stands for not tracing
+  auto session = lastSession_ = std::max(lastSession_ + 1, uint32_t{1});
+  tracingSession_ = session;
   reportProcess(processId_, "React Native");
+  buffer_.append(
+      TraceEvent{
+          .name = "TracingStartedInPage",
+          .cat = "disabled-by-default-devtools.timeline",
+          .ph = 'I',
+          .ts = getUnixTimestampOfNow(),
+          .pid = processId_,
+          .tid = oscompat::getCurrentThreadId(),
+          .args = folly::dynamic::object("data", folly::dynamic::object()),
+      },
+      session);
 
-  {
-    std::lock_guard lock(mutex_);
-    buffer_.push_back(TraceEvent{
-        .name = "TracingStartedInPage",
-        .cat = "disabled-by-default-devtools.timeline",
-        .ph = 'I',
-        .ts = getUnixTimestampOfNow(),
-        .pid = processId_,
-        .tid = oscompat::getCurrentThreadId(),
-        .args = folly::dynamic::object("data", folly::dynamic::object()),
-    });
-
-    return true;
-  }
+  return true;
 }
 
 bool PerformanceTracer::stopTracing() {
   std::lock_guard lock(mutex_);
-  if (!tracing_) {
+  auto session = tracingSession_.load();
+  if (session == 0) {
     return false;
   }
 
@@ -74,17 +74,19 @@ bool PerformanceTracer::stopTracing() {
   // samples will be displayed as empty. We use this event to avoid that.
   // This could happen for non-bridgeless apps, where Performance interface is
   // not supported and no spec-compliant Event Loop implementation.
-  buffer_.push_back(TraceEvent{
-      .name = "ReactNative-TracingStopped",
-      .cat = "disabled-by-default-devtools.timeline",
-      .ph = 'I',
-      .ts = getUnixTimestampOfNow(),
-      .pid = processId_,
-      .tid = oscompat::getCurrentThreadId(),
-  });
+  buffer_.append(
+      TraceEvent{
+          .name = "ReactNative-TracingStopped",
+          .cat = "disabled-by-default-devtools.timeline",
+          .ph = 'I',
+          .ts = getUnixTimestampOfNow(),
+          .pid = processId_,
+          .tid = oscompat::getCurrentThreadId(),
+      },
+      session);
 
   performanceMeasureCount_ = 0;
-  tracing_ = false;
+  tracingSession_ = 0;
   return true;
 }
 
@@ -94,47 +96,84 @@ void PerformanceTracer::collectEvents(
     uint16_t chunkSize) {
   std::lock_guard lock(mutex_);
 
-  if (buffer_.empty()) {
-    return;
-  }
-
   auto traceEvents = folly::dynamic::array();
-  for (auto event : buffer_) {
-    // Emit trace events
-    traceEvents.push_back(serializeTraceEvent(event));
-
-    if (traceEvents.size() == chunkSize) {
-      resultCallback(traceEvents);
-      traceEvents = folly::dynamic::array();
-    }
-  }
+  buffer_.consume(
+      [&](TraceEvent&& event) {
+        // Emit trace events
+        traceEvents.push_back(
+            TraceEventSerializer::serialize(std::move(event)));
+
+        if (traceEvents.size() == chunkSize) {
+          resultCallback(traceEvents);
+          traceEvents = folly::dynamic::array();
+        }
+      },
+      lastSession_);
   if (!traceEvents.empty()) {
     resultCallback(traceEvents);
   }
+  releaseBufferIfStopped();
+}
+
+void PerformanceTracer::collectEventsAsJson(
+    const std::function<void(std::string_view eventsChunkJson)>&
+        resultCallback,
+    uint16_t chunkSize) {
+  std::lock_guard lock(mutex_);
+
+  std::string traceEvents;
+  uint16_t traceEventCount = 0;
+  buffer_.consume(
+      [&](TraceEvent&& event) {
+        traceEvents.push_back(traceEventCount == 0 ? '[' : ',');
+        TraceEventSerializer::serializeAsJson(event, traceEvents);
+
+        if (++traceEventCount == chunkSize) {
+          traceEvents.push_back(']');
+          resultCallback(traceEvents);
+          // Keeps the capacity, chunks are of similar size
+          traceEvents.clear();
+          traceEventCount = 0;
+        }
+      },
+      lastSession_);
+  if (traceEventCount > 0) {
+    traceEvents.push_back(']');
+    resultCallback(traceEvents);
+  }
+  releaseBufferIfStopped();
+}
+
+void PerformanceTracer::releaseBufferIfStopped() {
+  // Once a stopped session is collected, reporting threads have nothing
+  // left to keep
+  if (tracingSession_ == 0) {
+    buffer_.clear();
+  }
+}
 
-  buffer_.clear();
+size_t PerformanceTracer::getBufferedBytes() const {
+  return buffer_.getAllocatedBytes();
 }
 
 void PerformanceTracer::reportMark(
     const std::string_view& name,
     uint64_t start) {
-  if (!tracing_) {
-    return;
-  }
-
-  std::lock_guard<std::mutex> lock(mutex_);
-  if (!tracing_) {
+  auto session = tracingSession_.load(std::memory_order_relaxed);
+  if (session == 0) {
     return;
   }
 
-  buffer_.push_back(TraceEvent{
-      .name = std::string(name),
-      .cat = "blink.user_timing",
-      .ph = 'I',
-      .ts = start,
-      .pid = processId_,
-      .tid = oscompat::getCurrentThreadId(),
-  });
+  buffer_.append(
+      TraceEvent{
+          .name = std::string(name),
+          .cat = "blink.user_timing",
+          .ph = 'I',
+          .ts = start,
+          .pid = processId_,
+          .tid = oscompat::getCurrentThreadId(),
+      },
+      session);
 }
 
 void PerformanceTracer::reportMeasure(
@@ -142,12 +181,8 @@ void PerformanceTracer::reportMeasure(
     uint64_t start,
     uint64_t duration,
     const std::optional<DevToolsTrackEntryPayload>& trackMetadata) {
-  if (!tracing_) {
-    return;
-  }
-
-  std::lock_guard<std::mutex> lock(mutex_);
-  if (!tracing_) {
+  auto session = tracingSession_.load(std::memory_order_relaxed);
+  if (session == 0) {
     return;
   }
 
@@ -160,48 +195,51 @@ void PerformanceTracer::reportMeasure(
         folly::dynamic::object("detail", folly::toJson(devtoolsObject));
   }
 
-  ++performanceMeasureCount_;
+  auto id =
+      performanceMeasureCount_.fetch_add(1, std::memory_order_relaxed) + 1;
   auto currentThreadId = oscompat::getCurrentThreadId();
-  buffer_.push_back(TraceEvent{
-      .id = performanceMeasureCount_,
-      .name = std::string(name),
-      .cat = "blink.user_timing",
-      .ph = 'b',
-      .ts = start,
-      .pid = processId_,
-      .tid = currentThreadId,
-      .args = beginEventArgs,
-  });
-  buffer_.push_back(TraceEvent{
-      .id = performanceMeasureCount_,
-      .name = std::string(name),
-      .cat = "blink.user_timing",
-      .ph = 'e',
-      .ts = start + duration,
-      .pid = processId_,
-      .tid = currentThreadId,
-  });
+  buffer_.append(
+      TraceEvent{
+          .id = id,
+          .name = std::string(name),
+          .cat = "blink.user_timing",
+          .ph = 'b',
+          .ts = start,
+          .pid = processId_,
+          .tid = currentThreadId,
+          .args = std::move(beginEventArgs),
+      },
+      session);
+  buffer_.append(
+      TraceEvent{
+          .id = id,
+          .name = std::string(name),
+          .cat = "blink.user_timing",
+          .ph = 'e',
+          .ts = start + duration,
+          .pid = processId_,
+          .tid = currentThreadId,
+      },
+      session);
 }
 
 void PerformanceTracer::reportProcess(uint64_t id, const std::string& name) {
-  if (!tracing_) {
-    return;
-  }
-
-  std::lock_guard<std::mutex> lock(mutex_);
-  if (!tracing_) {
+  auto session = tracingSession_.load(std::memory_order_relaxed);
+  if (session == 0) {
     return;
   }
 
-  buffer_.push_back(TraceEvent{
-      .name = "process_name",
-      .cat = "__metadata",
-      .ph = 'M',
-      .ts = 0,
-      .pid = id,
-      .tid = 0,
-      .args = folly::dynamic::object("name", name),
-  });
+  buffer_.append(
+      TraceEvent{
+          .name = "process_name",
+          .cat = "__metadata",
+          .ph = 'M',
+          .ts = 0,
+          .pid = id,
+          .tid = 0,
+          .args = folly::dynamic::object("name", name),
+      },
+      session);
 }
 
 void PerformanceTracer::reportJavaScriptThread() {
@@ -209,142 +247,127 @@ void PerformanceTracer::reportJavaScriptThread() {
 }
 
 void PerformanceTracer::reportThread(uint64_t id, const std::string& name) {
-  if (!tracing_) {
+  auto session = tracingSession_.load(std::memory_order_relaxed);
+  if (session == 0) {
     return;
   }
 
-  std::lock_guard<std::mutex> lock(mutex_);
-  if (!tracing_) {
-    return;
-  }
-
-  buffer_.push_back(TraceEvent{
-      .name = "thread_name",
-      .cat = "__metadata",
-      .ph = 'M',
-      .ts = 0,
-      .pid = processId_,
-      .tid = id,
-      .args = folly::dynamic::object("name", name),
-  });
+  buffer_.append(
+      TraceEvent{
+          .name = "thread_name",
+          .cat = "__metadata",
+          .ph = 'M',
+          .ts = 0,
+          .pid = processId_,
+          .tid = id,
+          .args = folly::dynamic::object("name", name),
+      },
+      session);
 
   // This is synthetic Trace Event, which should not be represented on a
   // timeline. CDT will filter out threads that only have JavaScript samples and
   // no timeline events or user timings. We use this event to avoid that.
   // This could happen for non-bridgeless apps, where Performance interface is
   // not supported and no spec-compliant Event Loop implementation.
-  buffer_.push_back(TraceEvent{
-      .name = "ReactNative-ThreadRegistered",
-      .cat = "disabled-by-default-devtools.timeline",
-      .ph = 'I',
-      .ts = 0,
-      .pid = processId_,
-      .tid = id,
-  });
+  buffer_.append(
+      TraceEvent{
+          .name = "ReactNative-ThreadRegistered",
+          .cat = "disabled-by-default-devtools.timeline",
+          .ph = 'I',
+          .ts = 0,
+          .pid = processId_,
+          .tid = id,
+      },
+      session);
 }
 
 void PerformanceTracer::reportEventLoopTask(uint64_t start, uint64_t end) {
-  if (!tracing_) {
-    return;
-  }
-
-  std::lock_guard lock(mutex_);
-  if (!tracing_) {
+  auto session = tracingSession_.load(std::memory_order_relaxed);
+  if (session == 0) {
     return;
   }
 
-  buffer_.push_back(TraceEvent{
-      .name = "RunTask",
-      .cat = "disabled-by-default-devtools.timeline",
-      .ph = 'X',
-      .ts = start,
-      .pid = oscompat::getCurrentProcessId(),
-      .tid = oscompat::getCurrentThreadId(),
-      .dur = end - start,
-  });
+  buffer_.append(
+      TraceEvent{
+          .name = "RunTask",
+          .cat = "disabled-by-default-devtools.timeline",
+          .ph = 'X',
+          .ts = start,
+          .pid = oscompat::getCurrentProcessId(),
+          .tid = oscompat::getCurrentThreadId(),
+          .dur = end - start,
+      },
+      session);
 }
 
 void PerformanceTracer::reportEventLoopMicrotasks(
     uint64_t start,
     uint64_t end) {
-  if (!tracing_) {
-    return;
-  }
-
-  std::lock_guard lock(mutex_);
-  if (!tracing_) {
+  auto session = tracingSession_.load(std::memory_order_relaxed);
+  if (session == 0) {
     return;
   }
 
-  buffer_.push_back(TraceEvent{
-      .name = "RunMicrotasks",
-      .cat = "v8.execute",
-      .ph = 'X',
-      .ts = start,
-      .pid = oscompat::getCurrentProcessId(),
-      .tid = oscompat::getCurrentThreadId(),
-      .dur = end - start,
-  });
+  buffer_.append(
+      TraceEvent{
+          .name = "RunMicrotasks",
+          .cat = "v8.execute",
+          .ph = 'X',
+          .ts = start,
+          .pid = oscompat::getCurrentProcessId(),
+          .tid = oscompat::getCurrentThreadId(),
+          .dur = end - start,
+      },
+      session);
 }
 
-folly::dynamic PerformanceTracer::getSerializedRuntimeProfileTraceEvent(
+void PerformanceTracer::appendSerializedRuntimeProfileTraceEvent(
     uint64_t threadId,
     uint16_t profileId,
-    uint64_t eventUnixTimestamp) {
+    uint64_t eventUnixTimestamp,
+    std::string& out) {
   // CDT prioritizes event timestamp over startTime metadata field.
   // https://fburl.com/lo764pf4
-  return serializeTraceEvent(TraceEvent{
-      .id = profileId,
-      .name = "Profile",
-      .cat = "disabled-by-default-v8.cpu_profiler",
-      .ph = 'P',
-      .ts = eventUnixTimestamp,
-      .pid = processId_,
-      .tid = threadId,
-      .args = folly::dynamic::object(
-          "data", folly ::dynamic::object("startTime", eventUnixTimestamp)),
-  });
+  TraceEventSerializer::serializeAsJson(
+      TraceEvent{
+          .id = profileId,
+          .name = "Profile",
+          .cat = "disabled-by-default-v8.cpu_profiler",
+          .ph = 'P',
+          .ts = eventUnixTimestamp,
+          .pid = processId_,
+          .tid = threadId,
+          .args = folly::dynamic::object(
+              "data",
+              folly::dynamic::object("startTime", eventUnixTimestamp)),
+      },
+      out);
 }
 
-folly::dynamic PerformanceTracer::getSerializedRuntimeProfileChunkTraceEvent(
+void PerformanceTracer::appendSerializedRuntimeProfileChunkTraceEvent(
     uint16_t profileId,
     uint64_t threadId,
     uint64_t eventUnixTimestamp,
-    const tracing::TraceEventProfileChunk& traceEventProfileChunk) {
-  return serializeTraceEvent(TraceEvent{
-      .id = profileId,
-      .name = "ProfileChunk",
-      .cat = "disabled-by-default-v8.cpu_profiler",
-      .ph = 'P',
-      .ts = eventUnixTimestamp,
-      .pid = processId_,
-      .tid = threadId,
-      .args =
-          folly::dynamic::object("data", traceEventProfileChunk.toDynamic()),
-  });
-}
-
-folly::dynamic PerformanceTracer::serializeTraceEvent(
-    const TraceEvent& event) const {
-  folly::dynamic result = folly::dynamic::object;
-
-  if (event.id.has_value()) {
-    std::array<char, 16> buffer{};
-    snprintf(buffer.data(), buffer.size(), "0x%x", event.id.value());
-    result["id"] = buffer.data();
-  }
-  result["name"] = event.name;
-  result["cat"] = event.cat;
-  result["ph"] = std::string(1, event.ph);
-  result["ts"] = event.ts;
-  result["pid"] = event.pid;
-  result["tid"] = event.tid;
-  result["args"] = event.args;
-  if (event.dur.has_value()) {
-    result["dur"] = event.dur.value();
-  }
-
-  return result;
+    std::string_view profileChunkJson,
+    std::string& out) {
+  std::string args;
+  args.reserve(profileChunkJson.size() + 10);
+  args.append("{\"data\":");
+  args.append(profileChunkJson);
+  args.push_back('}');
+
+  TraceEventSerializer::serializeAsJson(
+      TraceEvent{
+          .id = profileId,
+          .name = "ProfileChunk",
+          .cat = "disabled-by-default-v8.cpu_profiler",
+          .ph = 'P',
+          .ts = eventUnixTimestamp,
+          .pid = processId_,
+          .tid = threadId,
+      },
+      args,
+      out);
 }
 
 } // namespace facebook::react::jsinspector_modern
@@ -9,14 +9,16 @@
 
 #include "CdpTracing.h"
 #include "TraceEvent.h"
-#include "TraceEventProfile.h"
+#include "TraceEventBuffer.h"
 
 #include <folly/dynamic.h>
 
+#include <atomic>
 #include <functional>
 #include <mutex>
 #include <optional>
-#include <vector>
+#include <string>
+#include <string_view>
 
 namespace facebook::react::jsinspector_modern {
 
@@ -47,18 +49,34 @@ class PerformanceTracer {
    * enabled.
    */
   bool isTracing() const {
-    // This is not thread safe but it's only a performance optimization. The
-    // call to report marks and measures is already thread safe.
-    return tracing_;
+    return tracingSession_.load(std::memory_order_relaxed) != 0;
   }
 
   /**
-   * Flush out buffered CDP Trace Events using the given callback.
+   * Flush out buffered CDP Trace Events of the current or last session using
+   * the given callback. Events reported for earlier sessions are dropped.
    */
   void collectEvents(
       const std::function<void(const folly::dynamic& eventsChunk)>&
           resultCallback,
       uint16_t chunkSize);
+
+  /**
+   * Flush out buffered CDP Trace Events using the given callback, as chunks
+   * of JSON arrays of at most \p chunkSize events. Events are serialized
+   * straight to JSON as they are drained, so only one chunk is held in memory
+   * at a time.
+   */
+  void collectEventsAsJson(
+      const std::function<void(std::string_view eventsChunkJson)>&
+          resultCallback,
+      uint16_t chunkSize);
+
+  /**
+   * Number of bytes currently used to buffer Trace Events, not counting the
+   * strings and args they own.
+   */
+  size_t getBufferedBytes() const;
   /**
    * Record a `Performance.mark()` event - a labelled timestamp. If not
    * currently tracing, this is a no-op.
@@ -108,23 +126,25 @@ class PerformanceTracer {
   void reportEventLoopMicrotasks(uint64_t start, uint64_t end);
 
   /**
-   * Create and serialize Profile Trace Event.
-   * \return serialized Trace Event that represents a Profile for CDT.
+   * Create Profile Trace Event and append its JSON to \p out.
    */
-  folly::dynamic getSerializedRuntimeProfileTraceEvent(
+  void appendSerializedRuntimeProfileTraceEvent(
       uint64_t threadId,
       uint16_t profileId,
-      uint64_t eventUnixTimestamp);
+      uint64_t eventUnixTimestamp,
+      std::string& out);
 
   /**
-   * Create and serialize ProfileChunk Trace Event.
-   * \return serialized Trace Event that represents a Profile Chunk for CDT.
+   * Create ProfileChunk Trace Event and append its JSON to \p out.
+   * \param profileChunkJson The serialized "data" argument of the event, with
+   * the nodes, samples and time deltas of the chunk.
    */
-  folly::dynamic getSerializedRuntimeProfileChunkTraceEvent(
+  void appendSerializedRuntimeProfileChunkTraceEvent(
       uint16_t profileId,
       uint64_t threadId,
       uint64_t eventUnixTimestamp,
-      const tracing::TraceEventProfileChunk& traceEventProfileChunk);
+      std::string_view profileChunkJson,
+      std::string& out);
 
  private:
   PerformanceTracer();
@@ -132,12 +152,19 @@ class PerformanceTracer {
   PerformanceTracer& operator=(const PerformanceTracer&) = delete;
   ~PerformanceTracer() = default;
 
-  folly::dynamic serializeTraceEvent(const TraceEvent& event) const;
+  void releaseBufferIfStopped();
 
-  bool tracing_{false};
+  // Number of the current tracing session, 0 when not tracing. Events are
+  // tagged with it, so that a report racing the end of a session does not
+  // leak into the next one.
+  std::atomic<uint32_t> tracingSession_{0};
+  // Number of the current or last session, guarded by `mutex_`
+  uint32_t lastSession_{0};
   uint64_t processId_;
-  uint32_t performanceMeasureCount_{0};
-  std::vector<TraceEvent> buffer_;
+  std::atomic<uint32_t> performanceMeasureCount_{0};
+  // Recording is lock-free, each thread appends to its own buffer.
+  TraceEventBuffer buffer_;
+  // Serializes starting, stopping and collecting
   std::mutex mutex_;
 };
 
@@ -7,7 +7,9 @@
 
 #pragma once
 
+#include <memory>
 #include <utility>
+#include <vector>
 
 #include <jsinspector-modern/tracing/RuntimeSamplingProfile.h>
 
@@ -62,6 +64,15 @@ class ProfileTreeNode {
     return callFrame_;
   }
 
+  /**
+   * \return whether this node represents the given codeType and callFrame.
+   */
+  bool matches(
+      CodeType codeType,
+      const RuntimeSamplingProfile::SampleCallStackFrame& callFrame) const {
+    return codeType_ == codeType && callFrame_ == callFrame;
+  }
+
   /**
    * \return a pointer if the node already contains a child with the same
    * codeType and callFrame, nullptr otherwise.
@@ -70,9 +81,8 @@ class ProfileTreeNode {
       CodeType childCodeType,
       const RuntimeSamplingProfile::SampleCallStackFrame& childCallFrame) {
     for (auto& existingChild : children_) {
-      if (existingChild.getCodeType() == childCodeType &&
-          existingChild.getCallFrame() == childCallFrame) {
-        return &existingChild;
+      if (existingChild->matches(childCodeType, childCallFrame)) {
+        return existingChild.get();
       }
     }
 
@@ -81,14 +91,17 @@ class ProfileTreeNode {
 
   /**
    * Creates a ProfileTreeNode and links it as a child to this node.
-   * \return a pointer to the child node.
+   * \return a pointer to the child node, which stays valid for the lifetime
+   * of this node.
    */
   ProfileTreeNode* addChild(
       uint32_t childId,
       CodeType childCodeType,
       RuntimeSamplingProfile::SampleCallStackFrame childCallFrame) {
-    return &children_.emplace_back(
-        childId, childCodeType, std::move(childCallFrame), id_);
+    return children_
+        .emplace_back(std::make_unique<ProfileTreeNode>(
+            childId, childCodeType, std::move(childCallFrame), id_))
+        .get();
   }
 
  private:
@@ -107,9 +120,10 @@ class ProfileTreeNode {
   uint32_t parentId_;
   /**
    * List of children nodes, should be unique by codeType and callFrame among
-   * each other.
+   * each other. Heap allocated, so that pointers to nodes stay valid while
+   * the tree grows.
    */
-  std::vector<ProfileTreeNode> children_;
+  std::vector<std::unique_ptr<ProfileTreeNode>> children_;
   /**
    * Information about the corresponding call frame that is represented by this
    * node.
@@ -5,10 +5,11 @@
  * LICENSE file in the root directory of this source tree.
  */
 
-#include <string_view>
-
-#include "ProfileTreeNode.h"
 #include "RuntimeSamplingProfileTraceEventSerializer.h"
+#include "ProfileTreeNode.h"
+#include "TraceEventSerializer.h"
+
+#include <string_view>
 
 namespace facebook::react::jsinspector_modern::tracing {
 
@@ -35,33 +36,6 @@ uint64_t formatTimePointToUnixTimestamp(
       .count();
 }
 
-TraceEventProfileChunk::CPUProfile::Node convertToTraceEventProfileNode(
-    const ProfileTreeNode& node) {
-  const RuntimeSamplingProfile::SampleCallStackFrame& callFrame =
-      node.getCallFrame();
-  auto traceEventCallFrame =
-      TraceEventProfileChunk::CPUProfile::Node::CallFrame{
-          node.getCodeType() == ProfileTreeNode::CodeType::JavaScript ? "JS"
-                                                                      : "other",
-          callFrame.getScriptId(),
-          std::string(callFrame.getFunctionName()),
-          callFrame.hasUrl()
-              ? std::optional<std::string>(std::string(callFrame.getUrl()))
-              : std::nullopt,
-          callFrame.hasLineNumber()
-              ? std::optional<uint32_t>(callFrame.getLineNumber())
-              : std::nullopt,
-          callFrame.hasColumnNumber()
-              ? std::optional<uint32_t>(callFrame.getColumnNumber())
-              : std::nullopt};
-
-  return TraceEventProfileChunk::CPUProfile::Node{
-      node.getId(),
-      traceEventCallFrame,
-      node.hasParent() ? std::optional<uint32_t>(node.getParentId())
-                       : std::nullopt};
-}
-
 RuntimeSamplingProfile::SampleCallStackFrame createArtificialCallFrame(
     std::string_view callFrameName) {
   return RuntimeSamplingProfile::SampleCallStackFrame{
@@ -77,77 +51,177 @@ RuntimeSamplingProfile::SampleCallStackFrame createGarbageCollectorCallFrame() {
       GARBAGE_COLLECTOR_FRAME_NAME};
 };
 
-class ProfileTreeRootNode : public ProfileTreeNode {
- public:
-  explicit ProfileTreeRootNode(uint32_t id)
-      : ProfileTreeNode(
-            id,
-            CodeType::Other,
-            createArtificialCallFrame(ROOT_FRAME_NAME)) {}
-};
+void appendSeparator(std::string& out) {
+  if (!out.empty()) {
+    out.push_back(',');
+  }
+}
 
 } // namespace
 
+RuntimeSamplingProfileTraceEventSerializer::
+    RuntimeSamplingProfileTraceEventSerializer(
+        PerformanceTracer& performanceTracer,
+        std::function<void(std::string_view traceEventsChunkJson)>
+            notificationCallback,
+        uint16_t traceEventChunkSize,
+        uint16_t profileChunkSize)
+    : performanceTracer_(performanceTracer),
+      notificationCallback_(std::move(notificationCallback)),
+      traceEventChunkSize_(traceEventChunkSize),
+      profileChunkSize_(profileChunkSize),
+      nextNodeId_(1),
+      rootNode_(
+          nextNodeId_++,
+          ProfileTreeNode::CodeType::Other,
+          createArtificialCallFrame(ROOT_FRAME_NAME)) {
+  // The first chunk carries the artificial nodes, every chunk after that only
+  // the nodes that were added since the previous one.
+  appendNodeJson(rootNode_);
+  addNode(
+      rootNode_,
+      ProfileTreeNode::CodeType::Other,
+      createArtificialCallFrame(PROGRAM_FRAME_NAME));
+  idleNodeId_ = addNode(
+                    rootNode_,
+                    ProfileTreeNode::CodeType::Other,
+                    createArtificialCallFrame(IDLE_FRAME_NAME))
+                    ->getId();
+}
+
 void RuntimeSamplingProfileTraceEventSerializer::sendProfileTraceEvent(
-    uint64_t threadId,
-    uint16_t profileId,
-    uint64_t profileStartUnixTimestamp) const {
-  folly::dynamic serializedTraceEvent =
-      performanceTracer_.getSerializedRuntimeProfileTraceEvent(
-          threadId, profileId, profileStartUnixTimestamp);
-
-  notificationCallback_(folly::dynamic::array(serializedTraceEvent));
+    uint64_t threadId) const {
+  std::string traceEventJson = "[";
+  performanceTracer_.appendSerializedRuntimeProfileTraceEvent(
+      threadId, PROFILE_ID, tracingStartUnixTimestamp_, traceEventJson);
+  traceEventJson.push_back(']');
+
+  notificationCallback_(traceEventJson);
 }
 
-void RuntimeSamplingProfileTraceEventSerializer::chunkEmptySample(
-    ProfileChunk& chunk,
-    uint32_t idleNodeId,
-    long long samplesTimeDelta) {
-  chunk.samples.push_back(idleNodeId);
-  chunk.timeDeltas.push_back(samplesTimeDelta);
+ProfileTreeNode* RuntimeSamplingProfileTraceEventSerializer::addNode(
+    ProfileTreeNode& parent,
+    ProfileTreeNode::CodeType codeType,
+    const RuntimeSamplingProfile::SampleCallStackFrame& callFrame) {
+  ProfileTreeNode* node = parent.addChild(
+      nextNodeId_++,
+      codeType,
+      RuntimeSamplingProfile::SampleCallStackFrame{
+          callFrame.getKind(),
+          callFrame.getScriptId(),
+          internString(callFrame.getFunctionName()),
+          callFrame.hasUrl()
+              ? std::optional<std::string_view>(
+                    internString(callFrame.getUrl()))
+              : std::nullopt,
+          callFrame.hasLineNumber()
+              ? std::optional<uint32_t>(callFrame.getLineNumber())
+              : std::nullopt,
+          callFrame.hasColumnNumber()
+              ? std::optional<uint32_t>(callFrame.getColumnNumber())
+              : std::nullopt});
+  appendNodeJson(*node);
+  return node;
 }
 
-void RuntimeSamplingProfileTraceEventSerializer::bufferProfileChunkTraceEvent(
-    ProfileChunk& chunk,
-    uint16_t profileId) {
-  if (chunk.isEmpty()) {
-    return;
+void RuntimeSamplingProfileTraceEventSerializer::appendNodeJson(
+    const ProfileTreeNode& node) {
+  const RuntimeSamplingProfile::SampleCallStackFrame& callFrame =
+      node.getCallFrame();
+  std::string& out = chunk_.nodesJson;
+
+  appendSeparator(out);
+  out.append(R"({"callFrame":{"codeType":)");
+  out.append(
+      node.getCodeType() == ProfileTreeNode::CodeType::JavaScript
+          ? R"("JS")"
+          : R"("other")");
+  out.append(R"(,"scriptId":)");
+  TraceEventSerializer::appendJsonNumber(
+      static_cast<uint64_t>(callFrame.getScriptId()), out);
+  out.append(R"(,"functionName":)");
+  TraceEventSerializer::appendJsonString(callFrame.getFunctionName(), out);
+  if (callFrame.hasUrl()) {
+    out.append(R"(,"url":)");
+    TraceEventSerializer::appendJsonString(callFrame.getUrl(), out);
+  }
+  if (callFrame.hasLineNumber()) {
+    out.append(R"(,"lineNumber":)");
+    TraceEventSerializer::appendJsonNumber(
+        static_cast<uint64_t>(callFrame.getLineNumber()), out);
   }
+  if (callFrame.hasColumnNumber()) {
+    out.append(R"(,"columnNumber":)");
+    TraceEventSerializer::appendJsonNumber(
+        static_cast<uint64_t>(callFrame.getColumnNumber()), out);
+  }
+  out.append(R"(},"id":)");
+  TraceEventSerializer::appendJsonNumber(
+      static_cast<uint64_t>(node.getId()), out);
+  if (node.hasParent()) {
+    out.append(R"(,"parent":)");
+    TraceEventSerializer::appendJsonNumber(
+        static_cast<uint64_t>(node.getParentId()), out);
+  }
+  out.push_back('}');
+}
 
-  std::vector<TraceEventProfileChunk::CPUProfile::Node> traceEventNodes;
-  traceEventNodes.reserve(chunk.nodes.size());
-  for (const auto& node : chunk.nodes) {
-    traceEventNodes.push_back(convertToTraceEventProfileNode(node));
+std::string_view RuntimeSamplingProfileTraceEventSerializer::internString(
+    std::string_view value) {
+  auto it = internedStrings_.find(value);
+  if (it != internedStrings_.end()) {
+    return *it;
   }
 
-  traceEventBuffer_.push_back(
-      performanceTracer_.getSerializedRuntimeProfileChunkTraceEvent(
-          profileId,
-          chunk.threadId,
-          chunk.timestamp,
-          TraceEventProfileChunk{
-              .cpuProfile =
-                  TraceEventProfileChunk::CPUProfile{
-                      traceEventNodes, chunk.samples},
-              .timeDeltas =
-                  TraceEventProfileChunk::TimeDeltas{chunk.timeDeltas},
-          }));
+  std::string_view interned = internedStringsStorage_.emplace_back(value);
+  internedStrings_.insert(interned);
+  return interned;
 }
 
-void RuntimeSamplingProfileTraceEventSerializer::processCallStack(
-    const std::vector<RuntimeSamplingProfile::SampleCallStackFrame>& callStack,
-    ProfileChunk& chunk,
-    ProfileTreeNode& rootNode,
-    uint32_t idleNodeId,
-    long long samplesTimeDelta,
-    NodeIdGenerator& nodeIdGenerator) {
-  if (callStack.empty()) {
-    chunkEmptySample(chunk, idleNodeId, samplesTimeDelta);
+void RuntimeSamplingProfileTraceEventSerializer::
+    bufferProfileChunkTraceEvent() {
+  if (chunk_.isEmpty()) {
     return;
   }
 
-  ProfileTreeNode* previousNode = &rootNode;
-  for (auto it = callStack.rbegin(); it != callStack.rend(); ++it) {
+  std::string profileChunkJson;
+  profileChunkJson.reserve(
+      chunk_.nodesJson.size() + chunk_.samplesJson.size() +
+      chunk_.timeDeltasJson.size() + 64);
+  profileChunkJson.append(R"({"cpuProfile":{"nodes":[)");
+  profileChunkJson.append(chunk_.nodesJson);
+  profileChunkJson.append(R"(],"samples":[)");
+  profileChunkJson.append(chunk_.samplesJson);
+  profileChunkJson.append(R"(]},"timeDeltas":[)");
+  profileChunkJson.append(chunk_.timeDeltasJson);
+  profileChunkJson.append("]}");
+
+  traceEventsJson_.push_back(traceEventCount_ == 0 ? '[' : ',');
+  performanceTracer_.appendSerializedRuntimeProfileChunkTraceEvent(
+      PROFILE_ID,
+      chunk_.threadId,
+      tracingStartUnixTimestamp_,
+      profileChunkJson,
+      traceEventsJson_);
+  chunk_.clear();
+
+  if (++traceEventCount_ == traceEventChunkSize_) {
+    sendBufferedTraceEventsAndClear();
+  }
+}
+
+uint32_t RuntimeSamplingProfileTraceEventSerializer::processCallStack(
+    const std::vector<RuntimeSamplingProfile::SampleCallStackFrame>&
+        callStack) {
+  if (callStack.empty()) {
+    previousCallStackNodes_.clear();
+    return idleNodeId_;
+  }
+
+  ProfileTreeNode* previousNode = &rootNode_;
+  bool isOnPreviousCallStack = true;
+  size_t depth = 0;
+  for (auto it = callStack.rbegin(); it != callStack.rend(); ++it, ++depth) {
     const RuntimeSamplingProfile::SampleCallStackFrame& callFrame = *it;
     bool isGarbageCollectorFrame = callFrame.getKind() ==
         RuntimeSamplingProfile::SampleCallStackFrame::Kind::GarbageCollector;
@@ -160,104 +234,93 @@ void RuntimeSamplingProfileTraceEventSerializer::processCallStack(
     RuntimeSamplingProfile::SampleCallStackFrame childCallFrame =
         isGarbageCollectorFrame ? createGarbageCollectorCallFrame() : callFrame;
 
+    if (isOnPreviousCallStack && depth < previousCallStackNodes_.size() &&
+        previousCallStackNodes_[depth]->matches(
+            childCodeType, childCallFrame)) {
+      previousNode = previousCallStackNodes_[depth];
+      continue;
+    }
+
+    if (isOnPreviousCallStack) {
+      isOnPreviousCallStack = false;
+      previousCallStackNodes_.resize(depth);
+    }
     ProfileTreeNode* maybeExistingChild =
         previousNode->getIfAlreadyExists(childCodeType, childCallFrame);
-    if (maybeExistingChild != nullptr) {
-      previousNode = maybeExistingChild;
-    } else {
-      previousNode = previousNode->addChild(
-          nodeIdGenerator.getNext(), childCodeType, childCallFrame);
-      chunk.nodes.push_back(*previousNode);
-    }
+    previousNode = maybeExistingChild != nullptr
+        ? maybeExistingChild
+        : addNode(*previousNode, childCodeType, childCallFrame);
+    previousCallStackNodes_.push_back(previousNode);
   }
+  previousCallStackNodes_.resize(callStack.size());
 
-  chunk.samples.push_back(previousNode->getId());
-  chunk.timeDeltas.push_back(samplesTimeDelta);
+  return previousNode->getId();
 }
 
 void RuntimeSamplingProfileTraceEventSerializer::
     sendBufferedTraceEventsAndClear() {
-  notificationCallback_(traceEventBuffer_);
-  traceEventBuffer_ = folly::dynamic::array();
+  traceEventsJson_.push_back(']');
+  notificationCallback_(traceEventsJson_);
+  traceEventsJson_.clear();
+  traceEventCount_ = 0;
 }
 
-void RuntimeSamplingProfileTraceEventSerializer::serializeAndNotify(
-    const RuntimeSamplingProfile& profile,
+void RuntimeSamplingProfileTraceEventSerializer::start(
     std::chrono::steady_clock::time_point tracingStartTime) {
-  const std::vector<RuntimeSamplingProfile::Sample>& samples =
-      profile.getSamples();
-  if (samples.empty()) {
-    return;
-  }
-
-  uint64_t firstChunkThreadId = samples.front().getThreadId();
-  uint64_t tracingStartUnixTimestamp =
-      formatTimePointToUnixTimestamp(tracingStartTime);
-  uint64_t previousSampleUnixTimestamp = tracingStartUnixTimestamp;
-  uint64_t currentChunkUnixTimestamp = tracingStartUnixTimestamp;
-
-  sendProfileTraceEvent(
-      firstChunkThreadId, PROFILE_ID, tracingStartUnixTimestamp);
-
-  // There could be any number of new nodes in this chunk. Empty if all nodes
-  // are already emitted in previous chunks.
-  ProfileChunk chunk{
-      profileChunkSize_, firstChunkThreadId, currentChunkUnixTimestamp};
-
-  NodeIdGenerator nodeIdGenerator{};
-
-  ProfileTreeRootNode rootNode(nodeIdGenerator.getNext());
-  chunk.nodes.push_back(rootNode);
+  tracingStartUnixTimestamp_ = formatTimePointToUnixTimestamp(tracingStartTime);
+  previousSampleUnixTimestamp_ = tracingStartUnixTimestamp_;
+}
 
-  ProfileTreeNode* programNode = rootNode.addChild(
-      nodeIdGenerator.getNext(),
-      ProfileTreeNode::CodeType::Other,
-      createArtificialCallFrame(PROGRAM_FRAME_NAME));
-  chunk.nodes.push_back(*programNode);
+void RuntimeSamplingProfileTraceEventSerializer::addSample(
+    const RuntimeSamplingProfile::Sample& sample) {
+  uint64_t currentSampleThreadId = sample.getThreadId();
+  if (!hasSamples_) {
+    hasSamples_ = true;
+    sendProfileTraceEvent(currentSampleThreadId);
+    chunk_.threadId = currentSampleThreadId;
+  }
 
-  ProfileTreeNode* idleNode = rootNode.addChild(
-      nodeIdGenerator.getNext(),
-      ProfileTreeNode::CodeType::Other,
-      createArtificialCallFrame(IDLE_FRAME_NAME));
-  chunk.nodes.push_back(*idleNode);
-  uint32_t idleNodeId = idleNode->getId();
-
-  for (const auto& sample : samples) {
-    uint64_t currentSampleThreadId = sample.getThreadId();
-    long long currentSampleUnixTimestamp = sample.getTimestamp();
-
-    // We should not attempt to merge samples from different threads.
-    // From past observations, this only happens for GC nodes.
-    // We should group samples by thread id once we support executing JavaScript
-    // on different threads.
-    if (currentSampleThreadId != chunk.threadId || chunk.isFull()) {
-      bufferProfileChunkTraceEvent(chunk, PROFILE_ID);
-      chunk = ProfileChunk{
-          profileChunkSize_, currentSampleThreadId, currentChunkUnixTimestamp};
-    }
+  // We should not attempt to merge samples from different threads.
+  // From past observations, this only happens for GC nodes.
+  // We should group samples by thread id once we support executing JavaScript
+  // on different threads.
+  if (currentSampleThreadId != chunk_.threadId ||
+      chunk_.isFull(profileChunkSize_)) {
+    bufferProfileChunkTraceEvent();
+    chunk_.threadId = currentSampleThreadId;
+  }
 
-    if (traceEventBuffer_.size() == traceEventChunkSize_) {
-      sendBufferedTraceEventsAndClear();
-    }
+  uint32_t nodeId = processCallStack(sample.getCallStack());
+  auto currentSampleUnixTimestamp = sample.getTimestamp();
 
-    processCallStack(
-        sample.getCallStack(),
-        chunk,
-        rootNode,
-        idleNodeId,
-        currentSampleUnixTimestamp - previousSampleUnixTimestamp,
-        nodeIdGenerator);
+  appendSeparator(chunk_.samplesJson);
+  TraceEventSerializer::appendJsonNumber(
+      static_cast<uint64_t>(nodeId), chunk_.samplesJson);
+  appendSeparator(chunk_.timeDeltasJson);
+  TraceEventSerializer::appendJsonNumber(
+      static_cast<int64_t>(
+          currentSampleUnixTimestamp - previousSampleUnixTimestamp_),
+      chunk_.timeDeltasJson);
+  chunk_.sampleCount++;
 
-    previousSampleUnixTimestamp = currentSampleUnixTimestamp;
-  }
+  previousSampleUnixTimestamp_ = currentSampleUnixTimestamp;
+}
 
-  if (!chunk.isEmpty()) {
-    bufferProfileChunkTraceEvent(chunk, PROFILE_ID);
+void RuntimeSamplingProfileTraceEventSerializer::finish() {
+  bufferProfileChunkTraceEvent();
+  if (traceEventCount_ > 0) {
+    sendBufferedTraceEventsAndClear();
   }
+}
 
-  if (!traceEventBuffer_.empty()) {
-    sendBufferedTraceEventsAndClear();
+void RuntimeSamplingProfileTraceEventSerializer::serializeAndNotify(
+    const RuntimeSamplingProfile& profile,
+    std::chrono::steady_clock::time_point tracingStartTime) {
+  start(tracingStartTime);
+  for (const auto& sample : profile.getSamples()) {
+    addSample(sample);
   }
+  finish();
 }
 
 } // namespace facebook::react::jsinspector_modern::tracing
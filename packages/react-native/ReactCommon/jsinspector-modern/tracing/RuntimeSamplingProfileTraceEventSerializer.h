@@ -11,78 +11,74 @@
 #include "ProfileTreeNode.h"
 #include "RuntimeSamplingProfile.h"
 
-namespace facebook::react::jsinspector_modern::tracing {
-
-namespace {
-
-struct NodeIdGenerator {
- public:
-  uint32_t getNext() {
-    return ++counter_;
-  }
-
- private:
-  uint32_t counter_ = 0;
-};
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
 
-} // namespace
+namespace facebook::react::jsinspector_modern::tracing {
 
 /**
  * Serializes RuntimeSamplingProfile into collection of specific Trace Events,
  * which represent Profile information on a timeline.
+ *
+ * Samples are processed one at a time: the profile tree grows as new call
+ * stacks are seen and every ProfileChunk Trace Event is written out as JSON
+ * as soon as it is full, so the memory used does not grow with the number of
+ * samples. A serializer handles a single profile.
  */
 class RuntimeSamplingProfileTraceEventSerializer {
   struct ProfileChunk {
-    ProfileChunk(
-        uint16_t chunkSize,
-        uint64_t chunkThreadId,
-        uint64_t chunkTimestamp)
-        : size(chunkSize), threadId(chunkThreadId), timestamp(chunkTimestamp) {
-      samples.reserve(size);
-      timeDeltas.reserve(size);
+    bool isFull(uint16_t size) const {
+      return sampleCount == size;
     }
 
-    bool isFull() const {
-      return samples.size() == size;
+    bool isEmpty() const {
+      return sampleCount == 0;
     }
 
-    bool isEmpty() const {
-      return samples.empty();
+    void clear() {
+      // Keeps the capacity, chunks are of similar size
+      nodesJson.clear();
+      samplesJson.clear();
+      timeDeltasJson.clear();
+      sampleCount = 0;
     }
 
-    std::vector<ProfileTreeNode> nodes;
-    std::vector<uint32_t> samples;
-    std::vector<long long> timeDeltas;
-    uint16_t size;
-    uint64_t threadId;
-    uint64_t timestamp;
+    /** Comma separated JSON of the nodes first seen in this chunk. */
+    std::string nodesJson;
+    /** Comma separated ids of the sampled nodes. */
+    std::string samplesJson;
+    /** Comma separated deltas between sample timestamps. */
+    std::string timeDeltasJson;
+    uint16_t sampleCount{0};
+    uint64_t threadId{0};
   };
 
  public:
   /**
    * \param performanceTracer A reference to PerformanceTracer instance.
    * \param notificationCallback A reference to a callback, which is called
-   * when a chunk of trace events is ready to be sent.
+   * with a JSON array of trace events when a chunk of them is ready to be
+   * sent.
    * \param traceEventChunkSize The maximum number of ProfileChunk trace
    * events that can be sent in a single CDP Tracing.dataCollected message.
-   * \param profileChunkSize The maximum number of ProfileChunk trace events
-   * that can be sent in a single ProfileChunk trace event.
+   * \param profileChunkSize The maximum number of samples that can be sent
+   * in a single ProfileChunk trace event.
    */
   RuntimeSamplingProfileTraceEventSerializer(
       PerformanceTracer& performanceTracer,
-      std::function<void(const folly::dynamic& traceEventsChunk)>
+      std::function<void(std::string_view traceEventsChunkJson)>
           notificationCallback,
       uint16_t traceEventChunkSize,
-      uint16_t profileChunkSize = 10)
-      : performanceTracer_(performanceTracer),
-        notificationCallback_(std::move(notificationCallback)),
-        traceEventChunkSize_(traceEventChunkSize),
-        profileChunkSize_(profileChunkSize) {
-    traceEventBuffer_ = folly::dynamic::array();
-    traceEventBuffer_.reserve(traceEventChunkSize);
-  }
+      uint16_t profileChunkSize = 10);
 
   /**
+   * Serializes a complete profile, equivalent to calling \c start, \c
+   * addSample for each sample and \c finish.
    * \param profile What we will be serializing.
    * \param tracingStartTime A timestamp of when tracing of an Instance started,
    * will be used as a starting reference point of JavaScript samples recording.
@@ -91,60 +87,63 @@ class RuntimeSamplingProfileTraceEventSerializer {
       const RuntimeSamplingProfile& profile,
       std::chrono::steady_clock::time_point tracingStartTime);
 
+  /**
+   * Starts serializing a profile, before its first sample is added.
+   * \param tracingStartTime A timestamp of when tracing of an Instance started,
+   * will be used as a starting reference point of JavaScript samples recording.
+   */
+  void start(std::chrono::steady_clock::time_point tracingStartTime);
+
+  /**
+   * Adds the next sample of the profile. Samples should be added in
+   * chronological order. The sample is not referenced after this call
+   * returns.
+   */
+  void addSample(const RuntimeSamplingProfile::Sample& sample);
+
+  /**
+   * Sends the remaining buffered Trace Events. Nothing is sent for a profile
+   * without samples.
+   */
+  void finish();
+
  private:
   /**
    * Sends a single "Profile" Trace Event via notificationCallback_.
    * \param threadId The id of the thread, where the Profile was collected.
-   * \param profileId The id of the Profile.
-   * \param profileStartUnixTimestamp The Unix timestamp of the start of the
-   * profile.
    */
-  void sendProfileTraceEvent(
-      uint64_t threadId,
-      uint16_t profileId,
-      uint64_t profileStartUnixTimestamp) const;
+  void sendProfileTraceEvent(uint64_t threadId) const;
 
   /**
-   * Encapsulates logic for processing the empty sample, when the VM was idling.
-   * \param chunk The profile chunk, which will record this sample.
-   * \param idleNodeId The id of the (idle) node.
-   * \param samplesTimeDelta Delta between the current sample and the
-   * previous one.
+   * Adds the call stack of a sample to the profile tree.
+   * \return the id of the node for the top frame of the call stack.
    */
-  void chunkEmptySample(
-      ProfileChunk& chunk,
-      uint32_t idleNodeId,
-      long long samplesTimeDelta);
+  uint32_t processCallStack(
+      const std::vector<RuntimeSamplingProfile::SampleCallStackFrame>&
+          callStack);
 
   /**
-   * Records ProfileChunk as a "ProfileChunk" Trace Event in traceEventBuffer_.
-   * \param chunk The chunk that will be buffered.
-   * \param profileId The id of the Profile.
+   * Creates a node, records it in the current chunk.
    */
-  void bufferProfileChunkTraceEvent(ProfileChunk& chunk, uint16_t profileId);
+  ProfileTreeNode* addNode(
+      ProfileTreeNode& parent,
+      ProfileTreeNode::CodeType codeType,
+      const RuntimeSamplingProfile::SampleCallStackFrame& callFrame);
 
   /**
-   * Encapsulates logic for processing the call stack of the sample.
-   * \param callStack The call stack that will be processed.
-   * \param chunk The profile chunk, which will buffer the sample with the
-   * provided call stack.
-   * \param rootNode The (root) node. Will be the parent node of the
-   * corresponding profile tree branch.
-   * \param idleNodeId Id of the (idle) node. Will be the only node that is used
-   * for the corresponding profile tree branch, in case of an empty call stack.
-   * \param samplesTimeDelta Delta between the current sample and the previous
-   * one.
-   * \param nodeIdGenerator NodeIdGenerator instance that will be used for
-   * generating unique node ids.
+   * Appends the JSON of a node to the current chunk.
    */
-  void processCallStack(
-      const std::vector<RuntimeSamplingProfile::SampleCallStackFrame>&
-          callStack,
-      ProfileChunk& chunk,
-      ProfileTreeNode& rootNode,
-      uint32_t idleNodeId,
-      long long samplesTimeDelta,
-      NodeIdGenerator& nodeIdGenerator);
+  void appendNodeJson(const ProfileTreeNode& node);
+
+  /**
+   * \return a string equal to \p value, owned by this serializer.
+   */
+  std::string_view internString(std::string_view value);
+
+  /**
+   * Records the current chunk as a "ProfileChunk" Trace Event and clears it.
+   */
+  void bufferProfileChunkTraceEvent();
 
   /**
    * Sends buffered Trace Events via notificationCallback_ and then clears it.
@@ -152,12 +151,35 @@ class RuntimeSamplingProfileTraceEventSerializer {
   void sendBufferedTraceEventsAndClear();
 
   PerformanceTracer& performanceTracer_;
-  const std::function<void(const folly::dynamic& traceEventsChunk)>
+  const std::function<void(std::string_view traceEventsChunkJson)>
       notificationCallback_;
   uint16_t traceEventChunkSize_;
   uint16_t profileChunkSize_;
 
-  folly::dynamic traceEventBuffer_;
+  uint64_t tracingStartUnixTimestamp_{0};
+  uint64_t previousSampleUnixTimestamp_{0};
+  bool hasSamples_{false};
+
+  uint32_t nextNodeId_;
+  ProfileTreeNode rootNode_;
+  uint32_t idleNodeId_;
+  /**
+   * Nodes of the previous sample's call stack, from the bottom frame.
+   * Consecutive samples usually share most of their call stack, which can
+   * then be matched without searching the tree.
+   */
+  std::vector<ProfileTreeNode*> previousCallStackNodes_;
+
+  /**
+   * Function names and urls referenced by the nodes of the profile tree. The
+   * samples' own strings may not outlive the sample.
+   */
+  std::unordered_set<std::string_view> internedStrings_;
+  std::deque<std::string> internedStringsStorage_;
+
+  ProfileChunk chunk_;
+  std::string traceEventsJson_;
+  uint16_t traceEventCount_{0};
 };
 
 } // namespace facebook::react::jsinspector_modern::tracing
@@ -11,8 +11,6 @@
 
 namespace facebook::react::jsinspector_modern {
 
-namespace {
-
 /**
  * A trace event to send to the debugger frontend, as defined by the Trace Event
  * Format.
@@ -60,6 +58,4 @@ struct TraceEvent {
   std::optional<uint64_t> dur;
 };
 
-} // namespace
-
 } // namespace facebook::react::jsinspector_modern
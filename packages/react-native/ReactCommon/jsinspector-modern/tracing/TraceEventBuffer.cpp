@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "TraceEventBuffer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace facebook::react::jsinspector_modern {
+
+struct TraceEventBuffer::Chunk {
+  TraceEvent* at(size_t index) {
+    return std::launder(reinterpret_cast<TraceEvent*>(storage) + index);
+  }
+
+  // Written by the recording thread, each store publishes one more event
+  std::atomic<size_t> size{0};
+  // Set by the recording thread once this chunk is full
+  std::atomic<Chunk*> next{nullptr};
+  // Only accessed by the consuming thread
+  size_t consumed{0};
+
+  alignas(TraceEvent) std::byte storage[ChunkCapacity * sizeof(TraceEvent)];
+};
+
+struct TraceEventBuffer::ThreadBuffer {
+  explicit ThreadBuffer(uint32_t session)
+      : session(session), head(new Chunk()), tail(head) {}
+
+  ~ThreadBuffer() {
+    // The recording thread holds a reference while appending, so this only
+    // runs once it can no longer append
+    while (head != nullptr) {
+      auto size = head->size.load(std::memory_order_acquire);
+      for (auto i = head->consumed; i < size; i++) {
+        std::destroy_at(head->at(i));
+      }
+      delete std::exchange(head, head->next.load(std::memory_order_acquire));
+    }
+  }
+
+  void append(TraceEvent&& event) {
+    auto size = tail->size.load(std::memory_order_relaxed);
+    if (size == ChunkCapacity) {
+      auto* chunk = new Chunk();
+      chunkCount.fetch_add(1, std::memory_order_relaxed);
+      tail->next.store(chunk, std::memory_order_release);
+      tail = chunk;
+      size = 0;
+    }
+    new (tail->storage + size * sizeof(TraceEvent))
+        TraceEvent(std::move(event));
+    tail->size.store(size + 1, std::memory_order_release);
+  }
+
+  void consume(const std::function<void(TraceEvent&& event)>& consumer) {
+    while (true) {
+      // Loaded before the size: once a chunk has a successor, it is full.
+      auto* next = head->next.load(std::memory_order_acquire);
+      auto size = head->size.load(std::memory_order_acquire);
+      while (head->consumed < size) {
+        auto* event = head->at(head->consumed++);
+        auto consumed = std::move(*event);
+        std::destroy_at(event);
+        consumer(std::move(consumed));
+      }
+      if (next == nullptr) {
+        return;
+      }
+      delete std::exchange(head, next);
+      chunkCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+  }
+
+  const uint32_t session;
+
+  // Only accessed by the consuming thread, except in the destructor
+  Chunk* head;
+  // Only accessed by the recording thread
+  Chunk* tail;
+
+  std::atomic<size_t> chunkCount{1};
+  // Set once the recording thread exited
+  std::atomic<bool> abandoned{false};
+};
+
+namespace {
+
+std::atomic<uint64_t> nextBufferId{0};
+
+} // namespace
+
+TraceEventBuffer::TraceEventBuffer()
+    : id_(nextBufferId.fetch_add(1, std::memory_order_relaxed)) {}
+
+TraceEventBuffer::~TraceEventBuffer() = default;
+
+void TraceEventBuffer::append(TraceEvent&& event, uint32_t session) {
+  getThreadBuffer(session)->append(std::move(event));
+}
+
+void TraceEventBuffer::consume(
+    const std::function<void(TraceEvent&& event)>& consumer,
+    uint32_t session) {
+  // Copied so that the consumer runs without the lock, and threads recording
+  // their first event are not blocked behind it.
+  std::vector<std::shared_ptr<ThreadBuffer>> threadBuffers;
+  {
+    std::lock_guard lock(threadBuffersMutex_);
+    threadBuffers = threadBuffers_;
+  }
+
+  std::vector<std::shared_ptr<ThreadBuffer>> droppedBuffers;
+  for (auto& threadBuffer : threadBuffers) {
+    if (threadBuffer->session != session) {
+      // Its events are destroyed with it, possibly by its thread if it is
+      // still appending
+      droppedBuffers.push_back(threadBuffer);
+      continue;
+    }
+    // Checked before draining: an exited thread appended everything it ever
+    // will, so its buffer can be dropped once drained.
+    if (threadBuffer->abandoned.load(std::memory_order_acquire)) {
+      droppedBuffers.push_back(threadBuffer);
+    }
+    threadBuffer->consume(consumer);
+  }
+
+  if (!droppedBuffers.empty()) {
+    std::lock_guard lock(threadBuffersMutex_);
+    std::erase_if(threadBuffers_, [&](const auto& threadBuffer) {
+      return std::find(
+                 droppedBuffers.begin(), droppedBuffers.end(), threadBuffer) !=
+          droppedBuffers.end();
+    });
+  }
+}
+
+void TraceEventBuffer::clear() {
+  std::vector<std::shared_ptr<ThreadBuffer>> threadBuffers;
+  {
+    std::lock_guard lock(threadBuffersMutex_);
+    threadBuffers.swap(threadBuffers_);
+  }
+  // Destroyed here, or by their thread once it finished appending
+}
+
+size_t TraceEventBuffer::getAllocatedBytes() const {
+  std::lock_guard lock(threadBuffersMutex_);
+  size_t chunkCount = 0;
+  for (const auto& threadBuffer : threadBuffers_) {
+    chunkCount += threadBuffer->chunkCount.load(std::memory_order_relaxed);
+  }
+  return chunkCount * sizeof(Chunk);
+}
+
+std::shared_ptr<TraceEventBuffer::ThreadBuffer>
+TraceEventBuffer::getThreadBuffer(uint32_t session) {
+  // The buffers of the calling thread, one per TraceEventBuffer it recorded
+  // to. In practice there is a single one, owned by the PerformanceTracer.
+  struct ThreadBufferCache {
+    ~ThreadBufferCache() {
+      for (auto& [id, weakThreadBuffer] : entries) {
+        if (auto threadBuffer = weakThreadBuffer.lock()) {
+          threadBuffer->abandoned.store(true, std::memory_order_release);
+        }
+      }
+    }
+
+    std::vector<std::pair<uint64_t, std::weak_ptr<ThreadBuffer>>> entries;
+  };
+  thread_local ThreadBufferCache cache;
+
+  std::weak_ptr<ThreadBuffer>* entry = nullptr;
+  for (auto& [id, weakThreadBuffer] : cache.entries) {
+    if (id == id_) {
+      auto threadBuffer = weakThreadBuffer.lock();
+      if (threadBuffer && threadBuffer->session == session) {
+        return threadBuffer;
+      }
+      entry = &weakThreadBuffer;
+      break;
+    }
+  }
+
+  // The buffer of an earlier session, if any, is left to be dropped by the
+  // next consume
+  auto threadBuffer = std::make_shared<ThreadBuffer>(session);
+  {
+    std::lock_guard lock(threadBuffersMutex_);
+    threadBuffers_.push_back(threadBuffer);
+  }
+  if (entry != nullptr) {
+    *entry = threadBuffer;
+  } else {
+    // Entries of destroyed TraceEventBuffers stay until the thread exits,
+    // they are expired and hold no events.
+    cache.entries.emplace_back(id_, threadBuffer);
+  }
+  return threadBuffer;
+}
+
+} // namespace facebook::react::jsinspector_modern
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include "TraceEvent.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace facebook::react::jsinspector_modern {
+
+/**
+ * Buffers Trace Events recorded from any number of threads without taking a
+ * lock on the recording path.
+ *
+ * Each recording thread appends to its own list of fixed-size chunks; only
+ * that thread writes to it, and it publishes every event with a single
+ * release store. Events are drained by \c consume, which releases chunks as
+ * soon as they are fully consumed, so memory stays bounded by what has been
+ * recorded since the last drain. Events of one thread are consumed in
+ * recording order, events of different threads are not ordered.
+ *
+ * Events are recorded for a tracing session, and a thread starts a new buffer
+ * when its session changes. Threads only keep weak references to their
+ * buffers, so \c clear releases every chunk.
+ */
+class TraceEventBuffer {
+ public:
+  static constexpr size_t ChunkCapacity = 256;
+
+  TraceEventBuffer();
+  ~TraceEventBuffer();
+
+  TraceEventBuffer(const TraceEventBuffer&) = delete;
+  TraceEventBuffer& operator=(const TraceEventBuffer&) = delete;
+
+  /**
+   * Appends an event recorded during \p session to the calling thread's
+   * buffer. Only allocates when the thread's current chunk is full, or on the
+   * first event of a thread in a session.
+   */
+  void append(TraceEvent&& event, uint32_t session);
+
+  /**
+   * Moves every event of \p session appended so far into \c consumer, thread
+   * by thread. Events of other sessions, appended by threads which checked
+   * for an active session just before it ended, are dropped instead. Safe to
+   * call while other threads append, but not concurrently with itself or
+   * \c clear.
+   */
+  void consume(
+      const std::function<void(TraceEvent&& event)>& consumer,
+      uint32_t session);
+
+  /**
+   * Drops every buffered event and releases all chunks. Threads start a new
+   * buffer on their next event.
+   */
+  void clear();
+
+  /**
+   * Number of bytes currently held by event chunks.
+   */
+  size_t getAllocatedBytes() const;
+
+ private:
+  struct Chunk;
+  struct ThreadBuffer;
+
+  std::shared_ptr<ThreadBuffer> getThreadBuffer(uint32_t session);
+
+  // Distinguishes buffers in the calling thread's cache, even if a buffer is
+  // allocated at the address of a destroyed one.
+  const uint64_t id_;
+
+  // Guards the list of thread buffers, which only changes when a thread
+  // records its first event of a session, or when buffers are dropped.
+  mutable std::mutex threadBuffersMutex_;
+  std::vector<std::shared_ptr<ThreadBuffer>> threadBuffers_;
+};
+
+} // namespace facebook::react::jsinspector_modern
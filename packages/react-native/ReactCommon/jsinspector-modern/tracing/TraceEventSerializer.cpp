@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "TraceEventSerializer.h"
+
+#include <folly/json.h>
+
+#include <array>
+#include <charconv>
+#include <string_view>
+
+namespace facebook::react::jsinspector_modern {
+
+namespace {
+
+std::string formatId(uint32_t id) {
+  std::array<char, 16> buffer{'0', 'x'};
+  auto result =
+      std::to_chars(buffer.data() + 2, buffer.data() + buffer.size(), id, 16);
+  return std::string(buffer.data(), result.ptr);
+}
+
+} // namespace
+
+/* static */ folly::dynamic TraceEventSerializer::serialize(
+    TraceEvent&& event) {
+  folly::dynamic result = folly::dynamic::object;
+
+  if (event.id.has_value()) {
+    result["id"] = formatId(event.id.value());
+  }
+  result["name"] = std::move(event.name);
+  result["cat"] = std::move(event.cat);
+  result["ph"] = std::string(1, event.ph);
+  result["ts"] = event.ts;
+  result["pid"] = event.pid;
+  result["tid"] = event.tid;
+  result["args"] = std::move(event.args);
+  if (event.dur.has_value()) {
+    result["dur"] = event.dur.value();
+  }
+
+  return result;
+}
+
+/* static */ void TraceEventSerializer::serializeAsJson(
+    const TraceEvent& event,
+    std::string& out) {
+  if (event.args.isObject() && event.args.empty()) {
+    serializeAsJson(event, "{}", out);
+  } else {
+    serializeAsJson(event, folly::toJson(event.args), out);
+  }
+}
+
+/* static */ void TraceEventSerializer::serializeAsJson(
+    const TraceEvent& event,
+    std::string_view argsJson,
+    std::string& out) {
+  out.push_back('{');
+  if (event.id.has_value()) {
+    out.append("\"id\":\"");
+    out.append(formatId(event.id.value()));
+    out.append("\",");
+  }
+  out.append("\"name\":");
+  appendJsonString(event.name, out);
+  out.append(",\"cat\":");
+  appendJsonString(event.cat, out);
+  out.append(",\"ph\":");
+  appendJsonString(std::string_view(&event.ph, 1), out);
+  out.append(",\"ts\":");
+  appendJsonNumber(event.ts, out);
+  out.append(",\"pid\":");
+  appendJsonNumber(event.pid, out);
+  out.append(",\"tid\":");
+  appendJsonNumber(event.tid, out);
+  out.append(",\"args\":");
+  out.append(argsJson);
+  if (event.dur.has_value()) {
+    out.append(",\"dur\":");
+    appendJsonNumber(event.dur.value(), out);
+  }
+  out.push_back('}');
+}
+
+/* static */ void TraceEventSerializer::appendJsonString(
+    std::string_view value,
+    std::string& out) {
+  static constexpr std::string_view hexDigits = "0123456789abcdef";
+
+  out.push_back('"');
+  for (char c : value) {
+    switch (c) {
+      case '"':
+        out.append("\\\"");
+        break;
+      case '\\':
+        out.append("\\\\");
+        break;
+      case '\b':
+        out.append("\\b");
+        break;
+      case '\f':
+        out.append("\\f");
+        break;
+      case '\n':
+        out.append("\\n");
+        break;
+      case '\r':
+        out.append("\\r");
+        break;
+      case '\t':
+        out.append("\\t");
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          out.append("\\u00");
+          out.push_back(hexDigits[(c >> 4) & 0xf]);
+          out.push_back(hexDigits[c & 0xf]);
+        } else {
+          out.push_back(c);
+        }
+    }
+  }
+  out.push_back('"');
+}
+
+/* static */ void TraceEventSerializer::appendJsonNumber(
+    uint64_t value,
+    std::string& out) {
+  std::array<char, 20> buffer{};
+  auto result =
+      std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+  out.append(buffer.data(), result.ptr);
+}
+
+/* static */ void TraceEventSerializer::appendJsonNumber(
+    int64_t value,
+    std::string& out) {
+  std::array<char, 20> buffer{};
+  auto result =
+      std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+  out.append(buffer.data(), result.ptr);
+}
+
+} // namespace facebook::react::jsinspector_modern
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include "TraceEvent.h"
+
+#include <folly/dynamic.h>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace facebook::react::jsinspector_modern {
+
+/**
+ * Serializes Trace Events into the JSON Object format expected by Chrome
+ * DevTools.
+ */
+class TraceEventSerializer {
+ public:
+  /**
+   * Serializes a Trace Event into a folly::dynamic object. The event's args
+   * are moved into the result.
+   */
+  static folly::dynamic serialize(TraceEvent&& event);
+
+  /**
+   * Appends the JSON representation of a Trace Event to \p out, without going
+   * through folly::dynamic. Only the args, if not empty, are converted with
+   * folly::toJson. Produces the same JSON value as \c serialize.
+   */
+  static void serializeAsJson(const TraceEvent& event, std::string& out);
+
+  /**
+   * Same as above, but with \p argsJson written as the event's args instead
+   * of event.args. For payloads which are serialized by the caller.
+   */
+  static void serializeAsJson(
+      const TraceEvent& event,
+      std::string_view argsJson,
+      std::string& out);
+
+  /**
+   * Appends \p value to \p out as a JSON string literal.
+   */
+  static void appendJsonString(std::string_view value, std::string& out);
+
+  /**
+   * Appends \p value to \p out as a JSON number.
+   */
+  static void appendJsonNumber(uint64_t value, std::string& out);
+  static void appendJsonNumber(int64_t value, std::string& out);
+};
+
+} // namespace facebook::react::jsinspector_modern
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <jsinspector-modern/tracing/PerformanceTracer.h>
+#include <jsinspector-modern/tracing/TraceEventSerializer.h>
+
+#include <folly/json.h>
+#include <gtest/gtest.h>
+#include <map>
+#include <thread>
+#include <vector>
+
+namespace facebook::react::jsinspector_modern {
+
+namespace {
+
+std::vector<folly::dynamic> collectEventsAsJson(uint16_t chunkSize) {
+  std::vector<folly::dynamic> events;
+  PerformanceTracer::getInstance().collectEventsAsJson(
+      [&](std::string_view eventsChunkJson) {
+        auto eventsChunk = folly::parseJson(eventsChunkJson);
+        EXPECT_TRUE(eventsChunk.isArray());
+        EXPECT_LE(eventsChunk.size(), chunkSize);
+        for (auto& event : eventsChunk) {
+          events.push_back(std::move(event));
+        }
+      },
+      chunkSize);
+  return events;
+}
+
+} // namespace
+
+TEST(PerformanceTracerTest, SerializesTheSameAsJsonAndDynamic) {
+  std::vector<TraceEvent> events{
+      TraceEvent{
+          .name = "mark",
+          .cat = "blink.user_timing",
+          .ph = 'I',
+          .ts = 10,
+          .pid = 1,
+          .tid = 2,
+      },
+      TraceEvent{
+          .id = 0xbeef,
+          .name = "\"quoted\"\n\tname \\ with \x01 control characters",
+          .cat = "blink.user_timing",
+          .ph = 'b',
+          .ts = 20,
+          .pid = 1,
+          .tid = 2,
+          .args = folly::dynamic::object(
+              "detail", R"({"devtools":{"track":"Track"}})"),
+      },
+      TraceEvent{
+          .name = "RunTask",
+          .cat = "disabled-by-default-devtools.timeline",
+          .ph = 'X',
+          .ts = 1'700'000'000'000'000,
+          .pid = 1,
+          .tid = 3,
+          .dur = 42,
+      },
+  };
+
+  for (auto& event : events) {
+    std::string json;
+    TraceEventSerializer::serializeAsJson(event, json);
+    EXPECT_EQ(
+        folly::parseJson(json),
+        TraceEventSerializer::serialize(TraceEvent{event}));
+  }
+}
+
+TEST(PerformanceTracerTest, CollectsEventsRecordedFromManyThreads) {
+  auto& tracer = PerformanceTracer::getInstance();
+  constexpr int ThreadCount = 4;
+  constexpr int MarksPerThread = 1000;
+
+  ASSERT_TRUE(tracer.startTracing());
+  std::vector<std::thread> threads;
+  for (int i = 0; i < ThreadCount; i++) {
+    threads.emplace_back([&]() {
+      for (int j = 0; j < MarksPerThread; j++) {
+        tracer.reportMark("mark", j);
+      }
+      tracer.reportMeasure("measure", 0, 10, std::nullopt);
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_TRUE(tracer.stopTracing());
+
+  auto events = collectEventsAsJson(100);
+
+  std::map<int64_t, std::vector<int64_t>> markTimestampsByThread;
+  std::map<std::string, int> measureEventCountById;
+  bool sawTracingStarted = false;
+  bool sawTracingStopped = false;
+  for (const auto& event : events) {
+    auto name = event["name"].asString();
+    if (name == "mark") {
+      markTimestampsByThread[event["tid"].asInt()].push_back(
+          event["ts"].asInt());
+    } else if (name == "measure") {
+      measureEventCountById[event["id"].asString()]++;
+    } else if (name == "TracingStartedInPage") {
+      sawTracingStarted = true;
+    } else if (name == "ReactNative-TracingStopped") {
+      sawTracingStopped = true;
+    }
+  }
+
+  EXPECT_TRUE(sawTracingStarted);
+  EXPECT_TRUE(sawTracingStopped);
+  ASSERT_EQ(markTimestampsByThread.size(), ThreadCount);
+  for (const auto& [tid, timestamps] : markTimestampsByThread) {
+    ASSERT_EQ(timestamps.size(), MarksPerThread);
+    for (int j = 0; j < MarksPerThread; j++) {
+      EXPECT_EQ(timestamps[j], j);
+    }
+  }
+  // Each measure has a unique id, shared by its begin and end events
+  EXPECT_EQ(measureEventCountById.size(), ThreadCount);
+  for (const auto& [id, count] : measureEventCountById) {
+    EXPECT_EQ(count, 2) << id;
+  }
+
+  EXPECT_TRUE(collectEventsAsJson(100).empty());
+}
+
+TEST(PerformanceTracerTest, CollectsEventsAsDynamicChunks) {
+  auto& tracer = PerformanceTracer::getInstance();
+  ASSERT_TRUE(tracer.startTracing());
+  for (int i = 0; i < 25; i++) {
+    tracer.reportMark("mark", i);
+  }
+  ASSERT_TRUE(tracer.stopTracing());
+
+  std::vector<size_t> chunkSizes;
+  tracer.collectEvents(
+      [&](const folly::dynamic& eventsChunk) {
+        chunkSizes.push_back(eventsChunk.size());
+      },
+      10);
+
+  // Process name, tracing started, 25 marks and tracing stopped
+  EXPECT_EQ(chunkSizes, (std::vector<size_t>{10, 10, 8}));
+}
+
+TEST(PerformanceTracerTest, ReleasesBuffersOnceStoppedSessionIsCollected) {
+  auto& tracer = PerformanceTracer::getInstance();
+  ASSERT_TRUE(tracer.startTracing());
+  for (int i = 0; i < 1000; i++) {
+    tracer.reportMark("mark", i);
+  }
+  EXPECT_GT(tracer.getBufferedBytes(), 0);
+  ASSERT_TRUE(tracer.stopTracing());
+
+  // Process name, tracing started, the marks and tracing stopped
+  EXPECT_EQ(collectEventsAsJson(100).size(), 1003);
+  EXPECT_EQ(tracer.getBufferedBytes(), 0);
+}
+
+TEST(PerformanceTracerTest, IgnoresEventsWhenNotTracing) {
+  auto& tracer = PerformanceTracer::getInstance();
+  tracer.reportMark("mark", 0);
+  tracer.reportEventLoopTask(0, 1);
+
+  EXPECT_TRUE(collectEventsAsJson(100).empty());
+}
+
+} // namespace facebook::react::jsinspector_modern
@@ -7,9 +7,12 @@
 
 #include <jsinspector-modern/tracing/RuntimeSamplingProfileTraceEventSerializer.h>
 
+#include <folly/json.h>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <chrono>
+#include <map>
+#include <string>
 #include <utility>
 
 namespace facebook::react::jsinspector_modern::tracing {
@@ -18,10 +21,10 @@ class RuntimeSamplingProfileTraceEventSerializerTest : public ::testing::Test {
  protected:
   std::vector<folly::dynamic> notificationEvents_;
 
-  std::function<void(const folly::dynamic& traceEventsChunk)>
+  std::function<void(std::string_view traceEventsChunkJson)>
   createNotificationCallback() {
-    return [this](const folly::dynamic& traceEventsChunk) {
-      notificationEvents_.push_back(traceEventsChunk);
+    return [this](std::string_view traceEventsChunkJson) {
+      notificationEvents_.push_back(folly::parseJson(traceEventsChunkJson));
     };
   }
 
@@ -287,4 +290,116 @@ TEST_F(RuntimeSamplingProfileTraceEventSerializerTest, ProfileChunkSizeLimit) {
   }
 }
 
+TEST_F(
+    RuntimeSamplingProfileTraceEventSerializerTest,
+    StreamsChunksBeforeFinish) {
+  // Setup
+  auto notificationCallback = createNotificationCallback();
+  uint16_t traceEventChunkSize = 1;
+  uint16_t profileChunkSize = 2;
+  RuntimeSamplingProfileTraceEventSerializer serializer(
+      PerformanceTracer::getInstance(),
+      notificationCallback,
+      traceEventChunkSize,
+      profileChunkSize);
+
+  // Execute
+  serializer.start(std::chrono::steady_clock::now());
+  for (int i = 0; i < 5; i++) {
+    // The function name does not outlive the sample
+    std::string functionName = "foo" + std::to_string(i % 2);
+    serializer.addSample(createSample(
+        1000000 + i * 1000,
+        1,
+        {createJSCallFrame(functionName, 1, "test.js")}));
+  }
+
+  // [["Profile"], ["ProfileChunk"], ["ProfileChunk"]]
+  ASSERT_EQ(notificationEvents_.size(), 3);
+
+  serializer.finish();
+
+  // Verify
+  ASSERT_EQ(notificationEvents_.size(), 4);
+  std::vector<std::string> functionNames;
+  for (size_t i = 1; i < notificationEvents_.size(); i++) {
+    for (const auto& node :
+         notificationEvents_[i][0]["args"]["data"]["cpuProfile"]["nodes"]) {
+      functionNames.push_back(node["callFrame"]["functionName"].asString());
+    }
+  }
+  EXPECT_THAT(
+      functionNames,
+      ::testing::ElementsAre("(root)", "(program)", "(idle)", "foo0", "foo1"));
+}
+
+TEST_F(
+    RuntimeSamplingProfileTraceEventSerializerTest,
+    SamplesReferenceNodesOfTheirCallStack) {
+  // Setup
+  auto notificationCallback = createNotificationCallback();
+  RuntimeSamplingProfileTraceEventSerializer serializer(
+      PerformanceTracer::getInstance(), notificationCallback, 10, 100);
+
+  auto foo = createJSCallFrame("foo", 1, "test.js", 10, 5);
+  auto bar = createJSCallFrame("bar", 1, "test.js", 20, 10);
+  auto baz = createJSCallFrame("baz", 1, "other.js", 5, 1);
+  // Call stacks are listed from the top frame
+  std::vector<std::vector<RuntimeSamplingProfile::SampleCallStackFrame>>
+      callStacks = {
+          {bar, foo},
+          {baz, bar, foo},
+          {foo},
+          {},
+          {bar, foo},
+          {foo, bar, foo},
+          {baz, bar, foo},
+          {baz, foo},
+      };
+
+  auto samples = std::vector<RuntimeSamplingProfile::Sample>{};
+  for (size_t i = 0; i < callStacks.size(); i++) {
+    samples.emplace_back(createSample(1000000 + i * 1000, 1, callStacks[i]));
+  }
+  auto profile = createProfileWithSamples(std::move(samples));
+
+  // Execute
+  serializer.serializeAndNotify(profile, std::chrono::steady_clock::now());
+
+  // Verify
+  ASSERT_EQ(notificationEvents_.size(), 2);
+  const auto& data = notificationEvents_[1][0]["args"]["data"];
+  std::map<int64_t, std::pair<std::string, int64_t>> nodesById;
+  for (const auto& node : data["cpuProfile"]["nodes"]) {
+    nodesById[node["id"].asInt()] = {
+        node["callFrame"]["functionName"].asString(),
+        node.getDefault("parent", 0).asInt()};
+  }
+  // (root), (program), (idle), foo, bar, baz, foo > baz, foo > bar > foo
+  EXPECT_EQ(nodesById.size(), 8);
+
+  // Walks up the tree from the sampled node, to the call stack
+  auto getCallStack = [&](int64_t nodeId) {
+    std::vector<std::string> callStack;
+    while (nodesById.at(nodeId).first != "(root)") {
+      callStack.push_back(nodesById.at(nodeId).first);
+      nodeId = nodesById.at(nodeId).second;
+    }
+    return callStack;
+  };
+  const auto& sampledNodeIds = data["cpuProfile"]["samples"];
+  ASSERT_EQ(sampledNodeIds.size(), callStacks.size());
+  for (size_t i = 0; i < callStacks.size(); i++) {
+    std::vector<std::string> expected;
+    for (const auto& callFrame : callStacks[i]) {
+      expected.emplace_back(callFrame.getFunctionName());
+    }
+    if (expected.empty()) {
+      expected.emplace_back("(idle)");
+    }
+    EXPECT_EQ(getCallStack(sampledNodeIds[i].asInt()), expected)
+        << "sample " << i;
+  }
+}
+
 } // namespace facebook::react::jsinspector_modern::tracing
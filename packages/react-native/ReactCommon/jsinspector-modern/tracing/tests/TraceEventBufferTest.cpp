@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <jsinspector-modern/tracing/TraceEventBuffer.h>
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <map>
+#include <thread>
+#include <vector>
+
+namespace facebook::react::jsinspector_modern {
+
+namespace {
+
+constexpr uint32_t Session = 1;
+
+TraceEvent createEvent(uint64_t tid, uint64_t ts) {
+  return TraceEvent{
+      .name = "event",
+      .cat = "test",
+      .ph = 'I',
+      .ts = ts,
+      .pid = 1,
+      .tid = tid,
+  };
+}
+
+} // namespace
+
+TEST(TraceEventBufferTest, ConsumesEventsInRecordingOrder) {
+  TraceEventBuffer buffer;
+  constexpr uint64_t EventCount = TraceEventBuffer::ChunkCapacity * 3 + 1;
+  for (uint64_t i = 0; i < EventCount; i++) {
+    buffer.append(createEvent(1, i), Session);
+  }
+
+  std::vector<uint64_t> timestamps;
+  buffer.consume(
+      [&](TraceEvent&& event) { timestamps.push_back(event.ts); }, Session);
+
+  ASSERT_EQ(timestamps.size(), EventCount);
+  for (uint64_t i = 0; i < EventCount; i++) {
+    EXPECT_EQ(timestamps[i], i);
+  }
+
+  size_t remaining = 0;
+  buffer.consume([&](TraceEvent&&) { remaining++; }, Session);
+  EXPECT_EQ(remaining, 0);
+}
+
+TEST(TraceEventBufferTest, ReleasesConsumedChunks) {
+  TraceEventBuffer buffer;
+  buffer.append(createEvent(1, 0), Session);
+  auto singleChunkBytes = buffer.getAllocatedBytes();
+  EXPECT_GT(singleChunkBytes, 0);
+
+  for (uint64_t i = 1; i < TraceEventBuffer::ChunkCapacity * 10; i++) {
+    buffer.append(createEvent(1, i), Session);
+  }
+  EXPECT_EQ(buffer.getAllocatedBytes(), singleChunkBytes * 10);
+
+  buffer.consume([](TraceEvent&&) {}, Session);
+  // The chunk being recorded into is kept
+  EXPECT_EQ(buffer.getAllocatedBytes(), singleChunkBytes);
+}
+
+TEST(TraceEventBufferTest, KeepsEventsOfExitedThreads) {
+  TraceEventBuffer buffer;
+  std::thread([&]() {
+    for (uint64_t i = 0; i < 10; i++) {
+      buffer.append(createEvent(2, i), Session);
+    }
+  }).join();
+
+  size_t consumed = 0;
+  buffer.consume([&](TraceEvent&&) { consumed++; }, Session);
+  EXPECT_EQ(consumed, 10);
+  // The exited thread's buffer is dropped once drained
+  EXPECT_EQ(buffer.getAllocatedBytes(), 0);
+}
+
+TEST(TraceEventBufferTest, DropsEventsOfOtherSessions) {
+  TraceEventBuffer buffer;
+  buffer.append(createEvent(1, 0), Session);
+  auto singleChunkBytes = buffer.getAllocatedBytes();
+  // Recorded by a thread which was late for the previous session
+  std::thread([&]() { buffer.append(createEvent(2, 0), Session - 1); })
+      .join();
+  buffer.append(createEvent(1, 1), Session + 1);
+
+  std::vector<uint64_t> timestamps;
+  buffer.consume(
+      [&](TraceEvent&& event) { timestamps.push_back(event.ts); },
+      Session + 1);
+  EXPECT_EQ(timestamps, (std::vector<uint64_t>{1}));
+  // Only the buffer of the current session is kept
+  EXPECT_EQ(buffer.getAllocatedBytes(), singleChunkBytes);
+}
+
+TEST(TraceEventBufferTest, ClearReleasesAllChunks) {
+  TraceEventBuffer buffer;
+  for (uint64_t i = 0; i < TraceEventBuffer::ChunkCapacity * 3; i++) {
+    buffer.append(createEvent(1, i), Session);
+  }
+  buffer.clear();
+  EXPECT_EQ(buffer.getAllocatedBytes(), 0);
+
+  // The thread starts a new buffer
+  buffer.append(createEvent(1, 42), Session);
+  std::vector<uint64_t> timestamps;
+  buffer.consume(
+      [&](TraceEvent&& event) { timestamps.push_back(event.ts); }, Session);
+  EXPECT_EQ(timestamps, (std::vector<uint64_t>{42}));
+}
+
+TEST(TraceEventBufferTest, ConsumesWhileOtherThreadsRecord) {
+  TraceEventBuffer buffer;
+  constexpr uint64_t ThreadCount = 4;
+  constexpr uint64_t EventsPerThread = 50'000;
+
+  std::map<uint64_t, std::vector<uint64_t>> timestampsByThread;
+  auto consume = [&]() {
+    buffer.consume(
+        [&](TraceEvent&& event) {
+          timestampsByThread[event.tid].push_back(event.ts);
+        },
+        Session);
+  };
+
+  std::atomic<uint64_t> runningThreads = ThreadCount;
+  std::vector<std::thread> threads;
+  for (uint64_t tid = 0; tid < ThreadCount; tid++) {
+    threads.emplace_back([&, tid]() {
+      for (uint64_t i = 0; i < EventsPerThread; i++) {
+        buffer.append(createEvent(tid, i), Session);
+      }
+      runningThreads--;
+    });
+  }
+  while (runningThreads > 0) {
+    consume();
+    std::this_thread::yield();
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  consume();
+
+  ASSERT_EQ(timestampsByThread.size(), ThreadCount);
+  for (const auto& [tid, timestamps] : timestampsByThread) {
+    ASSERT_EQ(timestamps.size(), EventsPerThread) << "thread " << tid;
+    for (uint64_t i = 0; i < EventsPerThread; i++) {
+      ASSERT_EQ(timestamps[i], i) << "thread " << tid;
+    }
+  }
+  EXPECT_EQ(buffer.getAllocatedBytes(), 0);
+}
+
+} // namespace facebook::react::jsinspector_modern
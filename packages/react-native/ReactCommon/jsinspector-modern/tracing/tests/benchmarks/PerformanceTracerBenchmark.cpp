@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <folly/json.h>
+#include <jsinspector-modern/tracing/PerformanceTracer.h>
+#include <thread>
+#include <vector>
+
+namespace facebook::react::jsinspector_modern {
+
+namespace {
+
+constexpr int BatchSize = 10'000;
+
+void discardEvents(PerformanceTracer& tracer) {
+  tracer.collectEventsAsJson([](std::string_view) {}, 1000);
+}
+
+// Cost of recording an event, per thread
+void reportMark(benchmark::State& state) {
+  auto& tracer = PerformanceTracer::getInstance();
+  if (state.thread_index() == 0) {
+    tracer.startTracing();
+  }
+  uint64_t timestamp = 0;
+  for (auto _ : state) {
+    tracer.reportMark("mark", timestamp++);
+  }
+  state.SetItemsProcessed(state.iterations());
+  if (state.thread_index() == 0) {
+    tracer.stopTracing();
+    discardEvents(tracer);
+  }
+}
+
+void reportMeasureWithTrack(benchmark::State& state) {
+  auto& tracer = PerformanceTracer::getInstance();
+  tracer.startTracing();
+  DevToolsTrackEntryPayload track{.track = "Components"};
+  uint64_t timestamp = 0;
+  for (auto _ : state) {
+    tracer.reportMeasure("measure", timestamp++, 1, track);
+  }
+  tracer.stopTracing();
+  discardEvents(tracer);
+}
+
+// Memory held while recording, reported as bytes per buffered event
+void bufferedBytesPerEvent(benchmark::State& state) {
+  auto& tracer = PerformanceTracer::getInstance();
+  const auto threadCount = static_cast<int>(state.range(0));
+  size_t bufferedBytes = 0;
+  for (auto _ : state) {
+    tracer.startTracing();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threadCount; i++) {
+      threads.emplace_back([&]() {
+        for (int j = 0; j < BatchSize; j++) {
+          tracer.reportEventLoopTask(j, j + 1);
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    tracer.stopTracing();
+    bufferedBytes = tracer.getBufferedBytes();
+    discardEvents(tracer);
+  }
+  state.counters["bytesPerEvent"] =
+      static_cast<double>(bufferedBytes) / (threadCount * BatchSize);
+  state.SetItemsProcessed(state.iterations() * threadCount * BatchSize);
+}
+
+template <bool AsJson>
+void collectEvents(benchmark::State& state) {
+  auto& tracer = PerformanceTracer::getInstance();
+  size_t bytes = 0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    tracer.startTracing();
+    for (int i = 0; i < BatchSize; i++) {
+      tracer.reportMark("mark", i);
+      tracer.reportEventLoopTask(i, i + 1);
+    }
+    tracer.stopTracing();
+    state.ResumeTiming();
+
+    if constexpr (AsJson) {
+      tracer.collectEventsAsJson(
+          [&](std::string_view eventsChunkJson) {
+            bytes += eventsChunkJson.size();
+          },
+          1000);
+    } else {
+      tracer.collectEvents(
+          [&](const folly::dynamic& eventsChunk) {
+            // Converted to a string by the TracingAgent
+            bytes += folly::toJson(eventsChunk).size();
+          },
+          1000);
+    }
+  }
+  benchmark::DoNotOptimize(bytes);
+  state.SetItemsProcessed(state.iterations() * BatchSize * 2);
+}
+
+} // namespace
+
+BENCHMARK(reportMark)->Threads(1)->Threads(4)->UseRealTime();
+BENCHMARK(reportMeasureWithTrack);
+BENCHMARK(bufferedBytesPerEvent)->Arg(1)->Arg(4)->UseRealTime();
+BENCHMARK(collectEvents<false>)->Name("collectEventsAsDynamic");
+BENCHMARK(collectEvents<true>)->Name("collectEventsAsJson");
+
+} // namespace facebook::react::jsinspector_modern
+
+BENCHMARK_MAIN();
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <jsinspector-modern/tracing/RuntimeSamplingProfileTraceEventSerializer.h>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace facebook::react::jsinspector_modern::tracing {
+
+namespace {
+
+using SampleCallStackFrame = RuntimeSamplingProfile::SampleCallStackFrame;
+
+constexpr size_t SampleCount = 1'000'000;
+constexpr size_t FunctionCount = 2'000;
+constexpr size_t MaxCallStackDepth = 40;
+
+const std::vector<std::string>& getFunctionNames() {
+  static const std::vector<std::string> functionNames = []() {
+    std::vector<std::string> names;
+    names.reserve(FunctionCount);
+    for (size_t i = 0; i < FunctionCount; i++) {
+      names.push_back("function" + std::to_string(i));
+    }
+    return names;
+  }();
+  return functionNames;
+}
+
+/*
+ * A random walk over call stacks: each sample pushes, pops or replaces the
+ * top frame of the previous one, with occasional idle and GC samples.
+ */
+RuntimeSamplingProfile createProfile() {
+  const auto& functionNames = getFunctionNames();
+  std::mt19937 random(42);
+  std::vector<size_t> functions;
+  std::vector<RuntimeSamplingProfile::Sample> samples;
+  samples.reserve(SampleCount);
+
+  for (size_t i = 0; i < SampleCount; i++) {
+    switch (random() % 4) {
+      case 0:
+        if (!functions.empty()) {
+          functions.pop_back();
+        }
+        break;
+      case 1:
+        if (functions.size() < MaxCallStackDepth) {
+          functions.push_back(random() % FunctionCount);
+        }
+        break;
+      case 2:
+        if (!functions.empty()) {
+          functions.back() = random() % FunctionCount;
+        }
+        break;
+      default:
+        break;
+    }
+
+    std::vector<SampleCallStackFrame> callStack;
+    if (random() % 100 != 0) {
+      callStack.reserve(functions.size() + 1);
+      if (random() % 50 == 0) {
+        callStack.emplace_back(
+            SampleCallStackFrame::Kind::GarbageCollector, 0, "(gc)");
+      }
+      for (auto it = functions.rbegin(); it != functions.rend(); ++it) {
+        callStack.emplace_back(
+            SampleCallStackFrame::Kind::JSFunction,
+            1,
+            functionNames[*it],
+            "http://localhost:8081/index.bundle",
+            *it,
+            1);
+      }
+    }
+    samples.emplace_back(1'000 + i * 100, 1, std::move(callStack));
+  }
+
+  return {"Benchmark", std::move(samples), nullptr};
+}
+
+const RuntimeSamplingProfile& getProfile() {
+  static const RuntimeSamplingProfile profile = createProfile();
+  return profile;
+}
+
+void serializeProfile(benchmark::State& state) {
+  const auto& profile = getProfile();
+  const auto profileChunkSize = static_cast<uint16_t>(state.range(0));
+  size_t bytes = 0;
+  for (auto _ : state) {
+    bytes = 0;
+    RuntimeSamplingProfileTraceEventSerializer serializer(
+        PerformanceTracer::getInstance(),
+        [&](std::string_view traceEventsChunkJson) {
+          bytes += traceEventsChunkJson.size();
+        },
+        1,
+        profileChunkSize);
+    serializer.serializeAndNotify(profile, std::chrono::steady_clock::now());
+  }
+  state.counters["bytesPerSample"] = static_cast<double>(bytes) / SampleCount;
+  state.SetItemsProcessed(state.iterations() * SampleCount);
+}
+
+} // namespace
+
+BENCHMARK(serializeProfile)
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Unit(benchmark::kMillisecond);
+
+} // namespace facebook::react::jsinspector_modern::tracing
+
+BENCHMARK_MAIN();
@@ -40,6 +40,41 @@ class JSRuntime {
    */
   virtual void unstable_initializeOnJsThread() {}
 
+  /**
+   * Compiles a script ahead of time into a buffer which can be persisted and
+   * later passed to \c jsi::Runtime::evaluateJavaScript in place of its
+   * source, e.g. engine bytecode. Returns nullptr on failure.
+   */
+  using ScriptCompiler = std::function<std::shared_ptr<const jsi::Buffer>(
+      const jsi::Buffer& source,
+      const std::string& sourceURL)>;
+
+  /**
+   * Returns a compiler for scripts this runtime can evaluate, or nullptr if
+   * the runtime cannot precompile scripts. The compiler must not reference
+   * the runtime: it may outlive it and is called on background threads.
+   */
+  virtual ScriptCompiler getScriptCompiler() {
+    return nullptr;
+  }
+
+  /**
+   * Identifies the format of scripts produced by \c getScriptCompiler, e.g.
+   * the engine's bytecode version. Compiled scripts must only be evaluated by
+   * runtimes reporting the same version.
+   */
+  virtual std::string getCompiledScriptVersion() {
+    return {};
+  }
+
+  /**
+   * Whether \c script is already compiled, e.g. a bytecode bundle, in which
+   * case it is evaluated as is. Should only inspect the start of the buffer.
+   */
+  virtual bool isCompiledScript(const jsi::Buffer& /*script*/) {
+    return false;
+  }
+
  private:
   /**
    * Initialized by \c getRuntimeTargetDelegate if not overridden, and then
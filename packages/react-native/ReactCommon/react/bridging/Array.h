@@ -7,12 +7,16 @@
 
 #pragma once
 
+#include <react/bridging/ArrayBuffer.h>
 #include <react/bridging/Base.h>
 
 #include <array>
+#include <cmath>
+#include <cstring>
 #include <deque>
 #include <initializer_list>
 #include <list>
+#include <optional>
 #include <set>
 #include <tuple>
 #include <utility>
@@ -60,6 +64,108 @@ struct BridgingDynamic {
   }
 };
 
+// Arrays of numbers at least this long are converted through a typed array
+// in a handful of runtime calls, instead of one call per element.
+constexpr size_t BulkConversionThreshold = 1024;
+
+// Element types which `Number.h` bridges as plain JS numbers
+template <typename T>
+inline constexpr bool is_bulk_number_v = std::is_same_v<T, double> ||
+    std::is_same_v<T, float> || std::is_same_v<T, int32_t> ||
+    std::is_same_v<T, uint32_t>;
+
+/*
+ * Converts a JS array of finite numbers through a `Float64Array` copy of it.
+ * Returns `std::nullopt` when the array holds anything else, including holes,
+ * NaN or infinities, so that the caller can fall back to the per-element
+ * conversion and its exact semantics.
+ */
+template <typename T>
+std::optional<std::vector<T>>
+numbersFromJs(jsi::Runtime& rt, const jsi::Array& array, size_t length) {
+  auto global = rt.global();
+  auto arrayPrototype =
+      global.getPropertyAsObject(rt, "Array").getPropertyAsObject(
+          rt, "prototype");
+  auto isFinite = global.getPropertyAsObject(rt, "Number")
+                      .getPropertyAsFunction(rt, "isFinite");
+  // `Number.isFinite` does not coerce, so this rejects non-numbers.
+  auto allFinite = arrayPrototype.getPropertyAsFunction(rt, "every")
+                       .callWithThis(rt, array, isFinite);
+  if (!allFinite.isBool() || !allFinite.getBool()) {
+    return std::nullopt;
+  }
+
+  auto typedArray = global.getPropertyAsFunction(rt, "Float64Array")
+                        .callAsConstructor(rt, array)
+                        .asObject(rt);
+  auto buffer = typedArray.getPropertyAsObject(rt, "buffer");
+  if (!buffer.isArrayBuffer(rt)) {
+    return std::nullopt;
+  }
+  auto arrayBuffer = std::move(buffer).getArrayBuffer(rt);
+  if (arrayBuffer.size(rt) != length * sizeof(double)) {
+    return std::nullopt;
+  }
+
+  const auto* data = arrayBuffer.data(rt);
+  std::vector<T> vector;
+  vector.reserve(length);
+  for (size_t i = 0; i < length; i++) {
+    double number;
+    std::memcpy(&number, data + i * sizeof(double), sizeof(double));
+    // `every` skips holes, which read as NaN here
+    if (std::isnan(number)) {
+      return std::nullopt;
+    }
+    vector.push_back(Bridging<T>::fromJs(rt, jsi::Value(number)));
+  }
+  return vector;
+}
+
+/*
+ * Creates a JS array of numbers from a `Float64Array` view of the vector's
+ * values.
+ */
+template <typename T>
+jsi::Array numbersToJs(jsi::Runtime& rt, const std::vector<T>& vector) {
+  std::vector<uint8_t> bytes(vector.size() * sizeof(double));
+  for (size_t i = 0; i < vector.size(); i++) {
+    auto number = static_cast<double>(vector[i]);
+    std::memcpy(bytes.data() + i * sizeof(double), &number, sizeof(double));
+  }
+
+  auto global = rt.global();
+  auto typedArray =
+      global.getPropertyAsFunction(rt, "Float64Array")
+          .callAsConstructor(
+              rt,
+              jsi::ArrayBuffer(
+                  rt, std::make_shared<VectorMutableBuffer>(std::move(bytes))));
+  auto arrayConstructor = global.getPropertyAsObject(rt, "Array");
+  return arrayConstructor.getPropertyAsFunction(rt, "from")
+      .callWithThis(rt, arrayConstructor, typedArray)
+      .asObject(rt)
+      .asArray(rt);
+}
+
+template <typename T>
+std::vector<T> vectorFromJs(
+    jsi::Runtime& rt,
+    const jsi::Array& array,
+    size_t length,
+    const std::shared_ptr<CallInvoker>& jsInvoker) {
+  std::vector<T> vector;
+  vector.reserve(length);
+
+  for (size_t i = 0; i < length; i++) {
+    vector.push_back(
+        bridging::fromJs<T>(rt, array.getValueAtIndex(rt, i), jsInvoker));
+  }
+
+  return vector;
+}
+
 } // namespace array_detail
 
 template <typename T, size_t N>
@@ -118,15 +224,29 @@ struct Bridging<std::vector<T>>
       const std::shared_ptr<CallInvoker>& jsInvoker) {
     size_t length = array.length(rt);
 
-    std::vector<T> vector;
-    vector.reserve(length);
+    if constexpr (array_detail::is_bulk_number_v<T>) {
+      if (length >= array_detail::BulkConversionThreshold) {
+        if (auto vector = array_detail::numbersFromJs<T>(rt, array, length)) {
+          return std::move(*vector);
+        }
+      }
+    }
 
-    for (size_t i = 0; i < length; i++) {
-      vector.push_back(
-          bridging::fromJs<T>(rt, array.getValueAtIndex(rt, i), jsInvoker));
+    return array_detail::vectorFromJs<T>(rt, array, length, jsInvoker);
+  }
+
+  static jsi::Array toJs(
+      jsi::Runtime& rt,
+      const std::vector<T>& vector,
+      const std::shared_ptr<CallInvoker>& jsInvoker) {
+    if constexpr (array_detail::is_bulk_number_v<T>) {
+      if (vector.size() >= array_detail::BulkConversionThreshold) {
+        return array_detail::numbersToJs(rt, vector);
+      }
     }
 
-    return vector;
+    return array_detail::BridgingDynamic<std::vector<T>>::toJs(
+        rt, vector, jsInvoker);
   }
 };
 
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/bridging/Base.h>
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * A `jsi::MutableBuffer` owning its bytes. Returning one to JS wraps it in an
+ * `ArrayBuffer` without copying.
+ */
+class VectorMutableBuffer : public jsi::MutableBuffer {
+ public:
+  explicit VectorMutableBuffer(std::vector<uint8_t> bytes)
+      : bytes_(std::move(bytes)) {}
+
+  size_t size() const override {
+    return bytes_.size();
+  }
+
+  uint8_t* data() override {
+    return bytes_.data();
+  }
+
+ private:
+  std::vector<uint8_t> bytes_;
+};
+
+namespace bridging::detail {
+
+/*
+ * Returns the bytes of an `ArrayBuffer`, or the bytes viewed by an
+ * `ArrayBuffer` view such as `Uint8Array` or `DataView`.
+ */
+inline std::span<uint8_t> getArrayBufferBytes(
+    jsi::Runtime& rt,
+    const jsi::Object& value) {
+  if (value.isArrayBuffer(rt)) {
+    auto arrayBuffer = value.getArrayBuffer(rt);
+    return {arrayBuffer.data(rt), arrayBuffer.size(rt)};
+  }
+
+  auto buffer = value.getProperty(rt, "buffer");
+  if (buffer.isObject() && buffer.getObject(rt).isArrayBuffer(rt)) {
+    auto arrayBuffer = buffer.getObject(rt).getArrayBuffer(rt);
+    auto byteOffset = value.getProperty(rt, "byteOffset");
+    auto byteLength = value.getProperty(rt, "byteLength");
+    if (byteOffset.isNumber() && byteLength.isNumber()) {
+      auto size = arrayBuffer.size(rt);
+      auto offset = static_cast<size_t>(byteOffset.getNumber());
+      auto length = static_cast<size_t>(byteLength.getNumber());
+      if (offset <= size && length <= size - offset) {
+        return {arrayBuffer.data(rt) + offset, length};
+      }
+    }
+  }
+
+  throw jsi::JSError(rt, "Value is not an ArrayBuffer or an ArrayBuffer view");
+}
+
+inline jsi::ArrayBuffer copyToArrayBuffer(
+    jsi::Runtime& rt,
+    std::span<const uint8_t> bytes) {
+  return jsi::ArrayBuffer(
+      rt,
+      std::make_shared<VectorMutableBuffer>(
+          std::vector<uint8_t>(bytes.begin(), bytes.end())));
+}
+
+} // namespace bridging::detail
+
+/*
+ * Spans borrow the memory of the JS buffer they were created from, without
+ * copying it. They must not be used once the call they were passed to has
+ * returned. Converting a span to JS copies it, as JS cannot share memory it
+ * does not own.
+ */
+template <>
+struct Bridging<std::span<uint8_t>> {
+  static std::span<uint8_t> fromJs(
+      jsi::Runtime& rt,
+      const jsi::Object& value) {
+    return bridging::detail::getArrayBufferBytes(rt, value);
+  }
+
+  static jsi::ArrayBuffer toJs(
+      jsi::Runtime& rt,
+      std::span<const uint8_t> value) {
+    return bridging::detail::copyToArrayBuffer(rt, value);
+  }
+};
+
+template <>
+struct Bridging<std::span<const uint8_t>> {
+  static std::span<const uint8_t> fromJs(
+      jsi::Runtime& rt,
+      const jsi::Object& value) {
+    return bridging::detail::getArrayBufferBytes(rt, value);
+  }
+
+  static jsi::ArrayBuffer toJs(
+      jsi::Runtime& rt,
+      std::span<const uint8_t> value) {
+    return bridging::detail::copyToArrayBuffer(rt, value);
+  }
+};
+
+/*
+ * Native-owned buffers are handed over to JS without copying; the
+ * `ArrayBuffer` keeps them alive. Owned buffers created from JS values are
+ * copies, since JS keeps ownership of its memory.
+ */
+template <typename T>
+struct Bridging<
+    std::shared_ptr<T>,
+    std::enable_if_t<std::is_base_of_v<jsi::MutableBuffer, T>>> {
+  static std::shared_ptr<T> fromJs(jsi::Runtime& rt, const jsi::Object& value)
+    requires std::is_base_of_v<T, VectorMutableBuffer>
+  {
+    auto bytes = bridging::detail::getArrayBufferBytes(rt, value);
+    return std::make_shared<VectorMutableBuffer>(
+        std::vector<uint8_t>(bytes.begin(), bytes.end()));
+  }
+
+  static jsi::ArrayBuffer toJs(jsi::Runtime& rt, std::shared_ptr<T> value) {
+    return jsi::ArrayBuffer(rt, std::move(value));
+  }
+};
+
+} // namespace facebook::react
@@ -44,6 +44,14 @@ inline constexpr bool
 template <typename T>
 struct Converter;
 
+// Unlike `asArray` and `asFunction`, JSI has no checked ArrayBuffer cast.
+inline jsi::ArrayBuffer asArrayBuffer(jsi::Runtime& rt, jsi::Object&& object) {
+  if (!object.isArrayBuffer(rt)) {
+    throw jsi::JSError(rt, "Object is not an ArrayBuffer");
+  }
+  return std::move(object).getArrayBuffer(rt);
+}
+
 template <typename T>
 struct ConverterBase {
   using BaseT = remove_cvref_t<T>;
@@ -64,6 +72,8 @@ struct ConverterBase {
         return std::move(value).getObject(rt_);
       } else if constexpr (std::is_same_v<BaseT, jsi::Array>) {
         return std::move(value).getObject(rt_).getArray(rt_);
+      } else if constexpr (std::is_same_v<BaseT, jsi::ArrayBuffer>) {
+        return std::move(value).getObject(rt_).getArrayBuffer(rt_);
       } else if constexpr (std::is_same_v<BaseT, jsi::Function>) {
         return std::move(value).getObject(rt_).getFunction(rt_);
       }
@@ -114,6 +124,10 @@ struct Converter<jsi::Value> : public ConverterBase<jsi::Value> {
     return std::move(value_).asObject(rt_).asArray(rt_);
   }
 
+  operator jsi::ArrayBuffer() && {
+    return asArrayBuffer(rt_, std::move(value_).asObject(rt_));
+  }
+
   operator jsi::Function() && {
     return std::move(value_).asObject(rt_).asFunction(rt_);
   }
@@ -127,6 +141,10 @@ struct Converter<jsi::Object> : public ConverterBase<jsi::Object> {
     return std::move(value_).asArray(rt_);
   }
 
+  operator jsi::ArrayBuffer() && {
+    return asArrayBuffer(rt_, std::move(value_));
+  }
+
   operator jsi::Function() && {
     return std::move(value_).asFunction(rt_);
   }
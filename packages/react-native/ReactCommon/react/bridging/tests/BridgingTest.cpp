@@ -194,6 +194,115 @@ TEST_F(BridgingTest, arrayTest) {
   EXPECT_EQ(headers.size(), jsiHeaders.size(rt));
 }
 
+TEST_F(BridgingTest, bulkArrayTest) {
+  auto count = array_detail::BulkConversionThreshold;
+  auto numbers = std::vector<double>(count);
+  for (size_t i = 0; i < count; i++) {
+    numbers[i] = i - 0.5;
+  }
+  numbers[1] = -0.0;
+
+  // Large numeric vectors round-trip through typed arrays.
+  auto array = bridging::toJs(rt, numbers, invoker);
+  EXPECT_EQ(count, array.size(rt));
+  EXPECT_EQ(numbers[2], array.getValueAtIndex(rt, 2).asNumber());
+  auto roundTripped =
+      bridging::fromJs<std::vector<double>>(rt, array, invoker);
+  EXPECT_EQ(numbers, roundTripped);
+  EXPECT_TRUE(std::signbit(roundTripped[1]));
+
+  auto integers = bridging::fromJs<std::vector<int32_t>>(rt, array, invoker);
+  EXPECT_EQ(count, integers.size());
+  EXPECT_EQ(static_cast<int32_t>(numbers[count - 1]), integers[count - 1]);
+
+  // Anything but finite numbers is converted element by element.
+  auto withNaN = function("(array) => { array[3] = NaN; return array; }")
+                     .call(rt, array)
+                     .asObject(rt)
+                     .asArray(rt);
+  EXPECT_TRUE(std::isnan(
+      bridging::fromJs<std::vector<double>>(rt, withNaN, invoker)[3]));
+
+  auto withString = function("(array) => { array[3] = '3'; return array; }")
+                        .call(rt, array)
+                        .asObject(rt)
+                        .asArray(rt);
+  EXPECT_JSI_THROW(
+      bridging::fromJs<std::vector<double>>(rt, withString, invoker));
+
+  auto withHole = function(
+                      "(count) => {"
+                      "  const array = [];"
+                      "  array[count - 1] = 1;"
+                      "  return array;"
+                      "}")
+                      .call(rt, static_cast<double>(count))
+                      .asObject(rt)
+                      .asArray(rt);
+  EXPECT_JSI_THROW(
+      bridging::fromJs<std::vector<double>>(rt, withHole, invoker));
+}
+
+TEST_F(BridgingTest, arrayBufferTest) {
+  auto bytes = std::vector<uint8_t>{1, 2, 3, 4, 5, 6, 7, 8};
+
+  // Native-owned buffers are handed to JS without copying.
+  auto buffer = std::make_shared<VectorMutableBuffer>(bytes);
+  auto arrayBuffer = bridging::toJs(rt, buffer, invoker);
+  EXPECT_EQ(buffer->data(), arrayBuffer.data(rt));
+  EXPECT_EQ(bytes.size(), arrayBuffer.size(rt));
+
+  // Spans view the memory of the JS buffer in place.
+  auto value = jsi::Value(rt, arrayBuffer);
+  auto span = bridging::fromJs<std::span<uint8_t>>(rt, value, invoker);
+  EXPECT_EQ(buffer->data(), span.data());
+  EXPECT_EQ(bytes.size(), span.size());
+
+  span[0] = 42;
+  EXPECT_EQ(
+      42,
+      function("buffer => new Uint8Array(buffer)[0]")
+          .call(rt, value)
+          .asNumber());
+
+  // Views are read at their offset within their buffer.
+  auto view = function("buffer => new Uint8Array(buffer, 2, 4)")
+                  .call(rt, value);
+  auto viewSpan =
+      bridging::fromJs<std::span<const uint8_t>>(rt, view, invoker);
+  EXPECT_EQ(buffer->data() + 2, viewSpan.data());
+  EXPECT_EQ(
+      std::vector<uint8_t>({3, 4, 5, 6}),
+      std::vector<uint8_t>(viewSpan.begin(), viewSpan.end()));
+
+  auto dataView = function("buffer => new DataView(buffer, 6)")
+                      .call(rt, value);
+  auto dataViewSpan =
+      bridging::fromJs<std::span<uint8_t>>(rt, dataView, invoker);
+  EXPECT_EQ(buffer->data() + 6, dataViewSpan.data());
+  EXPECT_EQ(2, dataViewSpan.size());
+
+  // Spans converted to JS and owned buffers created from JS are copies.
+  auto copy = bridging::toJs(rt, viewSpan, invoker);
+  EXPECT_NE(viewSpan.data(), copy.data(rt));
+  EXPECT_EQ(4, copy.size(rt));
+  EXPECT_EQ(3, copy.data(rt)[0]);
+
+  auto owned =
+      bridging::fromJs<std::shared_ptr<jsi::MutableBuffer>>(rt, view, invoker);
+  EXPECT_NE(viewSpan.data(), owned->data());
+  EXPECT_EQ(
+      std::vector<uint8_t>({3, 4, 5, 6}),
+      std::vector<uint8_t>(owned->data(), owned->data() + owned->size()));
+
+  EXPECT_NO_THROW(bridging::fromJs<jsi::ArrayBuffer>(rt, value, invoker));
+  EXPECT_JSI_THROW(bridging::fromJs<jsi::ArrayBuffer>(rt, view, invoker));
+  EXPECT_JSI_THROW(
+      bridging::fromJs<std::span<uint8_t>>(rt, eval("[1, 2, 3]"), invoker));
+  EXPECT_JSI_THROW(
+      bridging::fromJs<std::span<uint8_t>>(rt, jsi::Object(rt), invoker));
+}
+
 TEST_F(BridgingTest, functionTest) {
   auto object = jsi::Object(rt);
   object.setProperty(rt, "foo", "bar");
@@ -593,6 +702,13 @@ TEST_F(BridgingTest, supportTest) {
   EXPECT_TRUE((bridging::supportsFromJs<std::set<int>, jsi::Array&>));
   EXPECT_TRUE((bridging::supportsFromJs<std::vector<int>, jsi::Array>));
   EXPECT_TRUE((bridging::supportsFromJs<std::vector<int>, jsi::Array&>));
+  EXPECT_TRUE((bridging::supportsFromJs<jsi::ArrayBuffer, jsi::Object>));
+  EXPECT_TRUE((bridging::supportsFromJs<std::span<uint8_t>, jsi::Object>));
+  EXPECT_TRUE(
+      (bridging::supportsFromJs<std::span<const uint8_t>, jsi::Object&>));
+  EXPECT_TRUE((bridging::supportsFromJs<
+               std::shared_ptr<jsi::MutableBuffer>,
+               jsi::Object>));
   EXPECT_TRUE((
       bridging::
           supportsFromJs<std::vector<std::array<std::string, 2>>, jsi::Array>));
@@ -667,6 +783,10 @@ TEST_F(BridgingTest, supportTest) {
   EXPECT_TRUE((bridging::supportsToJs<double>));
   EXPECT_TRUE((bridging::supportsToJs<std::string>));
   EXPECT_TRUE((bridging::supportsToJs<std::string, jsi::String>));
+  EXPECT_TRUE((bridging::supportsToJs<std::span<uint8_t>, jsi::ArrayBuffer>));
+  EXPECT_TRUE((bridging::supportsToJs<
+               std::shared_ptr<VectorMutableBuffer>,
+               jsi::ArrayBuffer>));
   EXPECT_TRUE((bridging::supportsToJs<std::set<int>>));
   EXPECT_TRUE((bridging::supportsToJs<std::set<int>, jsi::Array>));
   EXPECT_TRUE((bridging::supportsToJs<std::vector<int>>));
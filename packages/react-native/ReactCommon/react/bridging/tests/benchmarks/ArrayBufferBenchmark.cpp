@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <hermes/hermes.h>
+#include <react/bridging/Bridging.h>
+
+#include <numeric>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr size_t PayloadSize = 1024 * 1024;
+
+std::vector<uint8_t> makePayload() {
+  std::vector<uint8_t> payload(PayloadSize);
+  std::iota(payload.begin(), payload.end(), 0);
+  return payload;
+}
+
+uint64_t checksum(std::span<const uint8_t> bytes) {
+  return std::accumulate(bytes.begin(), bytes.end(), uint64_t{0});
+}
+
+// Binary payloads passed as arrays of numbers, the only option before
+// ArrayBuffer bridging.
+void arrayFromJs(benchmark::State& state) {
+  auto runtime = hermes::makeHermesRuntime();
+  auto& rt = *runtime;
+  auto bytes = makePayload();
+  auto payload = bridging::toJs(
+      rt, std::vector<int32_t>(bytes.begin(), bytes.end()), nullptr);
+
+  for (auto _ : state) {
+    auto bytes = bridging::fromJs<std::vector<int32_t>>(rt, payload, nullptr);
+    benchmark::DoNotOptimize(
+        std::accumulate(bytes.begin(), bytes.end(), uint64_t{0}));
+  }
+  state.SetBytesProcessed(state.iterations() * PayloadSize);
+}
+
+void arrayBufferFromJs(benchmark::State& state) {
+  auto runtime = hermes::makeHermesRuntime();
+  auto& rt = *runtime;
+  auto payload = jsi::Value(
+      rt,
+      bridging::toJs(
+          rt, std::make_shared<VectorMutableBuffer>(makePayload()), nullptr));
+
+  for (auto _ : state) {
+    auto bytes =
+        bridging::fromJs<std::span<const uint8_t>>(rt, payload, nullptr);
+    benchmark::DoNotOptimize(checksum(bytes));
+  }
+  state.SetBytesProcessed(state.iterations() * PayloadSize);
+}
+
+void arrayToJs(benchmark::State& state) {
+  auto runtime = hermes::makeHermesRuntime();
+  auto& rt = *runtime;
+  auto bytes = makePayload();
+  auto payload = std::vector<int32_t>(bytes.begin(), bytes.end());
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(bridging::toJs(rt, payload, nullptr));
+  }
+  state.SetBytesProcessed(state.iterations() * PayloadSize);
+}
+
+void arrayBufferToJs(benchmark::State& state) {
+  auto runtime = hermes::makeHermesRuntime();
+  auto& rt = *runtime;
+  auto payload = makePayload();
+
+  for (auto _ : state) {
+    // Copies the payload into a new buffer, as a module producing fresh
+    // data for every call would.
+    auto buffer = std::make_shared<VectorMutableBuffer>(payload);
+    benchmark::DoNotOptimize(bridging::toJs(rt, std::move(buffer), nullptr));
+  }
+  state.SetBytesProcessed(state.iterations() * PayloadSize);
+}
+
+} // namespace
+
+BENCHMARK(arrayFromJs);
+BENCHMARK(arrayBufferFromJs);
+BENCHMARK(arrayToJs);
+BENCHMARK(arrayBufferToJs);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
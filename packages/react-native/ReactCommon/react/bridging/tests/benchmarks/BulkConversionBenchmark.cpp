@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <hermes/hermes.h>
+#include <react/bridging/Bridging.h>
+
+#include <numeric>
+
+namespace facebook::react {
+
+namespace {
+
+std::vector<double> makeNumbers(size_t count) {
+  std::vector<double> numbers(count);
+  std::iota(numbers.begin(), numbers.end(), 0.5);
+  return numbers;
+}
+
+void vectorFromJsPerElement(benchmark::State& state) {
+  auto runtime = hermes::makeHermesRuntime();
+  auto& rt = *runtime;
+  auto count = static_cast<size_t>(state.range(0));
+  auto array = array_detail::BridgingDynamic<std::vector<double>>::toJs(
+      rt, makeNumbers(count), nullptr);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        array_detail::vectorFromJs<double>(rt, array, count, nullptr));
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+void vectorFromJsBulk(benchmark::State& state) {
+  auto runtime = hermes::makeHermesRuntime();
+  auto& rt = *runtime;
+  auto count = static_cast<size_t>(state.range(0));
+  auto array = array_detail::BridgingDynamic<std::vector<double>>::toJs(
+      rt, makeNumbers(count), nullptr);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        array_detail::numbersFromJs<double>(rt, array, count));
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+void vectorToJsPerElement(benchmark::State& state) {
+  auto runtime = hermes::makeHermesRuntime();
+  auto& rt = *runtime;
+  auto numbers = makeNumbers(static_cast<size_t>(state.range(0)));
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        array_detail::BridgingDynamic<std::vector<double>>::toJs(
+            rt, numbers, nullptr));
+  }
+  state.SetItemsProcessed(state.iterations() * numbers.size());
+}
+
+void vectorToJsBulk(benchmark::State& state) {
+  auto runtime = hermes::makeHermesRuntime();
+  auto& rt = *runtime;
+  auto numbers = makeNumbers(static_cast<size_t>(state.range(0)));
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(array_detail::numbersToJs(rt, numbers));
+  }
+  state.SetItemsProcessed(state.iterations() * numbers.size());
+}
+
+} // namespace
+
+BENCHMARK(vectorFromJsPerElement)->Arg(1'000)->Arg(10'000);
+BENCHMARK(vectorFromJsBulk)->Arg(1'000)->Arg(10'000);
+BENCHMARK(vectorToJsPerElement)->Arg(1'000)->Arg(10'000);
+BENCHMARK(vectorToJsBulk)->Arg(1'000)->Arg(10'000);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -6,7 +6,9 @@
  */
 
 #include "TurboModule.h"
+#include <react/bridging/LongLivedObject.h>
 #include <react/debug/react_native_assert.h>
+#include <optional>
 
 namespace facebook::react {
 
@@ -34,11 +36,218 @@ TurboModuleMethodValueKind getTurboModuleMethodValueKind(
   return VoidKind;
 }
 
+class TurboModule::MethodTable : public LongLivedObject {
+ public:
+  struct Entry {
+    jsi::PropNameID propName;
+    uint64_t key;
+    // Key of the method or event emitter in the maps of the module
+    std::string name;
+    // The host function of the method, and the metadata it was created for
+    std::optional<jsi::Function> function;
+    MethodMetadata functionMeta;
+
+    bool hasFunctionFor(const MethodMetadata& otherMeta) const {
+      return function.has_value() &&
+          functionMeta.invoker == otherMeta.invoker &&
+          functionMeta.argCount == otherMeta.argCount;
+    }
+  };
+
+  MethodTable(jsi::Runtime& runtime, const TurboModule& turboModule)
+      : LongLivedObject(runtime) {
+    build(turboModule);
+  }
+
+  bool belongsTo(const jsi::Runtime& runtime) const {
+    return &runtime_ == &runtime;
+  }
+
+  /*
+   * Catches methods or event emitters being added or removed. Entries only
+   * hold names, which are resolved in the maps of the module on every lookup,
+   * so the table can't point to removed entries when one was removed and
+   * another added since it was built.
+   */
+  bool isBuiltFor(const TurboModule& turboModule) const {
+    return methodCount_ == turboModule.methodMap_.size() &&
+        eventEmitterCount_ == turboModule.eventEmitterMap_.size();
+  }
+
+  void build(const TurboModule& turboModule) {
+    entries_.clear();
+    entries_.reserve(
+        turboModule.methodMap_.size() + turboModule.eventEmitterMap_.size());
+    for (const auto& [name, meta] : turboModule.methodMap_) {
+      addEntry(name);
+    }
+    for (const auto& [name, eventEmitter] : turboModule.eventEmitterMap_) {
+      // Methods take precedence over event emitters of the same name
+      if (turboModule.methodMap_.count(name) == 0) {
+        addEntry(name);
+      }
+    }
+    methodCount_ = turboModule.methodMap_.size();
+    eventEmitterCount_ = turboModule.eventEmitterMap_.size();
+
+    size_t slotCount = 8;
+    while (slotCount < entries_.size() * 2) {
+      slotCount *= 2;
+    }
+    slots_.assign(slotCount, kEmptySlot);
+    for (uint32_t i = 0; i < entries_.size(); i++) {
+      auto slot = slotFor(entries_[i].key);
+      while (slots_[slot] != kEmptySlot) {
+        slot = (slot + 1) & (slots_.size() - 1);
+      }
+      slots_[slot] = i;
+    }
+  }
+
+  Entry* find(const jsi::PropNameID& propName) {
+    auto key = keyOf(propName);
+    for (auto slot = slotFor(key); slots_[slot] != kEmptySlot;
+         slot = (slot + 1) & (slots_.size() - 1)) {
+      auto& entry = entries_[slots_[slot]];
+      if (entry.key == key &&
+          jsi::PropNameID::compare(runtime_, entry.propName, propName)) {
+        return &entry;
+      }
+    }
+    return nullptr;
+  }
+
+ private:
+  static constexpr uint32_t kEmptySlot = UINT32_MAX;
+
+  void addEntry(const std::string& name) {
+    auto propName = jsi::PropNameID::forUtf8(runtime_, name);
+    auto key = keyOf(propName);
+    entries_.push_back(Entry{
+        .propName = std::move(propName),
+        .key = key,
+        .name = name,
+        .function = std::nullopt,
+        .functionMeta = {}});
+  }
+
+  /*
+   * JSI has no hash of property names. Runtimes which intern them, like
+   * Hermes, hand out their characters without copying, which gives a key that
+   * separates most names of a module without reading all of them.
+   */
+  uint64_t keyOf(const jsi::PropNameID& propName) const {
+    struct {
+      uint64_t length{0};
+      uint64_t first{0};
+      uint64_t last{0};
+    } key;
+    auto onData = [&key](bool ascii, const void* data, size_t num) {
+      if (num == 0) {
+        return;
+      }
+      uint64_t first = ascii ? static_cast<const uint8_t*>(data)[0]
+                             : static_cast<const char16_t*>(data)[0];
+      uint64_t last = ascii ? static_cast<const uint8_t*>(data)[num - 1]
+                            : static_cast<const char16_t*>(data)[num - 1];
+      if (key.length == 0) {
+        key.first = first;
+      }
+      key.last = last;
+      key.length += num;
+    };
+    propName.getPropNameIdData(runtime_, onData);
+    return (key.length << 32) | (key.first << 16) | key.last;
+  }
+
+  size_t slotFor(uint64_t key) const {
+    return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> 32) &
+        (slots_.size() - 1);
+  }
+
+  std::vector<Entry> entries_;
+  // Indices into `entries_`, probed linearly
+  std::vector<uint32_t> slots_;
+  size_t methodCount_{0};
+  size_t eventEmitterCount_{0};
+};
+
 TurboModule::TurboModule(
     std::string name,
     std::shared_ptr<CallInvoker> jsInvoker)
     : name_(std::move(name)), jsInvoker_(std::move(jsInvoker)) {}
 
+TurboModule::~TurboModule() {
+  // The host functions of the table call into this module
+  if (auto methodTable = methodTable_.lock()) {
+    methodTable->allowRelease();
+  }
+}
+
+jsi::Function TurboModule::createMethod(
+    jsi::Runtime& runtime,
+    const jsi::PropNameID& propName,
+    const MethodMetadata& meta) {
+  return jsi::Function::createFromHostFunction(
+      runtime,
+      propName,
+      static_cast<unsigned int>(meta.argCount),
+      [this, meta](
+          jsi::Runtime& rt,
+          [[maybe_unused]] const jsi::Value& thisVal,
+          const jsi::Value* args,
+          size_t count) { return meta.invoker(rt, *this, args, count); });
+}
+
+jsi::Value TurboModule::lookupProperty(
+    jsi::Runtime& runtime,
+    const jsi::PropNameID& propName) {
+  auto methodTable = methodTable_.lock();
+  if (!methodTable || !methodTable->belongsTo(runtime)) {
+    // The table of another runtime is left to that runtime's collection, as
+    // its functions can only be released there
+    methodTable = std::make_shared<MethodTable>(runtime, *this);
+    LongLivedObjectCollection::get(runtime).add(methodTable);
+    methodTable_ = methodTable;
+  } else if (!methodTable->isBuiltFor(*this)) {
+    methodTable->build(*this);
+  }
+
+  auto* entry = methodTable->find(propName);
+  if (entry == nullptr) {
+    // A method or event emitter may have been added while another one was
+    // removed, which leaves the sizes of the maps unchanged
+    auto name = propName.utf8(runtime);
+    if (methodMap_.count(name) == 0 && eventEmitterMap_.count(name) == 0) {
+      // Neither Method nor EventEmitter were found, let JS decide what to do
+      return jsi::Value::undefined();
+    }
+    methodTable->build(*this);
+    entry = methodTable->find(propName);
+    if (entry == nullptr) {
+      return jsi::Value::undefined();
+    }
+  }
+
+  if (auto it = methodMap_.find(entry->name); it != methodMap_.end()) {
+    const auto& meta = it->second;
+    // The metadata of the method may have been replaced since its function
+    // was created
+    if (!entry->hasFunctionFor(meta)) {
+      entry->function = createMethod(runtime, entry->propName, meta);
+      entry->functionMeta = meta;
+    }
+    return jsi::Value(runtime, *entry->function);
+  }
+  if (auto it = eventEmitterMap_.find(entry->name);
+      it != eventEmitterMap_.end()) {
+    return it->second->get(runtime, jsInvoker_);
+  }
+  // Removed while another one was added
+  methodTable->build(*this);
+  return jsi::Value::undefined();
+}
+
 void TurboModule::emitDeviceEvent(
     const std::string& eventName,
     ArgFactory argFactory) {
@@ -10,6 +10,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <jsi/jsi.h>
 
@@ -49,6 +50,7 @@ class TurboModuleBinding;
 class JSI_EXPORT TurboModule : public jsi::HostObject {
  public:
   TurboModule(std::string name, std::shared_ptr<CallInvoker> jsInvoker);
+  ~TurboModule() override;
 
   // DO NOT OVERRIDE - it will become final in a future release.
   // This method provides automatic caching of properties on the TurboModule's
@@ -125,31 +127,43 @@ class JSI_EXPORT TurboModule : public jsi::HostObject {
   virtual jsi::Value create(
       jsi::Runtime& runtime,
       const jsi::PropNameID& propName) {
-    std::string propNameUtf8 = propName.utf8(runtime);
-    if (auto methodIter = methodMap_.find(propNameUtf8);
-        methodIter != methodMap_.end()) {
-      const MethodMetadata& meta = methodIter->second;
-      return jsi::Function::createFromHostFunction(
-          runtime,
-          propName,
-          static_cast<unsigned int>(meta.argCount),
-          [this, meta](
-              jsi::Runtime& rt,
-              [[maybe_unused]] const jsi::Value& thisVal,
-              const jsi::Value* args,
-              size_t count) { return meta.invoker(rt, *this, args, count); });
-    } else if (auto eventEmitterIter = eventEmitterMap_.find(propNameUtf8);
-               eventEmitterIter != eventEmitterMap_.end()) {
-      return eventEmitterIter->second->get(runtime, jsInvoker_);
-    } else {
-      // Neither Method nor EventEmitter were found, let JS decide what to do
-      return jsi::Value::undefined();
-    }
+    return lookupProperty(runtime, propName);
   }
 
+  jsi::Function createMethod(
+      jsi::Runtime& runtime,
+      const jsi::PropNameID& propName,
+      const MethodMetadata& meta);
+
+  /**
+   * Returns the method or event emitter of `methodMap_` and
+   * `eventEmitterMap_` named `propName`, or undefined.
+   *
+   * Both maps are indexed once per runtime in a dispatch table of property
+   * names. It is keyed by the length and the first and last characters of a
+   * name, read in place from the runtime, and a match is confirmed with
+   * `jsi::PropNameID::compare`, so found properties are not converted to
+   * UTF-8. The name of a match is then looked up in the maps, which are only
+   * read through the table and can be changed at any time. Host functions are
+   * created once per method and runtime, and recreated when the metadata of
+   * their method is replaced. The table is rebuilt when methods or event
+   * emitters are added or removed.
+   */
+  jsi::Value lookupProperty(
+      jsi::Runtime& runtime,
+      const jsi::PropNameID& propName);
+
  private:
   friend class TurboModuleBinding;
   std::unique_ptr<jsi::WeakObject> jsRepresentation_;
+
+  class MethodTable;
+
+  // The dispatch table of `lookupProperty`. It holds JS values, so it is owned
+  // by the `LongLivedObjectCollection` of its runtime and released with it
+  // when the runtime is torn down, or with the module when it is destroyed
+  // first.
+  std::weak_ptr<MethodTable> methodTable_;
 };
 
 /**
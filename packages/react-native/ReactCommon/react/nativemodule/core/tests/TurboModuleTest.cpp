@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+
+#include <ReactCommon/TurboModule.h>
+#include <ReactCommon/TurboModuleBinding.h>
+#include <react/bridging/LongLivedObject.h>
+
+namespace facebook::react {
+
+namespace {
+
+class TestTurboModule : public TurboModule {
+ public:
+  TestTurboModule() : TurboModule("TestTurboModule", nullptr) {
+    methodMap_["getNumber"] = MethodMetadata{1, getNumber};
+    methodMap_["getZero"] = MethodMetadata{0, getZero};
+    eventEmitterMap_["onChange"] = std::make_shared<AsyncEventEmitter<>>();
+  }
+
+  void addGetOne() {
+    methodMap_["getOne"] = MethodMetadata{0, getOne};
+  }
+
+  void replaceGetNumber() {
+    methodMap_["getNumber"] = MethodMetadata{1, getNegatedNumber};
+  }
+
+  void removeGetNumber() {
+    methodMap_.erase("getNumber");
+  }
+
+  // Leaves the number of methods unchanged
+  void replaceGetZeroWithGetOne() {
+    methodMap_.erase("getZero");
+    addGetOne();
+  }
+
+ private:
+  static jsi::Value getNumber(
+      jsi::Runtime& /*rt*/,
+      TurboModule& /*turboModule*/,
+      const jsi::Value* args,
+      size_t /*count*/) {
+    return {args[0].getNumber()};
+  }
+
+  static jsi::Value getNegatedNumber(
+      jsi::Runtime& /*rt*/,
+      TurboModule& /*turboModule*/,
+      const jsi::Value* args,
+      size_t /*count*/) {
+    return {-args[0].getNumber()};
+  }
+
+  static jsi::Value getZero(
+      jsi::Runtime& /*rt*/,
+      TurboModule& /*turboModule*/,
+      const jsi::Value* /*args*/,
+      size_t /*count*/) {
+    return {0};
+  }
+
+  static jsi::Value getOne(
+      jsi::Runtime& /*rt*/,
+      TurboModule& /*turboModule*/,
+      const jsi::Value* /*args*/,
+      size_t /*count*/) {
+    return {1};
+  }
+};
+
+class TurboModuleTest : public ::testing::Test {
+ protected:
+  TurboModuleTest()
+      : runtime_(hermes::makeHermesRuntime()),
+        rt_(*runtime_),
+        module_(std::make_shared<TestTurboModule>()) {}
+
+  ~TurboModuleTest() override {
+    LongLivedObjectCollection::get(rt_).clear();
+  }
+
+  jsi::Value get(const char* name) {
+    return module_->get(rt_, jsi::PropNameID::forAscii(rt_, name));
+  }
+
+  bool isSameFunction(const jsi::Value& value, const jsi::Value& otherValue) {
+    return jsi::Object::strictEquals(
+        rt_, value.asObject(rt_), otherValue.asObject(rt_));
+  }
+
+  std::unique_ptr<jsi::Runtime> runtime_;
+  jsi::Runtime& rt_;
+  std::shared_ptr<TestTurboModule> module_;
+};
+
+} // namespace
+
+TEST_F(TurboModuleTest, reusesHostFunctions) {
+  auto getNumber = get("getNumber");
+  auto getZero = get("getZero");
+  EXPECT_TRUE(isSameFunction(get("getNumber"), getNumber));
+  EXPECT_TRUE(isSameFunction(get("getZero"), getZero));
+  EXPECT_FALSE(isSameFunction(getNumber, getZero));
+  EXPECT_EQ(
+      getNumber.asObject(rt_).asFunction(rt_).call(rt_, 42).getNumber(), 42);
+  EXPECT_TRUE(get("unknownMethod").isUndefined());
+
+  // One cache holds all the functions of the module
+  EXPECT_EQ(LongLivedObjectCollection::get(rt_).size(), 1u);
+}
+
+TEST_F(TurboModuleTest, recreatesReplacedAndRemovedMethods) {
+  auto getNumber = get("getNumber");
+
+  module_->replaceGetNumber();
+  auto getNegatedNumber = get("getNumber");
+  EXPECT_FALSE(isSameFunction(getNegatedNumber, getNumber));
+  EXPECT_EQ(
+      getNegatedNumber.asObject(rt_).asFunction(rt_).call(rt_, 42).getNumber(),
+      -42);
+
+  module_->removeGetNumber();
+  EXPECT_TRUE(get("getNumber").isUndefined());
+  EXPECT_FALSE(get("getZero").isUndefined());
+}
+
+TEST_F(TurboModuleTest, findsEventEmittersAndAddedMethods) {
+  EXPECT_TRUE(get("onChange").asObject(rt_).isFunction(rt_));
+  EXPECT_TRUE(get("getOne").isUndefined());
+
+  module_->addGetOne();
+  EXPECT_EQ(
+      get("getOne").asObject(rt_).asFunction(rt_).call(rt_).getNumber(), 1);
+  EXPECT_FALSE(get("getNumber").isUndefined());
+  EXPECT_TRUE(get("onChange").asObject(rt_).isFunction(rt_));
+}
+
+TEST_F(TurboModuleTest, findsMethodsAddedWhileOthersWereRemoved) {
+  EXPECT_FALSE(get("getZero").isUndefined());
+  EXPECT_TRUE(get("getOne").isUndefined());
+
+  module_->replaceGetZeroWithGetOne();
+  EXPECT_TRUE(get("getZero").isUndefined());
+  EXPECT_EQ(
+      get("getOne").asObject(rt_).asFunction(rt_).call(rt_).getNumber(), 1);
+  EXPECT_EQ(
+      get("getNumber").asObject(rt_).asFunction(rt_).call(rt_, 42).getNumber(),
+      42);
+  EXPECT_TRUE(get("onChange").asObject(rt_).isFunction(rt_));
+}
+
+TEST_F(TurboModuleTest, dropsHostFunctionsOnModuleDestruction) {
+  get("getNumber");
+  EXPECT_EQ(LongLivedObjectCollection::get(rt_).size(), 1u);
+
+  module_.reset();
+  EXPECT_EQ(LongLivedObjectCollection::get(rt_).size(), 0u);
+}
+
+TEST_F(TurboModuleTest, dropsHostFunctionsOnRuntimeTeardown) {
+  auto getNumber = jsi::Value{};
+  {
+    auto binding = TurboModuleBinding(rt_, nullptr, nullptr);
+    getNumber = get("getNumber");
+    EXPECT_EQ(LongLivedObjectCollection::get(rt_).size(), 1u);
+  }
+
+  // The binding is destroyed with the runtime, which releases the cache
+  EXPECT_EQ(LongLivedObjectCollection::get(rt_).size(), 0u);
+
+  // and the module does not hand out its functions any more
+  EXPECT_FALSE(isSameFunction(get("getNumber"), getNumber));
+  EXPECT_EQ(LongLivedObjectCollection::get(rt_).size(), 1u);
+}
+
+} // namespace facebook::react
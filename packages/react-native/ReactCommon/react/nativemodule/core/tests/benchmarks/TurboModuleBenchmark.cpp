@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <ReactCommon/SampleTurboCxxModule.h>
+#include <benchmark/benchmark.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/bridging/LongLivedObject.h>
+
+#include <memory>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr int CallsPerIteration = 1'000;
+
+// Accesses the module object directly, as when there is no JS representation
+// caching its methods: every access goes through `TurboModule::get`.
+const std::string callMethodsScript = R"xyz123(
+function callSameMethod(module, count) {
+  var sum = 0;
+  for (var i = 0; i < count; i++) {
+    sum += module.getNumber(i);
+  }
+  return sum;
+}
+function callDifferentMethods(module, count) {
+  var sum = 0;
+  for (var i = 0; i < count; i += 4) {
+    sum += module.getNumber(i);
+    sum += module.getEnum(i);
+    sum += module.getBool(true) ? 1 : 0;
+    module.voidFunc();
+  }
+  return sum;
+}
+)xyz123";
+
+void callMethods(benchmark::State& state, const char* functionName) {
+  auto runtime = hermes::makeHermesRuntime();
+  runtime->evaluateJavaScript(
+      std::make_shared<jsi::StringBuffer>(callMethodsScript), "");
+  auto module = jsi::Object::createFromHostObject(
+      *runtime, std::make_shared<SampleTurboCxxModule>(nullptr));
+  auto function =
+      runtime->global().getPropertyAsFunction(*runtime, functionName);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        function.call(*runtime, module, CallsPerIteration));
+  }
+  state.SetItemsProcessed(state.iterations() * CallsPerIteration);
+
+  // Releases the host functions cached by the module while the runtime is
+  // alive, as TurboModuleBinding does on teardown
+  LongLivedObjectCollection::get(*runtime).clear();
+}
+
+void callSameMethod(benchmark::State& state) {
+  callMethods(state, "callSameMethod");
+}
+
+void callDifferentMethods(benchmark::State& state) {
+  callMethods(state, "callDifferentMethods");
+}
+
+} // namespace
+
+BENCHMARK(callSameMethod);
+BENCHMARK(callDifferentMethods);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
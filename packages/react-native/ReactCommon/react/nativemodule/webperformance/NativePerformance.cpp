@@ -249,9 +249,7 @@ std::vector<NativePerformanceEntry> NativePerformance::getEntriesByType(
 
 std::vector<std::pair<std::string, uint32_t>> NativePerformance::getEventCounts(
     jsi::Runtime& /*rt*/) {
-  const auto& eventCounts =
-      PerformanceEntryReporter::getInstance()->getEventCounts();
-  return {eventCounts.begin(), eventCounts.end()};
+  return PerformanceEntryReporter::getInstance()->getEventCounts();
 }
 
 std::unordered_map<std::string, double> NativePerformance::getSimpleMemoryInfo(
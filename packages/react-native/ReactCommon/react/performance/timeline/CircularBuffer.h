@@ -63,23 +63,16 @@ class CircularBuffer {
   }
 
   /**
-   * Clears buffer entries by predicate
+   * Clears buffer entries by predicate. Entries are compacted in place, so
+   * this doesn't allocate.
    */
-  void clear(std::function<bool(const T&)> predicate) {
-    std::vector<T> entries;
-
-    entries.reserve(maxSize_);
-    for (size_t i = 0; i < entries_.size(); i++) {
-      T& el = entries_[(i + position_) % entries_.size()];
-      if (predicate(el)) {
-        continue;
-      }
-
-      entries.push_back(std::move(el));
-    }
-
+  void clear(const std::function<bool(const T&)>& predicate) {
+    std::rotate(
+        entries_.begin(), entries_.begin() + position_, entries_.end());
     position_ = 0;
-    entries.swap(entries_);
+    entries_.erase(
+        std::remove_if(entries_.begin(), entries_.end(), predicate),
+        entries_.end());
   }
 
   /**
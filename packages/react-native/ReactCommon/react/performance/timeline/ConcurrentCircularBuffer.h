@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace facebook::react {
+
+/**
+ * A lock-free variant of CircularBuffer, which can be written to and read from
+ * any number of threads concurrently:
+ * - It can only grow up to a specified max size
+ * - It's a circular buffer (the oldest elements are dropped if reached max
+ * size and adding a new element)
+ *
+ * Each slot is guarded by a sequence number (a seqlock): writers claim a slot
+ * by making its sequence odd and publish the element by making it even again,
+ * readers copy the element out and discard the copy if the sequence changed in
+ * the meantime. For this to be safe, T must be trivially copyable; it is
+ * stored as a sequence of atomic words.
+ *
+ * Entries which are being written while the buffer is read are skipped.
+ */
+template <class T>
+class ConcurrentCircularBuffer {
+  static_assert(
+      std::is_trivially_copyable_v<T>,
+      "ConcurrentCircularBuffer requires a trivially copyable type");
+
+ public:
+  explicit ConcurrentCircularBuffer(size_t maxSize)
+      : maxSize_(maxSize), slots_(std::make_unique<Slot[]>(maxSize)) {}
+
+  /**
+   * Adds (pushes) element into the buffer.
+   *
+   * Returns `true` if an element which wasn't cleared yet got overwritten,
+   * `false` otherwise.
+   */
+  bool add(const T& el) {
+    const uint64_t index = nextIndex_.fetch_add(1, std::memory_order_relaxed);
+    Slot& slot = slots_[index % maxSize_];
+
+    const uint64_t writingSequence = index * 2 + 1;
+    uint64_t sequence = slot.sequence.load(std::memory_order_relaxed);
+    while (true) {
+      if (sequence > writingSequence) {
+        // Lapped by a writer that already stored a newer element in this slot.
+        return true;
+      }
+      if (sequence % 2 == 1) {
+        // A writer one lap behind hasn't finished yet.
+        std::this_thread::yield();
+        sequence = slot.sequence.load(std::memory_order_relaxed);
+        continue;
+      }
+      if (slot.sequence.compare_exchange_weak(
+              sequence, writingSequence, std::memory_order_relaxed)) {
+        break;
+      }
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+
+    std::array<uint64_t, WordCount> words{};
+    std::memcpy(words.data(), &el, sizeof(T));
+    for (size_t i = 0; i < WordCount; i++) {
+      slot.words[i].store(words[i], std::memory_order_relaxed);
+    }
+
+    slot.sequence.store(writingSequence + 1, std::memory_order_release);
+
+    // `sequence` is the one of the element we replaced, if any
+    return sequence != 0 &&
+        sequence / 2 - 1 >= clearedIndex_.load(std::memory_order_relaxed);
+  }
+
+  void clear() {
+    const uint64_t end = nextIndex_.load(std::memory_order_relaxed);
+    uint64_t clearedIndex = clearedIndex_.load(std::memory_order_relaxed);
+    while (clearedIndex < end &&
+           !clearedIndex_.compare_exchange_weak(
+               clearedIndex, end, std::memory_order_release)) {
+    }
+  }
+
+  /**
+   * Clears buffer entries by predicate
+   */
+  void clear(const std::function<bool(const T&)>& predicate) {
+    forEachEntry([&](Slot& slot, uint64_t sequence, const T& el) {
+      if (predicate(el)) {
+        // Fails if the element got overwritten in the meantime, which is fine
+        slot.sequence.compare_exchange_strong(
+            sequence, 0, std::memory_order_relaxed);
+      }
+    });
+  }
+
+  /**
+   * Retrieves buffer entries, from the oldest to the newest
+   */
+  std::vector<T> getEntries() const {
+    std::vector<T> res;
+    getEntries(res);
+    return res;
+  }
+
+  /**
+   * Retrieves buffer entries, from the oldest to the newest, with predicate
+   */
+  std::vector<T> getEntries(
+      const std::function<bool(const T&)>& predicate) const {
+    std::vector<T> res;
+    getEntries(res, predicate);
+    return res;
+  }
+
+  void getEntries(std::vector<T>& res) const {
+    forEachEntry(
+        [&](const Slot& /*slot*/, uint64_t /*sequence*/, const T& el) {
+          res.push_back(el);
+        });
+  }
+
+  void getEntries(
+      std::vector<T>& res,
+      const std::function<bool(const T&)>& predicate) const {
+    forEachEntry(
+        [&](const Slot& /*slot*/, uint64_t /*sequence*/, const T& el) {
+          if (predicate(el)) {
+            res.push_back(el);
+          }
+        });
+  }
+
+ private:
+  static constexpr size_t WordCount =
+      (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+  struct Slot {
+    // 0 if empty or cleared, 2 * index + 1 while element `index` is being
+    // written, 2 * index + 2 once it's been written.
+    std::atomic<uint64_t> sequence{0};
+    std::array<std::atomic<uint64_t>, WordCount> words{};
+  };
+
+  /**
+   * Calls `visitor` with a consistent copy of every element which was
+   * completely written, not cleared and not overwritten yet.
+   */
+  template <class SlotT, class Visitor>
+  static void visitEntries(
+      SlotT* slots,
+      size_t maxSize,
+      uint64_t begin,
+      uint64_t end,
+      Visitor&& visitor) {
+    for (uint64_t index = begin; index < end; index++) {
+      SlotT& slot = slots[index % maxSize];
+      const uint64_t writtenSequence = index * 2 + 2;
+      if (slot.sequence.load(std::memory_order_acquire) != writtenSequence) {
+        continue;
+      }
+
+      std::array<uint64_t, WordCount> words{};
+      for (size_t i = 0; i < WordCount; i++) {
+        words[i] = slot.words[i].load(std::memory_order_relaxed);
+      }
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (slot.sequence.load(std::memory_order_relaxed) != writtenSequence) {
+        continue;
+      }
+
+      T el{};
+      std::memcpy(&el, words.data(), sizeof(T));
+      visitor(slot, writtenSequence, el);
+    }
+  }
+
+  template <class Visitor>
+  void forEachEntry(Visitor&& visitor) const {
+    auto [begin, end] = getRange();
+    visitEntries(
+        static_cast<const Slot*>(slots_.get()),
+        maxSize_,
+        begin,
+        end,
+        std::forward<Visitor>(visitor));
+  }
+
+  template <class Visitor>
+  void forEachEntry(Visitor&& visitor) {
+    auto [begin, end] = getRange();
+    visitEntries(
+        slots_.get(), maxSize_, begin, end, std::forward<Visitor>(visitor));
+  }
+
+  std::pair<uint64_t, uint64_t> getRange() const {
+    const uint64_t end = nextIndex_.load(std::memory_order_acquire);
+    const uint64_t begin = std::max(
+        clearedIndex_.load(std::memory_order_acquire),
+        end > maxSize_ ? end - maxSize_ : 0);
+    return {begin, end};
+  }
+
+  const size_t maxSize_;
+  std::unique_ptr<Slot[]> slots_;
+
+  // Index of the next element to be added
+  std::atomic<uint64_t> nextIndex_{0};
+
+  // Elements with a lower index were cleared
+  std::atomic<uint64_t> clearedIndex_{0};
+};
+
+} // namespace facebook::react
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <vector>
 #include "PerformanceEntry.h"
 
@@ -18,12 +19,13 @@ constexpr double DEFAULT_DURATION_THRESHOLD = 0.0;
 
 /**
  * Abstract performance entry buffer with reporting flags.
- * Subtypes differ on how entries are stored.
+ * Subtypes differ on how entries are stored, and can be used from multiple
+ * threads concurrently.
  */
 class PerformanceEntryBuffer {
  public:
   double durationThreshold{DEFAULT_DURATION_THRESHOLD};
-  size_t droppedEntriesCount{0};
+  std::atomic<size_t> droppedEntriesCount{0};
 
   explicit PerformanceEntryBuffer() = default;
   virtual ~PerformanceEntryBuffer() = default;
@@ -12,19 +12,22 @@
 namespace facebook::react {
 
 void PerformanceEntryCircularBuffer::add(const PerformanceEntry& entry) {
+  std::lock_guard lock(mutex_);
   if (buffer_.add(entry)) {
-    droppedEntriesCount += 1;
+    droppedEntriesCount.fetch_add(1, std::memory_order_relaxed);
   }
 }
 
 void PerformanceEntryCircularBuffer::getEntries(
     std::vector<PerformanceEntry>& target) const {
+  std::lock_guard lock(mutex_);
   buffer_.getEntries(target);
 }
 
 void PerformanceEntryCircularBuffer::getEntries(
     std::vector<PerformanceEntry>& target,
     const std::string& name) const {
+  std::lock_guard lock(mutex_);
   buffer_.getEntries(target, [&](const PerformanceEntry& entry) {
     return std::visit(
         [&name](const auto& entryData) { return entryData.name == name; },
@@ -33,10 +36,12 @@ void PerformanceEntryCircularBuffer::getEntries(
 }
 
 void PerformanceEntryCircularBuffer::clear() {
+  std::lock_guard lock(mutex_);
   buffer_.clear();
 }
 
 void PerformanceEntryCircularBuffer::clear(const std::string& name) {
+  std::lock_guard lock(mutex_);
   buffer_.clear([&](const PerformanceEntry& entry) {
     return std::visit(
         [&name](const auto& entryData) { return entryData.name == name; },
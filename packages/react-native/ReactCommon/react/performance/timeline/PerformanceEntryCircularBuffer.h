@@ -10,6 +10,8 @@
 #include "CircularBuffer.h"
 #include "PerformanceEntryBuffer.h"
 
+#include <mutex>
+
 namespace facebook::react {
 
 class PerformanceEntryCircularBuffer : public PerformanceEntryBuffer {
@@ -28,6 +30,7 @@ class PerformanceEntryCircularBuffer : public PerformanceEntryBuffer {
   void clear(const std::string& name) override;
 
  private:
+  mutable std::mutex mutex_;
   CircularBuffer<PerformanceEntry> buffer_;
 };
 
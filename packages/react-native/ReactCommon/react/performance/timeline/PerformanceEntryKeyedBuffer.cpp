@@ -11,20 +11,19 @@
 namespace facebook::react {
 
 void PerformanceEntryKeyedBuffer::add(const PerformanceEntry& entry) {
-  auto name =
-      std::visit([](const auto& entryData) { return entryData.name; }, entry);
-
-  auto node = entryMap_.find(name);
-
-  if (node != entryMap_.end()) {
-    node->second.push_back(entry);
-  } else {
-    entryMap_.emplace(name, std::vector<PerformanceEntry>{entry});
-  }
+  const auto& name = std::visit(
+      [](const auto& entryData) -> const std::string& {
+        return entryData.name;
+      },
+      entry);
+
+  std::lock_guard lock(mutex_);
+  entryMap_[name].push_back(entry);
 }
 
 void PerformanceEntryKeyedBuffer::getEntries(
     std::vector<PerformanceEntry>& target) const {
+  std::lock_guard lock(mutex_);
   for (const auto& [_, entries] : entryMap_) {
     target.insert(target.end(), entries.begin(), entries.end());
   }
@@ -33,23 +32,25 @@ void PerformanceEntryKeyedBuffer::getEntries(
 void PerformanceEntryKeyedBuffer::getEntries(
     std::vector<PerformanceEntry>& target,
     const std::string& name) const {
-  std::string nameStr{name};
-
-  if (auto node = entryMap_.find(nameStr); node != entryMap_.end()) {
+  std::lock_guard lock(mutex_);
+  if (auto node = entryMap_.find(name); node != entryMap_.end()) {
     target.insert(target.end(), node->second.begin(), node->second.end());
   }
 }
 
 void PerformanceEntryKeyedBuffer::clear() {
+  std::lock_guard lock(mutex_);
   entryMap_.clear();
 }
 
 void PerformanceEntryKeyedBuffer::clear(const std::string& name) {
+  std::lock_guard lock(mutex_);
   entryMap_.erase(name);
 }
 
 std::optional<PerformanceEntry> PerformanceEntryKeyedBuffer::find(
     const std::string& name) const {
+  std::lock_guard lock(mutex_);
   if (auto node = entryMap_.find(name); node != entryMap_.end()) {
     if (!node->second.empty()) {
       return std::make_optional<PerformanceEntry>(node->second.back());
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <mutex>
 #include <optional>
 #include <unordered_map>
 #include <vector>
@@ -32,6 +33,7 @@ class PerformanceEntryKeyedBuffer : public PerformanceEntryBuffer {
   std::optional<PerformanceEntry> find(const std::string& name) const;
 
  private:
+  mutable std::mutex mutex_;
   std::unordered_map<std::string, std::vector<PerformanceEntry>> entryMap_{};
 };
 
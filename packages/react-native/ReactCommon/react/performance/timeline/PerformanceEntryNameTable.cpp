@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "PerformanceEntryNameTable.h"
+
+#include <array>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr size_t NAME_CACHE_SIZE = 8;
+
+struct CachedName {
+  uint64_t tableId{0};
+  std::string_view name;
+  PerformanceEntryNameTable::Entry* entry{nullptr};
+};
+
+// Names are only compared when the table id matches, which is never the case
+// for tables that were already destroyed.
+thread_local std::array<CachedName, NAME_CACHE_SIZE> nameCache;
+thread_local size_t nextNameCacheSlot{0};
+
+std::atomic<uint64_t> nextTableId{1};
+
+} // namespace
+
+PerformanceEntryNameTable::PerformanceEntryNameTable()
+    : id_(nextTableId.fetch_add(1, std::memory_order_relaxed)) {}
+
+PerformanceEntryNameTable::Entry& PerformanceEntryNameTable::intern(
+    std::string_view name) {
+  for (const auto& cachedName : nameCache) {
+    if (cachedName.tableId == id_ && cachedName.name == name) {
+      return *cachedName.entry;
+    }
+  }
+
+  Entry* entry = nullptr;
+  {
+    std::lock_guard lock(mutex_);
+    if (auto it = entryMap_.find(name); it != entryMap_.end()) {
+      entry = it->second;
+    } else {
+      entry = &entries_.emplace_back(name);
+      entryMap_.emplace(entry->name, entry);
+    }
+  }
+
+  nameCache[nextNameCacheSlot] = {
+      .tableId = id_, .name = entry->name, .entry = entry};
+  nextNameCacheSlot = (nextNameCacheSlot + 1) % NAME_CACHE_SIZE;
+  return *entry;
+}
+
+std::vector<std::pair<std::string, uint32_t>>
+PerformanceEntryNameTable::getCounts() const {
+  std::vector<std::pair<std::string, uint32_t>> counts;
+
+  std::lock_guard lock(mutex_);
+  counts.reserve(entries_.size());
+  for (const auto& entry : entries_) {
+    auto count = entry.count.load(std::memory_order_relaxed);
+    if (count > 0) {
+      counts.emplace_back(entry.name, count);
+    }
+  }
+  return counts;
+}
+
+} // namespace facebook::react
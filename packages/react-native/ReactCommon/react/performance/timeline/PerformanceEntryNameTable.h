@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace facebook::react {
+
+/**
+ * Interns performance entry names, so that buffers can refer to them with a
+ * stable pointer instead of a copy, and keeps a counter for each of them.
+ *
+ * Interned names are never removed: this is meant for names from a small,
+ * fixed set, such as event types.
+ *
+ * Looking up a name which was recently looked up on the same thread doesn't
+ * take any lock.
+ */
+class PerformanceEntryNameTable {
+ public:
+  struct Entry {
+    explicit Entry(std::string_view name) : name(name) {}
+
+    const std::string name;
+    std::atomic<uint32_t> count{0};
+  };
+
+  PerformanceEntryNameTable();
+
+  PerformanceEntryNameTable(const PerformanceEntryNameTable&) = delete;
+  PerformanceEntryNameTable& operator=(const PerformanceEntryNameTable&) =
+      delete;
+
+  /**
+   * Returns the entry for the given name, creating it if needed. The entry
+   * stays valid for the lifetime of the table.
+   */
+  Entry& intern(std::string_view name);
+
+  /**
+   * Returns the names with a non-zero count, with their count.
+   */
+  std::vector<std::pair<std::string, uint32_t>> getCounts() const;
+
+ private:
+  // Identifies the table in thread-local caches, never reused
+  const uint64_t id_;
+
+  mutable std::mutex mutex_;
+  std::deque<Entry> entries_;
+  std::unordered_map<std::string_view, Entry*> entryMap_;
+};
+
+} // namespace facebook::react
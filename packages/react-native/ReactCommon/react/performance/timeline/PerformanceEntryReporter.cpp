@@ -101,9 +101,8 @@ PerformanceEntryReporter::getSupportedEntryTypes() {
 
 uint32_t PerformanceEntryReporter::getDroppedEntriesCount(
     PerformanceEntryType entryType) const noexcept {
-  std::shared_lock lock(buffersMutex_);
-
-  return (uint32_t)getBuffer(entryType).droppedEntriesCount;
+  return (uint32_t)getBuffer(entryType).droppedEntriesCount.load(
+      std::memory_order_relaxed);
 }
 
 std::vector<PerformanceEntry> PerformanceEntryReporter::getEntries() const {
@@ -114,8 +113,6 @@ std::vector<PerformanceEntry> PerformanceEntryReporter::getEntries() const {
 
 void PerformanceEntryReporter::getEntries(
     std::vector<PerformanceEntry>& dest) const {
-  std::shared_lock lock(buffersMutex_);
-
   for (auto entryType : getSupportedEntryTypes()) {
     getBuffer(entryType).getEntries(dest);
   }
@@ -131,8 +128,6 @@ std::vector<PerformanceEntry> PerformanceEntryReporter::getEntries(
 void PerformanceEntryReporter::getEntries(
     std::vector<PerformanceEntry>& dest,
     PerformanceEntryType entryType) const {
-  std::shared_lock lock(buffersMutex_);
-
   getBuffer(entryType).getEntries(dest);
 }
 
@@ -148,30 +143,22 @@ void PerformanceEntryReporter::getEntries(
     std::vector<PerformanceEntry>& dest,
     PerformanceEntryType entryType,
     const std::string& entryName) const {
-  std::shared_lock lock(buffersMutex_);
-
   getBuffer(entryType).getEntries(dest, entryName);
 }
 
 void PerformanceEntryReporter::clearEntries() {
-  std::unique_lock lock(buffersMutex_);
-
   for (auto entryType : getSupportedEntryTypes()) {
     getBufferRef(entryType).clear();
   }
 }
 
 void PerformanceEntryReporter::clearEntries(PerformanceEntryType entryType) {
-  std::unique_lock lock(buffersMutex_);
-
   getBufferRef(entryType).clear();
 }
 
 void PerformanceEntryReporter::clearEntries(
     PerformanceEntryType entryType,
     const std::string& entryName) {
-  std::unique_lock lock(buffersMutex_);
-
   getBufferRef(entryType).clear(entryName);
 }
 
@@ -185,10 +172,7 @@ PerformanceMark PerformanceEntryReporter::reportMark(
   traceMark(entry);
 
   // Add to buffers & notify observers
-  {
-    std::unique_lock lock(buffersMutex_);
-    markBuffer_.add(entry);
-  }
+  markBuffer_.add(entry);
 
   observerRegistry_->queuePerformanceEntry(entry);
 
@@ -211,10 +195,7 @@ PerformanceMeasure PerformanceEntryReporter::reportMeasure(
   traceMeasure(entry);
 
   // Add to buffers & notify observers
-  {
-    std::unique_lock lock(buffersMutex_);
-    measureBuffer_.add(entry);
-  }
+  measureBuffer_.add(entry);
 
   observerRegistry_->queuePerformanceEntry(entry);
 
@@ -223,8 +204,6 @@ PerformanceMeasure PerformanceEntryReporter::reportMeasure(
 
 std::optional<DOMHighResTimeStamp> PerformanceEntryReporter::getMarkTime(
     const std::string& markName) const {
-  std::shared_lock lock(buffersMutex_);
-
   if (auto it = markBuffer_.find(markName); it) {
     return std::visit(
         [](const auto& entryData) { return entryData.startTime; }, *it);
@@ -240,7 +219,8 @@ void PerformanceEntryReporter::reportEvent(
     DOMHighResTimeStamp processingStart,
     DOMHighResTimeStamp processingEnd,
     uint32_t interactionId) {
-  eventCounts_[name]++;
+  auto& eventName = eventNames_.intern(name);
+  eventName.count.fetch_add(1, std::memory_order_relaxed);
 
   if (duration < eventBuffer_.durationThreshold) {
     // The entries duration is lower than the desired reporting threshold,
@@ -248,35 +228,37 @@ void PerformanceEntryReporter::reportEvent(
     return;
   }
 
-  const auto entry = PerformanceEventTiming{
-      {.name = std::move(name), .startTime = startTime, .duration = duration},
+  eventBuffer_.add(
+      eventName,
+      startTime,
+      duration,
       processingStart,
       processingEnd,
-      interactionId};
-
-  {
-    std::unique_lock lock(buffersMutex_);
-    eventBuffer_.add(entry);
-  }
+      interactionId);
 
   // TODO(T198982346): Log interaction events to jsinspector_modern
-  observerRegistry_->queuePerformanceEntry(entry);
+  if (observerRegistry_->isObserving(PerformanceEntryType::EVENT)) {
+    observerRegistry_->queuePerformanceEntry(PerformanceEventTiming{
+        {.name = std::move(name),
+         .startTime = startTime,
+         .duration = duration},
+        processingStart,
+        processingEnd,
+        interactionId});
+  }
 }
 
 void PerformanceEntryReporter::reportLongTask(
     DOMHighResTimeStamp startTime,
     DOMHighResTimeStamp duration) {
-  const auto entry = PerformanceLongTaskTiming{
+  auto entry = PerformanceLongTaskTiming{
       {.name = std::string{"self"},
        .startTime = startTime,
        .duration = duration}};
 
-  {
-    std::unique_lock lock(buffersMutex_);
-    longTaskBuffer_.add(entry);
-  }
+  longTaskBuffer_.add(entry);
 
-  observerRegistry_->queuePerformanceEntry(entry);
+  observerRegistry_->queuePerformanceEntry(std::move(entry));
 }
 
 PerformanceResourceTiming PerformanceEntryReporter::reportResourceTiming(
@@ -300,10 +282,7 @@ PerformanceResourceTiming PerformanceEntryReporter::reportResourceTiming(
   };
 
   // Add to buffers & notify observers
-  {
-    std::unique_lock lock(buffersMutex_);
-    resourceTimingBuffer_.add(entry);
-  }
+  resourceTimingBuffer_.add(entry);
 
   observerRegistry_->queuePerformanceEntry(entry);
 
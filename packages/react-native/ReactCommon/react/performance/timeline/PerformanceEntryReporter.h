@@ -9,6 +9,8 @@
 
 #include "PerformanceEntryCircularBuffer.h"
 #include "PerformanceEntryKeyedBuffer.h"
+#include "PerformanceEntryNameTable.h"
+#include "PerformanceEventTimingBuffer.h"
 #include "PerformanceObserverRegistry.h"
 
 #include <jsinspector-modern/tracing/CdpTracing.h>
@@ -16,7 +18,6 @@
 
 #include <memory>
 #include <optional>
-#include <shared_mutex>
 #include <vector>
 
 namespace facebook::react {
@@ -33,8 +34,8 @@ class PerformanceEntryReporter {
  public:
   PerformanceEntryReporter();
 
-  // NOTE: This class is not thread safe, make sure that the calls are made from
-  // the same thread.
+  // NOTE: Entries can be reported and retrieved from any thread. Each buffer
+  // is synchronized on its own, and events are recorded without taking locks.
   // TODO: Consider passing it as a parameter to the corresponding modules at
   // creation time instead of having the singleton.
   static std::shared_ptr<PerformanceEntryReporter>& getInstance();
@@ -76,8 +77,8 @@ class PerformanceEntryReporter {
 
   uint32_t getDroppedEntriesCount(PerformanceEntryType type) const noexcept;
 
-  const std::unordered_map<std::string, uint32_t>& getEventCounts() const {
-    return eventCounts_;
+  std::vector<std::pair<std::string, uint32_t>> getEventCounts() const {
+    return eventNames_.getCounts();
   }
 
   std::optional<double> getMarkTime(const std::string& markName) const;
@@ -116,16 +117,15 @@ class PerformanceEntryReporter {
  private:
   std::unique_ptr<PerformanceObserverRegistry> observerRegistry_;
 
-  mutable std::shared_mutex buffersMutex_;
-  PerformanceEntryCircularBuffer eventBuffer_{EVENT_BUFFER_SIZE};
+  // Event names are interned, and hold the event counts
+  PerformanceEntryNameTable eventNames_;
+  PerformanceEventTimingBuffer eventBuffer_{EVENT_BUFFER_SIZE, eventNames_};
   PerformanceEntryCircularBuffer longTaskBuffer_{LONG_TASK_BUFFER_SIZE};
   PerformanceEntryCircularBuffer resourceTimingBuffer_{
       RESOURCE_TIMING_BUFFER_SIZE};
   PerformanceEntryKeyedBuffer markBuffer_;
   PerformanceEntryKeyedBuffer measureBuffer_;
 
-  std::unordered_map<std::string, uint32_t> eventCounts_;
-
   std::function<double()> timeStampProvider_ = nullptr;
 
   const inline PerformanceEntryBuffer& getBuffer(
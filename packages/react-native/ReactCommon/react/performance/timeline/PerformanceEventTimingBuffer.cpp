@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "PerformanceEventTimingBuffer.h"
+
+#include <variant>
+
+namespace facebook::react {
+
+void PerformanceEventTimingBuffer::add(const PerformanceEntry& entry) {
+  const auto& eventTiming = std::get<PerformanceEventTiming>(entry);
+  add(nameTable_.intern(eventTiming.name),
+      eventTiming.startTime,
+      eventTiming.duration,
+      eventTiming.processingStart,
+      eventTiming.processingEnd,
+      eventTiming.interactionId);
+}
+
+void PerformanceEventTimingBuffer::add(
+    const PerformanceEntryNameTable::Entry& name,
+    DOMHighResTimeStamp startTime,
+    DOMHighResTimeStamp duration,
+    DOMHighResTimeStamp processingStart,
+    DOMHighResTimeStamp processingEnd,
+    PerformanceEntryInteractionId interactionId) {
+  if (buffer_.add(
+          {.name = &name,
+           .startTime = startTime,
+           .duration = duration,
+           .processingStart = processingStart,
+           .processingEnd = processingEnd,
+           .interactionId = interactionId})) {
+    droppedEntriesCount.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void PerformanceEventTimingBuffer::getEntries(
+    std::vector<PerformanceEntry>& target) const {
+  for (const auto& record : buffer_.getEntries()) {
+    target.push_back(toPerformanceEntry(record));
+  }
+}
+
+void PerformanceEventTimingBuffer::getEntries(
+    std::vector<PerformanceEntry>& target,
+    const std::string& name) const {
+  std::vector<Record> records;
+  buffer_.getEntries(
+      records, [&](const Record& record) { return record.name->name == name; });
+  for (const auto& record : records) {
+    target.push_back(toPerformanceEntry(record));
+  }
+}
+
+void PerformanceEventTimingBuffer::clear() {
+  buffer_.clear();
+}
+
+void PerformanceEventTimingBuffer::clear(const std::string& name) {
+  buffer_.clear(
+      [&](const Record& record) { return record.name->name == name; });
+}
+
+/* static */ PerformanceEntry PerformanceEventTimingBuffer::toPerformanceEntry(
+    const Record& record) {
+  return PerformanceEventTiming{
+      {.name = record.name->name,
+       .startTime = record.startTime,
+       .duration = record.duration},
+      record.processingStart,
+      record.processingEnd,
+      record.interactionId};
+}
+
+} // namespace facebook::react
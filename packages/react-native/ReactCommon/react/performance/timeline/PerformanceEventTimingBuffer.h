@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include "ConcurrentCircularBuffer.h"
+#include "PerformanceEntryBuffer.h"
+#include "PerformanceEntryNameTable.h"
+
+namespace facebook::react {
+
+/**
+ * Lock-free circular buffer for PerformanceEventTiming entries, which are
+ * reported for every dispatched event.
+ *
+ * Entries are stored without their name, which is interned in the given
+ * PerformanceEntryNameTable instead. The strings are only copied when entries
+ * are retrieved.
+ */
+class PerformanceEventTimingBuffer : public PerformanceEntryBuffer {
+ public:
+  PerformanceEventTimingBuffer(
+      size_t size,
+      PerformanceEntryNameTable& nameTable)
+      : buffer_(size), nameTable_(nameTable) {}
+  ~PerformanceEventTimingBuffer() override = default;
+
+  void add(const PerformanceEntry& entry) override;
+
+  /**
+   * Same as above, with a name which was interned in the name table of this
+   * buffer.
+   */
+  void add(
+      const PerformanceEntryNameTable::Entry& name,
+      DOMHighResTimeStamp startTime,
+      DOMHighResTimeStamp duration,
+      DOMHighResTimeStamp processingStart,
+      DOMHighResTimeStamp processingEnd,
+      PerformanceEntryInteractionId interactionId);
+
+  void getEntries(std::vector<PerformanceEntry>& target) const override;
+  void getEntries(
+      std::vector<PerformanceEntry>& target,
+      const std::string& name) const override;
+
+  void clear() override;
+  void clear(const std::string& name) override;
+
+ private:
+  struct Record {
+    const PerformanceEntryNameTable::Entry* name;
+    DOMHighResTimeStamp startTime;
+    DOMHighResTimeStamp duration;
+    DOMHighResTimeStamp processingStart;
+    DOMHighResTimeStamp processingEnd;
+    PerformanceEntryInteractionId interactionId;
+  };
+
+  static PerformanceEntry toPerformanceEntry(const Record& record);
+
+  ConcurrentCircularBuffer<Record> buffer_;
+  PerformanceEntryNameTable& nameTable_;
+};
+
+} // namespace facebook::react
@@ -12,24 +12,36 @@
 
 namespace facebook::react {
 
-void PerformanceObserver::handleEntry(const PerformanceEntry& entry) {
+bool PerformanceObserver::shouldHandleEntry(
+    const PerformanceEntry& entry) const {
   auto entryType = std::visit(
       [](const auto& entryData) { return entryData.entryType; }, entry);
 
-  if (observedTypes_.contains(entryType)) {
-    // https://www.w3.org/TR/event-timing/#should-add-performanceeventtiming
-    if (std::holds_alternative<PerformanceEventTiming>(entry) &&
-        std::get<PerformanceEventTiming>(entry).duration < durationThreshold_) {
-      // The entries duration is lower than the desired reporting threshold,
-      // skip
-      return;
-    }
+  if (!observedTypes_.contains(entryType)) {
+    return false;
+  }
+
+  // https://www.w3.org/TR/event-timing/#should-add-performanceeventtiming
+  // The entries duration is lower than the desired reporting threshold, skip
+  return !(
+      std::holds_alternative<PerformanceEventTiming>(entry) &&
+      std::get<PerformanceEventTiming>(entry).duration < durationThreshold_);
+}
 
+void PerformanceObserver::handleEntry(const PerformanceEntry& entry) {
+  if (shouldHandleEntry(entry)) {
     buffer_.push_back(entry);
     scheduleFlushBuffer();
   }
 }
 
+void PerformanceObserver::handleEntry(PerformanceEntry&& entry) {
+  if (shouldHandleEntry(entry)) {
+    buffer_.push_back(std::move(entry));
+    scheduleFlushBuffer();
+  }
+}
+
 std::vector<PerformanceEntry> PerformanceObserver::takeRecords() {
   std::vector<PerformanceEntry> result;
   buffer_.swap(result);
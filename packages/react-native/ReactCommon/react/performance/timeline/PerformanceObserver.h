@@ -72,10 +72,21 @@ class PerformanceObserver
 
   ~PerformanceObserver() = default;
 
+  /**
+   * Returns whether this observer watches the type of the entry and the entry
+   * is above the duration threshold.
+   */
+  bool shouldHandleEntry(const PerformanceEntry& entry) const;
+
   /**
    * Append entry to the buffer if this observer should handle this entry.
    */
   void handleEntry(const PerformanceEntry& entry);
+  void handleEntry(PerformanceEntry&& entry);
+
+  const PerformanceObserverEntryTypeFilter& getObservedTypes() const {
+    return observedTypes_;
+  }
 
   /**
    * Returns current observer buffer and clears it.
@@ -8,22 +8,32 @@
 #include "PerformanceObserverRegistry.h"
 #include "PerformanceObserver.h"
 
+#include <variant>
+
 namespace facebook::react {
 
 void PerformanceObserverRegistry::addObserver(
     std::shared_ptr<PerformanceObserver> observer) {
   std::lock_guard guard(observersMutex_);
   observers_.insert(observer);
+  updateObservedEntryTypes();
 }
 
 void PerformanceObserverRegistry::removeObserver(
     std::shared_ptr<PerformanceObserver> observer) {
   std::lock_guard guard(observersMutex_);
   observers_.erase(observer);
+  updateObservedEntryTypes();
 }
 
 void PerformanceObserverRegistry::queuePerformanceEntry(
     const PerformanceEntry& entry) {
+  auto entryType = std::visit(
+      [](const auto& entryData) { return entryData.entryType; }, entry);
+  if (!isObserving(entryType)) {
+    return;
+  }
+
   std::lock_guard lock(observersMutex_);
 
   for (auto& observer : observers_) {
@@ -31,4 +41,38 @@ void PerformanceObserverRegistry::queuePerformanceEntry(
   }
 }
 
+void PerformanceObserverRegistry::queuePerformanceEntry(
+    PerformanceEntry&& entry) {
+  auto entryType = std::visit(
+      [](const auto& entryData) { return entryData.entryType; }, entry);
+  if (!isObserving(entryType)) {
+    return;
+  }
+
+  std::lock_guard lock(observersMutex_);
+
+  PerformanceObserver* lastObserver = nullptr;
+  for (auto& observer : observers_) {
+    if (observer->shouldHandleEntry(entry)) {
+      if (lastObserver != nullptr) {
+        lastObserver->handleEntry(entry);
+      }
+      lastObserver = observer.get();
+    }
+  }
+  if (lastObserver != nullptr) {
+    lastObserver->handleEntry(std::move(entry));
+  }
+}
+
+void PerformanceObserverRegistry::updateObservedEntryTypes() {
+  uint32_t observedEntryTypes = 0;
+  for (auto& observer : observers_) {
+    for (auto entryType : observer->getObservedTypes()) {
+      observedEntryTypes |= entryTypeMask(entryType);
+    }
+  }
+  observedEntryTypes_.store(observedEntryTypes, std::memory_order_relaxed);
+}
+
 } // namespace facebook::react
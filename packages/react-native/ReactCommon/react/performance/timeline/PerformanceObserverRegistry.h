@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <set>
@@ -37,14 +38,37 @@ class PerformanceObserverRegistry {
    */
   void removeObserver(std::shared_ptr<PerformanceObserver> observer);
 
+  /**
+   * Returns whether any registered observer watches the given entry type.
+   * Doesn't take any lock, so that reporters can cheaply skip creating
+   * entries nobody is interested in.
+   */
+  bool isObserving(PerformanceEntryType entryType) const {
+    return (observedEntryTypes_.load(std::memory_order_relaxed) &
+            entryTypeMask(entryType)) != 0;
+  }
+
   /**
    * Delegates specified performance `entry` to all registered observers
    * in this registry.
    */
   void queuePerformanceEntry(const PerformanceEntry& entry);
 
+  /**
+   * Same as above, but the entry is moved to the last observer which handles
+   * it rather than copied.
+   */
+  void queuePerformanceEntry(PerformanceEntry&& entry);
+
  private:
+  static uint32_t entryTypeMask(PerformanceEntryType entryType) {
+    return 1u << static_cast<uint32_t>(entryType);
+  }
+
+  void updateObservedEntryTypes();
+
   mutable std::mutex observersMutex_;
+  std::atomic<uint32_t> observedEntryTypes_{0};
   std::set<
       std::shared_ptr<PerformanceObserver>,
       std::owner_less<std::shared_ptr<PerformanceObserver>>>
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include "../ConcurrentCircularBuffer.h"
+
+#include <thread>
+#include <vector>
+
+namespace facebook::react {
+
+constexpr auto OK = false;
+constexpr auto OVERWRITE = true;
+
+TEST(ConcurrentCircularBuffer, CanAddAndRetrieveElements) {
+  ConcurrentCircularBuffer<int> buffer{3};
+
+  ASSERT_EQ(OK, buffer.add(1));
+  ASSERT_EQ(OK, buffer.add(2));
+  ASSERT_EQ(std::vector<int>({1, 2}), buffer.getEntries());
+
+  ASSERT_EQ(OK, buffer.add(3));
+  ASSERT_EQ(OVERWRITE, buffer.add(4));
+  ASSERT_EQ(OVERWRITE, buffer.add(5));
+  ASSERT_EQ(std::vector<int>({3, 4, 5}), buffer.getEntries());
+}
+
+TEST(ConcurrentCircularBuffer, CanClear) {
+  ConcurrentCircularBuffer<int> buffer{3};
+
+  buffer.add(1);
+  buffer.add(2);
+  buffer.clear();
+  ASSERT_EQ(std::vector<int>{}, buffer.getEntries());
+
+  // Overwriting cleared elements doesn't count as dropping them
+  ASSERT_EQ(OK, buffer.add(3));
+  ASSERT_EQ(OK, buffer.add(4));
+  ASSERT_EQ(OK, buffer.add(5));
+  ASSERT_EQ(std::vector<int>({3, 4, 5}), buffer.getEntries());
+}
+
+TEST(ConcurrentCircularBuffer, CanClearAndGetByPredicate) {
+  ConcurrentCircularBuffer<int> buffer{5};
+
+  for (int i = 0; i < 7; i++) {
+    buffer.add(i);
+  }
+  ASSERT_EQ(
+      std::vector<int>({3, 5}),
+      buffer.getEntries([](const int& el) { return el % 2 == 1; }));
+
+  buffer.clear([](const int& el) { return el % 2 == 1; });
+  ASSERT_EQ(std::vector<int>({2, 4, 6}), buffer.getEntries());
+
+  ASSERT_EQ(OVERWRITE, buffer.add(7));
+  ASSERT_EQ(OK, buffer.add(8));
+  ASSERT_EQ(std::vector<int>({4, 6, 7, 8}), buffer.getEntries());
+}
+
+TEST(ConcurrentCircularBuffer, ReadsConsistentElementsWhileWriting) {
+  struct Element {
+    uint64_t value;
+    uint64_t square;
+    uint64_t thread;
+  };
+
+  constexpr uint64_t ThreadCount = 4;
+  constexpr uint64_t ElementsPerThread = 50'000;
+  ConcurrentCircularBuffer<Element> buffer{16};
+
+  std::vector<std::thread> writers;
+  for (uint64_t thread = 0; thread < ThreadCount; thread++) {
+    writers.emplace_back([&buffer, thread]() {
+      for (uint64_t i = 0; i < ElementsPerThread; i++) {
+        buffer.add({.value = i, .square = i * i, .thread = thread});
+      }
+    });
+  }
+
+  std::vector<Element> elements;
+  for (int i = 0; i < 1'000; i++) {
+    elements.clear();
+    buffer.getEntries(elements);
+    ASSERT_LE(elements.size(), 16);
+    std::vector<uint64_t> lastValues(ThreadCount);
+    for (const auto& element : elements) {
+      ASSERT_EQ(element.value * element.value, element.square);
+      ASSERT_LT(element.thread, ThreadCount);
+      // Elements from the same thread are retrieved in order
+      ASSERT_LE(lastValues[element.thread], element.value);
+      lastValues[element.thread] = element.value;
+    }
+    if (i % 100 == 0) {
+      buffer.clear([](const Element& el) { return el.value % 2 == 0; });
+    }
+  }
+
+  for (auto& writer : writers) {
+    writer.join();
+  }
+
+  for (uint64_t i = 0; i < 16; i++) {
+    buffer.add({.value = i, .square = i * i, .thread = 0});
+  }
+  ASSERT_EQ(16, buffer.getEntries().size());
+}
+
+} // namespace facebook::react
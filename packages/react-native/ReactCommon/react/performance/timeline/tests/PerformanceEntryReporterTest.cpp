@@ -11,6 +11,8 @@
 
 #include "../PerformanceEntryReporter.h"
 
+#include <thread>
+#include <unordered_map>
 #include <variant>
 
 using namespace facebook::react;
@@ -242,3 +244,96 @@ TEST(PerformanceEntryReporter, PerformanceEntryReporterTestClearMarks) {
     ASSERT_EQ(entries.size(), 0);
   }
 }
+
+TEST(PerformanceEntryReporter, PerformanceEntryReporterTestReportEvents) {
+  auto reporter = PerformanceEntryReporter::getInstance();
+  reporter->clearEntries();
+
+  reporter->reportEvent("report-events-click", 0, 10, 1, 9, 1);
+  reporter->reportEvent("report-events-pointermove", 1, 20, 2, 19, 0);
+  reporter->reportEvent("report-events-click", 5, 30, 6, 29, 2);
+
+  {
+    auto entries = reporter->getEntries(PerformanceEntryType::EVENT);
+    std::vector<PerformanceEntry> expected = {
+        PerformanceEventTiming{
+            {.name = "report-events-click", .startTime = 0, .duration = 10},
+            1,
+            9,
+            1},
+        PerformanceEventTiming{
+            {.name = "report-events-pointermove",
+             .startTime = 1,
+             .duration = 20},
+            2,
+            19,
+            0},
+        PerformanceEventTiming{
+            {.name = "report-events-click", .startTime = 5, .duration = 30},
+            6,
+            29,
+            2},
+    };
+    ASSERT_EQ(expected, entries);
+  }
+
+  {
+    auto entries = reporter->getEntries(
+        PerformanceEntryType::EVENT, "report-events-pointermove");
+    ASSERT_EQ(entries.size(), 1);
+  }
+
+  auto eventCounts = reporter->getEventCounts();
+  std::unordered_map<std::string, uint32_t> counts{
+      eventCounts.begin(), eventCounts.end()};
+  ASSERT_EQ(counts["report-events-click"], 2);
+  ASSERT_EQ(counts["report-events-pointermove"], 1);
+
+  reporter->clearEntries(PerformanceEntryType::EVENT);
+  ASSERT_EQ(reporter->getEntries(PerformanceEntryType::EVENT).size(), 0);
+}
+
+TEST(PerformanceEntryReporter, PerformanceEntryReporterTestReportConcurrently) {
+  auto reporter = PerformanceEntryReporter::getInstance();
+  reporter->clearEntries();
+
+  constexpr int ThreadCount = 4;
+  constexpr int EntriesPerThread = 1'000;
+
+  std::vector<std::thread> threads;
+  for (int thread = 0; thread < ThreadCount; thread++) {
+    threads.emplace_back([&reporter]() {
+      for (int i = 0; i < EntriesPerThread; i++) {
+        reporter->reportEvent("report-concurrently-event", i, i, i, i, 0);
+        reporter->reportMark("report-concurrently-mark", i);
+      }
+    });
+  }
+  for (int i = 0; i < 100; i++) {
+    for (const auto& entry :
+         reporter->getEntries(PerformanceEntryType::EVENT)) {
+      const auto& eventTiming = std::get<PerformanceEventTiming>(entry);
+      ASSERT_EQ(eventTiming.name, "report-concurrently-event");
+      ASSERT_EQ(eventTiming.startTime, eventTiming.duration);
+      ASSERT_EQ(eventTiming.startTime, eventTiming.processingEnd);
+    }
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  ASSERT_EQ(
+      reporter->getEntries(PerformanceEntryType::EVENT).size(),
+      EVENT_BUFFER_SIZE);
+  ASSERT_EQ(
+      reporter->getEntries(PerformanceEntryType::MARK).size(),
+      ThreadCount * EntriesPerThread);
+
+  auto eventCounts = reporter->getEventCounts();
+  std::unordered_map<std::string, uint32_t> counts{
+      eventCounts.begin(), eventCounts.end()};
+  ASSERT_EQ(
+      counts["report-concurrently-event"], ThreadCount * EntriesPerThread);
+
+  reporter->clearEntries();
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/performance/timeline/PerformanceEntryReporter.h>
+#include <react/performance/timeline/PerformanceObserver.h>
+
+#include <array>
+#include <string>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr int ClearInterval = 10'000;
+
+const std::array<std::string, 4> EventNames = {
+    "pointermove",
+    "pointerdown",
+    "pointerup",
+    "click",
+};
+
+// Cost of reporting an event, per thread
+void reportEvent(benchmark::State& state) {
+  auto& reporter = *PerformanceEntryReporter::getInstance();
+  size_t i = 0;
+  for (auto _ : state) {
+    reporter.reportEvent(EventNames[i % EventNames.size()], i, 16, i, i, 0);
+    i++;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Same as above, with an observer for events, which needs its own copy
+void reportEventWithObserver(benchmark::State& state) {
+  auto& reporter = *PerformanceEntryReporter::getInstance();
+  auto observer = PerformanceObserver::create(
+      reporter.getObserverRegistry(), []() {});
+  observer->observe(PerformanceEntryType::EVENT);
+  size_t i = 0;
+  for (auto _ : state) {
+    reporter.reportEvent(EventNames[i % EventNames.size()], i, 16, i, i, 0);
+    if (++i % EVENT_BUFFER_SIZE == 0) {
+      benchmark::DoNotOptimize(observer->takeRecords());
+    }
+  }
+  observer->disconnect();
+  state.SetItemsProcessed(state.iterations());
+}
+
+void reportMark(benchmark::State& state) {
+  auto& reporter = *PerformanceEntryReporter::getInstance();
+  int i = 0;
+  for (auto _ : state) {
+    reporter.reportMark("mark", i);
+    if (++i % ClearInterval == 0 && state.thread_index() == 0) {
+      reporter.clearEntries(PerformanceEntryType::MARK);
+    }
+  }
+  if (state.thread_index() == 0) {
+    reporter.clearEntries(PerformanceEntryType::MARK);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// All threads but the first one report events and marks, while the first one
+// keeps retrieving entries, the way the JS thread does for the
+// `performance.getEntries*` APIs.
+void reportWhileReading(benchmark::State& state) {
+  auto& reporter = *PerformanceEntryReporter::getInstance();
+  if (state.thread_index() == 0) {
+    size_t entryCount = 0;
+    for (auto _ : state) {
+      entryCount += reporter.getEntries(PerformanceEntryType::EVENT).size();
+      reporter.clearEntries(PerformanceEntryType::MARK);
+    }
+    state.counters["entriesPerRead"] = benchmark::Counter(
+        static_cast<double>(entryCount), benchmark::Counter::kAvgIterations);
+    return;
+  }
+
+  size_t i = 0;
+  for (auto _ : state) {
+    reporter.reportEvent(EventNames[i % EventNames.size()], i, 16, i, i, 0);
+    if (i % 16 == 0) {
+      reporter.reportMark("mark", i);
+    }
+    i++;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK(reportEvent)->Threads(1)->Threads(4)->Threads(8)->UseRealTime();
+BENCHMARK(reportEventWithObserver);
+BENCHMARK(reportMark)->Threads(1)->Threads(4)->UseRealTime();
+BENCHMARK(reportWhileReading)
+    ->Threads(2)
+    ->Threads(4)
+    ->Threads(8)
+    ->UseRealTime();
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -1012,6 +1012,9 @@ constexpr static MapBuffer::Key AS_KEY_FRAGMENTS = 2;
 constexpr static MapBuffer::Key AS_KEY_CACHE_ID = 3;
 constexpr static MapBuffer::Key AS_KEY_BASE_ATTRIBUTES = 4;
 
+// Number of entries written by toMapBuffer(const AttributedString&)
+constexpr static uint32_t AS_BUCKET_COUNT = 4;
+
 // constants for Fragment serialization
 constexpr static MapBuffer::Key FR_KEY_STRING = 0;
 constexpr static MapBuffer::Key FR_KEY_REACT_TAG = 1;
@@ -1061,8 +1064,12 @@ constexpr static MapBuffer::Key PA_KEY_HYPHENATION_FREQUENCY = 5;
 constexpr static MapBuffer::Key PA_KEY_MINIMUM_FONT_SIZE = 6;
 constexpr static MapBuffer::Key PA_KEY_MAXIMUM_FONT_SIZE = 7;
 
-inline MapBuffer toMapBuffer(const ParagraphAttributes& paragraphAttributes) {
-  auto builder = MapBufferBuilder();
+// Number of entries written by toMapBuffer(const ParagraphAttributes&)
+constexpr static uint32_t PA_BUCKET_COUNT = 8;
+
+inline void toMapBuffer(
+    const ParagraphAttributes& paragraphAttributes,
+    MapBufferBuilder& builder) {
   builder.putInt(
       PA_KEY_MAX_NUMBER_OF_LINES, paragraphAttributes.maximumNumberOfLines);
   builder.putString(
@@ -1081,12 +1088,17 @@ inline MapBuffer toMapBuffer(const ParagraphAttributes& paragraphAttributes) {
       PA_KEY_MINIMUM_FONT_SIZE, paragraphAttributes.minimumFontSize);
   builder.putDouble(
       PA_KEY_MAXIMUM_FONT_SIZE, paragraphAttributes.maximumFontSize);
+}
 
+inline MapBuffer toMapBuffer(const ParagraphAttributes& paragraphAttributes) {
+  auto builder = MapBufferBuilder(PA_BUCKET_COUNT);
+  toMapBuffer(paragraphAttributes, builder);
   return builder.build();
 }
 
-inline MapBuffer toMapBuffer(const FontVariant& fontVariant) {
-  auto builder = MapBufferBuilder();
+inline void toMapBuffer(
+    const FontVariant& fontVariant,
+    MapBufferBuilder& builder) {
   int index = 0;
   if ((int)fontVariant & (int)FontVariant::SmallCaps) {
     builder.putString(index++, "small-caps");
@@ -1103,12 +1115,17 @@ inline MapBuffer toMapBuffer(const FontVariant& fontVariant) {
   if ((int)fontVariant & (int)FontVariant::ProportionalNums) {
     builder.putString(index++, "proportional-nums");
   }
+}
 
+inline MapBuffer toMapBuffer(const FontVariant& fontVariant) {
+  auto builder = MapBufferBuilder();
+  toMapBuffer(fontVariant, builder);
   return builder.build();
 }
 
-inline MapBuffer toMapBuffer(const TextAttributes& textAttributes) {
-  auto builder = MapBufferBuilder();
+inline void toMapBuffer(
+    const TextAttributes& textAttributes,
+    MapBufferBuilder& builder) {
   if (textAttributes.foregroundColor) {
     builder.putInt(
         TA_KEY_FOREGROUND_COLOR, toAndroidRepr(textAttributes.foregroundColor));
@@ -1137,8 +1154,10 @@ inline MapBuffer toMapBuffer(const TextAttributes& textAttributes) {
     builder.putString(TA_KEY_FONT_STYLE, toString(*textAttributes.fontStyle));
   }
   if (textAttributes.fontVariant.has_value()) {
-    auto fontVariantMap = toMapBuffer(*textAttributes.fontVariant);
-    builder.putMapBuffer(TA_KEY_FONT_VARIANT, fontVariantMap);
+    builder.putMapBuffer(
+        TA_KEY_FONT_VARIANT, [&](MapBufferBuilder& fontVariantBuilder) {
+          toMapBuffer(*textAttributes.fontVariant, fontVariantBuilder);
+        });
   }
   if (textAttributes.allowFontScaling.has_value()) {
     builder.putBool(
@@ -1224,12 +1243,30 @@ inline MapBuffer toMapBuffer(const TextAttributes& textAttributes) {
     builder.putString(
         TA_KEY_ALIGNMENT_VERTICAL, toString(*textAttributes.textAlignVertical));
   }
-  return builder.build();
 }
 
-inline MapBuffer toMapBuffer(const AttributedString::Fragment& fragment) {
+inline MapBuffer toMapBuffer(const TextAttributes& textAttributes) {
   auto builder = MapBufferBuilder();
+  toMapBuffer(textAttributes, builder);
+  return builder.build();
+}
+
+// Number of entries written by toMapBuffer(const AttributedString::Fragment&)
+inline uint32_t fragmentBucketCount(
+    const AttributedString::Fragment& fragment) {
+  uint32_t count = 2;
+  if (fragment.parentShadowView.componentHandle) {
+    count += 1;
+  }
+  if (fragment.isAttachment()) {
+    count += 3;
+  }
+  return count;
+}
 
+inline void toMapBuffer(
+    const AttributedString::Fragment& fragment,
+    MapBufferBuilder& builder) {
   builder.putString(FR_KEY_STRING, fragment.string);
   if (fragment.parentShadowView.componentHandle) {
     builder.putInt(FR_KEY_REACT_TAG, fragment.parentShadowView.tag);
@@ -1242,31 +1279,57 @@ inline MapBuffer toMapBuffer(const AttributedString::Fragment& fragment) {
         FR_KEY_HEIGHT,
         fragment.parentShadowView.layoutMetrics.frame.size.height);
   }
-  auto textAttributesMap = toMapBuffer(fragment.textAttributes);
-  builder.putMapBuffer(FR_KEY_TEXT_ATTRIBUTES, textAttributesMap);
+  builder.putMapBuffer(
+      FR_KEY_TEXT_ATTRIBUTES, [&](MapBufferBuilder& textAttributesBuilder) {
+        toMapBuffer(fragment.textAttributes, textAttributesBuilder);
+      });
+}
 
+inline MapBuffer toMapBuffer(const AttributedString::Fragment& fragment) {
+  auto builder = MapBufferBuilder(fragmentBucketCount(fragment));
+  toMapBuffer(fragment, builder);
   return builder.build();
 }
 
-inline MapBuffer toMapBuffer(const AttributedString& attributedString) {
-  auto fragmentsBuilder = MapBufferBuilder();
-
-  int index = 0;
-  for (auto fragment : attributedString.getFragments()) {
-    fragmentsBuilder.putMapBuffer(index++, toMapBuffer(fragment));
-  }
-
-  auto builder = MapBufferBuilder();
+/**
+ * Writes the attributed string into `builder`, with nested maps encoded in
+ * place. Returns the hash stored under AS_KEY_HASH.
+ */
+inline int32_t toMapBuffer(
+    const AttributedString& attributedString,
+    MapBufferBuilder& builder) {
   size_t hash =
       std::hash<facebook::react::AttributedString>{}(attributedString);
   // TODO: This truncates half the hash
-  builder.putInt(AS_KEY_HASH, static_cast<int>(hash));
+  auto truncatedHash = static_cast<int32_t>(hash);
+  builder.putInt(AS_KEY_HASH, truncatedHash);
   builder.putString(AS_KEY_STRING, attributedString.getString());
+  const auto& fragments = attributedString.getFragments();
   builder.putMapBuffer(
-      AS_KEY_BASE_ATTRIBUTES,
-      toMapBuffer(attributedString.getBaseTextAttributes()));
-  auto fragmentsMap = fragmentsBuilder.build();
-  builder.putMapBuffer(AS_KEY_FRAGMENTS, fragmentsMap);
+      AS_KEY_FRAGMENTS,
+      static_cast<uint32_t>(fragments.size()),
+      [&](MapBufferBuilder& fragmentsBuilder) {
+        MapBuffer::Key index = 0;
+        for (const auto& fragment : fragments) {
+          fragmentsBuilder.putMapBuffer(
+              index++,
+              fragmentBucketCount(fragment),
+              [&](MapBufferBuilder& fragmentBuilder) {
+                toMapBuffer(fragment, fragmentBuilder);
+              });
+        }
+      });
+  builder.putMapBuffer(
+      AS_KEY_BASE_ATTRIBUTES, [&](MapBufferBuilder& textAttributesBuilder) {
+        toMapBuffer(
+            attributedString.getBaseTextAttributes(), textAttributesBuilder);
+      });
+  return truncatedHash;
+}
+
+inline MapBuffer toMapBuffer(const AttributedString& attributedString) {
+  auto builder = MapBufferBuilder(AS_BUCKET_COUNT);
+  toMapBuffer(attributedString, builder);
   return builder.build();
 }
 
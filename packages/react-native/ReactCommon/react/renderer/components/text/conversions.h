@@ -19,12 +19,23 @@ namespace facebook::react {
 
 #ifdef RN_SERIALIZABLE_STATE
 inline MapBuffer toMapBuffer(const ParagraphState& paragraphState) {
-  auto builder = MapBufferBuilder();
-  auto attStringMapBuffer = toMapBuffer(paragraphState.attributedString);
-  builder.putMapBuffer(TX_STATE_KEY_ATTRIBUTED_STRING, attStringMapBuffer);
-  auto paMapBuffer = toMapBuffer(paragraphState.paragraphAttributes);
-  builder.putMapBuffer(TX_STATE_KEY_PARAGRAPH_ATTRIBUTES, paMapBuffer);
-  builder.putInt(TX_STATE_KEY_HASH, attStringMapBuffer.getInt(AS_KEY_HASH));
+  auto builder = MapBufferBuilder(3);
+  int32_t hash = 0;
+  builder.putMapBuffer(
+      TX_STATE_KEY_ATTRIBUTED_STRING,
+      AS_BUCKET_COUNT,
+      [&](MapBufferBuilder& attributedStringBuilder) {
+        hash = toMapBuffer(
+            paragraphState.attributedString, attributedStringBuilder);
+      });
+  builder.putMapBuffer(
+      TX_STATE_KEY_PARAGRAPH_ATTRIBUTES,
+      PA_BUCKET_COUNT,
+      [&](MapBufferBuilder& paragraphAttributesBuilder) {
+        toMapBuffer(
+            paragraphState.paragraphAttributes, paragraphAttributesBuilder);
+      });
+  builder.putInt(TX_STATE_KEY_HASH, hash);
   return builder.build();
 }
 #endif
@@ -17,7 +17,7 @@ folly::dynamic AndroidTextInputState::getDynamic() const {
 }
 
 MapBuffer AndroidTextInputState::getMapBuffer() const {
-  auto builder = MapBufferBuilder();
+  auto builder = MapBufferBuilder(cachedAttributedStringId == 0 ? 4 : 0);
   // If we have a `cachedAttributedStringId` we know that we're (1) not trying
   // to set a new string, so we don't need to pass it along; (2) setState was
   // called from Java to trigger a relayout with a `cachedAttributedStringId`,
@@ -29,12 +29,22 @@ MapBuffer AndroidTextInputState::getMapBuffer() const {
         TX_STATE_KEY_MOST_RECENT_EVENT_COUNT,
         static_cast<int32_t>(mostRecentEventCount));
 
-    auto attStringMapBuffer = toMapBuffer(attributedStringBox.getValue());
-    builder.putMapBuffer(TX_STATE_KEY_ATTRIBUTED_STRING, attStringMapBuffer);
-    auto paMapBuffer = toMapBuffer(paragraphAttributes);
-    builder.putMapBuffer(TX_STATE_KEY_PARAGRAPH_ATTRIBUTES, paMapBuffer);
-
-    builder.putInt(TX_STATE_KEY_HASH, attStringMapBuffer.getInt(AS_KEY_HASH));
+    int32_t hash = 0;
+    builder.putMapBuffer(
+        TX_STATE_KEY_ATTRIBUTED_STRING,
+        AS_BUCKET_COUNT,
+        [&](MapBufferBuilder& attributedStringBuilder) {
+          hash = toMapBuffer(
+              attributedStringBox.getValue(), attributedStringBuilder);
+        });
+    builder.putMapBuffer(
+        TX_STATE_KEY_PARAGRAPH_ATTRIBUTES,
+        PA_BUCKET_COUNT,
+        [&](MapBufferBuilder& paragraphAttributesBuilder) {
+          toMapBuffer(paragraphAttributes, paragraphAttributesBuilder);
+        });
+
+    builder.putInt(TX_STATE_KEY_HASH, hash);
   }
   return builder.build();
 }
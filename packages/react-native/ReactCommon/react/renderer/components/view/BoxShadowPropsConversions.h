@@ -14,7 +14,7 @@
 #include <react/renderer/core/PropsParserContext.h>
 #include <react/renderer/core/RawProps.h>
 #include <react/renderer/css/CSSShadow.h>
-#include <react/renderer/css/CSSValueParser.h>
+#include <react/renderer/css/CSSParseCache.h>
 #include <react/renderer/graphics/BoxShadow.h>
 #include <optional>
 #include <string>
@@ -139,9 +139,9 @@ inline std::optional<BoxShadow> fromCSSShadow(const CSSShadow& cssShadow) {
 }
 
 inline void parseUnprocessedBoxShadowString(
-    std::string&& value,
+    std::string_view value,
     std::vector<BoxShadow>& result) {
-  auto boxShadowList = parseCSSProperty<CSSShadowList>((std::string)value);
+  auto boxShadowList = parseCSSPropertyCached<CSSShadowList>(value);
   if (!std::holds_alternative<CSSShadowList>(boxShadowList)) {
     result = {};
     return;
@@ -253,7 +253,8 @@ inline void parseUnprocessedBoxShadow(
     const RawValue& value,
     std::vector<BoxShadow>& result) {
   if (value.hasType<std::string>()) {
-    parseUnprocessedBoxShadowString((std::string)value, result);
+    std::string storage;
+    parseUnprocessedBoxShadowString(value.getStringView(storage), result);
   } else if (value.hasType<std::vector<RawValue>>()) {
     parseUnprocessedBoxShadowList(
         context, (std::vector<RawValue>)value, result);
@@ -14,7 +14,7 @@
 #include <react/renderer/css/CSSLength.h>
 #include <react/renderer/css/CSSNumber.h>
 #include <react/renderer/css/CSSPercentage.h>
-#include <react/renderer/css/CSSValueParser.h>
+#include <react/renderer/css/CSSParseCache.h>
 #include <react/renderer/graphics/Color.h>
 #include <react/renderer/graphics/Float.h>
 
@@ -31,8 +31,9 @@ inline std::optional<Float> coerceAmount(const RawValue& value) {
   }
 
   if (value.hasType<std::string>()) {
-    auto cssVal =
-        parseCSSProperty<CSSNumber, CSSPercentage>((std::string)value);
+    std::string storage;
+    auto cssVal = parseCSSPropertyCached<CSSNumber, CSSPercentage>(
+        value.getStringView(storage));
     if (std::holds_alternative<CSSNumber>(cssVal)) {
       return std::get<CSSNumber>(cssVal).value;
     } else if (std::holds_alternative<CSSPercentage>(cssVal)) {
@@ -48,7 +49,9 @@ inline std::optional<Float> coerceAngle(const RawValue& value) {
   }
 
   if (value.hasType<std::string>()) {
-    auto cssVal = parseCSSProperty<CSSAngle>((std::string)value);
+    std::string storage;
+    auto cssVal =
+        parseCSSPropertyCached<CSSAngle>(value.getStringView(storage));
     if (std::holds_alternative<CSSAngle>(cssVal)) {
       return std::get<CSSAngle>(cssVal).degrees;
     }
@@ -60,7 +63,9 @@ inline SharedColor coerceColor(
     const RawValue& value,
     const PropsParserContext& context) {
   if (value.hasType<std::string>()) {
-    auto cssColor = parseCSSProperty<CSSColor>((std::string)value);
+    std::string storage;
+    auto cssColor =
+        parseCSSPropertyCached<CSSColor>(value.getStringView(storage));
     if (!std::holds_alternative<CSSColor>(cssColor)) {
       return {};
     }
@@ -78,7 +83,8 @@ inline std::optional<Float> coerceLength(const RawValue& value) {
   }
 
   if (value.hasType<std::string>()) {
-    auto len = parseCSSProperty<CSSLength>((std::string)value);
+    std::string storage;
+    auto len = parseCSSPropertyCached<CSSLength>(value.getStringView(storage));
     if (!std::holds_alternative<CSSLength>(len)) {
       return {};
     }
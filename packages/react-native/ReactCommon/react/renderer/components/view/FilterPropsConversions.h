@@ -14,7 +14,7 @@
 #include <react/renderer/core/PropsParserContext.h>
 #include <react/renderer/core/RawProps.h>
 #include <react/renderer/css/CSSFilter.h>
-#include <react/renderer/css/CSSValueParser.h>
+#include <react/renderer/css/CSSParseCache.h>
 #include <react/renderer/graphics/Filter.h>
 #include <optional>
 #include <string>
@@ -219,9 +219,9 @@ inline std::optional<FilterFunction> fromCSSFilter(
 }
 
 inline void parseUnprocessedFilterString(
-    std::string&& value,
+    std::string_view value,
     std::vector<FilterFunction>& result) {
-  auto filterList = parseCSSProperty<CSSFilterList>((std::string)value);
+  auto filterList = parseCSSPropertyCached<CSSFilterList>(value);
   if (!std::holds_alternative<CSSFilterList>(filterList)) {
     result = {};
     return;
@@ -241,8 +241,10 @@ inline std::optional<FilterFunction> parseDropShadow(
     const PropsParserContext& context,
     const RawValue& value) {
   if (value.hasType<std::string>()) {
-    auto val = parseCSSProperty<CSSDropShadowFilter>(
-        std::string("drop-shadow(") + (std::string)value + ")");
+    std::string storage;
+    auto css = std::string{"drop-shadow("};
+    css.append(value.getStringView(storage)).append(")");
+    auto val = parseCSSPropertyCached<CSSDropShadowFilter>(css);
     if (std::holds_alternative<CSSDropShadowFilter>(val)) {
       return fromCSSFilter(std::get<CSSDropShadowFilter>(val));
     }
@@ -364,7 +366,8 @@ inline void parseUnprocessedFilter(
     const RawValue& value,
     std::vector<FilterFunction>& result) {
   if (value.hasType<std::string>()) {
-    parseUnprocessedFilterString((std::string)value, result);
+    std::string storage;
+    parseUnprocessedFilterString(value.getStringView(storage), result);
   } else if (value.hasType<std::vector<RawValue>>()) {
     parseUnprocessedFilterList(context, (std::vector<RawValue>)value, result);
   } else {
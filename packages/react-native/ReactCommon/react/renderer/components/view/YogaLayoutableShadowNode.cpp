@@ -63,6 +63,11 @@ static int FabricDefaultYogaLog(
 }
 
 thread_local LayoutContext threadLocalLayoutContext;
+thread_local uint64_t threadLocalMeasureCount{0};
+
+/* static */ uint64_t YogaLayoutableShadowNode::getThreadLocalMeasureCount() {
+  return threadLocalMeasureCount;
+}
 
 YogaLayoutableShadowNode::YogaLayoutableShadowNode(
     const ShadowNodeFragment& fragment,
@@ -806,6 +811,7 @@ YGSize YogaLayoutableShadowNode::yogaNodeMeasureCallbackConnector(
   TraceSection s("YogaLayoutableShadowNode::yogaNodeMeasureCallbackConnector");
 
   auto& shadowNode = shadowNodeFromContext(yogaNode);
+  threadLocalMeasureCount++;
 
   auto minimumSize = Size{0, 0};
   auto maximumSize = Size{
@@ -37,6 +37,13 @@ class YogaLayoutableShadowNode : public LayoutableShadowNode {
       const ShadowNode& sourceShadowNode,
       const ShadowNodeFragment& fragment);
 
+  /*
+   * Returns the number of times that nodes were measured during layout on
+   * the calling thread so far. The difference between two calls is the
+   * number of measurements in between (e.g. during a commit), for telemetry.
+   */
+  static uint64_t getThreadLocalMeasureCount();
+
 #pragma mark - Mutating Methods
 
   /*
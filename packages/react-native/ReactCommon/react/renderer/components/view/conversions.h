@@ -17,7 +17,7 @@
 #include <react/renderer/css/CSSAngle.h>
 #include <react/renderer/css/CSSNumber.h>
 #include <react/renderer/css/CSSPercentage.h>
-#include <react/renderer/css/CSSValueParser.h>
+#include <react/renderer/css/CSSParseCache.h>
 #include <react/renderer/graphics/BackgroundImage.h>
 #include <react/renderer/graphics/BlendMode.h>
 #include <react/renderer/graphics/Isolation.h>
@@ -188,7 +188,8 @@ inline void fromRawValue(
   if (!value.hasType<std::string>()) {
     return;
   }
-  auto stringValue = (std::string)value;
+  std::string storage;
+  auto stringValue = value.getStringView(storage);
   if (stringValue == "inherit") {
     result = yoga::Direction::Inherit;
     return;
@@ -213,7 +214,8 @@ inline void fromRawValue(
   if (!value.hasType<std::string>()) {
     return;
   }
-  auto stringValue = (std::string)value;
+  std::string storage;
+  auto stringValue = value.getStringView(storage);
   if (stringValue == "row") {
     result = yoga::FlexDirection::Row;
     return;
@@ -242,7 +244,8 @@ inline void fromRawValue(
   if (!value.hasType<std::string>()) {
     return;
   }
-  auto stringValue = (std::string)value;
+  std::string storage;
+  auto stringValue = value.getStringView(storage);
   if (stringValue == "border-box") {
     result = yoga::BoxSizing::BorderBox;
     return;
@@ -264,7 +267,8 @@ inline void fromRawValue(
   if (!value.hasType<std::string>()) {
     return;
   }
-  auto stringValue = (std::string)value;
+  std::string storage;
+  auto stringValue = value.getStringView(storage);
   if (stringValue == "flex-start") {
     result = yoga::Justify::FlexStart;
     return;
@@ -301,7 +305,8 @@ inline void fromRawValue(
   if (!value.hasType<std::string>()) {
     return;
   }
-  auto stringValue = (std::string)value;
+  std::string storage;
+  auto stringValue = value.getStringView(storage);
   if (stringValue == "auto") {
     result = yoga::Align::Auto;
     return;
@@ -351,7 +356,8 @@ inline void fromRawValue(
   if (!value.hasType<std::string>()) {
     return;
   }
-  auto stringValue = (std::string)value;
+  std::string storage;
+  auto stringValue = value.getStringView(storage);
   if (stringValue == "static") {
     result = yoga::PositionType::Static;
     return;
@@ -376,7 +382,8 @@ inline void fromRawValue(
   if (!value.hasType<std::string>()) {
     return;
   }
-  auto stringValue = (std::string)value;
+  std::string storage;
+  auto stringValue = value.getStringView(storage);
   if (stringValue == "nowrap") {
     result = yoga::Wrap::NoWrap;
     return;
@@ -401,7 +408,8 @@ inline void fromRawValue(
   if (!value.hasType<std::string>()) {
     return;
   }
-  auto stringValue = (std::string)value;
+  std::string storage;
+  auto stringValue = value.getStringView(storage);
   if (stringValue == "visible") {
     result = yoga::Overflow::Visible;
     return;
@@ -427,7 +435,8 @@ inline void fromRawValue(
   if (!value.hasType<std::string>()) {
     return;
   }
-  auto stringValue = (std::string)value;
+  std::string storage;
+  auto stringValue = value.getStringView(storage);
   if (stringValue == "flex") {
     result = yoga::Display::Flex;
     return;
@@ -451,7 +460,8 @@ inline void fromRawValue(
     result = yoga::StyleSizeLength::points((float)value);
     return;
   } else if (value.hasType<std::string>()) {
-    const auto stringValue = (std::string)value;
+    std::string storage;
+    const auto stringValue = value.getStringView(storage);
     if (stringValue == "auto") {
       result = yoga::StyleSizeLength::ofAuto();
       return;
@@ -465,7 +475,8 @@ inline void fromRawValue(
       result = yoga::StyleSizeLength::ofFitContent();
       return;
     } else {
-      auto parsed = parseCSSProperty<CSSNumber, CSSPercentage>(stringValue);
+      auto parsed =
+          parseCSSPropertyCached<CSSNumber, CSSPercentage>(stringValue);
       if (std::holds_alternative<CSSPercentage>(parsed)) {
         result = yoga::StyleSizeLength::percent(
             std::get<CSSPercentage>(parsed).value);
@@ -488,12 +499,14 @@ inline void fromRawValue(
     result = yoga::StyleLength::points((float)value);
     return;
   } else if (value.hasType<std::string>()) {
-    const auto stringValue = (std::string)value;
+    std::string storage;
+    const auto stringValue = value.getStringView(storage);
     if (stringValue == "auto") {
       result = yoga::StyleLength::ofAuto();
       return;
     } else {
-      auto parsed = parseCSSProperty<CSSNumber, CSSPercentage>(stringValue);
+      auto parsed =
+          parseCSSPropertyCached<CSSNumber, CSSPercentage>(stringValue);
       if (std::holds_alternative<CSSPercentage>(parsed)) {
         result =
             yoga::StyleLength::percent(std::get<CSSPercentage>(parsed).value);
@@ -532,7 +545,8 @@ inline std::optional<Float> toRadians(const RawValue& value) {
     return {};
   }
 
-  auto angle = parseCSSProperty<CSSAngle>((std::string)value);
+  std::string storage;
+  auto angle = parseCSSPropertyCached<CSSAngle>(value.getStringView(storage));
   if (std::holds_alternative<CSSAngle>(angle)) {
     return std::get<CSSAngle>(angle).degrees * M_PI / 180.0f;
   }
@@ -548,7 +562,9 @@ inline ValueUnit toValueUnit(const RawValue& value) {
     return {};
   }
 
-  auto pct = parseCSSProperty<CSSPercentage>((std::string)value);
+  std::string storage;
+  auto pct =
+      parseCSSPropertyCached<CSSPercentage>(value.getStringView(storage));
   if (std::holds_alternative<CSSPercentage>(pct)) {
     return ValueUnit(std::get<CSSPercentage>(pct).value, UnitType::Percent);
   }
@@ -827,7 +843,8 @@ inline void fromRawValue(
   if (!value.hasType<std::string>()) {
     return;
   }
-  auto stringValue = (std::string)value;
+  std::string storage;
+  auto stringValue = value.getStringView(storage);
   if (stringValue == "auto") {
     result = PointerEventsMode::Auto;
     return;
@@ -857,7 +874,8 @@ inline void fromRawValue(
   if (!value.hasType<std::string>()) {
     return;
   }
-  auto stringValue = (std::string)value;
+  std::string storage;
+  auto stringValue = value.getStringView(storage);
   if (stringValue == "auto") {
     result = BackfaceVisibility::Auto;
     return;
@@ -883,7 +901,8 @@ inline void fromRawValue(
   if (!value.hasType<std::string>()) {
     return;
   }
-  auto stringValue = (std::string)value;
+  std::string storage;
+  auto stringValue = value.getStringView(storage);
   if (stringValue == "circular") {
     result = BorderCurve::Circular;
     return;
@@ -905,7 +924,8 @@ inline void fromRawValue(
   if (!value.hasType<std::string>()) {
     return;
   }
-  auto stringValue = (std::string)value;
+  std::string storage;
+  auto stringValue = value.getStringView(storage);
   if (stringValue == "solid") {
     result = BorderStyle::Solid;
     return;
@@ -931,7 +951,8 @@ inline void fromRawValue(
   if (!value.hasType<std::string>()) {
     return;
   }
-  auto stringValue = (std::string)value;
+  std::string storage;
+  auto stringValue = value.getStringView(storage);
   if (stringValue == "solid") {
     result = OutlineStyle::Solid;
     return;
@@ -957,7 +978,8 @@ inline void fromRawValue(
   if (!value.hasType<std::string>()) {
     return;
   }
-  auto stringValue = (std::string)value;
+  std::string storage;
+  auto stringValue = value.getStringView(storage);
   if (stringValue == "alias") {
     result = Cursor::Alias;
     return;
@@ -1116,7 +1138,8 @@ inline void fromRawValue(
     return;
   }
 
-  auto stringValue = (std::string)value;
+  std::string storage;
+  auto stringValue = value.getStringView(storage);
   if (stringValue == "strict") {
     result = LayoutConformance::Strict;
   } else if (stringValue == "compatibility") {
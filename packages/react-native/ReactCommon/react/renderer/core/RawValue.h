@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <string>
+#include <string_view>
 #include <unordered_map>
 #include <variant>
 
@@ -156,6 +158,21 @@ class RawValue {
     }
   }
 
+  /*
+   * A view of the stored string, which must be one. A string stored in a
+   * `folly::dynamic` is viewed in place, without a copy. A JavaScript string
+   * is converted into `storage`, which the view then refers to.
+   */
+  std::string_view getStringView(std::string& storage) const {
+    if (std::holds_alternative<folly::dynamic>(value_)) {
+      return std::get<folly::dynamic>(value_).getString();
+    } else {
+      const auto& [runtime, value] = std::get<JsiValuePair>(value_);
+      storage = castValue(runtime, value, (std::string*)nullptr);
+      return storage;
+    }
+  }
+
  private:
   using JsiValuePair = std::pair<jsi::Runtime*, jsi::Value>;
   std::variant<folly::dynamic, JsiValuePair> value_;
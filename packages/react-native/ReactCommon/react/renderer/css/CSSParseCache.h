@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <react/renderer/css/CSSValueParser.h>
+
+namespace facebook::react {
+
+namespace detail {
+
+struct CSSParseCacheHash {
+  using is_transparent = void;
+
+  size_t operator()(std::string_view css) const noexcept {
+    return std::hash<std::string_view>{}(css);
+  }
+};
+
+/*
+ * Thread-safe map from CSS text to the result of parsing it into a given set
+ * of data types. Lookups take a shared lock and do not copy the key.
+ */
+template <typename ResultT>
+class CSSParseCache {
+ public:
+  /*
+   * Upper bound on the number of distinct strings kept per set of data types.
+   * Once it is reached, each new string replaces one which was not looked up
+   * since the eviction hand last passed over it (the CLOCK approximation of
+   * LRU), so strings looked up often stay cached while one-off strings come
+   * and go. Lookups only set a flag, so they keep a shared lock.
+   */
+  static constexpr size_t MaxEntries = 512;
+
+  CSSParseCache() {
+    entries_.reserve(MaxEntries);
+    keys_.reserve(MaxEntries);
+  }
+
+  template <typename ParseFnT>
+  ResultT getOrParse(std::string_view css, ParseFnT&& parse) {
+    {
+      std::shared_lock lock(mutex_);
+      if (auto it = entries_.find(css); it != entries_.end()) {
+        it->second.referenced.store(true, std::memory_order_relaxed);
+        return it->second.result;
+      }
+    }
+
+    auto result = parse(css);
+
+    std::unique_lock lock(mutex_);
+    if (entries_.find(css) != entries_.end()) {
+      // Parsed concurrently by another thread
+      return result;
+    }
+    auto slot = keys_.size();
+    if (slot == MaxEntries) {
+      slot = evict();
+    }
+    auto it = entries_.try_emplace(std::string{css}, result).first;
+    if (slot == keys_.size()) {
+      keys_.emplace_back(it->first);
+    } else {
+      keys_[slot] = it->first;
+    }
+    return result;
+  }
+
+  void clear() {
+    std::unique_lock lock(mutex_);
+    entries_.clear();
+    keys_.clear();
+    hand_ = 0;
+  }
+
+  size_t size() const {
+    std::shared_lock lock(mutex_);
+    return entries_.size();
+  }
+
+ private:
+  struct Entry {
+    explicit Entry(ResultT result) : result(std::move(result)) {}
+
+    ResultT result;
+    // Set by lookups, cleared when the eviction hand passes over the entry
+    std::atomic<bool> referenced{false};
+  };
+
+  /*
+   * Moves the hand to the first entry not looked up since the hand last
+   * passed over it, removes that entry and returns its slot in `keys_`. Must
+   * be called on a full cache, with the lock held exclusively.
+   */
+  size_t evict() {
+    while (true) {
+      auto slot = hand_;
+      hand_ = (hand_ + 1) % MaxEntries;
+      auto it = entries_.find(keys_[slot]);
+      if (!it->second.referenced.exchange(false, std::memory_order_relaxed)) {
+        entries_.erase(it);
+        return slot;
+      }
+    }
+  }
+
+  mutable std::shared_mutex mutex_;
+  std::unordered_map<std::string, Entry, CSSParseCacheHash, std::equal_to<>>
+      entries_;
+  // Keys of `entries_` in the order the eviction hand visits them. Views stay
+  // valid until their entry is erased, as map nodes do not move.
+  std::vector<std::string_view> keys_;
+  size_t hand_{0};
+};
+
+template <CSSMaybeCompoundDataType... AllowedTypesT>
+using CSSParsePropertyResult =
+    decltype(parseCSSProperty<AllowedTypesT...>(std::string_view{}));
+
+/*
+ * Process-wide cache for a set of data types. Intentionally leaked so that
+ * prop parsing on background threads during shutdown never observes a
+ * destroyed cache.
+ */
+template <CSSMaybeCompoundDataType... AllowedTypesT>
+CSSParseCache<CSSParsePropertyResult<AllowedTypesT...>>& getCSSParseCache() {
+  static auto& cache =
+      *new CSSParseCache<CSSParsePropertyResult<AllowedTypesT...>>();
+  return cache;
+}
+
+} // namespace detail
+
+/**
+ * Same as `parseCSSProperty`, but results are memoized process-wide per set of
+ * data types. Meant for prop conversions, which see the same CSS text (e.g.
+ * a `boxShadow` or `filter` string) on every update of every view using it.
+ */
+template <CSSMaybeCompoundDataType... AllowedTypesT>
+auto parseCSSPropertyCached(std::string_view css)
+    -> detail::CSSParsePropertyResult<AllowedTypesT...> {
+  return detail::getCSSParseCache<AllowedTypesT...>().getOrParse(
+      css, [](std::string_view text) {
+        return parseCSSProperty<AllowedTypesT...>(text);
+      });
+}
+
+} // namespace facebook::react
@@ -7,7 +7,9 @@
 
 #pragma once
 
+#include <array>
 #include <cmath>
+#include <cstdint>
 #include <string_view>
 
 #include <fast_float/fast_float.h>
@@ -15,6 +17,47 @@
 
 namespace facebook::react {
 
+namespace detail {
+
+enum CSSCharClass : uint8_t {
+  CSSCharClassDigit = 1 << 0,
+  CSSCharClassIdentStart = 1 << 1,
+  CSSCharClassIdent = 1 << 2,
+  CSSCharClassWhitespace = 1 << 3,
+};
+
+/*
+ * Classes of every byte value, so that the tokenizer's character predicates
+ * (which run for every character of every prop string) are a single load
+ * instead of a chain of range comparisons.
+ */
+inline constexpr std::array<uint8_t, 256> cssCharClasses = [] {
+  std::array<uint8_t, 256> classes{};
+  for (int c = 0; c < 256; c++) {
+    // https://www.w3.org/TR/css-syntax-3/#digit
+    bool isDigit = c >= '0' && c <= '9';
+    // https://www.w3.org/TR/css-syntax-3/#ident-start-code-point
+    bool isIdentStart = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+        c == '_' || c > 0x80;
+    // https://www.w3.org/TR/css-syntax-3/#ident-code-point
+    bool isIdent = isIdentStart || isDigit || c == '-';
+    // https://www.w3.org/TR/css-syntax-3/#whitespace
+    bool isWhitespace = c == ' ' || c == '\t' || c == '\r' || c == '\n';
+
+    classes[c] = (isDigit ? CSSCharClassDigit : 0) |
+        (isIdentStart ? CSSCharClassIdentStart : 0) |
+        (isIdent ? CSSCharClassIdent : 0) |
+        (isWhitespace ? CSSCharClassWhitespace : 0);
+  }
+  return classes;
+}();
+
+constexpr bool hasCSSCharClass(char c, CSSCharClass charClass) {
+  return (cssCharClasses[static_cast<uint8_t>(c)] & charClass) != 0;
+}
+
+} // namespace detail
+
 /**
  * A minimal tokenizer for a subset of CSS syntax.
  *
@@ -211,26 +254,19 @@ class CSSTokenizer {
   }
 
   static constexpr bool isDigit(char c) {
-    // https://www.w3.org/TR/css-syntax-3/#digit
-    return c >= '0' && c <= '9';
+    return detail::hasCSSCharClass(c, detail::CSSCharClassDigit);
   }
 
   static constexpr bool isIdentStart(char c) {
-    // https://www.w3.org/TR/css-syntax-3/#ident-start-code-point
-    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' ||
-        static_cast<unsigned char>(c) > 0x80;
+    return detail::hasCSSCharClass(c, detail::CSSCharClassIdentStart);
   }
 
   static constexpr bool isIdent(char c) {
-    {
-      // https://www.w3.org/TR/css-syntax-3/#ident-code-point
-      return isIdentStart(c) || isDigit(c) || c == '-';
-    }
+    return detail::hasCSSCharClass(c, detail::CSSCharClassIdent);
   }
 
   static constexpr bool isWhitespace(char c) {
-    // https://www.w3.org/TR/css-syntax-3/#whitespace
-    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+    return detail::hasCSSCharClass(c, detail::CSSCharClassWhitespace);
   }
 
   std::string_view remainingCharacters_;
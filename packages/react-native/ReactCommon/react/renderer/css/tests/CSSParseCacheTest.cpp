@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/renderer/css/CSSColor.h>
+#include <react/renderer/css/CSSLength.h>
+#include <react/renderer/css/CSSParseCache.h>
+#include <react/renderer/css/CSSShadow.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace facebook::react {
+
+TEST(CSSParseCache, matches_uncached_parse) {
+  for (const auto* css :
+       {"10px 5px 2px red", "inset 0 0 4px 1px #00000080", "10px 5px,", ""}) {
+    EXPECT_EQ(
+        parseCSSPropertyCached<CSSShadowList>(css),
+        parseCSSProperty<CSSShadowList>(css));
+    // Second lookup is served from the cache
+    EXPECT_EQ(
+        parseCSSPropertyCached<CSSShadowList>(css),
+        parseCSSProperty<CSSShadowList>(css));
+  }
+}
+
+TEST(CSSParseCache, keyed_by_data_types) {
+  auto asColor = parseCSSPropertyCached<CSSColor>("red");
+  auto asLength = parseCSSPropertyCached<CSSLength>("red");
+
+  EXPECT_TRUE(std::holds_alternative<CSSColor>(asColor));
+  EXPECT_TRUE(std::holds_alternative<std::monostate>(asLength));
+}
+
+TEST(CSSParseCache, does_not_retain_input) {
+  auto css = std::string{"20px"};
+  auto first = parseCSSPropertyCached<CSSLength>(css);
+  css = "30px";
+  auto second = parseCSSPropertyCached<CSSLength>(css);
+
+  ASSERT_TRUE(std::holds_alternative<CSSLength>(first));
+  ASSERT_TRUE(std::holds_alternative<CSSLength>(second));
+  EXPECT_EQ(std::get<CSSLength>(first).value, 20.0f);
+  EXPECT_EQ(std::get<CSSLength>(second).value, 30.0f);
+}
+
+TEST(CSSParseCache, bounded_size) {
+  auto& cache = detail::getCSSParseCache<CSSLength>();
+  for (size_t i = 0; i < 2 * cache.MaxEntries; i++) {
+    parseCSSPropertyCached<CSSLength>(std::to_string(i) + "px");
+  }
+  EXPECT_LE(cache.size(), cache.MaxEntries);
+}
+
+TEST(CSSParseCache, keeps_frequent_strings_when_full) {
+  auto cache = detail::CSSParseCache<int>{};
+  auto parseCount = 0;
+  auto parse = [&](std::string_view /*css*/) { return ++parseCount; };
+
+  EXPECT_EQ(cache.getOrParse("frequent", parse), 1);
+  for (size_t i = 0; i < 4 * cache.MaxEntries; i++) {
+    cache.getOrParse(std::to_string(i), parse);
+    EXPECT_EQ(cache.getOrParse("frequent", parse), 1);
+  }
+  EXPECT_EQ(cache.size(), cache.MaxEntries);
+  EXPECT_EQ(parseCount, 1 + 4 * cache.MaxEntries);
+}
+
+TEST(CSSParseCache, concurrent_lookups) {
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([] {
+      for (int i = 0; i < 1000; i++) {
+        auto css = std::to_string(i % 64) + "px";
+        auto value = parseCSSPropertyCached<CSSLength>(css);
+        ASSERT_TRUE(std::holds_alternative<CSSLength>(value));
+        ASSERT_EQ(std::get<CSSLength>(value).value, static_cast<float>(i % 64));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+} // namespace facebook::react
@@ -239,4 +239,49 @@ TEST(CSSTokenizer, hash_values) {
       CSSToken{CSSTokenType::Delim, "*"},
       CSSToken{CSSTokenType::EndOfFile});
 }
+
+TEST(CSSTokenizer, long_runs) {
+  EXPECT_TOKENS(
+      "drop-shadow-with-a-very-long-identifier   \t\n  \r   translateX(",
+      CSSToken{CSSTokenType::Ident, "drop-shadow-with-a-very-long-identifier"},
+      CSSToken{CSSTokenType::WhiteSpace},
+      CSSToken{CSSTokenType::Function, "translateX"},
+      CSSToken{CSSTokenType::EndOfFile});
+
+  EXPECT_TOKENS(
+      "12.5pxabcdefghijklmnop%",
+      CSSToken{CSSTokenType::Dimension, 12.5f, "pxabcdefghijklmnop"},
+      CSSToken{CSSTokenType::Delim, "%"},
+      CSSToken{CSSTokenType::EndOfFile});
+}
+
+TEST(CSSTokenizer, char_classes_for_every_byte) {
+  // Characters are classified through a lookup table; every byte value must
+  // end (or continue) a run exactly as the CSS syntax spec describes.
+  for (int c = 1; c < 256; c++) {
+    auto ch = static_cast<char>(c);
+    auto isIdent = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+        (c >= '0' && c <= '9') || c == '_' || c == '-' || c > 0x80;
+    auto isWhitespace = c == ' ' || c == '\t' || c == '\r' || c == '\n';
+
+    auto ident = std::string(9, 'a') + ch + std::string(9, 'a');
+    CSSTokenizer identTokenizer{ident};
+    auto identToken = identTokenizer.next();
+    EXPECT_EQ(
+        identToken.type(),
+        c == '(' ? CSSTokenType::Function : CSSTokenType::Ident)
+        << c;
+    EXPECT_EQ(identToken.stringValue().size(), isIdent ? 19u : 9u) << c;
+
+    auto whitespace = std::string(9, ' ') + ch + std::string(9, ' ');
+    CSSTokenizer whitespaceTokenizer{whitespace};
+    EXPECT_EQ(whitespaceTokenizer.next().type(), CSSTokenType::WhiteSpace)
+        << c;
+    EXPECT_EQ(
+        whitespaceTokenizer.next().type() == CSSTokenType::EndOfFile,
+        isWhitespace)
+        << c;
+  }
+}
+
 } // namespace facebook::react
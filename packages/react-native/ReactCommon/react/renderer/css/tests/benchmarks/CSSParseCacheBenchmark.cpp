@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/css/CSSColor.h>
+#include <react/renderer/css/CSSFilter.h>
+#include <react/renderer/css/CSSNumber.h>
+#include <react/renderer/css/CSSParseCache.h>
+#include <react/renderer/css/CSSPercentage.h>
+#include <react/renderer/css/CSSShadow.h>
+#include <string_view>
+
+namespace facebook::react {
+
+namespace {
+
+// String-valued style props as they show up in a list of cards, where each
+// row carries the same shadow, filter, colors and percentage sizes.
+constexpr std::string_view boxShadows[] = {
+    "0 1px 3px rgba(0, 0, 0, 0.12), 0 1px 2px rgba(0, 0, 0, 0.24)",
+    "inset 0 0 0 1px #e4e6eb",
+    "0 8px 24px -4px hsla(220, 20%, 10%, 0.25)",
+};
+
+constexpr std::string_view filters[] = {
+    "blur(4px) brightness(0.9)",
+    "drop-shadow(0 2px 4px rgba(0, 0, 0, 0.3)) saturate(120%)",
+    "grayscale(1) opacity(50%)",
+};
+
+constexpr std::string_view colors[] = {
+    "#1877f2",
+    "rgba(255, 255, 255, 0.85)",
+    "rebeccapurple",
+    "hsl(210, 50%, 40%)",
+};
+
+constexpr std::string_view sizes[] = {"100%", "50%", "33.333%", "12"};
+
+template <typename ParseFnT>
+void parseStylePayload(ParseFnT&& parse) {
+  for (auto css : boxShadows) {
+    benchmark::DoNotOptimize(parse.template operator()<CSSShadowList>(css));
+  }
+  for (auto css : filters) {
+    benchmark::DoNotOptimize(parse.template operator()<CSSFilterList>(css));
+  }
+  for (auto css : colors) {
+    benchmark::DoNotOptimize(parse.template operator()<CSSColor>(css));
+  }
+  for (auto css : sizes) {
+    benchmark::DoNotOptimize(
+        parse.template operator()<CSSNumber, CSSPercentage>(css));
+  }
+}
+
+} // namespace
+
+static void parseStylePayloadUncached(benchmark::State& state) {
+  for (auto _ : state) {
+    parseStylePayload([]<typename... AllowedTypesT>(std::string_view css) {
+      return parseCSSProperty<AllowedTypesT...>(css);
+    });
+  }
+}
+BENCHMARK(parseStylePayloadUncached);
+
+static void parseStylePayloadCached(benchmark::State& state) {
+  for (auto _ : state) {
+    parseStylePayload([]<typename... AllowedTypesT>(std::string_view css) {
+      return parseCSSPropertyCached<AllowedTypesT...>(css);
+    });
+  }
+}
+BENCHMARK(parseStylePayloadCached);
+
+static void parseStylePayloadCachedMultiThreaded(benchmark::State& state) {
+  for (auto _ : state) {
+    parseStylePayload([]<typename... AllowedTypesT>(std::string_view css) {
+      return parseCSSPropertyCached<AllowedTypesT...>(css);
+    });
+  }
+}
+BENCHMARK(parseStylePayloadCachedMultiThreaded)->Threads(4);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
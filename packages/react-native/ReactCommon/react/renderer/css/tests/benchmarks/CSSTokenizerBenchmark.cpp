@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/css/CSSTokenizer.h>
+#include <string_view>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr std::string_view transformList =
+    "perspective(1000px) translateX(-12.5px) translateY(calc(100% - 4px)) "
+    "rotateX(15deg) rotateY(-7.25deg) rotateZ(0.5turn) scaleX(1.05) "
+    "scaleY(0.95) skewX(3deg) skewY(-2deg) matrix(1, 0, 0, 1, 24, 48)";
+
+constexpr std::string_view filterList =
+    "drop-shadow(0 2px 4px rgba(0, 0, 0, 0.3)) blur(2px) brightness(110%) "
+    "contrast(95%) grayscale(0.25) hue-rotate(45deg) saturate(1.2) "
+    "sepia(10%) opacity(90%) invert(0)";
+
+constexpr std::string_view gradient =
+    "linear-gradient(to bottom right, rebeccapurple 0%, "
+    "cornflowerblue 25%, lightgoldenrodyellow 50%, mediumseagreen 75%, "
+    "transparent 100%)";
+
+constexpr std::string_view boxShadowList =
+    "inset 0 0 0 1px rgba(255, 255, 255, 0.12),     "
+    "0 1px 3px rgba(0, 0, 0, 0.12),\n    0 1px 2px rgba(0, 0, 0, 0.24),\n"
+    "0 14px 28px -6px hsla(220, 20%, 10%, 0.25)";
+
+void tokenize(benchmark::State& state, std::string_view css) {
+  for (auto _ : state) {
+    CSSTokenizer tokenizer{css};
+    while (tokenizer.next().type() != CSSTokenType::EndOfFile) {
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(
+      static_cast<int64_t>(state.iterations() * css.size()));
+}
+
+} // namespace
+
+static void tokenizeTransformList(benchmark::State& state) {
+  tokenize(state, transformList);
+}
+BENCHMARK(tokenizeTransformList);
+
+static void tokenizeFilterList(benchmark::State& state) {
+  tokenize(state, filterList);
+}
+BENCHMARK(tokenizeFilterList);
+
+static void tokenizeGradient(benchmark::State& state) {
+  tokenize(state, gradient);
+}
+BENCHMARK(tokenizeGradient);
+
+static void tokenizeBoxShadowList(benchmark::State& state) {
+  tokenize(state, boxShadowList);
+}
+BENCHMARK(tokenizeBoxShadowList);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
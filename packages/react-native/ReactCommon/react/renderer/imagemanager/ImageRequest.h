@@ -34,6 +34,16 @@ class ImageRequest final {
       SharedFunction<> resumeFunction = {},
       SharedFunction<> cancelationFunction = {});
 
+  /*
+   * Creates a request which observes the same response as other requests
+   * sharing `coordinator` (e.g. when concurrent requests for the same image
+   * are coalesced).
+   */
+  ImageRequest(
+      ImageSource imageSource,
+      std::shared_ptr<const ImageTelemetry> telemetry,
+      std::shared_ptr<const ImageResponseObserverCoordinator> coordinator);
+
   /*
    * The move constructor.
    */
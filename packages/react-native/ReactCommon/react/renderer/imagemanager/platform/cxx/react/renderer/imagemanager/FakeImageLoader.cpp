@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "FakeImageLoader.h"
+
+#include <thread>
+
+namespace facebook::react {
+
+FakeImageLoader::FakeImageLoader(
+    Size defaultSize,
+    std::chrono::microseconds latency)
+    : defaultSize_(defaultSize), latency_(latency) {}
+
+void FakeImageLoader::setImageSize(const std::string& uri, Size size) {
+  std::scoped_lock lock(mutex_);
+  sizes_[uri] = size;
+}
+
+void FakeImageLoader::setFailure(const std::string& uri) {
+  std::scoped_lock lock(mutex_);
+  failures_.insert(uri);
+}
+
+size_t FakeImageLoader::getLoadCount() const {
+  std::scoped_lock lock(mutex_);
+  return loadCount_;
+}
+
+size_t FakeImageLoader::getLoadCount(const std::string& uri) const {
+  std::scoped_lock lock(mutex_);
+  auto iterator = loadCounts_.find(uri);
+  return iterator != loadCounts_.end() ? iterator->second : 0;
+}
+
+ImageLoadResult FakeImageLoader::loadImage(
+    const ImageSource& imageSource) const {
+  if (latency_.count() > 0) {
+    std::this_thread::sleep_for(latency_);
+  }
+
+  auto size = defaultSize_;
+  {
+    std::scoped_lock lock(mutex_);
+    loadCount_++;
+    loadCounts_[imageSource.uri]++;
+    if (failures_.contains(imageSource.uri)) {
+      return ImageLoadResult{
+          .image = nullptr,
+          .error = {.error = "Failed to load " + imageSource.uri}};
+    }
+    auto iterator = sizes_.find(imageSource.uri);
+    if (iterator != sizes_.end()) {
+      size = iterator->second;
+    }
+  }
+
+  return ImageLoadResult{
+      .image = std::make_shared<const LoadedImage>(LoadedImage{
+          .size = size,
+          .mimeType = "image/png",
+          .byteSize = static_cast<size_t>(size.width * size.height * 4)}),
+      .error = {}};
+}
+
+} // namespace facebook::react
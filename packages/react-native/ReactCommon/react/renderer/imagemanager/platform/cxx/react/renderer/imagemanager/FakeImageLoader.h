@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/imagemanager/ImageLoader.h>
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace facebook::react {
+
+/*
+ * An in-process image loader for tests and load testing, which "loads" any
+ * URI as an image of a default size after an optional latency, without
+ * touching the file system or the network.
+ */
+class FakeImageLoader final : public ImageLoader {
+ public:
+  explicit FakeImageLoader(
+      Size defaultSize = {.width = 100, .height = 100},
+      std::chrono::microseconds latency = {});
+
+  /*
+   * Makes `uri` load as an image of `size`.
+   */
+  void setImageSize(const std::string& uri, Size size);
+
+  /*
+   * Makes loads of `uri` fail.
+   */
+  void setFailure(const std::string& uri);
+
+  /*
+   * Returns how many times an image was loaded.
+   */
+  size_t getLoadCount() const;
+  size_t getLoadCount(const std::string& uri) const;
+
+  ImageLoadResult loadImage(const ImageSource& imageSource) const override;
+
+ private:
+  const Size defaultSize_;
+  const std::chrono::microseconds latency_;
+
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, Size> sizes_;
+  std::unordered_set<std::string> failures_;
+  mutable std::unordered_map<std::string, size_t> loadCounts_;
+  mutable size_t loadCount_{0};
+};
+
+} // namespace facebook::react
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "FileImageLoader.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string_view>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr std::string_view kFileScheme = "file://";
+
+uint32_t readBigEndian(std::span<const uint8_t> data, size_t offset, int size) {
+  uint32_t value = 0;
+  for (int i = 0; i < size; i++) {
+    value = (value << 8) | data[offset + i];
+  }
+  return value;
+}
+
+uint32_t
+readLittleEndian(std::span<const uint8_t> data, size_t offset, int size) {
+  uint32_t value = 0;
+  for (int i = size - 1; i >= 0; i--) {
+    value = (value << 8) | data[offset + i];
+  }
+  return value;
+}
+
+bool startsWith(std::span<const uint8_t> data, std::string_view prefix) {
+  if (data.size() < prefix.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < prefix.size(); i++) {
+    if (data[i] != static_cast<uint8_t>(prefix[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool hasTagAt(
+    std::span<const uint8_t> data,
+    size_t offset,
+    std::string_view tag) {
+  return offset <= data.size() && startsWith(data.subspan(offset), tag);
+}
+
+std::shared_ptr<const LoadedImage>
+makeImage(uint32_t width, uint32_t height, std::string mimeType) {
+  if (width == 0 || height == 0) {
+    return nullptr;
+  }
+  return std::make_shared<const LoadedImage>(LoadedImage{
+      .size =
+          {.width = static_cast<Float>(width),
+           .height = static_cast<Float>(height)},
+      .mimeType = std::move(mimeType),
+      .byteSize = size_t{width} * height * 4});
+}
+
+/*
+ * Finds the first start of frame segment of a JPEG image, which holds its
+ * size.
+ */
+std::shared_ptr<const LoadedImage> readJpegHeader(
+    std::span<const uint8_t> data) {
+  size_t offset = 2;
+  while (offset + 9 <= data.size()) {
+    if (data[offset] != 0xFF) {
+      return nullptr;
+    }
+    uint8_t marker = data[offset + 1];
+    if (marker == 0xFF) {
+      // Fill byte
+      offset++;
+      continue;
+    }
+    if (marker == 0x01 || (marker >= 0xD0 && marker <= 0xD8)) {
+      // Markers without a segment
+      offset += 2;
+      continue;
+    }
+    bool isStartOfFrame = marker >= 0xC0 && marker <= 0xCF &&
+        marker != 0xC4 && marker != 0xC8 && marker != 0xCC;
+    if (isStartOfFrame) {
+      return makeImage(
+          readBigEndian(data, offset + 7, 2),
+          readBigEndian(data, offset + 5, 2),
+          "image/jpeg");
+    }
+    offset += 2 + readBigEndian(data, offset + 2, 2);
+  }
+  return nullptr;
+}
+
+std::shared_ptr<const LoadedImage> readWebpHeader(
+    std::span<const uint8_t> data) {
+  if (data.size() < 30) {
+    return nullptr;
+  }
+  if (hasTagAt(data, 12, "VP8 ")) {
+    // Lossy: 14 bits per dimension after the frame tag and start code
+    return makeImage(
+        readLittleEndian(data, 26, 2) & 0x3FFF,
+        readLittleEndian(data, 28, 2) & 0x3FFF,
+        "image/webp");
+  }
+  if (hasTagAt(data, 12, "VP8L")) {
+    // Lossless: 14 bits per dimension minus one after the signature
+    auto bits = readLittleEndian(data, 21, 4);
+    return makeImage(
+        (bits & 0x3FFF) + 1, ((bits >> 14) & 0x3FFF) + 1, "image/webp");
+  }
+  if (hasTagAt(data, 12, "VP8X")) {
+    // Extended: 24 bits per dimension minus one
+    return makeImage(
+        readLittleEndian(data, 24, 3) + 1,
+        readLittleEndian(data, 27, 3) + 1,
+        "image/webp");
+  }
+  return nullptr;
+}
+
+} // namespace
+
+/* static */ std::shared_ptr<const LoadedImage>
+FileImageLoader::readImageHeader(std::span<const uint8_t> data) {
+  if (startsWith(data, "\x89PNG\r\n\x1A\n")) {
+    if (data.size() < 24 || !hasTagAt(data, 12, "IHDR")) {
+      return nullptr;
+    }
+    return makeImage(
+        readBigEndian(data, 16, 4), readBigEndian(data, 20, 4), "image/png");
+  }
+  if (startsWith(data, "GIF87a") || startsWith(data, "GIF89a")) {
+    if (data.size() < 10) {
+      return nullptr;
+    }
+    return makeImage(
+        readLittleEndian(data, 6, 2),
+        readLittleEndian(data, 8, 2),
+        "image/gif");
+  }
+  if (startsWith(data, "\xFF\xD8")) {
+    return readJpegHeader(data);
+  }
+  if (startsWith(data, "BM")) {
+    if (data.size() < 26) {
+      return nullptr;
+    }
+    // Images stored top-down have a negative height
+    auto height = static_cast<int32_t>(readLittleEndian(data, 22, 4));
+    return makeImage(
+        readLittleEndian(data, 18, 4),
+        static_cast<uint32_t>(std::abs(height)),
+        "image/bmp");
+  }
+  if (startsWith(data, "RIFF") && hasTagAt(data, 8, "WEBP")) {
+    return readWebpHeader(data);
+  }
+  return nullptr;
+}
+
+ImageLoadResult FileImageLoader::loadImage(
+    const ImageSource& imageSource) const {
+  std::string_view path = imageSource.uri;
+  if (path.starts_with(kFileScheme)) {
+    path.remove_prefix(kFileScheme.size());
+  } else if (!path.starts_with('/')) {
+    return ImageLoadResult{
+        .image = nullptr,
+        .error = {.error = "Unsupported image URI: " + imageSource.uri}};
+  }
+
+  std::ifstream file{std::string(path), std::ios::binary};
+  if (!file) {
+    return ImageLoadResult{
+        .image = nullptr,
+        .error = {.error = "Could not open image file: " + std::string(path)}};
+  }
+  std::vector<uint8_t> data(
+      (std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+  auto image = readImageHeader(data);
+  if (!image) {
+    return ImageLoadResult{
+        .image = nullptr,
+        .error = {.error = "Unsupported image format: " + std::string(path)}};
+  }
+  return ImageLoadResult{.image = std::move(image), .error = {}};
+}
+
+} // namespace facebook::react
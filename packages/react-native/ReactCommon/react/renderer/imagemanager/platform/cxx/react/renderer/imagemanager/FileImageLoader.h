@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/imagemanager/ImageLoader.h>
+
+#include <cstdint>
+#include <span>
+
+namespace facebook::react {
+
+/*
+ * Loads images from local files, given as absolute paths or `file://` URIs.
+ * The size of the image is read from the header of the file, which can be a
+ * PNG, JPEG, GIF, BMP or WebP image.
+ */
+class FileImageLoader final : public ImageLoader {
+ public:
+  ImageLoadResult loadImage(const ImageSource& imageSource) const override;
+
+  /*
+   * Reads the format and the size of the image stored in `data`, or returns
+   * nullptr if it is not an image of a supported format.
+   */
+  static std::shared_ptr<const LoadedImage> readImageHeader(
+      std::span<const uint8_t> data);
+};
+
+} // namespace facebook::react
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ImageCache.h"
+
+namespace facebook::react {
+
+ImageCache::ImageCache(size_t maximumByteSize)
+    : maximumByteSize_(maximumByteSize) {}
+
+std::shared_ptr<const LoadedImage> ImageCache::get(
+    const ImageSource& imageSource) {
+  auto iterator = index_.find(imageSource);
+  if (iterator == index_.end()) {
+    return nullptr;
+  }
+  entries_.splice(entries_.begin(), entries_, iterator->second);
+  return iterator->second->image;
+}
+
+void ImageCache::set(
+    const ImageSource& imageSource,
+    std::shared_ptr<const LoadedImage> image) {
+  auto iterator = index_.find(imageSource);
+  if (iterator != index_.end()) {
+    evict(iterator->second);
+  }
+  if (image->byteSize > maximumByteSize_) {
+    return;
+  }
+
+  while (byteSize_ + image->byteSize > maximumByteSize_) {
+    evict(std::prev(entries_.end()));
+  }
+  byteSize_ += image->byteSize;
+  entries_.push_front(Entry{.imageSource = imageSource, .image = image});
+  index_.emplace(imageSource, entries_.begin());
+}
+
+size_t ImageCache::getByteSize() const {
+  return byteSize_;
+}
+
+size_t ImageCache::size() const {
+  return entries_.size();
+}
+
+void ImageCache::evict(std::list<Entry>::iterator iterator) {
+  byteSize_ -= iterator->image->byteSize;
+  index_.erase(iterator->imageSource);
+  entries_.erase(iterator);
+}
+
+} // namespace facebook::react
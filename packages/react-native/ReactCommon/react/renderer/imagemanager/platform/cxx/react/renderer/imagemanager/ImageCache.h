@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/imagemanager/ImageLoader.h>
+
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+namespace facebook::react {
+
+/*
+ * Least recently used cache of loaded images, bounded by the sum of their
+ * `byteSize`s. An image larger than the whole cache is not cached.
+ * Not thread-safe.
+ */
+class ImageCache final {
+ public:
+  explicit ImageCache(size_t maximumByteSize);
+
+  /*
+   * Returns the image loaded for `imageSource` and marks it as the most
+   * recently used, or returns nullptr if it is not in the cache.
+   */
+  std::shared_ptr<const LoadedImage> get(const ImageSource& imageSource);
+
+  /*
+   * Adds the image loaded for `imageSource`, evicting the least recently
+   * used images until the cache fits in its maximum size.
+   */
+  void set(
+      const ImageSource& imageSource,
+      std::shared_ptr<const LoadedImage> image);
+
+  size_t getByteSize() const;
+  size_t size() const;
+
+ private:
+  struct Entry {
+    ImageSource imageSource;
+    std::shared_ptr<const LoadedImage> image;
+  };
+
+  void evict(std::list<Entry>::iterator iterator);
+
+  const size_t maximumByteSize_;
+  size_t byteSize_{0};
+
+  // Most recently used first
+  std::list<Entry> entries_;
+  std::unordered_map<ImageSource, std::list<Entry>::iterator> index_;
+};
+
+} // namespace facebook::react
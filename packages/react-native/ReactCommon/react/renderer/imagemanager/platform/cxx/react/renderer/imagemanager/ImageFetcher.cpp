@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ImageFetcher.h"
+
+#include <react/renderer/imagemanager/ImageCache.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr size_t kMaximumDefaultWorkerCount = 4;
+
+ImageResponse makeImageResponse(std::shared_ptr<const LoadedImage> image) {
+  return ImageResponse{
+      std::const_pointer_cast<LoadedImage>(std::move(image)), nullptr};
+}
+
+} // namespace
+
+struct ImageFetcher::Load {
+  enum class Status { Queued, Running, Cancelled, Finished };
+
+  explicit Load(ImageSource imageSource)
+      : imageSource(std::move(imageSource)) {}
+
+  const ImageSource imageSource;
+
+  /*
+   * Mutable: protected by State::mutex.
+   */
+  Status status{Status::Queued};
+  std::weak_ptr<const ImageResponseObserverCoordinator> coordinator;
+};
+
+struct ImageFetcher::State {
+  State(ImageLoader::Shared imageLoader, size_t maximumCacheByteSize)
+      : imageLoader(std::move(imageLoader)), cache(maximumCacheByteSize) {}
+
+  const ImageLoader::Shared imageLoader;
+
+  /*
+   * Protects everything below, and the status and coordinator of loads.
+   */
+  std::mutex mutex;
+  ImageCache cache;
+
+  // Loads which are queued or running, by image source
+  std::unordered_map<ImageSource, std::shared_ptr<Load>> loads;
+
+  std::deque<std::shared_ptr<Load>> queue;
+  std::condition_variable queueCondition;
+  bool isStopped{false};
+
+  Statistics statistics{};
+};
+
+ImageFetcher::ImageFetcher(
+    ImageLoader::Shared imageLoader,
+    size_t maximumCacheByteSize,
+    size_t workerCount)
+    : state_(std::make_shared<State>(
+          std::move(imageLoader),
+          maximumCacheByteSize)) {
+  if (workerCount == 0) {
+    workerCount = std::clamp<size_t>(
+        std::thread::hardware_concurrency(), 1, kMaximumDefaultWorkerCount);
+  }
+  workers_.reserve(workerCount);
+  for (size_t i = 0; i < workerCount; i++) {
+    workers_.emplace_back([state = state_]() { runWorker(state); });
+  }
+}
+
+ImageFetcher::~ImageFetcher() {
+  {
+    std::scoped_lock lock(state_->mutex);
+    state_->isStopped = true;
+  }
+  state_->queueCondition.notify_all();
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+}
+
+ImageRequest ImageFetcher::requestImage(
+    const ImageSource& imageSource,
+    SurfaceId /*surfaceId*/) const {
+  std::unique_lock lock(state_->mutex);
+  auto& statistics = state_->statistics;
+  statistics.requestCount++;
+
+  if (auto image = state_->cache.get(imageSource)) {
+    statistics.cacheHitCount++;
+    lock.unlock();
+    auto imageRequest = ImageRequest(imageSource, nullptr);
+    imageRequest.getObserverCoordinator().nativeImageResponseComplete(
+        makeImageResponse(std::move(image)));
+    return imageRequest;
+  }
+
+  std::shared_ptr<Load> load;
+  auto iterator = state_->loads.find(imageSource);
+  if (iterator != state_->loads.end()) {
+    load = iterator->second;
+    if (auto coordinator = load->coordinator.lock()) {
+      statistics.coalescedRequestCount++;
+      return ImageRequest(imageSource, nullptr, std::move(coordinator));
+    }
+    // All the requests which shared the load were destroyed: the load is
+    // taken over by a new coordinator.
+  } else {
+    load = std::make_shared<Load>(imageSource);
+    state_->loads.emplace(imageSource, load);
+    state_->queue.push_back(load);
+    state_->queueCondition.notify_one();
+  }
+
+  auto weakState = std::weak_ptr<State>(state_);
+  auto imageRequest = ImageRequest(
+      imageSource,
+      nullptr,
+      SharedFunction<>([weakState, load]() {
+        if (auto state = weakState.lock()) {
+          resumeLoad(*state, load);
+        }
+      }),
+      SharedFunction<>([weakState, load]() {
+        if (auto state = weakState.lock()) {
+          cancelLoad(*state, load);
+        }
+      }));
+  load->coordinator = imageRequest.getSharedObserverCoordinator();
+  return imageRequest;
+}
+
+ImageFetcher::Statistics ImageFetcher::getStatistics() const {
+  std::scoped_lock lock(state_->mutex);
+  return state_->statistics;
+}
+
+/* static */ void ImageFetcher::runWorker(const std::shared_ptr<State>& state) {
+  while (true) {
+    std::shared_ptr<Load> load;
+    {
+      std::unique_lock lock(state->mutex);
+      state->queueCondition.wait(
+          lock, [&]() { return state->isStopped || !state->queue.empty(); });
+      if (state->isStopped) {
+        return;
+      }
+      load = std::move(state->queue.front());
+      state->queue.pop_front();
+      // Cancelled loads, and loads which were queued again after they were
+      // resumed, are skipped
+      if (load->status != Load::Status::Queued) {
+        continue;
+      }
+      load->status = Load::Status::Running;
+      state->statistics.loadCount++;
+    }
+
+    auto result = state->imageLoader->loadImage(load->imageSource);
+
+    std::shared_ptr<const ImageResponseObserverCoordinator> coordinator;
+    {
+      std::scoped_lock lock(state->mutex);
+      load->status = Load::Status::Finished;
+      if (result.image) {
+        state->cache.set(load->imageSource, result.image);
+      }
+      auto iterator = state->loads.find(load->imageSource);
+      if (iterator != state->loads.end() && iterator->second == load) {
+        state->loads.erase(iterator);
+      }
+      coordinator = load->coordinator.lock();
+    }
+
+    if (!coordinator) {
+      continue;
+    }
+    if (result.image) {
+      coordinator->nativeImageResponseComplete(
+          makeImageResponse(std::move(result.image)));
+    } else {
+      coordinator->nativeImageResponseFailed(ImageLoadError{
+          std::make_shared<ImageErrorInfo>(std::move(result.error))});
+    }
+  }
+}
+
+/*
+ * Called by the coordinator of the load, with its lock held, when its last
+ * observer is removed.
+ */
+/* static */ void ImageFetcher::cancelLoad(
+    State& state,
+    const std::shared_ptr<Load>& load) {
+  std::scoped_lock lock(state.mutex);
+  if (load->status != Load::Status::Queued) {
+    // Running loads complete, so that their image is cached
+    return;
+  }
+  load->status = Load::Status::Cancelled;
+  auto iterator = state.loads.find(load->imageSource);
+  if (iterator != state.loads.end() && iterator->second == load) {
+    state.loads.erase(iterator);
+  }
+}
+
+/*
+ * Called by the coordinator of a cancelled load when an observer is added.
+ */
+/* static */ void ImageFetcher::resumeLoad(
+    State& state,
+    const std::shared_ptr<Load>& load) {
+  {
+    std::scoped_lock lock(state.mutex);
+    if (load->status != Load::Status::Cancelled || state.isStopped) {
+      return;
+    }
+    load->status = Load::Status::Queued;
+    state.loads.try_emplace(load->imageSource, load);
+    state.queue.push_back(load);
+  }
+  state.queueCondition.notify_one();
+}
+
+} // namespace facebook::react
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/core/ReactPrimitives.h>
+#include <react/renderer/imagemanager/ImageLoader.h>
+#include <react/renderer/imagemanager/ImageRequest.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Requests images from an ImageLoader on a pool of worker threads.
+ *
+ * Concurrent requests for the same image source share one load and one
+ * ImageResponseObserverCoordinator. Loaded images are kept in an ImageCache,
+ * so requests for cached images complete immediately. A load which all
+ * observers stopped observing before it started is cancelled, and resumed if
+ * an observer comes back.
+ */
+class ImageFetcher final {
+ public:
+  static constexpr size_t DefaultMaximumCacheByteSize = 64 * 1024 * 1024;
+
+  /*
+   * Counters of what happened to requests, e.g. to measure request fan-out
+   * in load tests.
+   */
+  struct Statistics {
+    size_t requestCount;
+    // Requests for images which were in the cache
+    size_t cacheHitCount;
+    // Requests which joined the load of another request
+    size_t coalescedRequestCount;
+    // Loads which the image loader performed
+    size_t loadCount;
+  };
+
+  /*
+   * Loads images with `imageLoader` on `workerCount` threads (by default,
+   * up to 4 depending on the hardware).
+   */
+  explicit ImageFetcher(
+      ImageLoader::Shared imageLoader,
+      size_t maximumCacheByteSize = DefaultMaximumCacheByteSize,
+      size_t workerCount = 0);
+
+  /*
+   * Stops the workers. Loads which were not finished never complete.
+   */
+  ~ImageFetcher();
+
+  ImageFetcher(const ImageFetcher&) = delete;
+  ImageFetcher& operator=(const ImageFetcher&) = delete;
+
+  ImageRequest requestImage(
+      const ImageSource& imageSource,
+      SurfaceId surfaceId) const;
+
+  Statistics getStatistics() const;
+
+ private:
+  struct Load;
+  struct State;
+
+  static void runWorker(const std::shared_ptr<State>& state);
+  static void cancelLoad(State& state, const std::shared_ptr<Load>& load);
+  static void resumeLoad(State& state, const std::shared_ptr<Load>& load);
+
+  // Shared with the workers and, weakly, with the coordinators of requests,
+  // which can outlive the fetcher
+  std::shared_ptr<State> state_;
+  std::vector<std::thread> workers_;
+};
+
+} // namespace facebook::react
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/graphics/Size.h>
+#include <react/renderer/imagemanager/primitives.h>
+
+#include <memory>
+#include <string>
+
+namespace facebook::react {
+
+/*
+ * An image loaded by an ImageLoader. Headless builds don't draw images, so
+ * only what layout and load testing need is kept: the size and format of the
+ * image, not its pixels.
+ */
+struct LoadedImage {
+  /*
+   * Size of the image, in pixels.
+   */
+  Size size;
+
+  std::string mimeType;
+
+  /*
+   * Memory the decoded image would take, which is what bounds the image
+   * cache (as it would on platforms which keep bitmaps).
+   */
+  size_t byteSize{};
+};
+
+struct ImageLoadResult {
+  /*
+   * The image, or nullptr if it could not be loaded.
+   */
+  std::shared_ptr<const LoadedImage> image;
+
+  ImageErrorInfo error;
+};
+
+/*
+ * Loads images for the ImageManager of the cxx platform. Loaders are called
+ * on the worker threads of the ImageManager, so they must be thread-safe.
+ *
+ * To use a custom loader, store it in the ContextContainer passed to the
+ * ImageManager under `ImageLoader::ContextContainerKey`. Images are loaded
+ * from local files by default.
+ */
+class ImageLoader {
+ public:
+  using Shared = std::shared_ptr<const ImageLoader>;
+
+  static constexpr const char* ContextContainerKey = "ImageLoader";
+
+  virtual ~ImageLoader() = default;
+
+  /*
+   * Loads `imageSource` synchronously.
+   */
+  virtual ImageLoadResult loadImage(const ImageSource& imageSource) const = 0;
+};
+
+} // namespace facebook::react
@@ -7,17 +7,32 @@
 
 #include "ImageManager.h"
 
+#include "FileImageLoader.h"
+#include "ImageFetcher.h"
+
 namespace facebook::react {
 
-ImageManager::ImageManager(
-    const ContextContainer::Shared& /*contextContainer*/) {
-  // Silence unused-private-field warning.
-  (void)self_;
-  // Not implemented.
+namespace {
+
+ImageLoader::Shared getImageLoader(
+    const ContextContainer::Shared& contextContainer) {
+  if (contextContainer) {
+    auto imageLoader = contextContainer->find<ImageLoader::Shared>(
+        ImageLoader::ContextContainerKey);
+    if (imageLoader.has_value() && *imageLoader) {
+      return *imageLoader;
+    }
+  }
+  return std::make_shared<const FileImageLoader>();
 }
 
+} // namespace
+
+ImageManager::ImageManager(const ContextContainer::Shared& contextContainer)
+    : self_(new ImageFetcher(getImageLoader(contextContainer))) {}
+
 ImageManager::~ImageManager() {
-  // Not implemented.
+  delete static_cast<ImageFetcher*>(self_);
 }
 
 ImageRequest ImageManager::requestImage(
@@ -28,11 +43,11 @@ ImageRequest ImageManager::requestImage(
 
 ImageRequest ImageManager::requestImage(
     const ImageSource& imageSource,
-    SurfaceId /*surfaceId*/,
+    SurfaceId surfaceId,
     const ImageRequestParams& /*imageRequestParams*/,
     Tag /*tag*/) const {
-  // Not implemented.
-  return {imageSource, nullptr, {}};
+  return static_cast<const ImageFetcher*>(self_)->requestImage(
+      imageSource, surfaceId);
 }
 
 } // namespace facebook::react
@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/imagemanager/FakeImageLoader.h>
+#include <react/renderer/imagemanager/FileImageLoader.h>
+#include <react/renderer/imagemanager/ImageCache.h>
+#include <react/renderer/imagemanager/ImageFetcher.h>
+
+using namespace facebook::react;
+
+namespace {
+
+ImageSource makeImageSource(std::string uri) {
+  return ImageSource{.type = ImageSource::Type::Remote, .uri = std::move(uri)};
+}
+
+std::shared_ptr<const LoadedImage> makeImage(size_t byteSize) {
+  return std::make_shared<const LoadedImage>(LoadedImage{
+      .size = {.width = 1, .height = 1},
+      .mimeType = "image/png",
+      .byteSize = byteSize});
+}
+
+class TestImageResponseObserver : public ImageResponseObserver {
+ public:
+  void didReceiveProgress(float /*progress*/, int64_t /*loaded*/, int64_t
+                          /*total*/) const override {}
+
+  void didReceiveImage(const ImageResponse& imageResponse) const override {
+    std::scoped_lock lock(mutex_);
+    image_ = std::static_pointer_cast<const LoadedImage>(
+        imageResponse.getImage());
+    responseCount_++;
+    condition_.notify_all();
+  }
+
+  void didReceiveFailure(const ImageLoadError& error) const override {
+    std::scoped_lock lock(mutex_);
+    error_ = std::static_pointer_cast<const ImageErrorInfo>(error.getError());
+    responseCount_++;
+    condition_.notify_all();
+  }
+
+  /*
+   * Waits for a response, and returns whether one was received.
+   */
+  bool waitForResponse() const {
+    std::unique_lock lock(mutex_);
+    return condition_.wait_for(lock, std::chrono::seconds(5), [&]() {
+      return responseCount_ > 0;
+    });
+  }
+
+  std::shared_ptr<const LoadedImage> getImage() const {
+    std::scoped_lock lock(mutex_);
+    return image_;
+  }
+
+  std::shared_ptr<const ImageErrorInfo> getError() const {
+    std::scoped_lock lock(mutex_);
+    return error_;
+  }
+
+  size_t getResponseCount() const {
+    std::scoped_lock lock(mutex_);
+    return responseCount_;
+  }
+
+ private:
+  mutable std::mutex mutex_;
+  mutable std::condition_variable condition_;
+  mutable std::shared_ptr<const LoadedImage> image_;
+  mutable std::shared_ptr<const ImageErrorInfo> error_;
+  mutable size_t responseCount_{0};
+};
+
+} // namespace
+
+TEST(ImageFetcherTest, testImageCacheEvictsLeastRecentlyUsed) {
+  auto cache = ImageCache(100);
+  cache.set(makeImageSource("a"), makeImage(40));
+  cache.set(makeImageSource("b"), makeImage(40));
+  EXPECT_EQ(cache.getByteSize(), 80);
+
+  // Using "a" makes "b" the least recently used
+  EXPECT_NE(cache.get(makeImageSource("a")), nullptr);
+  cache.set(makeImageSource("c"), makeImage(40));
+  EXPECT_EQ(cache.size(), 2);
+  EXPECT_EQ(cache.getByteSize(), 80);
+  EXPECT_NE(cache.get(makeImageSource("a")), nullptr);
+  EXPECT_EQ(cache.get(makeImageSource("b")), nullptr);
+  EXPECT_NE(cache.get(makeImageSource("c")), nullptr);
+
+  // Replacing an image updates the size of the cache
+  cache.set(makeImageSource("c"), makeImage(10));
+  EXPECT_EQ(cache.getByteSize(), 50);
+
+  // Images larger than the cache are not cached
+  cache.set(makeImageSource("d"), makeImage(101));
+  EXPECT_EQ(cache.get(makeImageSource("d")), nullptr);
+  EXPECT_EQ(cache.size(), 2);
+}
+
+TEST(ImageFetcherTest, testConcurrentRequestsAreCoalesced) {
+  auto imageLoader = std::make_shared<FakeImageLoader>(
+      Size{.width = 10, .height = 20}, std::chrono::milliseconds(20));
+  auto imageFetcher = ImageFetcher(imageLoader);
+  auto imageSource = makeImageSource("https://example.com/image.png");
+
+  std::vector<ImageRequest> imageRequests;
+  std::vector<std::unique_ptr<TestImageResponseObserver>> observers;
+  for (int i = 0; i < 10; i++) {
+    imageRequests.push_back(imageFetcher.requestImage(imageSource, 1));
+    observers.push_back(std::make_unique<TestImageResponseObserver>());
+    imageRequests.back().getObserverCoordinator().addObserver(
+        *observers.back());
+  }
+
+  for (const auto& observer : observers) {
+    ASSERT_TRUE(observer->waitForResponse());
+    ASSERT_NE(observer->getImage(), nullptr);
+    EXPECT_EQ(observer->getImage()->size.width, 10);
+    EXPECT_EQ(observer->getImage()->size.height, 20);
+  }
+  EXPECT_EQ(imageLoader->getLoadCount(), 1);
+
+  auto statistics = imageFetcher.getStatistics();
+  EXPECT_EQ(statistics.requestCount, 10);
+  EXPECT_EQ(statistics.coalescedRequestCount, 9);
+  EXPECT_EQ(statistics.loadCount, 1);
+
+  for (size_t i = 0; i < observers.size(); i++) {
+    imageRequests[i].getObserverCoordinator().removeObserver(*observers[i]);
+  }
+}
+
+TEST(ImageFetcherTest, testCachedImagesCompleteImmediately) {
+  auto imageLoader = std::make_shared<FakeImageLoader>();
+  auto imageFetcher = ImageFetcher(imageLoader);
+  auto imageSource = makeImageSource("https://example.com/image.png");
+
+  {
+    auto imageRequest = imageFetcher.requestImage(imageSource, 1);
+    auto observer = TestImageResponseObserver{};
+    imageRequest.getObserverCoordinator().addObserver(observer);
+    ASSERT_TRUE(observer.waitForResponse());
+    imageRequest.getObserverCoordinator().removeObserver(observer);
+  }
+
+  auto imageRequest = imageFetcher.requestImage(imageSource, 1);
+  auto observer = TestImageResponseObserver{};
+  imageRequest.getObserverCoordinator().addObserver(observer);
+  EXPECT_EQ(observer.getResponseCount(), 1);
+  EXPECT_NE(observer.getImage(), nullptr);
+  EXPECT_EQ(imageLoader->getLoadCount(), 1);
+  EXPECT_EQ(imageFetcher.getStatistics().cacheHitCount, 1);
+}
+
+TEST(ImageFetcherTest, testFailures) {
+  auto imageLoader = std::make_shared<FakeImageLoader>();
+  imageLoader->setFailure("https://example.com/missing.png");
+  auto imageFetcher = ImageFetcher(imageLoader);
+  auto imageSource = makeImageSource("https://example.com/missing.png");
+
+  for (int i = 0; i < 2; i++) {
+    auto imageRequest = imageFetcher.requestImage(imageSource, 1);
+    auto observer = TestImageResponseObserver{};
+    imageRequest.getObserverCoordinator().addObserver(observer);
+    ASSERT_TRUE(observer.waitForResponse());
+    EXPECT_EQ(observer.getImage(), nullptr);
+    ASSERT_NE(observer.getError(), nullptr);
+    EXPECT_FALSE(observer.getError()->error.empty());
+  }
+
+  // Failures are not cached
+  EXPECT_EQ(imageLoader->getLoadCount(), 2);
+}
+
+TEST(ImageFetcherTest, testCancelledLoadsResume) {
+  auto imageLoader = std::make_shared<FakeImageLoader>(
+      Size{.width = 10, .height = 10}, std::chrono::milliseconds(50));
+  // A single worker, kept busy with the first image
+  auto imageFetcher = ImageFetcher(imageLoader, 1024 * 1024, 1);
+
+  auto busyRequest = imageFetcher.requestImage(makeImageSource("busy"), 1);
+  auto busyObserver = TestImageResponseObserver{};
+  busyRequest.getObserverCoordinator().addObserver(busyObserver);
+
+  auto imageRequest = imageFetcher.requestImage(makeImageSource("image"), 1);
+  auto observer = TestImageResponseObserver{};
+  imageRequest.getObserverCoordinator().addObserver(observer);
+  // Removing the only observer cancels the queued load...
+  imageRequest.getObserverCoordinator().removeObserver(observer);
+  ASSERT_TRUE(busyObserver.waitForResponse());
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_EQ(imageLoader->getLoadCount("image"), 0);
+
+  // ...and adding one back resumes it
+  imageRequest.getObserverCoordinator().addObserver(observer);
+  ASSERT_TRUE(observer.waitForResponse());
+  EXPECT_NE(observer.getImage(), nullptr);
+  EXPECT_EQ(imageLoader->getLoadCount("image"), 1);
+
+  busyRequest.getObserverCoordinator().removeObserver(busyObserver);
+  imageRequest.getObserverCoordinator().removeObserver(observer);
+}
+
+TEST(ImageFetcherTest, testFileImageLoader) {
+  // A 3x2 PNG, as far as its header goes
+  std::vector<uint8_t> png = {
+      0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n', 0, 0, 0, 13, 'I', 'H', 'D',
+      'R',  0,   0,   0,   3,    0,    0,    0,    2,    8, 6, 0,  0, 0};
+  auto image = FileImageLoader::readImageHeader(png);
+  ASSERT_NE(image, nullptr);
+  EXPECT_EQ(image->mimeType, "image/png");
+  EXPECT_EQ(image->size.width, 3);
+  EXPECT_EQ(image->size.height, 2);
+  EXPECT_EQ(image->byteSize, 3 * 2 * 4);
+
+  // A 5x4 JPEG with an APP0 segment before its start of frame
+  std::vector<uint8_t> jpeg = {
+      0xFF, 0xD8, 0xFF, 0xE0, 0, 4, 0, 0, 0xFF, 0xC0, 0, 11, 8, 0, 4, 0, 5};
+  image = FileImageLoader::readImageHeader(jpeg);
+  ASSERT_NE(image, nullptr);
+  EXPECT_EQ(image->mimeType, "image/jpeg");
+  EXPECT_EQ(image->size.width, 5);
+  EXPECT_EQ(image->size.height, 4);
+
+  std::vector<uint8_t> gif = {'G', 'I', 'F', '8', '9', 'a', 7, 0, 1, 1};
+  image = FileImageLoader::readImageHeader(gif);
+  ASSERT_NE(image, nullptr);
+  EXPECT_EQ(image->size.width, 7);
+  EXPECT_EQ(image->size.height, 257);
+
+  std::vector<uint8_t> text = {'h', 'e', 'l', 'l', 'o'};
+  EXPECT_EQ(FileImageLoader::readImageHeader(text), nullptr);
+
+  // Loading from a file
+  auto path = testing::TempDir() + "image.png";
+  {
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(png.data()), png.size());
+  }
+  auto imageLoader = FileImageLoader{};
+  auto result = imageLoader.loadImage(
+      ImageSource{.type = ImageSource::Type::Local, .uri = "file://" + path});
+  ASSERT_NE(result.image, nullptr);
+  EXPECT_EQ(result.image->size.width, 3);
+  std::remove(path.c_str());
+
+  result = imageLoader.loadImage(
+      ImageSource{.type = ImageSource::Type::Local, .uri = path});
+  EXPECT_EQ(result.image, nullptr);
+  EXPECT_FALSE(result.error.error.empty());
+}
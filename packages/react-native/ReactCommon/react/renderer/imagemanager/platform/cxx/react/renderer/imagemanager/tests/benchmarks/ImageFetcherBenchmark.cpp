@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/imagemanager/FakeImageLoader.h>
+#include <react/renderer/imagemanager/ImageFetcher.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+/*
+ * Counts responses, so that a screen is done when all its images are.
+ */
+class CountingObserver : public ImageResponseObserver {
+ public:
+  void didReceiveProgress(float /*progress*/, int64_t /*loaded*/, int64_t
+                          /*total*/) const override {}
+
+  void didReceiveImage(const ImageResponse& /*imageResponse*/) const override {
+    didReceiveResponse();
+  }
+
+  void didReceiveFailure(const ImageLoadError& /*error*/) const override {
+    didReceiveResponse();
+  }
+
+  void waitForResponses(size_t count) const {
+    std::unique_lock lock(mutex_);
+    condition_.wait(lock, [&]() { return responseCount_ >= count; });
+    responseCount_ = 0;
+  }
+
+ private:
+  void didReceiveResponse() const {
+    std::scoped_lock lock(mutex_);
+    responseCount_++;
+    condition_.notify_one();
+  }
+
+  mutable std::mutex mutex_;
+  mutable std::condition_variable condition_;
+  mutable size_t responseCount_{0};
+};
+
+std::vector<ImageSource> buildImageSources(
+    size_t imageCount,
+    size_t uniqueImageCount) {
+  std::vector<ImageSource> imageSources;
+  imageSources.reserve(imageCount);
+  for (size_t i = 0; i < imageCount; i++) {
+    imageSources.push_back(ImageSource{
+        .type = ImageSource::Type::Remote,
+        .uri = "https://example.com/" + std::to_string(i % uniqueImageCount) +
+            ".png"});
+  }
+  return imageSources;
+}
+
+/*
+ * Loads a screen of `imageCount` images, of which one in `range(1)` is
+ * unique, with an empty cache every time.
+ */
+void loadScreen(benchmark::State& state) {
+  auto imageCount = static_cast<size_t>(state.range(0));
+  auto imageSources =
+      buildImageSources(imageCount, imageCount / state.range(1));
+  auto imageLoader = std::make_shared<FakeImageLoader>();
+  auto observer = CountingObserver{};
+
+  for (auto _ : state) {
+    // A cache too small for any image, so that every screen loads again
+    auto imageFetcher = ImageFetcher(imageLoader, 0);
+    std::vector<ImageRequest> imageRequests;
+    imageRequests.reserve(imageCount);
+    for (const auto& imageSource : imageSources) {
+      imageRequests.push_back(imageFetcher.requestImage(imageSource, 1));
+      imageRequests.back().getObserverCoordinator().addObserver(observer);
+    }
+    observer.waitForResponses(imageCount);
+    for (const auto& imageRequest : imageRequests) {
+      imageRequest.getObserverCoordinator().removeObserver(observer);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * imageCount);
+}
+
+/*
+ * Loads a screen of `imageCount` images which are all in the cache.
+ */
+void loadCachedScreen(benchmark::State& state) {
+  auto imageCount = static_cast<size_t>(state.range(0));
+  auto imageSources = buildImageSources(imageCount, imageCount);
+  auto imageLoader = std::make_shared<FakeImageLoader>(
+      Size{.width = 100, .height = 100});
+  auto imageFetcher = ImageFetcher(imageLoader, imageCount * 100 * 100 * 4);
+  auto observer = CountingObserver{};
+
+  for (auto _ : state) {
+    std::vector<ImageRequest> imageRequests;
+    imageRequests.reserve(imageCount);
+    for (const auto& imageSource : imageSources) {
+      imageRequests.push_back(imageFetcher.requestImage(imageSource, 1));
+      imageRequests.back().getObserverCoordinator().addObserver(observer);
+    }
+    observer.waitForResponses(imageCount);
+    for (const auto& imageRequest : imageRequests) {
+      imageRequest.getObserverCoordinator().removeObserver(observer);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * imageCount);
+}
+
+} // namespace
+
+BENCHMARK(loadScreen)
+    ->Args({1000, 1})
+    ->Args({1000, 10})
+    ->Args({5000, 10})
+    ->UseRealTime();
+BENCHMARK(loadCachedScreen)->Arg(1000)->Arg(5000)->UseRealTime();
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -7,11 +7,14 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include <react/renderer/graphics/Float.h>
 #include <react/renderer/graphics/Size.h>
+#include <react/utils/hash_combine.h>
 
 namespace facebook::react {
 
@@ -58,3 +61,10 @@ class ImageErrorInfo {
 };
 
 } // namespace facebook::react
+
+template <>
+struct std::hash<facebook::react::ImageSource> {
+  size_t operator()(const facebook::react::ImageSource& imageSource) const {
+    return facebook::react::hash_combine(imageSource.type, imageSource.uri);
+  }
+};
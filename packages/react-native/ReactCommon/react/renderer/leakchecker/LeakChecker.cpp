@@ -10,16 +10,37 @@
 #include <glog/logging.h>
 #include <jsi/instrumentation.h>
 
+#include <algorithm>
+#include <unordered_map>
 #include <utility>
 
 namespace facebook::react {
 
-LeakChecker::LeakChecker(RuntimeExecutor runtimeExecutor)
-    : runtimeExecutor_(std::move(runtimeExecutor)) {}
+LeakChecker::LeakChecker(
+    RuntimeExecutor runtimeExecutor,
+    LeakReportHandler leakReportHandler)
+    : runtimeExecutor_(std::move(runtimeExecutor)),
+      leakReportHandler_(std::move(leakReportHandler)),
+      worker_([this]() { runWorker(); }) {}
+
+LeakChecker::~LeakChecker() {
+  {
+    std::scoped_lock lock(workerMutex_);
+    isStopping_ = true;
+  }
+  workerCondition_.notify_one();
+  worker_.join();
+}
 
 void LeakChecker::uiManagerDidCreateShadowNodeFamily(
     const ShadowNodeFamily::Shared& shadowNodeFamily) const {
-  registry_.add(shadowNodeFamily);
+  if (registry_.add(shadowNodeFamily)) {
+    {
+      std::scoped_lock lock(workerMutex_);
+      isCompactionRequested_ = true;
+    }
+    workerCondition_.notify_one();
+  }
 }
 
 void LeakChecker::stopSurface(SurfaceId surfaceId) {
@@ -33,28 +54,95 @@ void LeakChecker::stopSurface(SurfaceId surfaceId) {
       // buffering which keeps the surface that was just stopped in
       // memory. This is a documented problem in the last point of
       // https://github.com/facebook/react/issues/16087
-      checkSurfaceForLeaks(previouslyStoppedSurface);
+      scheduleCheckForLeaks(previouslyStoppedSurface);
     });
   }
 
   previouslyStoppedSurface_ = surfaceId;
 }
 
+void LeakChecker::scheduleCheckForLeaks(SurfaceId surfaceId) const {
+  {
+    std::scoped_lock lock(workerMutex_);
+    surfacesToCheck_.push(surfaceId);
+  }
+  workerCondition_.notify_one();
+}
+
 void LeakChecker::checkSurfaceForLeaks(SurfaceId surfaceId) const {
-  auto weakFamilies = registry_.weakFamiliesForSurfaceId(surfaceId);
-  unsigned int numberOfLeaks = 0;
-  for (const auto& weakFamily : weakFamilies) {
-    auto strong = weakFamily.lock();
-    if (strong) {
+  auto removedFamilies = registry_.removeFamiliesWithSurfaceId(surfaceId);
+
+  auto leaksByComponentName = std::unordered_map<std::string, size_t>{};
+  size_t numberOfLeaks = 0;
+  for (const auto& weakFamily : removedFamilies.weakFamilies) {
+    // Families must not be locked here (see `WeakFamily::componentName`).
+    if (!weakFamily.family.expired()) {
       ++numberOfLeaks;
+      ++leaksByComponentName[weakFamily.componentName];
     }
   }
-  if (numberOfLeaks > 0) {
-    LOG(ERROR) << "[LeakChecker] Surface with id: " << surfaceId
-               << " has leaked " << numberOfLeaks << " components out of "
-               << weakFamilies.size();
+  if (numberOfLeaks == 0) {
+    return;
+  }
+
+  auto leakReport = LeakReport{
+      surfaceId,
+      numberOfLeaks,
+      removedFamilies.numberOfAddedFamilies,
+      {leaksByComponentName.begin(), leaksByComponentName.end()}};
+  std::sort(
+      leakReport.leaksByComponentName.begin(),
+      leakReport.leaksByComponentName.end(),
+      [](const auto& lhs, const auto& rhs) {
+        return lhs.second != rhs.second ? lhs.second > rhs.second
+                                        : lhs.first < rhs.first;
+      });
+
+  if (leakReportHandler_) {
+    leakReportHandler_(leakReport);
+    return;
+  }
+
+  auto message = std::string{};
+  for (const auto& [componentName, count] : leakReport.leaksByComponentName) {
+    message += (message.empty() ? "" : ", ") + componentName + " (" +
+        std::to_string(count) + ")";
+  }
+  LOG(ERROR) << "[LeakChecker] Surface with id: " << surfaceId
+             << " has leaked " << numberOfLeaks << " components out of "
+             << leakReport.numberOfFamilies << ": " << message;
+}
+
+void LeakChecker::runWorker() const {
+  std::unique_lock lock(workerMutex_);
+  while (true) {
+    workerCondition_.wait(lock, [this]() {
+      return isStopping_ || !surfacesToCheck_.empty() ||
+          isCompactionRequested_;
+    });
+    if (isStopping_) {
+      return;
+    }
+
+    // Checks come first, and compaction resumes in between.
+    if (!surfacesToCheck_.empty()) {
+      auto surfaceId = surfacesToCheck_.front();
+      surfacesToCheck_.pop();
+      lock.unlock();
+      checkSurfaceForLeaks(surfaceId);
+      lock.lock();
+      continue;
+    }
+
+    isCompactionRequested_ = false;
+    lock.unlock();
+    auto hasMoreToCompact = registry_.compact(kCompactionBudget);
+    if (hasMoreToCompact) {
+      std::this_thread::yield();
+    }
+    lock.lock();
+    isCompactionRequested_ = isCompactionRequested_ || hasMoreToCompact;
   }
-  registry_.removeFamiliesWithSurfaceId(surfaceId);
 }
 
 } // namespace facebook::react
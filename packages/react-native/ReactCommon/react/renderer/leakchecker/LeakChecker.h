@@ -11,27 +11,83 @@
 #include <react/renderer/core/ReactPrimitives.h>
 #include <react/renderer/core/ShadowNodeFamily.h>
 #include <react/renderer/leakchecker/WeakFamilyRegistry.h>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
 #include <vector>
 
 namespace facebook::react {
 
 using GarbageCollectionTrigger = std::function<void()>;
 
+/*
+ * Components of a stopped surface which are still alive.
+ */
+struct LeakReport {
+  SurfaceId surfaceId{};
+  size_t numberOfLeaks{0};
+  size_t numberOfFamilies{0};
+
+  /*
+   * Number of leaked components of each type, from the most leaked.
+   */
+  std::vector<std::pair<std::string, size_t>> leaksByComponentName{};
+};
+
+using LeakReportHandler = std::function<void(const LeakReport& leakReport)>;
+
+/*
+ * Checks that the components of a surface are destroyed after it is stopped.
+ * Families are compacted and checked on a background thread, so that the
+ * checker costs little more than registering each family.
+ */
 class LeakChecker final {
  public:
-  LeakChecker(RuntimeExecutor runtimeExecutor);
+  /*
+   * Leaks are logged unless a `leakReportHandler` is given.
+   */
+  LeakChecker(
+      RuntimeExecutor runtimeExecutor,
+      LeakReportHandler leakReportHandler = nullptr);
+  ~LeakChecker();
+
+  LeakChecker(const LeakChecker&) = delete;
+  LeakChecker& operator=(const LeakChecker&) = delete;
 
   void uiManagerDidCreateShadowNodeFamily(
       const ShadowNodeFamily::Shared& shadowNodeFamily) const;
   void stopSurface(SurfaceId surfaceId);
 
  private:
+  /*
+   * Number of references compacted at a time, between which families can
+   * be added and surfaces checked.
+   */
+  static constexpr size_t kCompactionBudget = 4096;
+
+  void scheduleCheckForLeaks(SurfaceId surfaceId) const;
   void checkSurfaceForLeaks(SurfaceId surfaceId) const;
+  void runWorker() const;
 
   const RuntimeExecutor runtimeExecutor_{};
+  const LeakReportHandler leakReportHandler_{};
 
   WeakFamilyRegistry registry_{};
   SurfaceId previouslyStoppedSurface_{};
+
+  /*
+   * State of the background thread, protected by `workerMutex_`.
+   */
+  mutable std::mutex workerMutex_;
+  mutable std::condition_variable workerCondition_;
+  mutable std::queue<SurfaceId> surfacesToCheck_{};
+  mutable bool isCompactionRequested_{false};
+  bool isStopping_{false};
+
+  std::thread worker_;
 };
 
 } // namespace facebook::react
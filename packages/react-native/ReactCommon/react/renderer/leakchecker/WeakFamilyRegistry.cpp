@@ -7,28 +7,150 @@
 
 #include "WeakFamilyRegistry.h"
 
+#include <algorithm>
+
 namespace facebook::react {
 
-void WeakFamilyRegistry::add(
+bool WeakFamilyRegistry::add(
     const ShadowNodeFamily::Shared& shadowNodeFamily) const {
   std::scoped_lock lock(familiesMutex_);
-  ShadowNodeFamily::Weak weakFamily = shadowNodeFamily;
-  families_[shadowNodeFamily->getSurfaceId()].push_back(weakFamily);
+  auto& surfaceFamilies = families_[shadowNodeFamily->getSurfaceId()];
+  surfaceFamilies.weakFamilies.push_back(
+      WeakFamily{shadowNodeFamily, shadowNodeFamily->getComponentName()});
+  surfaceFamilies.numberOfAddedFamilies++;
+
+  if (surfaceFamilies.isCompactionPending) {
+    return false;
+  }
+  auto youngGenerationSize = surfaceFamilies.weakFamilies.size() -
+      surfaceFamilies.oldGenerationSize;
+  if (youngGenerationSize <
+      std::max(kMinCompactionSize, surfaceFamilies.oldGenerationSize / 2)) {
+    return false;
+  }
+  surfaceFamilies.isCompactionPending = true;
+  return true;
 }
 
-void WeakFamilyRegistry::removeFamiliesWithSurfaceId(
-    SurfaceId surfaceId) const {
+WeakFamilyRegistry::RemovedFamilies
+WeakFamilyRegistry::removeFamiliesWithSurfaceId(SurfaceId surfaceId) const {
   std::scoped_lock lock(familiesMutex_);
-  families_.erase(surfaceId);
+  auto iterator = families_.find(surfaceId);
+  if (iterator == families_.end()) {
+    return {};
+  }
+
+  auto& surfaceFamilies = iterator->second;
+  auto& weakFamilies = surfaceFamilies.weakFamilies;
+  if (surfaceFamilies.isCompacting) {
+    weakFamilies.erase(
+        weakFamilies.begin() + surfaceFamilies.writeIndex,
+        weakFamilies.begin() + surfaceFamilies.readIndex);
+  }
+  auto removedFamilies = RemovedFamilies{
+      std::move(weakFamilies), surfaceFamilies.numberOfAddedFamilies};
+  families_.erase(iterator);
+  return removedFamilies;
 }
 
 WeakFamilyRegistry::WeakFamilies WeakFamilyRegistry::weakFamiliesForSurfaceId(
     SurfaceId surfaceId) const {
   std::scoped_lock lock(familiesMutex_);
-  if (families_.find(surfaceId) != families_.end()) {
-    return families_[surfaceId];
+  auto iterator = families_.find(surfaceId);
+  if (iterator == families_.end()) {
+    return {};
+  }
+
+  const auto& surfaceFamilies = iterator->second;
+  const auto& weakFamilies = surfaceFamilies.weakFamilies;
+  if (!surfaceFamilies.isCompacting) {
+    return weakFamilies;
+  }
+  auto result = WeakFamilies{};
+  result.reserve(
+      weakFamilies.size() - surfaceFamilies.readIndex +
+      surfaceFamilies.writeIndex);
+  result.insert(
+      result.end(),
+      weakFamilies.begin(),
+      weakFamilies.begin() + surfaceFamilies.writeIndex);
+  result.insert(
+      result.end(),
+      weakFamilies.begin() + surfaceFamilies.readIndex,
+      weakFamilies.end());
+  return result;
+}
+
+bool WeakFamilyRegistry::compact(size_t budget) const {
+  std::scoped_lock lock(familiesMutex_);
+  bool hasPendingCompactions = false;
+  for (auto& [surfaceId, surfaceFamilies] : families_) {
+    if (!surfaceFamilies.isCompactionPending) {
+      continue;
+    }
+    if (budget > 0) {
+      budget -= std::min(budget, compact(surfaceFamilies, budget));
+    }
+    hasPendingCompactions =
+        hasPendingCompactions || surfaceFamilies.isCompactionPending;
+  }
+  return hasPendingCompactions;
+}
+
+/* static */ size_t WeakFamilyRegistry::compact(
+    SurfaceFamilies& surfaceFamilies,
+    size_t budget) {
+  auto& weakFamilies = surfaceFamilies.weakFamilies;
+
+  if (!surfaceFamilies.isCompacting) {
+    // Families that survived a compaction can still be destroyed later, so
+    // everything is compacted once the families added since outnumber them.
+    auto numberOfAddedFamiliesSinceFullCompaction =
+        surfaceFamilies.numberOfAddedFamilies -
+        surfaceFamilies.numberOfAddedFamiliesAtFullCompaction;
+    surfaceFamilies.isFullCompaction =
+        surfaceFamilies.oldGenerationSize >= kMinCompactionSize &&
+        numberOfAddedFamiliesSinceFullCompaction >=
+            surfaceFamilies.oldGenerationSize;
+    auto startIndex = surfaceFamilies.isFullCompaction
+        ? 0
+        : surfaceFamilies.oldGenerationSize;
+    surfaceFamilies.isCompacting = true;
+    surfaceFamilies.writeIndex = startIndex;
+    surfaceFamilies.readIndex = startIndex;
+    surfaceFamilies.endIndex = weakFamilies.size();
+  }
+
+  size_t count = 0;
+  auto& writeIndex = surfaceFamilies.writeIndex;
+  auto& readIndex = surfaceFamilies.readIndex;
+  while (readIndex < surfaceFamilies.endIndex && count < budget) {
+    if (!weakFamilies[readIndex].family.expired()) {
+      if (writeIndex != readIndex) {
+        weakFamilies[writeIndex] = std::move(weakFamilies[readIndex]);
+      }
+      writeIndex++;
+    }
+    readIndex++;
+    count++;
+  }
+
+  if (readIndex == surfaceFamilies.endIndex) {
+    weakFamilies.erase(
+        weakFamilies.begin() + writeIndex, weakFamilies.begin() + readIndex);
+    if (weakFamilies.capacity() >
+        2 * weakFamilies.size() + kMinCompactionSize) {
+      weakFamilies.shrink_to_fit();
+    }
+    surfaceFamilies.oldGenerationSize = writeIndex;
+    if (surfaceFamilies.isFullCompaction) {
+      surfaceFamilies.numberOfAddedFamiliesAtFullCompaction =
+          surfaceFamilies.numberOfAddedFamilies;
+    }
+    surfaceFamilies.isCompacting = false;
+    surfaceFamilies.isCompactionPending = false;
   }
-  return {};
+  return count;
 }
 
 } // namespace facebook::react
@@ -9,21 +9,107 @@
 
 #include <react/renderer/core/ReactPrimitives.h>
 #include <react/renderer/core/ShadowNodeFamily.h>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
 namespace facebook::react {
 
+/*
+ * Keeps weak references to the families created on each surface, to check
+ * which ones outlive it.
+ *
+ * Most families are short-lived, so the references are compacted by
+ * generation: references added since the last compaction (the young
+ * generation) are compacted once they outnumber half of the others, and all
+ * of them once as many families were added as survived compactions (the old
+ * generation). This keeps the registry proportional to the number of live
+ * families, for amortized constant time per family, and compaction is done
+ * incrementally (see `compact`) so that it never holds the lock for long.
+ */
 class WeakFamilyRegistry final {
  public:
-  using WeakFamilies = std::vector<ShadowNodeFamily::Weak>;
+  struct WeakFamily {
+    ShadowNodeFamily::Weak family{};
+
+    /*
+     * Recorded when the family is added, so that a leak can be reported
+     * without locking the family: the strong reference could turn out to be
+     * the last one, and destroy the family (with its instance handle and
+     * event emitter) on the checking thread.
+     */
+    ComponentName componentName{};
+  };
+
+  using WeakFamilies = std::vector<WeakFamily>;
 
-  void add(const ShadowNodeFamily::Shared& shadowNodeFamily) const;
-  void removeFamiliesWithSurfaceId(SurfaceId surfaceId) const;
+  /*
+   * Minimum number of references added to a surface before compacting it.
+   */
+  static constexpr size_t kMinCompactionSize = 1024;
+
+  /*
+   * Families removed from the registry, with the number of families that
+   * were added (including the ones that were compacted away since).
+   */
+  struct RemovedFamilies {
+    WeakFamilies weakFamilies{};
+    size_t numberOfAddedFamilies{0};
+  };
+
+  /*
+   * Returns `true` when the surface of the family needs to be compacted,
+   * once until it is.
+   */
+  bool add(const ShadowNodeFamily::Shared& shadowNodeFamily) const;
+  RemovedFamilies removeFamiliesWithSurfaceId(SurfaceId surfaceId) const;
   WeakFamilies weakFamiliesForSurfaceId(SurfaceId surfaceId) const;
 
+  /*
+   * Drops references to destroyed families from surfaces that need it,
+   * looking at no more than `budget` references, and returns `true` if
+   * there is more to compact.
+   * Meant to be called repeatedly on a background thread; a compaction can
+   * stop in the middle and resume on the next call while families are added.
+   */
+  bool compact(size_t budget) const;
+
  private:
-  /**
+  struct SurfaceFamilies {
+    WeakFamilies weakFamilies{};
+    size_t numberOfAddedFamilies{0};
+
+    /*
+     * References before this index survived the last compaction.
+     */
+    size_t oldGenerationSize{0};
+
+    /*
+     * Value of `numberOfAddedFamilies` when the old generation was last
+     * compacted.
+     */
+    size_t numberOfAddedFamiliesAtFullCompaction{0};
+
+    bool isCompactionPending{false};
+    bool isCompacting{false};
+    bool isFullCompaction{false};
+
+    /*
+     * During a compaction, references in [writeIndex, readIndex) were moved
+     * or dropped, and references from `endIndex` on were added since it
+     * started.
+     */
+    size_t writeIndex{0};
+    size_t readIndex{0};
+    size_t endIndex{0};
+  };
+
+  /*
+   * Returns the number of references looked at.
+   */
+  static size_t compact(SurfaceFamilies& surfaceFamilies, size_t budget);
+
+  /*
    * Mutex protecting `families_` property.
    */
   mutable std::mutex familiesMutex_;
@@ -31,7 +117,7 @@ class WeakFamilyRegistry final {
   /**
    * A map of ShadowNodeFamily used on surface.
    */
-  mutable std::unordered_map<SurfaceId, WeakFamilies> families_{};
+  mutable std::unordered_map<SurfaceId, SurfaceFamilies> families_{};
 };
 
 } // namespace facebook::react
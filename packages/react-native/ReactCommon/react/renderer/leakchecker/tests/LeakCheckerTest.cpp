@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/leakchecker/LeakChecker.h>
+
+using namespace facebook::react;
+
+namespace {
+
+using ComponentCount = std::pair<std::string, size_t>;
+
+class LeakCheckerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    runtime_ = facebook::hermes::makeHermesRuntime();
+  }
+
+  /*
+   * Surfaces are checked once the next one is stopped, so this one is
+   * stopped last to check all the others.
+   */
+  static constexpr SurfaceId kLastSurfaceId = 100;
+
+  std::unique_ptr<LeakChecker> createLeakChecker(
+      LeakReportHandler leakReportHandler = nullptr) {
+    return std::make_unique<LeakChecker>(
+        [this](
+            std::function<void(facebook::jsi::Runtime& runtime)>&& callback) {
+          callback(*runtime_);
+        },
+        [this, leakReportHandler](const LeakReport& leakReport) {
+          if (leakReportHandler) {
+            leakReportHandler(leakReport);
+          }
+          std::scoped_lock lock(mutex_);
+          leakReports_.push_back(leakReport);
+          handlerThreadIds_.push_back(std::this_thread::get_id());
+          condition_.notify_all();
+        });
+  }
+
+  ShadowNodeFamily::Shared createViewFamily(SurfaceId surfaceId) {
+    return createFamily(viewComponentDescriptor_, surfaceId);
+  }
+
+  ShadowNodeFamily::Shared createRootFamily(SurfaceId surfaceId) {
+    return createFamily(rootComponentDescriptor_, surfaceId);
+  }
+
+  std::vector<LeakReport> waitForLeakReports(size_t count) {
+    std::unique_lock lock(mutex_);
+    condition_.wait_for(lock, std::chrono::seconds(10), [&]() {
+      return leakReports_.size() >= count;
+    });
+    return leakReports_;
+  }
+
+  std::vector<std::thread::id> getHandlerThreadIds() {
+    std::scoped_lock lock(mutex_);
+    return handlerThreadIds_;
+  }
+
+ private:
+  ShadowNodeFamily::Shared createFamily(
+      const ComponentDescriptor& componentDescriptor,
+      SurfaceId surfaceId) {
+    return componentDescriptor.createFamily(ShadowNodeFamilyFragment{
+        /* .tag = */ nextTag_++,
+        /* .surfaceId = */ surfaceId,
+        /* .instanceHandle = */ nullptr,
+    });
+  }
+
+  std::unique_ptr<facebook::hermes::HermesRuntime> runtime_;
+
+  ComponentDescriptorParameters parameters_{
+      EventDispatcher::Shared{},
+      nullptr,
+      {}};
+  ViewComponentDescriptor viewComponentDescriptor_{parameters_};
+  RootComponentDescriptor rootComponentDescriptor_{parameters_};
+  Tag nextTag_{1};
+
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::vector<LeakReport> leakReports_;
+  std::vector<std::thread::id> handlerThreadIds_;
+};
+
+} // namespace
+
+TEST_F(LeakCheckerTest, reportsLeaksByComponentOnBackgroundThread) {
+  auto leakChecker = createLeakChecker();
+  auto liveFamilies = std::vector<ShadowNodeFamily::Shared>{};
+  for (int i = 0; i < 4; i++) {
+    auto viewFamily = createViewFamily(1);
+    leakChecker->uiManagerDidCreateShadowNodeFamily(viewFamily);
+    if (i < 3) {
+      liveFamilies.push_back(viewFamily);
+    }
+  }
+  auto rootFamily = createRootFamily(1);
+  leakChecker->uiManagerDidCreateShadowNodeFamily(rootFamily);
+  liveFamilies.push_back(rootFamily);
+
+  leakChecker->stopSurface(1);
+  leakChecker->stopSurface(kLastSurfaceId);
+
+  auto leakReports = waitForLeakReports(1);
+  ASSERT_EQ(leakReports.size(), 1u);
+  EXPECT_EQ(leakReports[0].surfaceId, 1);
+  EXPECT_EQ(leakReports[0].numberOfLeaks, 4u);
+  EXPECT_EQ(leakReports[0].numberOfFamilies, 5u);
+  // From the most leaked component
+  EXPECT_EQ(
+      leakReports[0].leaksByComponentName,
+      (std::vector<ComponentCount>{{"View", 3}, {"RootView", 1}}));
+
+  auto handlerThreadIds = getHandlerThreadIds();
+  ASSERT_EQ(handlerThreadIds.size(), 1u);
+  EXPECT_NE(handlerThreadIds[0], std::this_thread::get_id());
+}
+
+TEST_F(LeakCheckerTest, checksStoppedSurfacesInOrder) {
+  auto leakChecker = createLeakChecker();
+  auto liveFamilies = std::vector<ShadowNodeFamily::Shared>{};
+  for (SurfaceId surfaceId = 1; surfaceId <= 3; surfaceId++) {
+    // Surface 2 does not leak
+    for (int i = 0; i < 2; i++) {
+      auto viewFamily = createViewFamily(surfaceId);
+      auto rootFamily = createRootFamily(surfaceId);
+      leakChecker->uiManagerDidCreateShadowNodeFamily(viewFamily);
+      leakChecker->uiManagerDidCreateShadowNodeFamily(rootFamily);
+      if (surfaceId != 2) {
+        liveFamilies.push_back(viewFamily);
+        liveFamilies.push_back(rootFamily);
+      }
+    }
+  }
+
+  for (SurfaceId surfaceId = 1; surfaceId <= 3; surfaceId++) {
+    leakChecker->stopSurface(surfaceId);
+  }
+  leakChecker->stopSurface(kLastSurfaceId);
+
+  // Checks run one at a time in the order surfaces were stopped, so surface
+  // 2 was checked once surface 3 is reported.
+  auto leakReports = waitForLeakReports(2);
+  ASSERT_EQ(leakReports.size(), 2u);
+  EXPECT_EQ(leakReports[0].surfaceId, 1);
+  EXPECT_EQ(leakReports[1].surfaceId, 3);
+  // Components leaked as many times are sorted by name
+  EXPECT_EQ(
+      leakReports[1].leaksByComponentName,
+      (std::vector<ComponentCount>{{"RootView", 2}, {"View", 2}}));
+
+  auto handlerThreadIds = getHandlerThreadIds();
+  ASSERT_EQ(handlerThreadIds.size(), 2u);
+  EXPECT_EQ(handlerThreadIds[0], handlerThreadIds[1]);
+}
+
+TEST_F(LeakCheckerTest, compactsDestroyedFamiliesInBackground) {
+  auto leakChecker = createLeakChecker();
+  auto liveFamilies = std::vector<ShadowNodeFamily::Shared>{};
+  const size_t numberOfFamilies = 8 * WeakFamilyRegistry::kMinCompactionSize;
+  for (size_t i = 0; i < numberOfFamilies; i++) {
+    auto family = createViewFamily(1);
+    leakChecker->uiManagerDidCreateShadowNodeFamily(family);
+    if (i % 100 == 0) {
+      liveFamilies.push_back(family);
+    }
+  }
+
+  leakChecker->stopSurface(1);
+  leakChecker->stopSurface(kLastSurfaceId);
+
+  auto leakReports = waitForLeakReports(1);
+  ASSERT_EQ(leakReports.size(), 1u);
+  EXPECT_EQ(leakReports[0].numberOfLeaks, liveFamilies.size());
+  // Including the families that were compacted away
+  EXPECT_EQ(leakReports[0].numberOfFamilies, numberOfFamilies);
+}
+
+TEST_F(LeakCheckerTest, stopsWithPendingWork) {
+  auto isHandlerReleased = std::promise<void>{};
+  auto handlerRelease = isHandlerReleased.get_future().share();
+  auto leakChecker = createLeakChecker(
+      [handlerRelease](const LeakReport& /*leakReport*/) {
+        handlerRelease.wait();
+      });
+
+  auto liveFamilies = std::vector<ShadowNodeFamily::Shared>{};
+  for (SurfaceId surfaceId = 1; surfaceId <= 4; surfaceId++) {
+    auto family = createViewFamily(surfaceId);
+    leakChecker->uiManagerDidCreateShadowNodeFamily(family);
+    liveFamilies.push_back(family);
+  }
+  // Keeps compaction requested
+  for (size_t i = 0; i < 4 * WeakFamilyRegistry::kMinCompactionSize; i++) {
+    leakChecker->uiManagerDidCreateShadowNodeFamily(createViewFamily(5));
+  }
+  for (SurfaceId surfaceId = 1; surfaceId <= 4; surfaceId++) {
+    leakChecker->stopSurface(surfaceId);
+  }
+  leakChecker->stopSurface(kLastSurfaceId);
+
+  // The worker is blocked in the handler of the first report while the
+  // checker is destroyed, with the other checks still queued.
+  auto releaser = std::thread([&isHandlerReleased]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    isHandlerReleased.set_value();
+  });
+  leakChecker.reset();
+  releaser.join();
+
+  EXPECT_LE(waitForLeakReports(0).size(), 4u);
+}
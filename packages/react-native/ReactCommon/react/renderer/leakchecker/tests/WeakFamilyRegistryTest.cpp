@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/leakchecker/WeakFamilyRegistry.h>
+
+using namespace facebook::react;
+
+namespace {
+
+class WeakFamilyRegistryTest : public ::testing::Test {
+ protected:
+  ShadowNodeFamily::Shared createFamily(SurfaceId surfaceId) {
+    return componentDescriptor_.createFamily(ShadowNodeFamilyFragment{
+        /* .tag = */ nextTag_++,
+        /* .surfaceId = */ surfaceId,
+        /* .instanceHandle = */ nullptr,
+    });
+  }
+
+  static size_t countAlive(const WeakFamilyRegistry::WeakFamilies& families) {
+    size_t count = 0;
+    for (const auto& weakFamily : families) {
+      count += weakFamily.family.expired() ? 0 : 1;
+    }
+    return count;
+  }
+
+ private:
+  ViewComponentDescriptor componentDescriptor_{
+      ComponentDescriptorParameters{EventDispatcher::Shared{}, nullptr, {}}};
+  Tag nextTag_{1};
+};
+
+} // namespace
+
+TEST_F(WeakFamilyRegistryTest, addAndRemove) {
+  auto registry = WeakFamilyRegistry{};
+  auto family1 = createFamily(1);
+  auto family2 = createFamily(2);
+  EXPECT_FALSE(registry.add(family1));
+  EXPECT_FALSE(registry.add(family2));
+  registry.add(createFamily(1));
+
+  EXPECT_EQ(registry.weakFamiliesForSurfaceId(1).size(), 2u);
+  EXPECT_EQ(registry.weakFamiliesForSurfaceId(3).size(), 0u);
+
+  auto removedFamilies = registry.removeFamiliesWithSurfaceId(1);
+  EXPECT_EQ(removedFamilies.numberOfAddedFamilies, 2u);
+  EXPECT_EQ(countAlive(removedFamilies.weakFamilies), 1u);
+  EXPECT_EQ(registry.weakFamiliesForSurfaceId(1).size(), 0u);
+  EXPECT_EQ(registry.weakFamiliesForSurfaceId(2).size(), 1u);
+}
+
+TEST_F(WeakFamilyRegistryTest, compactsExpiredFamiliesIncrementally) {
+  auto registry = WeakFamilyRegistry{};
+  auto liveFamilies = std::vector<ShadowNodeFamily::Shared>{};
+  size_t numberOfCompactionRequests = 0;
+  for (size_t i = 0; i < 100 * WeakFamilyRegistry::kMinCompactionSize; i++) {
+    auto family = createFamily(1);
+    if (registry.add(family)) {
+      numberOfCompactionRequests++;
+      // Compacts a little at a time, while families keep being added
+      while (registry.compact(100)) {
+        registry.add(createFamily(1));
+      }
+    }
+    // One family out of ten outlives the loop
+    if (i % 10 == 0) {
+      liveFamilies.push_back(family);
+    }
+  }
+  EXPECT_GT(numberOfCompactionRequests, 0u);
+
+  auto weakFamilies = registry.weakFamiliesForSurfaceId(1);
+  EXPECT_EQ(countAlive(weakFamilies), liveFamilies.size());
+  // Expired families don't accumulate
+  EXPECT_LT(
+      weakFamilies.size(),
+      3 * liveFamilies.size() + 2 * WeakFamilyRegistry::kMinCompactionSize);
+
+  // Families that die after surviving a compaction are dropped eventually
+  liveFamilies.resize(liveFamilies.size() / 10);
+  for (size_t i = 0; i < 20 * WeakFamilyRegistry::kMinCompactionSize; i++) {
+    if (registry.add(createFamily(1))) {
+      while (registry.compact(100)) {
+      }
+    }
+  }
+  weakFamilies = registry.weakFamiliesForSurfaceId(1);
+  EXPECT_EQ(countAlive(weakFamilies), liveFamilies.size());
+  EXPECT_LT(weakFamilies.size(), 4 * WeakFamilyRegistry::kMinCompactionSize);
+
+  auto removedFamilies = registry.removeFamiliesWithSurfaceId(1);
+  EXPECT_EQ(countAlive(removedFamilies.weakFamilies), liveFamilies.size());
+  EXPECT_GT(
+      removedFamilies.numberOfAddedFamilies,
+      120 * WeakFamilyRegistry::kMinCompactionSize);
+}
+
+TEST_F(WeakFamilyRegistryTest, removeDuringCompaction) {
+  auto registry = WeakFamilyRegistry{};
+  auto liveFamilies = std::vector<ShadowNodeFamily::Shared>{};
+  bool isCompactionPending = false;
+  for (size_t i = 0; !isCompactionPending; i++) {
+    auto family = createFamily(1);
+    isCompactionPending = registry.add(family);
+    if (i % 2 == 0) {
+      liveFamilies.push_back(family);
+    }
+  }
+
+  // Stops in the middle of the compaction
+  EXPECT_TRUE(registry.compact(WeakFamilyRegistry::kMinCompactionSize / 2));
+  auto weakFamilies = registry.weakFamiliesForSurfaceId(1);
+  EXPECT_EQ(countAlive(weakFamilies), liveFamilies.size());
+  EXPECT_LT(weakFamilies.size(), WeakFamilyRegistry::kMinCompactionSize);
+
+  auto removedFamilies = registry.removeFamiliesWithSurfaceId(1);
+  EXPECT_EQ(countAlive(removedFamilies.weakFamilies), liveFamilies.size());
+  EXPECT_EQ(removedFamilies.weakFamilies.size(), weakFamilies.size());
+  EXPECT_FALSE(registry.compact(WeakFamilyRegistry::kMinCompactionSize));
+}
@@ -15,6 +15,7 @@
 #include <cstdlib>
 #include <limits>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace facebook::react {
@@ -127,6 +128,12 @@ class MapBuffer {
 
   std::string getString(MapBuffer::Key key) const;
 
+  /**
+   * Same as getString, without copying: the result points into this
+   * MapBuffer. Use MapBufferView to read nested maps without copying them.
+   */
+  std::string_view getStringView(MapBuffer::Key key) const;
+
   // TODO T83483191: review this declaration
   MapBuffer getMapBuffer(MapBuffer::Key key) const;
 
@@ -145,11 +152,6 @@ class MapBuffer {
   // amount of items in the MapBuffer
   uint16_t count_ = 0;
 
-  // returns the relative offset of the first byte of dynamic data
-  int32_t getDynamicDataOffset() const;
-
-  int32_t getKeyBucket(MapBuffer::Key key) const;
-
   friend JReadableMapBuffer;
 };
 
@@ -7,6 +7,7 @@
 
 #include "MapBufferBuilder.h"
 #include <algorithm>
+#include <cstring>
 
 using namespace facebook::react;
 
@@ -17,14 +18,115 @@ constexpr uint32_t LONG_SIZE = sizeof(uint64_t);
 constexpr uint32_t DOUBLE_SIZE = sizeof(double);
 constexpr uint32_t MAX_BUCKET_VALUE_SIZE = sizeof(uint64_t);
 
+constexpr size_t HEADER_SIZE = sizeof(MapBuffer::Header);
+constexpr size_t BUCKET_SIZE = sizeof(MapBuffer::Bucket);
+constexpr size_t INITIAL_DYNAMIC_DATA_SIZE = 128;
+
 MapBuffer MapBufferBuilder::EMPTY() {
   return MapBufferBuilder(0).build();
 }
 
-MapBufferBuilder::MapBufferBuilder(uint32_t initialSize) {
+MapBufferBuilder::MapBufferBuilder(uint32_t initialSize)
+    : reservedBucketCount_(initialSize) {
   buckets_.reserve(initialSize);
-  header_.count = 0;
-  header_.bufferSize = 0;
+  bytes_.reserve(
+      HEADER_SIZE + BUCKET_SIZE * initialSize + INITIAL_DYNAMIC_DATA_SIZE);
+  begin();
+}
+
+MapBufferBuilder::MapBufferBuilder(
+    MapBufferBuilder& parent,
+    uint32_t initialSize)
+    : root_(parent.root_ != nullptr ? parent.root_ : &parent),
+      depth_(parent.depth_ + 1),
+      reservedBucketCount_(initialSize) {
+  begin();
+}
+
+void MapBufferBuilder::begin() {
+  auto& bytes = this->bytes();
+  start_ = bytes.size();
+  bucketsStart_ = buckets().size();
+  lastKey_ = 0;
+  needsSort_ = false;
+
+  // The header and buckets are written by finish(), once they're known
+  dynamicDataStart_ = start_ + HEADER_SIZE + BUCKET_SIZE * reservedBucketCount_;
+  bytes.resize(dynamicDataStart_);
+}
+
+void MapBufferBuilder::ensureBegun() {
+  react_native_assert(
+      (root_ != nullptr ? root_->activeDepth_ : activeDepth_) == depth_ &&
+      "MapBufferBuilder used while building a nested map");
+  if (bytes_.empty() && root_ == nullptr) {
+    // build() was called
+    begin();
+  }
+}
+
+void MapBufferBuilder::finish() {
+  auto& bytes = this->bytes();
+  auto& buckets = this->buckets();
+
+  const size_t count = buckets.size() - bucketsStart_;
+  const size_t dynamicDataSize = bytes.size() - dynamicDataStart_;
+
+  // Fit the space between the header and the dynamic data to the buckets.
+  // Nothing moves if as many buckets as were reserved have been put.
+  const size_t bucketsEnd = start_ + HEADER_SIZE + BUCKET_SIZE * count;
+  if (bucketsEnd > dynamicDataStart_) {
+    bytes.resize(bucketsEnd + dynamicDataSize);
+    memmove(
+        bytes.data() + bucketsEnd,
+        bytes.data() + dynamicDataStart_,
+        dynamicDataSize);
+  } else if (bucketsEnd < dynamicDataStart_) {
+    memmove(
+        bytes.data() + bucketsEnd,
+        bytes.data() + dynamicDataStart_,
+        dynamicDataSize);
+    bytes.resize(bucketsEnd + dynamicDataSize);
+  }
+
+  if (needsSort_) {
+    std::sort(
+        buckets.begin() + bucketsStart_,
+        buckets.end(),
+        [](const MapBuffer::Bucket& a, const MapBuffer::Bucket& b) {
+          return a.key < b.key;
+        });
+  }
+
+  // TODO(T83483191): add pass to check for duplicates
+
+  MapBuffer::Header header{
+      .count = static_cast<uint16_t>(count),
+      .bufferSize = static_cast<uint32_t>(bytes.size() - start_)};
+  memcpy(bytes.data() + start_, &header, HEADER_SIZE);
+  if (count > 0) {
+    memcpy(
+        bytes.data() + start_ + HEADER_SIZE,
+        buckets.data() + bucketsStart_,
+        BUCKET_SIZE * count);
+  }
+
+  buckets.erase(buckets.begin() + bucketsStart_, buckets.end());
+}
+
+int32_t MapBufferBuilder::appendDynamicData(const void* data, size_t size) {
+  auto& bytes = this->bytes();
+  const size_t end = bytes.size();
+  auto offset = static_cast<int32_t>(end - dynamicDataStart_);
+  auto dataSize = static_cast<int32_t>(size);
+
+  // format [length of data (int)] + [bytes of data]
+  bytes.resize(end + INT_SIZE + size);
+  memcpy(bytes.data() + end, &dataSize, INT_SIZE);
+  if (size > 0) {
+    memcpy(bytes.data() + end + INT_SIZE, data, size);
+  }
+  return offset;
 }
 
 void MapBufferBuilder::storeKeyValue(
@@ -42,9 +144,7 @@ void MapBufferBuilder::storeKeyValue(
   auto* dataPtr = reinterpret_cast<uint8_t*>(&data);
   memcpy(dataPtr, value, valueSize);
 
-  buckets_.emplace_back(key, static_cast<uint16_t>(type), data);
-
-  header_.count++;
+  buckets().emplace_back(key, static_cast<uint16_t>(type), data);
 
   if (lastKey_ > key) {
     needsSort_ = true;
@@ -53,6 +153,7 @@ void MapBufferBuilder::storeKeyValue(
 }
 
 void MapBufferBuilder::putBool(MapBuffer::Key key, bool value) {
+  ensureBegun();
   int intValue = (int)value;
   storeKeyValue(
       key,
@@ -62,6 +163,7 @@ void MapBufferBuilder::putBool(MapBuffer::Key key, bool value) {
 }
 
 void MapBufferBuilder::putDouble(MapBuffer::Key key, double value) {
+  ensureBegun();
   storeKeyValue(
       key,
       MapBuffer::DataType::Double,
@@ -70,6 +172,7 @@ void MapBufferBuilder::putDouble(MapBuffer::Key key, double value) {
 }
 
 void MapBufferBuilder::putInt(MapBuffer::Key key, int32_t value) {
+  ensureBegun();
   storeKeyValue(
       key,
       MapBuffer::DataType::Int,
@@ -78,6 +181,7 @@ void MapBufferBuilder::putInt(MapBuffer::Key key, int32_t value) {
 }
 
 void MapBufferBuilder::putLong(MapBuffer::Key key, int64_t value) {
+  ensureBegun();
   storeKeyValue(
       key,
       MapBuffer::DataType::Long,
@@ -85,15 +189,11 @@ void MapBufferBuilder::putLong(MapBuffer::Key key, int64_t value) {
       LONG_SIZE);
 }
 
-void MapBufferBuilder::putString(MapBuffer::Key key, const std::string& value) {
-  auto strSize = value.size();
-  const char* strData = value.data();
+void MapBufferBuilder::putString(MapBuffer::Key key, std::string_view value) {
+  ensureBegun();
 
   // format [length of string (int)] + [Array of Characters in the string]
-  auto offset = dynamicData_.size();
-  dynamicData_.resize(offset + INT_SIZE + strSize, 0);
-  memcpy(dynamicData_.data() + offset, &strSize, INT_SIZE);
-  memcpy(dynamicData_.data() + offset + INT_SIZE, strData, strSize);
+  auto offset = appendDynamicData(value.data(), value.size());
 
   // Store Key and pointer to the string
   storeKeyValue(
@@ -104,15 +204,10 @@ void MapBufferBuilder::putString(MapBuffer::Key key, const std::string& value) {
 }
 
 void MapBufferBuilder::putMapBuffer(MapBuffer::Key key, const MapBuffer& map) {
-  auto mapBufferSize = map.size();
-
-  auto offset = dynamicData_.size();
+  ensureBegun();
 
   // format [length of buffer (int)] + [bytes of MapBuffer]
-  dynamicData_.resize(offset + INT_SIZE + mapBufferSize, 0);
-  memcpy(dynamicData_.data() + offset, &mapBufferSize, INT_SIZE);
-  // Copy the content of the map into dynamicData_
-  memcpy(dynamicData_.data() + offset + INT_SIZE, map.data(), mapBufferSize);
+  auto offset = appendDynamicData(map.data(), map.size());
 
   // Store Key and pointer to the string
   storeKeyValue(
@@ -122,29 +217,64 @@ void MapBufferBuilder::putMapBuffer(MapBuffer::Key key, const MapBuffer& map) {
       INT_SIZE);
 }
 
+MapBufferBuilder MapBufferBuilder::beginMapBuffer(
+    MapBuffer::Key key,
+    uint32_t bucketCount) {
+  ensureBegun();
+
+  // format [length of buffer (int)] + [bytes of MapBuffer], the length is
+  // written by endMapBuffer()
+  auto offset = appendDynamicData(nullptr, 0);
+
+  storeKeyValue(
+      key,
+      MapBuffer::DataType::Map,
+      reinterpret_cast<const uint8_t*>(&offset),
+      INT_SIZE);
+
+  auto& root = root_ != nullptr ? *root_ : *this;
+  root.activeDepth_ = depth_ + 1;
+  return MapBufferBuilder(*this, bucketCount);
+}
+
+void MapBufferBuilder::endMapBuffer(MapBufferBuilder& nestedBuilder) {
+  nestedBuilder.finish();
+
+  auto& bytes = this->bytes();
+  auto mapBufferSize =
+      static_cast<int32_t>(bytes.size() - nestedBuilder.start_);
+  memcpy(
+      bytes.data() + nestedBuilder.start_ - INT_SIZE,
+      &mapBufferSize,
+      INT_SIZE);
+
+  auto& root = root_ != nullptr ? *root_ : *this;
+  root.activeDepth_ = depth_;
+}
+
 void MapBufferBuilder::putMapBufferList(
     MapBuffer::Key key,
     const std::vector<MapBuffer>& mapBufferList) {
-  auto offset = static_cast<int32_t>(dynamicData_.size());
+  ensureBegun();
   int32_t dataSize = 0;
   for (const MapBuffer& mapBuffer : mapBufferList) {
     dataSize = dataSize + INT_SIZE + static_cast<int32_t>(mapBuffer.size());
   }
 
-  dynamicData_.resize(offset + INT_SIZE, 0);
-  memcpy(dynamicData_.data() + offset, &dataSize, INT_SIZE);
+  // format [length of list (int)] + [length of buffer (int)] + [bytes of
+  // MapBuffer] for each item in the list
+  auto& bytes = this->bytes();
+  auto offset = static_cast<int32_t>(bytes.size() - dynamicDataStart_);
+  size_t end = bytes.size();
+  bytes.resize(end + INT_SIZE + dataSize);
+  memcpy(bytes.data() + end, &dataSize, INT_SIZE);
+  end += INT_SIZE;
 
   for (const MapBuffer& mapBuffer : mapBufferList) {
     auto mapBufferSize = static_cast<int32_t>(mapBuffer.size());
-    auto dynamicDataSize = static_cast<int32_t>(dynamicData_.size());
-    dynamicData_.resize(dynamicDataSize + INT_SIZE + mapBufferSize, 0);
-    // format [length of buffer (int)] + [bytes of MapBuffer]
-    memcpy(dynamicData_.data() + dynamicDataSize, &mapBufferSize, INT_SIZE);
-    // Copy the content of the map into dynamicData_
-    memcpy(
-        dynamicData_.data() + dynamicDataSize + INT_SIZE,
-        mapBuffer.data(),
-        mapBufferSize);
+    memcpy(bytes.data() + end, &mapBufferSize, INT_SIZE);
+    memcpy(bytes.data() + end + INT_SIZE, mapBuffer.data(), mapBufferSize);
+    end += INT_SIZE + mapBufferSize;
   }
 
   // Store Key and pointer to the string
@@ -155,35 +285,16 @@ void MapBufferBuilder::putMapBufferList(
       INT_SIZE);
 }
 
-static inline bool compareBuckets(
-    const MapBuffer::Bucket& a,
-    const MapBuffer::Bucket& b) {
-  return a.key < b.key;
-}
-
 MapBuffer MapBufferBuilder::build() {
-  // Create buffer: [header] + [key, values] + [dynamic data]
-  auto bucketSize = buckets_.size() * sizeof(MapBuffer::Bucket);
-  auto headerSize = sizeof(MapBuffer::Header);
-  auto bufferSize = headerSize + bucketSize + dynamicData_.size();
-
-  header_.bufferSize = static_cast<uint32_t>(bufferSize);
-
-  if (needsSort_) {
-    std::sort(buckets_.begin(), buckets_.end(), compareBuckets);
-  }
-
-  // TODO(T83483191): add pass to check for duplicates
-
-  std::vector<uint8_t> buffer(bufferSize);
-  memcpy(buffer.data(), &header_, headerSize);
-  memcpy(buffer.data() + headerSize, buckets_.data(), bucketSize);
-  memcpy(
-      buffer.data() + headerSize + bucketSize,
-      dynamicData_.data(),
-      dynamicData_.size());
-
-  return MapBuffer(std::move(buffer));
+  react_native_assert(
+      root_ == nullptr && "build() can't be called on a nested builder");
+  ensureBegun();
+  finish();
+
+  // The next put*() call begins a new map
+  auto bytes = std::move(bytes_);
+  bytes_.clear();
+  return MapBuffer(std::move(bytes));
 }
 
 } // namespace facebook::react
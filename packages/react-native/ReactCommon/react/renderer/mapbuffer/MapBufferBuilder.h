@@ -8,6 +8,9 @@
 #pragma once
 
 #include <react/debug/react_native_assert.h>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 #include <vector>
 #include "MapBuffer.h"
 
@@ -17,12 +20,29 @@ namespace facebook::react {
 constexpr uint32_t INITIAL_BUCKETS_SIZE = 10;
 
 /**
- * MapBufferBuilder is a builder class for MapBuffer
+ * MapBufferBuilder is a builder class for MapBuffer.
+ *
+ * Everything is written in place into a single growable buffer, which is
+ * handed off to the MapBuffer by build() without being copied. Buckets are
+ * collected on the side and only sorted if keys were not put in ascending
+ * order.
+ *
+ * Space for `initialSize` buckets is reserved ahead of the dynamic data
+ * (strings and nested maps). If the map ends up with a different number of
+ * entries, its dynamic data is moved once when it's done, so passing the
+ * expected number of entries avoids that copy.
+ *
+ * Nested maps can be encoded in place as well, see putMapBuffer(key, fill).
  */
 class MapBufferBuilder {
  public:
   MapBufferBuilder(uint32_t initialSize = INITIAL_BUCKETS_SIZE);
 
+  MapBufferBuilder(const MapBufferBuilder&) = delete;
+  MapBufferBuilder& operator=(const MapBufferBuilder&) = delete;
+  MapBufferBuilder(MapBufferBuilder&&) = default;
+  MapBufferBuilder& operator=(MapBufferBuilder&&) = default;
+
   static MapBuffer EMPTY();
 
   void putInt(MapBuffer::Key key, int32_t value);
@@ -33,27 +53,96 @@ class MapBufferBuilder {
 
   void putDouble(MapBuffer::Key key, double value);
 
-  void putString(MapBuffer::Key key, const std::string& value);
+  void putString(MapBuffer::Key key, std::string_view value);
 
   void putMapBuffer(MapBuffer::Key key, const MapBuffer& map);
 
+  /**
+   * Encodes a nested map directly into this builder's buffer, instead of
+   * building a separate MapBuffer and copying it: `fill` is called with a
+   * builder for the nested map. This builder must not be used until `fill`
+   * returns.
+   */
+  template <typename Fill>
+    requires std::is_invocable_v<Fill, MapBufferBuilder&>
+  void putMapBuffer(MapBuffer::Key key, Fill&& fill) {
+    putMapBuffer(key, INITIAL_BUCKETS_SIZE, std::forward<Fill>(fill));
+  }
+
+  /**
+   * Same as above, reserving space for `bucketCount` entries in the nested
+   * map, which must be its exact number of entries for its data not to be
+   * moved.
+   */
+  template <typename Fill>
+    requires std::is_invocable_v<Fill, MapBufferBuilder&>
+  void putMapBuffer(MapBuffer::Key key, uint32_t bucketCount, Fill&& fill) {
+    auto nestedBuilder = beginMapBuffer(key, bucketCount);
+    std::forward<Fill>(fill)(nestedBuilder);
+    endMapBuffer(nestedBuilder);
+  }
+
   void putMapBufferList(
       MapBuffer::Key key,
       const std::vector<MapBuffer>& mapBufferList);
 
+  /**
+   * Returns the MapBuffer, leaving the builder empty.
+   */
   MapBuffer build();
 
  private:
-  MapBuffer::Header header_;
+  // Builder for a map nested in the one built by `parent`
+  MapBufferBuilder(MapBufferBuilder& parent, uint32_t initialSize);
+
+  MapBufferBuilder beginMapBuffer(MapBuffer::Key key, uint32_t bucketCount);
+
+  void endMapBuffer(MapBufferBuilder& nestedBuilder);
+
+  // The builder owning bytes_ and buckets_, nullptr if this is the one
+  MapBufferBuilder* root_{nullptr};
+
+  // Nesting level of this builder, and of the innermost builder in use for
+  // the root one.
+  uint32_t depth_{0};
+  uint32_t activeDepth_{0};
 
+  uint32_t reservedBucketCount_;
+
+  // Serialized maps: header, space reserved for the buckets, dynamic data
+  std::vector<uint8_t> bytes_{};
+
+  // Buckets of the maps being built, from the outermost to the innermost
   std::vector<MapBuffer::Bucket> buckets_{};
 
-  std::vector<uint8_t> dynamicData_{};
+  // Offset of this map in bytes(), and of its dynamic data
+  size_t start_{0};
+  size_t dynamicDataStart_{0};
+
+  // Index of the first bucket of this map in buckets()
+  size_t bucketsStart_{0};
 
   uint16_t lastKey_{0};
 
   bool needsSort_{false};
 
+  std::vector<uint8_t>& bytes() {
+    return root_ != nullptr ? root_->bytes_ : bytes_;
+  }
+
+  std::vector<MapBuffer::Bucket>& buckets() {
+    return root_ != nullptr ? root_->buckets_ : buckets_;
+  }
+
+  void begin();
+
+  void ensureBegun();
+
+  void finish();
+
+  // Appends [size (int)] + [data] to the dynamic data, returns its offset
+  int32_t appendDynamicData(const void* data, size_t size);
+
   void storeKeyValue(
       MapBuffer::Key key,
       MapBuffer::DataType type,
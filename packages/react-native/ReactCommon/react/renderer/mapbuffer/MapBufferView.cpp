@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "MapBufferView.h"
+
+#include <cstring>
+#include <vector>
+
+namespace facebook::react {
+
+const uint8_t* MapBufferView::getDynamicData(MapBuffer::Key key) const {
+  // The start of dynamic data can be calculated as the offset of the next
+  // key in the map
+  return getBucket(count_) + getInt(key);
+}
+
+std::string_view MapBufferView::getString(MapBuffer::Key key) const {
+  const uint8_t* dynamicData = getDynamicData(key);
+  auto stringLength = read<int32_t>(dynamicData);
+
+  return {
+      reinterpret_cast<const char*>(dynamicData + sizeof(int32_t)),
+      static_cast<size_t>(stringLength)};
+}
+
+MapBufferView MapBufferView::getMapBuffer(MapBuffer::Key key) const {
+  return MapBufferView(getDynamicData(key) + sizeof(int32_t));
+}
+
+MapBufferListView MapBufferView::getMapBufferList(MapBuffer::Key key) const {
+  const uint8_t* dynamicData = getDynamicData(key);
+  auto mapBufferListLength = read<int32_t>(dynamicData);
+  const uint8_t* begin = dynamicData + sizeof(int32_t);
+
+  return {begin, begin + mapBufferListLength};
+}
+
+MapBuffer MapBufferView::toMapBuffer() const {
+  return MapBuffer(std::vector<uint8_t>(data_, data_ + size()));
+}
+
+size_t MapBufferView::size() const {
+  return read<uint32_t>(data_ + offsetof(MapBuffer::Header, bufferSize));
+}
+
+const uint8_t* MapBufferView::data() const {
+  return data_;
+}
+
+uint16_t MapBufferView::count() const {
+  return count_;
+}
+
+MapBufferView MapBufferListView::Iterator::operator*() const {
+  return MapBufferView(position_ + sizeof(int32_t));
+}
+
+MapBufferListView::Iterator& MapBufferListView::Iterator::operator++() {
+  int32_t mapBufferLength = 0;
+  std::memcpy(&mapBufferLength, position_, sizeof(int32_t));
+  position_ += sizeof(int32_t) + mapBufferLength;
+  return *this;
+}
+
+MapBufferListView::Iterator MapBufferListView::Iterator::operator++(int) {
+  auto previous = *this;
+  ++*this;
+  return previous;
+}
+
+} // namespace facebook::react
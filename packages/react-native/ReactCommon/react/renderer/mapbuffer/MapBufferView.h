@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/debug/react_native_assert.h>
+#include <react/renderer/mapbuffer/MapBuffer.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string_view>
+
+namespace facebook::react {
+
+class MapBufferListView;
+
+/**
+ * MapBufferView is a non-owning, read-only view over the bytes of a
+ * serialized MapBuffer.
+ *
+ * Strings are returned as std::string_view, and nested maps and lists of maps
+ * as views into the same bytes, so reading a map (however deep) never
+ * allocates. A view, and everything read from it, is only valid as long as
+ * the underlying bytes are alive.
+ */
+class MapBufferView {
+ public:
+  explicit MapBufferView(const MapBuffer& map)
+      : data_(map.data()), count_(map.count()) {}
+
+  /**
+   * Creates a view over a serialized MapBuffer, starting with its header.
+   */
+  explicit MapBufferView(const uint8_t* data)
+      : data_(data),
+        count_(read<uint16_t>(data + offsetof(MapBuffer::Header, count))) {}
+
+  int32_t getInt(MapBuffer::Key key) const {
+    return read<int32_t>(getValue(key));
+  }
+
+  int64_t getLong(MapBuffer::Key key) const {
+    return read<int64_t>(getValue(key));
+  }
+
+  bool getBool(MapBuffer::Key key) const {
+    return getInt(key) != 0;
+  }
+
+  double getDouble(MapBuffer::Key key) const {
+    return read<double>(getValue(key));
+  }
+
+  std::string_view getString(MapBuffer::Key key) const;
+
+  MapBufferView getMapBuffer(MapBuffer::Key key) const;
+
+  MapBufferListView getMapBufferList(MapBuffer::Key key) const;
+
+  /**
+   * Copies the viewed bytes into a MapBuffer which owns them.
+   */
+  MapBuffer toMapBuffer() const;
+
+  size_t size() const;
+
+  const uint8_t* data() const;
+
+  uint16_t count() const;
+
+ private:
+  const uint8_t* data_;
+
+  // amount of items in the MapBuffer
+  uint16_t count_;
+
+  // Nested maps and dynamic data are not aligned, so every value is read
+  // with memcpy rather than through a cast pointer.
+  template <typename T>
+  static T read(const uint8_t* data) {
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return value;
+  }
+
+  const uint8_t* getBucket(int32_t index) const {
+    return data_ + sizeof(MapBuffer::Header) +
+        sizeof(MapBuffer::Bucket) * index;
+  }
+
+  MapBuffer::Key getBucketKey(int32_t index) const {
+    return read<MapBuffer::Key>(
+        getBucket(index) + offsetof(MapBuffer::Bucket, key));
+  }
+
+  int32_t getKeyBucket(MapBuffer::Key key) const {
+    if (count_ == 0) {
+      return -1;
+    }
+
+    // Buckets are sorted by key, and keys are usually a contiguous range (e.g.
+    // list indices or the keys of a fully populated struct), in which case
+    // the bucket index of a key is its distance to the first key.
+    MapBuffer::Key firstKey = getBucketKey(0);
+    MapBuffer::Key lastKey = getBucketKey(count_ - 1);
+    if (key < firstKey || key > lastKey) {
+      return -1;
+    }
+    if (lastKey - firstKey == count_ - 1) {
+      int32_t index = key - firstKey;
+      // Duplicate keys can make a map look contiguous when it isn't
+      if (getBucketKey(index) == key) {
+        return index;
+      }
+    }
+
+    int32_t lo = 0;
+    int32_t hi = count_ - 1;
+    while (lo <= hi) {
+      int32_t mid = (lo + hi) >> 1;
+
+      MapBuffer::Key midVal = getBucketKey(mid);
+
+      if (midVal < key) {
+        lo = mid + 1;
+      } else if (midVal > key) {
+        hi = mid - 1;
+      } else {
+        return mid;
+      }
+    }
+
+    return -1;
+  }
+
+  // returns a pointer to the first byte of the bucket value of `key`
+  const uint8_t* getValue(MapBuffer::Key key) const {
+    auto bucketIndex = getKeyBucket(key);
+    react_native_assert(bucketIndex != -1 && "Key not found in MapBuffer");
+
+    return getBucket(bucketIndex) + offsetof(MapBuffer::Bucket, data);
+  }
+
+  // returns a pointer to the [length | bytes] dynamic data of `key`
+  const uint8_t* getDynamicData(MapBuffer::Key key) const;
+};
+
+/**
+ * A lazy, non-owning view over a list of MapBuffers, as written by
+ * MapBufferBuilder::putMapBufferList. Elements are only located while
+ * iterating.
+ */
+class MapBufferListView {
+ public:
+  class Iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = MapBufferView;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = MapBufferView;
+
+    Iterator() = default;
+
+    explicit Iterator(const uint8_t* position) : position_(position) {}
+
+    MapBufferView operator*() const;
+
+    Iterator& operator++();
+
+    Iterator operator++(int);
+
+    bool operator==(const Iterator& other) const = default;
+
+   private:
+    // points to the [length | bytes] of the current element
+    const uint8_t* position_{nullptr};
+  };
+
+  MapBufferListView(const uint8_t* begin, const uint8_t* end)
+      : begin_(begin), end_(end) {}
+
+  Iterator begin() const {
+    return Iterator(begin_);
+  }
+
+  Iterator end() const {
+    return Iterator(end_);
+  }
+
+  bool empty() const {
+    return begin_ == end_;
+  }
+
+ private:
+  const uint8_t* begin_;
+  const uint8_t* end_;
+};
+
+} // namespace facebook::react
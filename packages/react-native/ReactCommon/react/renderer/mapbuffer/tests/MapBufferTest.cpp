@@ -12,6 +12,7 @@
 #include <gtest/gtest.h>
 #include <react/renderer/mapbuffer/MapBuffer.h>
 #include <react/renderer/mapbuffer/MapBufferBuilder.h>
+#include <react/renderer/mapbuffer/MapBufferView.h>
 
 using namespace facebook::react;
 
@@ -210,3 +211,174 @@ TEST(MapBufferTest, testMapRandomAccess) {
   EXPECT_EQ(map.getInt(1234), 4321);
   EXPECT_EQ(map.getString(65535), "Let's count: 的, 一, 是");
 }
+
+TEST(MapBufferTest, testNestedMapEntries) {
+  auto builder = MapBufferBuilder();
+  builder.putInt(0, 4321);
+  builder.putMapBuffer(1, [](MapBufferBuilder& nestedBuilder) {
+    nestedBuilder.putString(0, "This is a test");
+    nestedBuilder.putMapBuffer(2, [](MapBufferBuilder& innerBuilder) {
+      innerBuilder.putDouble(1, 908.1);
+      innerBuilder.putString(0, "Let's count: 的, 一, 是");
+    });
+    nestedBuilder.putInt(1, 1234);
+  });
+  builder.putString(2, "After the nested map");
+  auto map = builder.build();
+
+  EXPECT_EQ(map.count(), 3);
+  EXPECT_EQ(map.getInt(0), 4321);
+  EXPECT_EQ(map.getString(2), "After the nested map");
+
+  auto nestedMap = map.getMapBuffer(1);
+  EXPECT_EQ(nestedMap.count(), 3);
+  EXPECT_EQ(nestedMap.getString(0), "This is a test");
+  EXPECT_EQ(nestedMap.getInt(1), 1234);
+
+  auto innerMap = nestedMap.getMapBuffer(2);
+  EXPECT_EQ(innerMap.count(), 2);
+  EXPECT_EQ(innerMap.getString(0), "Let's count: 的, 一, 是");
+  EXPECT_EQ(innerMap.getDouble(1), 908.1);
+}
+
+TEST(MapBufferTest, testNestedMapMatchesCopiedMap) {
+  auto fill = [](MapBufferBuilder& builder) {
+    for (MapBuffer::Key key = 0; key < 30; key++) {
+      builder.putString(29 - key, "Value " + std::to_string(key));
+    }
+  };
+
+  auto copiedBuilder = MapBufferBuilder();
+  auto nestedBuilder = MapBufferBuilder();
+  fill(nestedBuilder);
+  copiedBuilder.putMapBuffer(0, nestedBuilder.build());
+  auto copiedMap = copiedBuilder.build();
+
+  auto builder = MapBufferBuilder();
+  builder.putMapBuffer(0, fill);
+  auto map = builder.build();
+
+  ASSERT_EQ(map.size(), copiedMap.size());
+  EXPECT_EQ(0, memcmp(map.data(), copiedMap.data(), map.size()));
+}
+
+TEST(MapBufferTest, testNestedMapWithBucketCount) {
+  auto fill = [](MapBufferBuilder& builder) {
+    builder.putString(0, "This is a test");
+    builder.putMapBuffer(1, 1, [](MapBufferBuilder& innerBuilder) {
+      innerBuilder.putString(0, "Let's count: 的, 一, 是");
+    });
+    builder.putInt(2, 1234);
+  };
+
+  auto expectedBuilder = MapBufferBuilder();
+  expectedBuilder.putMapBuffer(0, fill);
+  auto expectedMap = expectedBuilder.build();
+
+  // Exact, too small and too large bucket counts
+  for (uint32_t bucketCount : {3, 1, 20}) {
+    auto builder = MapBufferBuilder(1);
+    builder.putMapBuffer(0, bucketCount, fill);
+    auto map = builder.build();
+
+    ASSERT_EQ(map.size(), expectedMap.size());
+    EXPECT_EQ(0, memcmp(map.data(), expectedMap.data(), map.size()));
+  }
+}
+
+TEST(MapBufferTest, testBuilderCanBeReused) {
+  auto builder = MapBufferBuilder();
+  builder.putInt(0, 1234);
+  auto map = builder.build();
+
+  builder.putString(1, "This is a test");
+  auto map2 = builder.build();
+
+  EXPECT_EQ(map.count(), 1);
+  EXPECT_EQ(map.getInt(0), 1234);
+  EXPECT_EQ(map2.count(), 1);
+  EXPECT_EQ(map2.getString(1), "This is a test");
+}
+
+TEST(MapBufferTest, testKeyLookupWithGaps) {
+  auto builder = MapBufferBuilder();
+  for (MapBuffer::Key key = 5; key < 15; key++) {
+    builder.putInt(key, key * 10);
+  }
+  builder.putInt(20, 200);
+  builder.putInt(1000, 10000);
+  auto map = builder.build();
+
+  EXPECT_EQ(map.count(), 12);
+  for (MapBuffer::Key key = 5; key < 15; key++) {
+    EXPECT_EQ(map.getInt(key), key * 10);
+  }
+  EXPECT_EQ(map.getInt(20), 200);
+  EXPECT_EQ(map.getInt(1000), 10000);
+}
+
+TEST(MapBufferTest, testMapBufferView) {
+  auto builder = MapBufferBuilder();
+  builder.putString(0, "This is a test");
+  builder.putMapBuffer(1, [](MapBufferBuilder& nestedBuilder) {
+    nestedBuilder.putInt(0, 1234);
+    nestedBuilder.putString(1, "Let's count: 的, 一, 是");
+    nestedBuilder.putDouble(2, 908.1);
+  });
+  builder.putBool(2, true);
+  auto map = builder.build();
+
+  auto view = MapBufferView(map);
+  EXPECT_EQ(view.count(), 3);
+  EXPECT_EQ(view.size(), map.size());
+  EXPECT_EQ(view.getString(0), "This is a test");
+  EXPECT_EQ(map.getStringView(0), "This is a test");
+  EXPECT_TRUE(view.getBool(2));
+
+  // Nested maps and strings point into the original buffer
+  auto nestedView = view.getMapBuffer(1);
+  EXPECT_GT(nestedView.data(), map.data());
+  EXPECT_LE(nestedView.data() + nestedView.size(), map.data() + map.size());
+  EXPECT_EQ(nestedView.count(), 3);
+  EXPECT_EQ(nestedView.getInt(0), 1234);
+  EXPECT_EQ(nestedView.getString(1), "Let's count: 的, 一, 是");
+  EXPECT_EQ(nestedView.getDouble(2), 908.1);
+
+  auto nestedString = nestedView.getString(1);
+  EXPECT_GT(
+      reinterpret_cast<const uint8_t*>(nestedString.data()),
+      nestedView.data());
+
+  auto nestedMap = nestedView.toMapBuffer();
+  EXPECT_EQ(nestedMap.size(), nestedView.size());
+  EXPECT_EQ(nestedMap.getString(1), "Let's count: 的, 一, 是");
+}
+
+TEST(MapBufferTest, testMapBufferListView) {
+  std::vector<MapBuffer> mapBufferList;
+  for (int i = 0; i < 3; i++) {
+    auto builder = MapBufferBuilder();
+    builder.putInt(0, i);
+    builder.putString(1, "Item " + std::to_string(i));
+    mapBufferList.push_back(builder.build());
+  }
+
+  auto builder = MapBufferBuilder();
+  builder.putMapBufferList(0, mapBufferList);
+  builder.putMapBufferList(1, {});
+  auto map = builder.build();
+
+  auto listView = MapBufferView(map).getMapBufferList(0);
+  EXPECT_FALSE(listView.empty());
+  int i = 0;
+  for (auto itemView : listView) {
+    EXPECT_EQ(itemView.count(), 2);
+    EXPECT_EQ(itemView.getInt(0), i);
+    EXPECT_EQ(itemView.getString(1), "Item " + std::to_string(i));
+    i++;
+  }
+  EXPECT_EQ(i, 3);
+
+  EXPECT_TRUE(MapBufferView(map).getMapBufferList(1).empty());
+  EXPECT_TRUE(map.getMapBufferList(1).empty());
+}
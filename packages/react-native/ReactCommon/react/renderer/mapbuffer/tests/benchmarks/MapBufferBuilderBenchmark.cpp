@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/mapbuffer/MapBufferBuilder.h>
+
+#include <string>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr MapBuffer::Key AttributeCount = 20;
+
+const std::string FragmentText =
+    "Lorem ipsum dolor sit amet, consectetur adipiscing elit";
+
+// Roughly the shape of the text attributes of an attributed string fragment
+void putTextAttributes(MapBufferBuilder& builder) {
+  for (MapBuffer::Key key = 0; key < AttributeCount; key++) {
+    if (key % 4 == 0) {
+      builder.putString(key, "attribute");
+    } else if (key % 4 == 1) {
+      builder.putDouble(key, 14.5);
+    } else {
+      builder.putInt(key, key);
+    }
+  }
+}
+
+// A map with one nested map per fragment, each built separately and copied
+// into its parent.
+void buildCopiedMaps(benchmark::State& state) {
+  const auto fragmentCount = static_cast<MapBuffer::Key>(state.range(0));
+  size_t bytes = 0;
+  for (auto _ : state) {
+    auto fragmentsBuilder = MapBufferBuilder();
+    for (MapBuffer::Key index = 0; index < fragmentCount; index++) {
+      auto textAttributesBuilder = MapBufferBuilder();
+      putTextAttributes(textAttributesBuilder);
+      auto fragmentBuilder = MapBufferBuilder();
+      fragmentBuilder.putString(0, FragmentText);
+      fragmentBuilder.putMapBuffer(1, textAttributesBuilder.build());
+      fragmentsBuilder.putMapBuffer(index, fragmentBuilder.build());
+    }
+    auto builder = MapBufferBuilder();
+    builder.putInt(0, 42);
+    builder.putMapBuffer(1, fragmentsBuilder.build());
+    auto map = builder.build();
+    bytes += map.size();
+    benchmark::DoNotOptimize(map.data());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(bytes));
+}
+
+// Same map, with nested maps encoded in place
+void buildNestedMaps(benchmark::State& state) {
+  const auto fragmentCount = static_cast<MapBuffer::Key>(state.range(0));
+  size_t bytes = 0;
+  for (auto _ : state) {
+    auto builder = MapBufferBuilder();
+    builder.putInt(0, 42);
+    builder.putMapBuffer(1, [&](MapBufferBuilder& fragmentsBuilder) {
+      for (MapBuffer::Key index = 0; index < fragmentCount; index++) {
+        fragmentsBuilder.putMapBuffer(
+            index, [](MapBufferBuilder& fragmentBuilder) {
+              fragmentBuilder.putString(0, FragmentText);
+              fragmentBuilder.putMapBuffer(1, putTextAttributes);
+            });
+      }
+    });
+    auto map = builder.build();
+    bytes += map.size();
+    benchmark::DoNotOptimize(map.data());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(bytes));
+}
+
+// Same map, declaring the number of entries of every map but the text
+// attributes, so that only their dynamic data is moved when they're done
+void buildNestedMapsWithBucketCounts(benchmark::State& state) {
+  const auto fragmentCount = static_cast<MapBuffer::Key>(state.range(0));
+  size_t bytes = 0;
+  for (auto _ : state) {
+    auto builder = MapBufferBuilder(2);
+    builder.putInt(0, 42);
+    builder.putMapBuffer(
+        1, fragmentCount, [&](MapBufferBuilder& fragmentsBuilder) {
+          for (MapBuffer::Key index = 0; index < fragmentCount; index++) {
+            fragmentsBuilder.putMapBuffer(
+                index, 2, [](MapBufferBuilder& fragmentBuilder) {
+                  fragmentBuilder.putString(0, FragmentText);
+                  fragmentBuilder.putMapBuffer(1, putTextAttributes);
+                });
+          }
+        });
+    auto map = builder.build();
+    bytes += map.size();
+    benchmark::DoNotOptimize(map.data());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(bytes));
+}
+
+// Flat map with keys put in ascending or descending order
+template <bool Ascending>
+void buildFlatMap(benchmark::State& state) {
+  const auto count = static_cast<MapBuffer::Key>(state.range(0));
+  for (auto _ : state) {
+    auto builder = MapBufferBuilder();
+    for (MapBuffer::Key i = 0; i < count; i++) {
+      builder.putInt(Ascending ? i : count - i - 1, i);
+    }
+    auto map = builder.build();
+    benchmark::DoNotOptimize(map.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+} // namespace
+
+BENCHMARK(buildCopiedMaps)->Arg(1)->Arg(10)->Arg(100);
+BENCHMARK(buildNestedMaps)->Arg(1)->Arg(10)->Arg(100);
+BENCHMARK(buildNestedMapsWithBucketCounts)->Arg(1)->Arg(10)->Arg(100);
+BENCHMARK(buildFlatMap<true>)->Name("buildFlatMapSorted")->Arg(10)->Arg(100);
+BENCHMARK(buildFlatMap<false>)->Name("buildFlatMapUnsorted")->Arg(10)->Arg(100);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/mapbuffer/MapBufferBuilder.h>
+#include <react/renderer/mapbuffer/MapBufferView.h>
+
+#include <string>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr MapBuffer::Key AttributeCount = 20;
+
+const std::string FragmentText =
+    "Lorem ipsum dolor sit amet, consectetur adipiscing elit";
+
+// Flat map of ints, with keys either contiguous or spread out
+MapBuffer buildFlatMap(MapBuffer::Key count, MapBuffer::Key keyStride) {
+  auto builder = MapBufferBuilder();
+  for (MapBuffer::Key i = 0; i < count; i++) {
+    builder.putInt(i * keyStride, i);
+  }
+  return builder.build();
+}
+
+// Roughly the shape of an attributed string: a map of fragments, each with a
+// string and a nested map of text attributes.
+MapBuffer buildFragmentsMap(MapBuffer::Key fragmentCount) {
+  auto builder = MapBufferBuilder();
+  builder.putMapBuffer(0, [&](MapBufferBuilder& fragmentsBuilder) {
+    for (MapBuffer::Key index = 0; index < fragmentCount; index++) {
+      fragmentsBuilder.putMapBuffer(
+          index, [](MapBufferBuilder& fragmentBuilder) {
+            fragmentBuilder.putString(0, FragmentText);
+            fragmentBuilder.putMapBuffer(1, [](MapBufferBuilder& attributes) {
+              for (MapBuffer::Key key = 0; key < AttributeCount; key++) {
+                attributes.putInt(key, key);
+              }
+            });
+          });
+    }
+  });
+  return builder.build();
+}
+
+template <MapBuffer::Key KeyStride>
+void readFlatMap(benchmark::State& state) {
+  const auto count = static_cast<MapBuffer::Key>(state.range(0));
+  auto map = buildFlatMap(count, KeyStride);
+  for (auto _ : state) {
+    int64_t sum = 0;
+    for (MapBuffer::Key i = 0; i < count; i++) {
+      sum += map.getInt(i * KeyStride);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+// Reads every fragment through the owning API, which copies nested maps and
+// strings out of their parent.
+void readNestedMapsCopied(benchmark::State& state) {
+  const auto fragmentCount = static_cast<MapBuffer::Key>(state.range(0));
+  auto map = buildFragmentsMap(fragmentCount);
+  for (auto _ : state) {
+    size_t length = 0;
+    int64_t sum = 0;
+    auto fragments = map.getMapBuffer(0);
+    for (MapBuffer::Key index = 0; index < fragmentCount; index++) {
+      auto fragment = fragments.getMapBuffer(index);
+      length += fragment.getString(0).size();
+      auto attributes = fragment.getMapBuffer(1);
+      for (MapBuffer::Key key = 0; key < AttributeCount; key++) {
+        sum += attributes.getInt(key);
+      }
+    }
+    benchmark::DoNotOptimize(length);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * fragmentCount);
+}
+
+// Same reads through MapBufferView, without any allocation
+void readNestedMapsView(benchmark::State& state) {
+  const auto fragmentCount = static_cast<MapBuffer::Key>(state.range(0));
+  auto map = buildFragmentsMap(fragmentCount);
+  for (auto _ : state) {
+    size_t length = 0;
+    int64_t sum = 0;
+    auto fragments = MapBufferView(map).getMapBuffer(0);
+    for (MapBuffer::Key index = 0; index < fragmentCount; index++) {
+      auto fragment = fragments.getMapBuffer(index);
+      length += fragment.getString(0).size();
+      auto attributes = fragment.getMapBuffer(1);
+      for (MapBuffer::Key key = 0; key < AttributeCount; key++) {
+        sum += attributes.getInt(key);
+      }
+    }
+    benchmark::DoNotOptimize(length);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * fragmentCount);
+}
+
+} // namespace
+
+BENCHMARK(readFlatMap<1>)->Name("readFlatMapContiguous")->Arg(10)->Arg(1000);
+BENCHMARK(readFlatMap<3>)->Name("readFlatMapSparse")->Arg(10)->Arg(1000);
+BENCHMARK(readNestedMapsCopied)->Arg(1)->Arg(100);
+BENCHMARK(readNestedMapsView)->Arg(1)->Arg(100);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "CullingCache.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <react/renderer/core/LayoutableShadowNode.h>
+#include <react/renderer/graphics/Transform.h>
+#include <react/renderer/mounting/ShadowView.h>
+
+namespace facebook::react {
+
+namespace {
+
+bool isSameNode(
+    const std::weak_ptr<const ShadowNode>& weakShadowNode,
+    const ShadowNode::Shared& shadowNode) {
+  return !weakShadowNode.owner_before(shadowNode) &&
+      !shadowNode.owner_before(weakShadowNode);
+}
+
+bool hasSameChildren(
+    const ShadowNode::ListOfWeak& indexedChildren,
+    const ShadowNode::ListOfShared& children) {
+  // Cheap checks first: children are rarely the same size but different.
+  return indexedChildren.size() == children.size() &&
+      isSameNode(indexedChildren.front(), children.front()) &&
+      isSameNode(indexedChildren.back(), children.back()) &&
+      std::equal(
+          indexedChildren.begin(),
+          indexedChildren.end(),
+          children.begin(),
+          isSameNode);
+}
+
+} // namespace
+
+std::optional<std::vector<size_t>> CullingCache::getChildIndicesIntersecting(
+    const ShadowNode& shadowNode,
+    const Rect& frame) {
+  const auto& children = shadowNode.getChildren();
+  if (children.size() < kMinChildCount) {
+    return std::nullopt;
+  }
+
+  auto iterator =
+      std::find_if(indices_.begin(), indices_.end(), [&](const Index& index) {
+        return hasSameChildren(index.children, children);
+      });
+  if (iterator == indices_.end()) {
+    // Indices of replaced children lists can never match again.
+    indices_.erase(
+        std::remove_if(
+            indices_.begin(),
+            indices_.end(),
+            [](const Index& index) {
+              return index.children.front().expired() ||
+                  index.children.back().expired();
+            }),
+        indices_.end());
+    if (indices_.size() == kMaxIndexCount) {
+      indices_.pop_back();
+    }
+    indices_.insert(indices_.begin(), buildIndex(shadowNode));
+  } else {
+    std::rotate(indices_.begin(), iterator, iterator + 1);
+  }
+  const auto& index = indices_.front();
+
+  auto frameStart = index.isVertical ? frame.origin.y : frame.origin.x;
+  auto frameEnd = frameStart +
+      (index.isVertical ? frame.size.height : frame.size.width);
+
+  // Children starting before the end of the frame, from the first one which
+  // (or one before which) ends after its start.
+  auto first = std::lower_bound(
+                   index.maxEnds.begin(), index.maxEnds.end(), frameStart) -
+      index.maxEnds.begin();
+  auto last = std::upper_bound(
+                  index.bounds.begin(),
+                  index.bounds.end(),
+                  frameEnd,
+                  [](Float value, const Index::Bounds& bounds) {
+                    return value < bounds.start;
+                  }) -
+      index.bounds.begin();
+
+  auto childIndices = index.unboundedChildIndices;
+  for (auto i = first; i < last; i++) {
+    if (index.bounds[i].end >= frameStart) {
+      childIndices.push_back(index.bounds[i].childIndex);
+    }
+  }
+  std::sort(childIndices.begin(), childIndices.end());
+  return childIndices;
+}
+
+void CullingCache::clear() {
+  indices_.clear();
+}
+
+/* static */ CullingCache::Index CullingCache::buildIndex(
+    const ShadowNode& shadowNode) {
+  const auto& children = shadowNode.getChildren();
+  auto index = Index{
+      .children = ShadowNode::ListOfWeak(children.begin(), children.end()),
+      .isVertical = true};
+
+  // Same bounds as the ones culling checks, without the transform of the
+  // culling context (which must be the identity to use the index).
+  auto frames = std::vector<Rect>{};
+  frames.reserve(children.size());
+  auto boundingRect = Rect{};
+  for (size_t i = 0; i < children.size(); i++) {
+    const auto& childShadowNode = *children[i];
+    auto layoutMetrics = ShadowView(childShadowNode).layoutMetrics;
+    if (layoutMetrics == EmptyLayoutMetrics) {
+      index.unboundedChildIndices.push_back(i);
+      frames.push_back({});
+      continue;
+    }
+
+    auto frame =
+        layoutMetrics.getOverflowInsetFrame() * Transform::Identity();
+    if (auto layoutableShadowNode =
+            dynamic_cast<const LayoutableShadowNode*>(&childShadowNode)) {
+      frame = frame * layoutableShadowNode->getTransform();
+    }
+    if (std::isnan(frame.origin.x) || std::isnan(frame.origin.y) ||
+        std::isnan(frame.size.width) || std::isnan(frame.size.height)) {
+      index.unboundedChildIndices.push_back(i);
+      frames.push_back({});
+      continue;
+    }
+    boundingRect.unionInPlace(frame);
+    frames.push_back(frame);
+  }
+
+  index.isVertical = boundingRect.size.height >= boundingRect.size.width;
+  auto unboundedChildIndex = index.unboundedChildIndices.begin();
+  index.bounds.reserve(children.size() - index.unboundedChildIndices.size());
+  for (size_t i = 0; i < children.size(); i++) {
+    if (unboundedChildIndex != index.unboundedChildIndices.end() &&
+        *unboundedChildIndex == i) {
+      unboundedChildIndex++;
+      continue;
+    }
+    const auto& frame = frames[i];
+    index.bounds.push_back(
+        index.isVertical
+            ? Index::Bounds{frame.getMinY(), frame.getMaxY(), i}
+            : Index::Bounds{frame.getMinX(), frame.getMaxX(), i});
+  }
+
+  std::stable_sort(
+      index.bounds.begin(),
+      index.bounds.end(),
+      [](const Index::Bounds& lhs, const Index::Bounds& rhs) {
+        return lhs.start < rhs.start;
+      });
+  index.maxEnds.reserve(index.bounds.size());
+  for (const auto& bounds : index.bounds) {
+    index.maxEnds.push_back(
+        index.maxEnds.empty() ? bounds.end
+                              : std::max(index.maxEnds.back(), bounds.end));
+  }
+  return index;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include <react/renderer/core/ShadowNode.h>
+#include <react/renderer/graphics/Rect.h>
+
+namespace facebook::react {
+
+/*
+ * Spatial indices of the children of large containers (typically the content
+ * of a long, non-virtualized scroll view), kept from one revision to the
+ * next, so that view culling only looks at the children around the viewport
+ * instead of all of them.
+ * An index stays valid as long as the container has the same children, so
+ * changing the scroll offset only queries it again.
+ * Indices only keep weak references to the children, so that the ones of
+ * containers which are not in the current revision any more (up to
+ * `kMaxIndexCount` of them) do not keep old subtrees alive. Destroyed
+ * children still hold on to their own allocation (as `std::make_shared`
+ * allocates the node with its control block) until their index is dropped,
+ * which happens once its first or last child is destroyed, or when it is
+ * the least recently used one.
+ * Not thread-safe: `MountingCoordinator` keeps one per surface and uses it
+ * under its lock.
+ */
+class CullingCache final {
+ public:
+  /*
+   * Containers with fewer children are not indexed.
+   */
+  static constexpr size_t kMinChildCount = 128;
+
+  /*
+   * Number of indices kept, from the most recently used.
+   */
+  static constexpr size_t kMaxIndexCount = 4;
+
+  /*
+   * Returns the indices, in order, of the children of `shadowNode` which may
+   * intersect `frame` (in the coordinate space of `shadowNode`, without
+   * transform), or `std::nullopt` if it has too few children to be indexed.
+   * Children without layout metrics are always included.
+   */
+  std::optional<std::vector<size_t>> getChildIndicesIntersecting(
+      const ShadowNode& shadowNode,
+      const Rect& frame);
+
+  /*
+   * Drops all indices.
+   */
+  void clear();
+
+ private:
+  struct Index {
+    struct Bounds {
+      Float start;
+      Float end;
+      size_t childIndex;
+    };
+
+    /*
+     * Weak references keep the control blocks of the children from being
+     * reused, so that comparing owners tells whether a container has the
+     * same children, without keeping them alive.
+     */
+    ShadowNode::ListOfWeak children;
+
+    /*
+     * Whether the bounds are along the vertical axis.
+     */
+    bool isVertical;
+
+    /*
+     * Bounds of the children along the axis, ordered by start, and the
+     * running maximum of their ends.
+     */
+    std::vector<Bounds> bounds;
+    std::vector<Float> maxEnds;
+
+    std::vector<size_t> unboundedChildIndices;
+  };
+
+  static Index buildIndex(const ShadowNode& shadowNode);
+
+  std::vector<Index> indices_;
+};
+
+} // namespace facebook::react
@@ -1354,7 +1354,8 @@ static void calculateShadowViewMutations(
 
 ShadowViewMutation::List calculateShadowViewMutations(
     const ShadowNode& oldRootShadowNode,
-    const ShadowNode& newRootShadowNode) {
+    const ShadowNode& newRootShadowNode,
+    CullingCache* cullingCache) {
   TraceSection s("calculateShadowViewMutations");
 
   // Root shadow nodes must be belong the same family.
@@ -1376,24 +1377,27 @@ ShadowViewMutation::List calculateShadowViewMutations(
         oldRootShadowView, newRootShadowView, {}));
   }
 
+  auto cullingContext = CullingContext{.cullingCache = cullingCache};
   auto sliceOne = sliceChildShadowNodeViewPairs(
       ShadowViewNodePair{.shadowNode = &oldRootShadowNode},
       viewNodePairScope,
       false /* allowFlattened */,
       {} /* layoutOffset */,
-      {} /* cullingContext */);
+      cullingContext);
   auto sliceTwo = sliceChildShadowNodeViewPairs(
       ShadowViewNodePair{.shadowNode = &newRootShadowNode},
       viewNodePairScope,
       false /* allowFlattened */,
       {} /* layoutOffset */,
-      {} /* cullingContext */);
+      cullingContext);
   calculateShadowViewMutations(
       innerViewNodePairScope,
       mutations,
       oldRootShadowNode.getTag(),
       std::move(sliceOne),
-      std::move(sliceTwo));
+      std::move(sliceTwo),
+      cullingContext,
+      cullingContext);
 
   DEBUG_LOGS({
     LOG(ERROR) << "Differ Completed: " << mutations.size() << " mutations";
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <react/renderer/core/ShadowNode.h>
+#include <react/renderer/mounting/CullingCache.h>
 #include <react/renderer/mounting/ShadowViewMutation.h>
 
 namespace facebook::react {
@@ -16,9 +17,12 @@ namespace facebook::react {
  * Calculates a list of view mutations which describes how the old
  * `ShadowTree` can be transformed to the new one.
  * The list of mutations might be and might not be optimal.
+ * With view culling enabled, a `cullingCache` kept across calls avoids
+ * looking at every child of large containers when their viewport moves.
  */
 ShadowViewMutation::List calculateShadowViewMutations(
     const ShadowNode& oldRootShadowNode,
-    const ShadowNode& newRootShadowNode);
+    const ShadowNode& newRootShadowNode,
+    CullingCache* cullingCache = nullptr);
 
 } // namespace facebook::react
@@ -59,6 +59,7 @@ void MountingCoordinator::revoke() const {
   // 2. A possible call to `pullTransaction()` should return empty optional.
   baseRevision_.rootShadowNode.reset();
   lastRevision_.reset();
+  cullingCache_.clear();
 }
 
 bool MountingCoordinator::waitForTransaction(
@@ -96,7 +97,9 @@ std::optional<MountingTransaction> MountingCoordinator::pullTransaction(
     telemetry.willDiff();
 
     auto mutations = calculateShadowViewMutations(
-        *baseRevision_.rootShadowNode, *lastRevision_->rootShadowNode);
+        *baseRevision_.rootShadowNode,
+        *lastRevision_->rootShadowNode,
+        &cullingCache_);
 
     telemetry.didDiff();
 
@@ -213,6 +216,10 @@ const TelemetryController& MountingCoordinator::getTelemetryController() const {
   return telemetryController_;
 }
 
+TelemetryController& MountingCoordinator::getTelemetryController() {
+  return telemetryController_;
+}
+
 ShadowTreeRevision MountingCoordinator::getBaseRevision() const {
   std::scoped_lock lock(mutex_);
   return baseRevision_;
@@ -95,6 +95,7 @@ class MountingCoordinator final {
   bool waitForTransaction(std::chrono::duration<double> timeout) const;
 
   const TelemetryController& getTelemetryController() const;
+  TelemetryController& getTelemetryController();
 
   ShadowTreeRevision getBaseRevision() const;
 
@@ -139,6 +140,7 @@ class MountingCoordinator final {
   mutable std::condition_variable signal_;
   mutable std::vector<std::weak_ptr<const MountingOverrideDelegate>>
       mountingOverrideDelegates_;
+  mutable CullingCache cullingCache_; // Protected by `mutex_`.
 
   TelemetryController telemetryController_;
 
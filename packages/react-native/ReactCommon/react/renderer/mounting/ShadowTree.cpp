@@ -11,6 +11,7 @@
 #include <react/debug/react_native_assert.h>
 #include <react/renderer/components/root/RootComponentDescriptor.h>
 #include <react/renderer/components/view/ViewShadowNode.h>
+#include <react/renderer/components/view/YogaLayoutableShadowNode.h>
 #include <react/renderer/core/LayoutContext.h>
 #include <react/renderer/core/LayoutPrimitives.h>
 #include <react/renderer/mounting/ShadowTreeRevision.h>
@@ -298,11 +299,15 @@ CommitStatus ShadowTree::tryCommit(
   std::vector<const LayoutableShadowNode*> affectedLayoutableNodes{};
   affectedLayoutableNodes.reserve(1024);
 
+  const auto measureCount =
+      YogaLayoutableShadowNode::getThreadLocalMeasureCount();
   telemetry.willLayout();
   telemetry.setAsThreadLocal();
   newRootShadowNode->layoutIfNeeded(&affectedLayoutableNodes);
   telemetry.unsetAsThreadLocal();
   telemetry.didLayout(static_cast<int>(affectedLayoutableNodes.size()));
+  telemetry.setMeasuredNodesCount(static_cast<int>(
+      YogaLayoutableShadowNode::getThreadLocalMeasureCount() - measureCount));
 
   {
     // Updating `currentRevision_` in unique manner if it hasn't changed.
@@ -316,9 +321,10 @@ CommitStatus ShadowTree::tryCommit(
 
     {
       std::scoped_lock dispatchLock(EventEmitter::DispatchMutex());
-      updateMountedFlag(
+      auto clonedNodesCount = updateMountedFlag(
           currentRevision_.rootShadowNode->getChildren(),
           newRootShadowNode->getChildren());
+      telemetry.setClonedNodesCount(static_cast<int>(clonedNodesCount));
     }
 
     telemetry.didCommit();
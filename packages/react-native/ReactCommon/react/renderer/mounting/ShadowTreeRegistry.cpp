@@ -9,17 +9,56 @@
 
 #include <react/debug/react_native_assert.h>
 
+#include <thread>
+
 namespace facebook::react {
 
+namespace {
+
+size_t getReaderShardIndex(size_t shardCount) {
+  static std::atomic<size_t> nextShardIndex{0};
+  thread_local const size_t shardIndex = // NOLINT
+      nextShardIndex.fetch_add(1, std::memory_order_relaxed);
+  return shardIndex % shardCount;
+}
+
+} // namespace
+
+/*
+ * Registers a reader for the epoch it started in, for its lifetime.
+ */
+class ShadowTreeRegistry::ReadLock final {
+ public:
+  explicit ReadLock(const ShadowTreeRegistry& registry)
+      : count_(registry.readerShards_[getReaderShardIndex(kReaderShardCount)]
+                   .counts[registry.epoch_.load() % 2]) {
+    count_.fetch_add(1);
+  }
+
+  ~ReadLock() {
+    count_.fetch_sub(1);
+  }
+
+  ReadLock(const ReadLock&) = delete;
+  ReadLock& operator=(const ReadLock&) = delete;
+
+ private:
+  std::atomic<int64_t>& count_;
+};
+
+ShadowTreeRegistry::ShadowTreeRegistry() : snapshot_(new Snapshot{}) {}
+
 ShadowTreeRegistry::~ShadowTreeRegistry() {
   react_native_assert(
       registry_.empty() && "Deallocation of non-empty `ShadowTreeRegistry`.");
+  delete snapshot_.load();
 }
 
 void ShadowTreeRegistry::add(std::unique_ptr<ShadowTree>&& shadowTree) const {
   std::unique_lock lock(mutex_);
 
   registry_.emplace(shadowTree->getSurfaceId(), std::move(shadowTree));
+  publish();
 }
 
 std::unique_ptr<ShadowTree> ShadowTreeRegistry::remove(
@@ -33,17 +72,20 @@ std::unique_ptr<ShadowTree> ShadowTreeRegistry::remove(
 
   auto shadowTree = std::unique_ptr<ShadowTree>(iterator->second.release());
   registry_.erase(iterator);
+  // No reader can see the `ShadowTree` once the snapshot is published.
+  publish();
   return shadowTree;
 }
 
 bool ShadowTreeRegistry::visit(
     SurfaceId surfaceId,
     const std::function<void(const ShadowTree& shadowTree)>& callback) const {
-  std::shared_lock lock(mutex_);
+  auto readLock = ReadLock{*this};
+  const auto& snapshot = *snapshot_.load();
 
-  auto iterator = registry_.find(surfaceId);
+  auto iterator = snapshot.find(surfaceId);
 
-  if (iterator == registry_.end()) {
+  if (iterator == snapshot.end()) {
     return false;
   }
 
@@ -54,9 +96,10 @@ bool ShadowTreeRegistry::visit(
 void ShadowTreeRegistry::enumerate(
     const std::function<void(const ShadowTree& shadowTree, bool& stop)>&
         callback) const {
-  std::shared_lock lock(mutex_);
+  auto readLock = ReadLock{*this};
+  const auto& snapshot = *snapshot_.load();
   auto stop = false;
-  for (const auto& pair : registry_) {
+  for (const auto& pair : snapshot) {
     callback(*pair.second, stop);
     if (stop) {
       return;
@@ -64,4 +107,30 @@ void ShadowTreeRegistry::enumerate(
   }
 }
 
+void ShadowTreeRegistry::publish() const {
+  auto snapshot = std::make_unique<Snapshot>();
+  snapshot->reserve(registry_.size());
+  for (const auto& [surfaceId, shadowTree] : registry_) {
+    snapshot->emplace(surfaceId, shadowTree.get());
+  }
+
+  auto previousSnapshot =
+      std::unique_ptr<const Snapshot>(snapshot_.exchange(snapshot.release()));
+  synchronize();
+}
+
+void ShadowTreeRegistry::synchronize() const {
+  // Readers only increment the count of the epoch they read, possibly a
+  // stale one, so both counts are waited for; flipping the epoch first lets
+  // new readers use the other one meanwhile.
+  for (int i = 0; i < 2; i++) {
+    auto previousEpoch = epoch_.fetch_add(1) % 2;
+    for (const auto& readerShard : readerShards_) {
+      while (readerShard.counts[previousEpoch].load() != 0) {
+        std::this_thread::yield();
+      }
+    }
+  }
+}
+
 } // namespace facebook::react
@@ -7,7 +7,9 @@
 
 #pragma once
 
-#include <shared_mutex>
+#include <array>
+#include <atomic>
+#include <mutex>
 #include <unordered_map>
 
 #include <react/renderer/core/ReactPrimitives.h>
@@ -17,15 +19,22 @@ namespace facebook::react {
 
 /*
  * Owning registry of `ShadowTree`s.
+ *
+ * Lookups are wait-free (read-copy-update): readers use an immutable map of
+ * the shadow trees, which `add` and `remove` replace with an updated copy.
+ * Readers count themselves in per-thread shards, and a replaced map (or a
+ * removed `ShadowTree`) is only released once the readers which could still
+ * use it are done.
  */
 class ShadowTreeRegistry final {
  public:
-  ShadowTreeRegistry() = default;
+  ShadowTreeRegistry();
   ~ShadowTreeRegistry();
 
   /*
    * Adds a `ShadowTree` instance to the registry.
    * The ownership of the instance is also transferred to the registry.
+   * Waits for the ongoing calls to `visit` and `enumerate` to finish.
    * Can be called from any thread.
    */
   void add(std::unique_ptr<ShadowTree>&& shadowTree) const;
@@ -35,17 +44,19 @@ class ShadowTreeRegistry final {
    * and returns it as a result.
    * The ownership of the instance is also transferred to the caller.
    * Returns `nullptr` if a `ShadowTree` with given `surfaceId` was not found.
+   * Waits for the ongoing calls to `visit` and `enumerate` to finish, so it
+   * must not be called from their callbacks.
    * Can be called from any thread.
    */
   std::unique_ptr<ShadowTree> remove(SurfaceId surfaceId) const;
 
   /*
    * Finds a `ShadowTree` instance with a given `surfaceId` in the registry and
-   * synchronously calls the `callback` with a reference to the instance while
-   * the mutex is being acquired.
+   * synchronously calls the `callback` with a reference to the instance,
+   * which cannot be removed until the `callback` returns.
    * Returns `true` if the registry has `ShadowTree` instance with corresponding
    * `surfaceId`, otherwise returns `false` without calling the `callback`.
-   * Can be called from any thread.
+   * Can be called from any thread, without blocking.
    */
   bool visit(
       SurfaceId surfaceId,
@@ -54,16 +65,45 @@ class ShadowTreeRegistry final {
   /*
    * Enumerates all stored shadow trees.
    * Set `stop` to `true` to interrupt the enumeration.
-   * Can be called from any thread.
+   * Can be called from any thread, without blocking.
    */
   void enumerate(
       const std::function<void(const ShadowTree& shadowTree, bool& stop)>&
           callback) const;
 
  private:
-  mutable std::shared_mutex mutex_;
+  using Snapshot = std::unordered_map<SurfaceId, const ShadowTree*>;
+
+  class ReadLock;
+
+  static constexpr size_t kReaderShardCount = 16;
+
+  /*
+   * Number of readers of each epoch, in its own cache line.
+   */
+  struct alignas(64) ReaderShard {
+    std::array<std::atomic<int64_t>, 2> counts{};
+  };
+
+  /*
+   * Replaces the snapshot of the registry, and waits until nothing can use
+   * the previous one. Must be called with `mutex_` held.
+   */
+  void publish() const;
+
+  /*
+   * Waits until the readers which started before the call are done. The
+   * epoch is flipped, so that new readers don't hold it back.
+   */
+  void synchronize() const;
+
+  mutable std::mutex mutex_;
   mutable std::unordered_map<SurfaceId, std::unique_ptr<ShadowTree>>
       registry_; // Protected by `mutex_`.
+
+  mutable std::atomic<const Snapshot*> snapshot_;
+  mutable std::atomic<size_t> epoch_{0};
+  mutable std::array<ReaderShard, kReaderShardCount> readerShards_{};
 };
 
 } // namespace facebook::react
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "SurfaceTelemetryHistograms.h"
+
+#include <algorithm>
+
+namespace facebook::react {
+
+namespace {
+
+uint64_t toNanoseconds(TelemetryDuration duration) {
+  return static_cast<uint64_t>(std::max<int64_t>(duration.count(), 0));
+}
+
+uint64_t toCount(int count) {
+  return static_cast<uint64_t>(std::max(count, 0));
+}
+
+} // namespace
+
+/* static */ const char* SurfaceTelemetryHistograms::getMetricName(
+    Metric metric) {
+  switch (metric) {
+    case Metric::CommitTime:
+      return "commitTime";
+    case Metric::LayoutTime:
+      return "layoutTime";
+    case Metric::TextMeasureTime:
+      return "textMeasureTime";
+    case Metric::DiffTime:
+      return "diffTime";
+    case Metric::MountTime:
+      return "mountTime";
+    case Metric::ClonedNodes:
+      return "clonedNodes";
+    case Metric::LaidOutNodes:
+      return "laidOutNodes";
+    case Metric::MeasuredNodes:
+      return "measuredNodes";
+    case Metric::CreateMutations:
+      return "createMutations";
+    case Metric::DeleteMutations:
+      return "deleteMutations";
+    case Metric::InsertMutations:
+      return "insertMutations";
+    case Metric::RemoveMutations:
+      return "removeMutations";
+    case Metric::UpdateMutations:
+      return "updateMutations";
+  }
+  return "unknown";
+}
+
+void SurfaceTelemetryHistograms::incorporate(
+    const TransactionTelemetry& telemetry,
+    const ShadowViewMutationList& mutations) {
+  record(
+      Metric::CommitTime,
+      toNanoseconds(
+          telemetry.getCommitEndTime() - telemetry.getCommitStartTime()));
+  record(
+      Metric::LayoutTime,
+      toNanoseconds(
+          telemetry.getLayoutEndTime() - telemetry.getLayoutStartTime()));
+  record(
+      Metric::TextMeasureTime, toNanoseconds(telemetry.getTextMeasureTime()));
+  record(
+      Metric::DiffTime,
+      toNanoseconds(telemetry.getDiffEndTime() - telemetry.getDiffStartTime()));
+  record(
+      Metric::MountTime,
+      toNanoseconds(
+          telemetry.getMountEndTime() - telemetry.getMountStartTime()));
+
+  record(Metric::ClonedNodes, toCount(telemetry.getClonedNodesCount()));
+  record(
+      Metric::LaidOutNodes, toCount(telemetry.getAffectedLayoutNodesCount()));
+  record(Metric::MeasuredNodes, toCount(telemetry.getMeasuredNodesCount()));
+
+  uint64_t createCount = 0;
+  uint64_t deleteCount = 0;
+  uint64_t insertCount = 0;
+  uint64_t removeCount = 0;
+  uint64_t updateCount = 0;
+  for (const auto& mutation : mutations) {
+    switch (mutation.type) {
+      case ShadowViewMutation::Create:
+        createCount++;
+        break;
+      case ShadowViewMutation::Delete:
+        deleteCount++;
+        break;
+      case ShadowViewMutation::Insert:
+        insertCount++;
+        break;
+      case ShadowViewMutation::Remove:
+        removeCount++;
+        break;
+      case ShadowViewMutation::Update:
+        updateCount++;
+        break;
+    }
+  }
+  record(Metric::CreateMutations, createCount);
+  record(Metric::DeleteMutations, deleteCount);
+  record(Metric::InsertMutations, insertCount);
+  record(Metric::RemoveMutations, removeCount);
+  record(Metric::UpdateMutations, updateCount);
+}
+
+SurfaceTelemetryHistograms::Snapshot SurfaceTelemetryHistograms::getSnapshot()
+    const {
+  auto snapshot = Snapshot{};
+  for (size_t i = 0; i < kMetricCount; i++) {
+    snapshot.histograms[i] = histograms_[i].getSnapshot();
+  }
+  return snapshot;
+}
+
+SurfaceTelemetryHistograms::Snapshot
+SurfaceTelemetryHistograms::takeSnapshot() {
+  auto snapshot = Snapshot{};
+  for (size_t i = 0; i < kMetricCount; i++) {
+    snapshot.histograms[i] = histograms_[i].takeSnapshot();
+  }
+  return snapshot;
+}
+
+void SurfaceTelemetryHistograms::record(Metric metric, uint64_t value) {
+  histograms_[static_cast<size_t>(metric)].record(value);
+}
+
+} // namespace facebook::react
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include <react/renderer/mounting/ShadowViewMutation.h>
+#include <react/renderer/telemetry/TelemetryHistogram.h>
+#include <react/renderer/telemetry/TransactionTelemetry.h>
+
+namespace facebook::react {
+
+/*
+ * Distributions of the durations of the phases of the transactions of a
+ * Surface, from commit to mount, and of how much work they did.
+ * `SurfaceTelemetry` sums these up; histograms show the outliers which make
+ * frames drop.
+ *
+ * Recording is lock-free, and so is reading, which can happen concurrently.
+ */
+class SurfaceTelemetryHistograms final {
+ public:
+  enum class Metric : uint8_t {
+    // Durations, in nanoseconds
+    CommitTime,
+    LayoutTime,
+    TextMeasureTime,
+    DiffTime,
+    MountTime,
+    // Numbers of nodes per transaction
+    ClonedNodes,
+    LaidOutNodes,
+    MeasuredNodes,
+    // Numbers of mutations per transaction, by type
+    CreateMutations,
+    DeleteMutations,
+    InsertMutations,
+    RemoveMutations,
+    UpdateMutations,
+  };
+
+  static constexpr size_t kMetricCount =
+      static_cast<size_t>(Metric::UpdateMutations) + 1;
+
+  static const char* getMetricName(Metric metric);
+
+  struct Snapshot {
+    std::array<TelemetryHistogram::Snapshot, kMetricCount> histograms{};
+
+    const TelemetryHistogram::Snapshot& operator[](Metric metric) const {
+      return histograms[static_cast<size_t>(metric)];
+    }
+  };
+
+  /*
+   * Records a mounted transaction.
+   */
+  void incorporate(
+      const TransactionTelemetry& telemetry,
+      const ShadowViewMutationList& mutations);
+
+  Snapshot getSnapshot() const;
+
+  /*
+   * Returns the distributions since the last call, e.g. to export them
+   * periodically.
+   */
+  Snapshot takeSnapshot();
+
+ private:
+  void record(Metric metric, uint64_t value);
+
+  std::array<TelemetryHistogram, kMetricCount> histograms_{};
+};
+
+} // namespace facebook::react
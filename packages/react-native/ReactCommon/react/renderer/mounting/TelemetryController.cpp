@@ -40,6 +40,7 @@ bool TelemetryController::pullTransaction(
   telemetry.didMount();
 
   compoundTelemetry.incorporate(telemetry, numberOfMutations);
+  histograms_.incorporate(telemetry, transaction.getMutations());
 
   didMount(transaction, compoundTelemetry);
 
@@ -50,4 +51,14 @@ bool TelemetryController::pullTransaction(
   return true;
 }
 
+SurfaceTelemetryHistograms::Snapshot TelemetryController::getHistogramSnapshot()
+    const {
+  return histograms_.getSnapshot();
+}
+
+SurfaceTelemetryHistograms::Snapshot
+TelemetryController::takeHistogramSnapshot() {
+  return histograms_.takeSnapshot();
+}
+
 } // namespace facebook::react
@@ -11,6 +11,7 @@
 #include <mutex>
 
 #include <react/renderer/mounting/MountingTransaction.h>
+#include <react/renderer/mounting/SurfaceTelemetryHistograms.h>
 #include <react/renderer/telemetry/TransactionTelemetry.h>
 
 namespace facebook::react {
@@ -49,10 +50,25 @@ class TelemetryController final {
       const MountingTransactionCallback& doMount,
       const MountingTransactionCallback& didMount) const;
 
+  /*
+   * Distributions of the durations and sizes of the transactions pulled so
+   * far. Can be called on any thread.
+   */
+  SurfaceTelemetryHistograms::Snapshot getHistogramSnapshot() const;
+
+  /*
+   * Same as `getHistogramSnapshot`, and starts over, so that the next
+   * snapshot only has the transactions pulled after this one.
+   */
+  SurfaceTelemetryHistograms::Snapshot takeHistogramSnapshot();
+
  private:
   const MountingCoordinator& mountingCoordinator_;
   mutable SurfaceTelemetry compoundTelemetry_{};
   mutable std::mutex mutex_;
+
+  // Lock-free
+  mutable SurfaceTelemetryHistograms histograms_{};
 };
 
 } // namespace facebook::react
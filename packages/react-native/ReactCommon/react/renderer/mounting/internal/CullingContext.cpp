@@ -31,7 +31,7 @@ CullingContext CullingContext::adjustCullingContextIfNeeded(
       cullingContext.transform = Transform::Identity();
     } else if (pair.shadowView.traits.check(
                    ShadowNodeTraits::Trait::RootNodeKind)) {
-      cullingContext = {};
+      cullingContext = {.cullingCache = cullingCache};
     } else {
       cullingContext.frame.origin -= pair.shadowView.layoutMetrics.frame.origin;
 
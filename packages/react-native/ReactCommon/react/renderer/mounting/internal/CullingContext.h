@@ -12,12 +12,18 @@
 
 namespace facebook::react {
 
+class CullingCache;
 struct ShadowViewNodePair;
 
 struct CullingContext {
   Rect frame;
   Transform transform;
 
+  /*
+   * Indices of large containers kept across revisions, if any.
+   */
+  CullingCache* cullingCache{nullptr};
+
   bool shouldConsiderCulling() const;
 
   CullingContext adjustCullingContextIfNeeded(
@@ -8,6 +8,7 @@
 #include "sliceChildShadowNodeViewPairs.h"
 #include <react/featureflags/ReactNativeFeatureFlags.h>
 #include <react/renderer/core/LayoutableShadowNode.h>
+#include <react/renderer/mounting/CullingCache.h>
 
 #include "ShadowViewNodePair.h"
 
@@ -54,8 +55,22 @@ static void sliceChildShadowNodeViewPairsRecursively(
     Point layoutOffset,
     const ShadowNode& shadowNode,
     const CullingContext& cullingContext) {
-  for (const auto& sharedChildShadowNode : shadowNode.getChildren()) {
-    auto& childShadowNode = *sharedChildShadowNode;
+  const auto& children = shadowNode.getChildren();
+
+  // Large containers are indexed, to only look at the children that may be
+  // visible instead of culling them one by one.
+  auto childIndices = std::optional<std::vector<size_t>>{};
+  if (ReactNativeFeatureFlags::enableViewCulling() &&
+      cullingContext.cullingCache != nullptr &&
+      cullingContext.shouldConsiderCulling() &&
+      cullingContext.transform == Transform::Identity()) {
+    childIndices = cullingContext.cullingCache->getChildIndicesIntersecting(
+        shadowNode, cullingContext.frame);
+  }
+
+  auto childCount = childIndices ? childIndices->size() : children.size();
+  for (size_t i = 0; i < childCount; i++) {
+    auto& childShadowNode = *children[childIndices ? (*childIndices)[i] : i];
 #ifndef ANDROID
     // T153547836: Disabled on Android because the mounting infrastructure
     // is not fully ready yet.
@@ -0,0 +1,340 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/featureflags/ReactNativeFeatureFlags.h>
+#include <react/featureflags/ReactNativeFeatureFlagsDefaults.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/scrollview/ScrollViewComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+#include <react/renderer/mounting/CullingCache.h>
+#include <react/renderer/mounting/Differentiator.h>
+#include <react/renderer/mounting/ShadowView.h>
+
+namespace facebook::react {
+
+class CullingCacheTestFeatureFlags : public ReactNativeFeatureFlagsDefaults {
+ public:
+  bool enableViewCulling() override {
+    return true;
+  }
+};
+
+class CullingCacheTest : public ::testing::Test {
+ protected:
+  static constexpr int kItemCount = 1000;
+  static constexpr Float kItemHeight = 50;
+  static constexpr Float kViewportHeight = 500;
+
+  std::unique_ptr<ComponentBuilder> builder_;
+  std::shared_ptr<RootShadowNode> rootShadowNode_;
+  std::shared_ptr<ScrollViewShadowNode> scrollViewShadowNode_;
+
+  void SetUp() override {
+    ReactNativeFeatureFlags::override(
+        std::make_unique<CullingCacheTestFeatureFlags>());
+
+    auto items = std::vector<ElementFragment>{};
+    for (int i = 0; i < kItemCount; i++) {
+      items.push_back(Element<ViewShadowNode>().tag(10 + i).props([] {
+        auto sharedProps = std::make_shared<ViewShadowNodeProps>();
+        sharedProps->yogaStyle.setDimension(
+            yoga::Dimension::Height,
+            yoga::StyleSizeLength::points(kItemHeight));
+        return sharedProps;
+      }));
+    }
+
+    // clang-format off
+    auto element =
+        Element<RootShadowNode>()
+          .reference(rootShadowNode_)
+          .tag(1)
+          .props([] {
+            auto sharedProps = std::make_shared<RootProps>();
+            sharedProps->layoutConstraints =
+                LayoutConstraints{{0, 0}, {500, kViewportHeight}};
+            return sharedProps;
+          })
+          .children({
+            Element<ScrollViewShadowNode>()
+              .reference(scrollViewShadowNode_)
+              .tag(2)
+              .props([] {
+                auto sharedProps = std::make_shared<ScrollViewProps>();
+                sharedProps->yogaStyle.setDimension(
+                    yoga::Dimension::Height,
+                    yoga::StyleSizeLength::points(kViewportHeight));
+                return sharedProps;
+              })
+              .children({
+                Element<ViewShadowNode>()
+                  .tag(3)
+                  .children(items)
+              })
+          });
+    // clang-format on
+
+    builder_ = std::make_unique<ComponentBuilder>(simpleComponentBuilder());
+    builder_->build(element);
+    rootShadowNode_->layoutIfNeeded();
+  }
+
+  void TearDown() override {
+    ReactNativeFeatureFlags::dangerouslyReset();
+  }
+
+  std::shared_ptr<const RootShadowNode> scrollTo(Float offset) const {
+    const auto& componentDescriptor =
+        scrollViewShadowNode_->getComponentDescriptor();
+    const auto& family = scrollViewShadowNode_->getFamily();
+    auto state = componentDescriptor.createState(
+        family,
+        std::make_shared<const ScrollViewState>(
+            Point{0, offset}, Rect{}, 0));
+    return std::static_pointer_cast<const RootShadowNode>(
+        rootShadowNode_->cloneTree(
+            family, [&](const ShadowNode& oldShadowNode) {
+              return oldShadowNode.clone({.state = state});
+            }));
+  }
+
+  static std::shared_ptr<ViewShadowNodeProps> createAbsoluteProps(
+      const Rect& frame,
+      const Transform& transform = Transform::Identity()) {
+    auto sharedProps = std::make_shared<ViewShadowNodeProps>();
+    auto& yogaStyle = sharedProps->yogaStyle;
+    yogaStyle.setPositionType(yoga::PositionType::Absolute);
+    yogaStyle.setPosition(
+        yoga::Edge::Left, yoga::StyleLength::points(frame.origin.x));
+    yogaStyle.setPosition(
+        yoga::Edge::Top, yoga::StyleLength::points(frame.origin.y));
+    yogaStyle.setDimension(
+        yoga::Dimension::Width,
+        yoga::StyleSizeLength::points(frame.size.width));
+    yogaStyle.setDimension(
+        yoga::Dimension::Height,
+        yoga::StyleSizeLength::points(frame.size.height));
+    sharedProps->transform = transform;
+    return sharedProps;
+  }
+
+  /*
+   * Whether culling keeps `childShadowNode` when checking it alone against
+   * `frame`, as slicing does without an index.
+   */
+  static bool isKeptByCulling(
+      const ShadowNode& childShadowNode,
+      const Rect& frame) {
+    auto layoutMetrics = ShadowView(childShadowNode).layoutMetrics;
+    if (layoutMetrics == EmptyLayoutMetrics) {
+      return true;
+    }
+    auto childFrame = layoutMetrics.getOverflowInsetFrame();
+    if (auto layoutableShadowNode =
+            dynamic_cast<const LayoutableShadowNode*>(&childShadowNode)) {
+      childFrame = childFrame * layoutableShadowNode->getTransform();
+    }
+    return Rect::intersect(frame, childFrame) != Rect{};
+  }
+
+  static void expectSameMutations(
+      const ShadowViewMutation::List& mutations,
+      const ShadowViewMutation::List& expectedMutations) {
+    ASSERT_EQ(mutations.size(), expectedMutations.size());
+    for (size_t i = 0; i < mutations.size(); i++) {
+      EXPECT_EQ(mutations[i].type, expectedMutations[i].type);
+      EXPECT_EQ(mutations[i].parentTag, expectedMutations[i].parentTag);
+      EXPECT_EQ(
+          mutations[i].oldChildShadowView.tag,
+          expectedMutations[i].oldChildShadowView.tag);
+      EXPECT_EQ(
+          mutations[i].newChildShadowView.tag,
+          expectedMutations[i].newChildShadowView.tag);
+      EXPECT_EQ(mutations[i].index, expectedMutations[i].index);
+    }
+  }
+};
+
+TEST_F(CullingCacheTest, childIndicesIntersecting) {
+  auto cullingCache = CullingCache{};
+  const auto& contentShadowNode = *scrollViewShadowNode_->getChildren()[0];
+
+  auto childIndices = cullingCache.getChildIndicesIntersecting(
+      contentShadowNode, Rect{{0, 1010}, {500, 100}});
+  ASSERT_TRUE(childIndices.has_value());
+  EXPECT_EQ(*childIndices, (std::vector<size_t>{20, 21, 22}));
+
+  // Touching frames intersect, as far as culling is concerned
+  childIndices = cullingCache.getChildIndicesIntersecting(
+      contentShadowNode, Rect{{0, 100}, {500, 50}});
+  EXPECT_EQ(*childIndices, (std::vector<size_t>{1, 2, 3}));
+
+  childIndices = cullingCache.getChildIndicesIntersecting(
+      contentShadowNode, Rect{{0, -100}, {500, 50}});
+  EXPECT_TRUE(childIndices->empty());
+
+  // Too few children to be indexed
+  EXPECT_FALSE(
+      cullingCache
+          .getChildIndicesIntersecting(*rootShadowNode_, Rect{{0, 0}, {1, 1}})
+          .has_value());
+}
+
+TEST_F(CullingCacheTest, indicesDoNotKeepChildrenAlive) {
+  auto cullingCache = CullingCache{};
+  const auto& contentShadowNode = *scrollViewShadowNode_->getChildren()[0];
+
+  auto clonedChildren = std::make_shared<ShadowNode::ListOfShared>();
+  for (const auto& childShadowNode : contentShadowNode.getChildren()) {
+    clonedChildren->push_back(childShadowNode->clone({}));
+  }
+  auto weakClonedChild =
+      std::weak_ptr<const ShadowNode>(clonedChildren->front());
+  auto clonedContentShadowNode =
+      contentShadowNode.clone({.children = clonedChildren});
+  clonedChildren.reset();
+  ASSERT_TRUE(cullingCache
+                  .getChildIndicesIntersecting(
+                      *clonedContentShadowNode, Rect{{0, 0}, {500, 100}})
+                  .has_value());
+
+  // Replaced by the next revision
+  clonedContentShadowNode.reset();
+  EXPECT_TRUE(weakClonedChild.expired());
+
+  auto childIndices = cullingCache.getChildIndicesIntersecting(
+      contentShadowNode, Rect{{0, 1010}, {500, 100}});
+  ASSERT_TRUE(childIndices.has_value());
+  EXPECT_EQ(*childIndices, (std::vector<size_t>{20, 21, 22}));
+}
+
+TEST_F(CullingCacheTest, childIndicesIncludeAllChildrenKeptByCulling) {
+  auto random = std::mt19937{42};
+  auto uniform = [&](Float min, Float max) {
+    return std::uniform_real_distribution<Float>{min, max}(random);
+  };
+  auto oneIn = [&](int count) {
+    return std::uniform_int_distribution<int>{0, count - 1}(random) == 0;
+  };
+
+  size_t numberOfChildren = 0;
+  size_t numberOfChildIndices = 0;
+  for (int layout = 0; layout < 20; layout++) {
+    // Absolutely positioned children, scattered along one axis, some of
+    // them transformed or overflowing their frame
+    const bool isHorizontal = layout % 2 == 1;
+    const int childCount = static_cast<int>(CullingCache::kMinChildCount) +
+        std::uniform_int_distribution<int>{0, 400}(random);
+    auto children = std::vector<ElementFragment>{};
+    for (int i = 0; i < childCount; i++) {
+      auto across = uniform(0, 500);
+      auto along = uniform(-200, 20'000);
+      auto width = uniform(0, 300);
+      auto height = uniform(0, 300);
+      auto transform = oneIn(5)
+          ? (oneIn(2) ? Transform::Scale(uniform(0.5, 2), uniform(0.5, 2), 1)
+                      : Transform::Translate(uniform(-300, 300), 0, 0))
+          : Transform::Identity();
+      auto frame = isHorizontal ? Rect{{along, across}, {width, height}}
+                                : Rect{{across, along}, {width, height}};
+      auto child = Element<ViewShadowNode>().tag(10'000 + i).props([=]() {
+        return createAbsoluteProps(frame, transform);
+      });
+      if (oneIn(5)) {
+        auto overflow = uniform(-500, 500);
+        child.children({Element<ViewShadowNode>().tag(100'000 + i).props([=]() {
+          return createAbsoluteProps(Rect{{overflow, -overflow}, {10, 10}});
+        })});
+      }
+      children.push_back(child);
+    }
+
+    auto rootShadowNode = std::shared_ptr<RootShadowNode>{};
+    // clang-format off
+    auto element =
+        Element<RootShadowNode>()
+          .reference(rootShadowNode)
+          .tag(1)
+          .props([] {
+            auto sharedProps = std::make_shared<RootProps>();
+            sharedProps->layoutConstraints =
+                LayoutConstraints{{0, 0}, {500, 500}};
+            return sharedProps;
+          })
+          .children({
+            Element<ViewShadowNode>()
+              .tag(2)
+              .children(children)
+          });
+    // clang-format on
+    builder_->build(element);
+    rootShadowNode->layoutIfNeeded();
+    const auto& containerShadowNode = *rootShadowNode->getChildren()[0];
+
+    auto cullingCache = CullingCache{};
+    for (int query = 0; query < 50; query++) {
+      auto frame = Rect{
+          {uniform(-500, 20'000), uniform(-500, 20'000)},
+          {uniform(1, 1'000), uniform(1, 1'000)}};
+      auto childIndices =
+          cullingCache.getChildIndicesIntersecting(containerShadowNode, frame);
+      ASSERT_TRUE(childIndices.has_value());
+      EXPECT_TRUE(std::is_sorted(childIndices->begin(), childIndices->end()));
+
+      const auto& containerChildren = containerShadowNode.getChildren();
+      for (size_t i = 0; i < containerChildren.size(); i++) {
+        if (isKeptByCulling(*containerChildren[i], frame)) {
+          EXPECT_TRUE(std::binary_search(
+              childIndices->begin(), childIndices->end(), i))
+              << "Child " << i << " of layout " << layout << " is missing";
+        }
+      }
+      numberOfChildren += containerChildren.size();
+      numberOfChildIndices += childIndices->size();
+    }
+  }
+
+  // The index does leave children out
+  EXPECT_LT(numberOfChildIndices, numberOfChildren / 4);
+}
+
+TEST_F(CullingCacheTest, sameMutationsWhileScrolling) {
+  auto cullingCache = CullingCache{};
+  auto emptyRootShadowNode = std::static_pointer_cast<const RootShadowNode>(
+      rootShadowNode_->ShadowNode::clone(
+          {.children = ShadowNode::emptySharedShadowNodeSharedList()}));
+
+  auto previousRootShadowNode =
+      std::static_pointer_cast<const RootShadowNode>(emptyRootShadowNode);
+  for (auto offset : {0.f, 10.f, 480.f, 30'000.f, 12'345.f, 49'500.f, 0.f}) {
+    auto rootShadowNode = scrollTo(offset);
+    auto mutations = calculateShadowViewMutations(
+        *previousRootShadowNode, *rootShadowNode, &cullingCache);
+    expectSameMutations(
+        mutations,
+        calculateShadowViewMutations(*previousRootShadowNode, *rootShadowNode));
+    // Only the views around the viewport are created
+    auto createdCount = 0;
+    for (const auto& mutation : mutations) {
+      createdCount += mutation.type == ShadowViewMutation::Create ? 1 : 0;
+    }
+    EXPECT_LE(createdCount, 2 + kViewportHeight / kItemHeight + 1);
+    previousRootShadowNode = rootShadowNode;
+  }
+}
+
+} // namespace facebook::react
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/mounting/ShadowTreeDelegate.h>
+#include <react/renderer/mounting/ShadowTreeRegistry.h>
+
+using namespace facebook::react;
+
+namespace {
+
+class DummyShadowTreeDelegate : public ShadowTreeDelegate {
+ public:
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      const ShadowTree& /*shadowTree*/,
+      const RootShadowNode::Shared& /*oldRootShadowNode*/,
+      const RootShadowNode::Unshared& newRootShadowNode,
+      const ShadowTree::CommitOptions& /*commitOptions*/) const override {
+    return newRootShadowNode;
+  };
+
+  void shadowTreeDidFinishTransaction(
+      std::shared_ptr<const MountingCoordinator> /*mountingCoordinator*/,
+      bool /*mountSynchronously*/) const override {};
+};
+
+class ShadowTreeRegistryTest : public ::testing::Test {
+ protected:
+  std::unique_ptr<ShadowTree> createShadowTree(SurfaceId surfaceId) const {
+    return std::make_unique<ShadowTree>(
+        surfaceId,
+        LayoutConstraints{},
+        LayoutContext{},
+        shadowTreeDelegate_,
+        contextContainer_);
+  }
+
+ private:
+  DummyShadowTreeDelegate shadowTreeDelegate_{};
+  ContextContainer contextContainer_{};
+};
+
+} // namespace
+
+TEST_F(ShadowTreeRegistryTest, addVisitAndRemove) {
+  auto registry = ShadowTreeRegistry{};
+  registry.add(createShadowTree(1));
+  registry.add(createShadowTree(2));
+
+  auto visitedSurfaceId = SurfaceId{0};
+  EXPECT_TRUE(registry.visit(2, [&](const ShadowTree& shadowTree) {
+    visitedSurfaceId = shadowTree.getSurfaceId();
+  }));
+  EXPECT_EQ(visitedSurfaceId, 2);
+  EXPECT_FALSE(registry.visit(3, [](const ShadowTree& /*shadowTree*/) {
+    FAIL() << "There is no surface 3";
+  }));
+
+  auto numberOfShadowTrees = 0;
+  registry.enumerate([&](const ShadowTree& /*shadowTree*/, bool& /*stop*/) {
+    numberOfShadowTrees++;
+  });
+  EXPECT_EQ(numberOfShadowTrees, 2);
+
+  auto shadowTree = registry.remove(1);
+  ASSERT_NE(shadowTree, nullptr);
+  EXPECT_EQ(shadowTree->getSurfaceId(), 1);
+  EXPECT_EQ(registry.remove(1), nullptr);
+  EXPECT_FALSE(registry.visit(1, [](const ShadowTree& /*shadowTree*/) {}));
+
+  // Visits can be nested
+  EXPECT_TRUE(registry.visit(2, [&](const ShadowTree& /*shadowTree*/) {
+    EXPECT_TRUE(registry.visit(2, [](const ShadowTree& /*shadowTree*/) {}));
+  }));
+
+  registry.remove(2);
+}
+
+TEST_F(ShadowTreeRegistryTest, concurrentVisitsAndUpdates) {
+  constexpr SurfaceId kSurfaceCount = 24;
+  auto registry = ShadowTreeRegistry{};
+  // Even surfaces stay for the whole test, odd ones come and go
+  for (SurfaceId surfaceId = 0; surfaceId < kSurfaceCount; surfaceId += 2) {
+    registry.add(createShadowTree(surfaceId));
+  }
+
+  auto isDone = std::atomic<bool>{false};
+  auto numberOfVisits = std::atomic<int>{0};
+  auto readers = std::vector<std::thread>{};
+  for (int i = 0; i < 4; i++) {
+    readers.emplace_back([&, i]() {
+      auto surfaceId = SurfaceId{i};
+      while (!isDone) {
+        surfaceId = (surfaceId + 1) % kSurfaceCount;
+        auto found = registry.visit(surfaceId, [&](const ShadowTree& tree) {
+          // The tree must still be alive and the right one
+          EXPECT_EQ(tree.getSurfaceId(), surfaceId);
+          EXPECT_NE(tree.getCurrentRevision().rootShadowNode, nullptr);
+        });
+        EXPECT_TRUE(found || surfaceId % 2 == 1);
+        registry.enumerate([&](const ShadowTree& tree, bool& stop) {
+          EXPECT_LT(tree.getSurfaceId(), kSurfaceCount);
+          stop = tree.getSurfaceId() == surfaceId;
+        });
+        numberOfVisits++;
+      }
+    });
+  }
+
+  for (int i = 0; i < 50; i++) {
+    auto surfaceId = SurfaceId{1 + 2 * (i % (kSurfaceCount / 2))};
+    registry.add(createShadowTree(surfaceId));
+    std::this_thread::yield();
+    auto shadowTree = registry.remove(surfaceId);
+    // Not `ASSERT_NE`: returning early would leave the readers unjoined
+    EXPECT_NE(shadowTree, nullptr);
+    // Destroyed right away: no visit can still be using it
+    shadowTree.reset();
+  }
+  isDone = true;
+  for (auto& reader : readers) {
+    reader.join();
+  }
+  EXPECT_GT(numberOfVisits, 0);
+
+  for (SurfaceId surfaceId = 0; surfaceId < kSurfaceCount; surfaceId += 2) {
+    EXPECT_NE(registry.remove(surfaceId), nullptr);
+  }
+}
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+#include <react/renderer/mounting/ShadowTree.h>
+#include <react/renderer/mounting/ShadowTreeDelegate.h>
+#include <react/renderer/mounting/SurfaceTelemetryHistograms.h>
+#include <react/test_utils/MockClock.h>
+
+using namespace facebook::react;
+
+MockClock::time_point MockClock::time_ = {};
+
+namespace {
+
+using Metric = SurfaceTelemetryHistograms::Metric;
+
+TransactionTelemetry makeTelemetry(std::chrono::milliseconds layoutTime) {
+  auto telemetry = TransactionTelemetry{[]() { return MockClock::now(); }};
+  telemetry.willCommit();
+  telemetry.willLayout();
+  MockClock::advance_by(layoutTime);
+  telemetry.didLayout(12);
+  telemetry.setClonedNodesCount(30);
+  telemetry.setMeasuredNodesCount(4);
+  MockClock::advance_by(std::chrono::milliseconds(1));
+  telemetry.didCommit();
+  telemetry.willDiff();
+  MockClock::advance_by(std::chrono::milliseconds(2));
+  telemetry.didDiff();
+  telemetry.willMount();
+  MockClock::advance_by(std::chrono::milliseconds(3));
+  telemetry.didMount();
+  return telemetry;
+}
+
+class DummyShadowTreeDelegate : public ShadowTreeDelegate {
+ public:
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      const ShadowTree& /*shadowTree*/,
+      const RootShadowNode::Shared& /*oldRootShadowNode*/,
+      const RootShadowNode::Unshared& newRootShadowNode,
+      const ShadowTree::CommitOptions& /*commitOptions*/) const override {
+    return newRootShadowNode;
+  };
+
+  void shadowTreeDidFinishTransaction(
+      std::shared_ptr<const MountingCoordinator> /*mountingCoordinator*/,
+      bool /*mountSynchronously*/) const override {};
+};
+
+ShadowView makeShadowView(Tag tag) {
+  auto shadowView = ShadowView{};
+  shadowView.tag = tag;
+  return shadowView;
+}
+
+} // namespace
+
+TEST(SurfaceTelemetryHistogramsTest, incorporate) {
+  auto histograms = SurfaceTelemetryHistograms{};
+
+  auto mutations = ShadowViewMutationList{
+      ShadowViewMutation::CreateMutation(makeShadowView(2)),
+      ShadowViewMutation::CreateMutation(makeShadowView(3)),
+      ShadowViewMutation::InsertMutation(1, makeShadowView(2), 0),
+      ShadowViewMutation::UpdateMutation(
+          makeShadowView(4), makeShadowView(4), 1),
+  };
+  histograms.incorporate(makeTelemetry(std::chrono::milliseconds(5)), {});
+  histograms.incorporate(
+      makeTelemetry(std::chrono::milliseconds(50)), mutations);
+
+  auto snapshot = histograms.getSnapshot();
+  EXPECT_EQ(snapshot[Metric::CommitTime].count, 2u);
+  EXPECT_EQ(snapshot[Metric::CommitTime].max, 51'000'000u);
+  EXPECT_NEAR(
+      snapshot[Metric::LayoutTime].getValueAtPercentile(0),
+      5'000'000,
+      5'000'000 / 16);
+  EXPECT_EQ(snapshot[Metric::DiffTime].max, 2'000'000u);
+  EXPECT_EQ(snapshot[Metric::MountTime].max, 3'000'000u);
+  EXPECT_EQ(snapshot[Metric::ClonedNodes].sum, 60u);
+  EXPECT_EQ(snapshot[Metric::LaidOutNodes].max, 12u);
+  EXPECT_EQ(snapshot[Metric::MeasuredNodes].max, 4u);
+  EXPECT_EQ(snapshot[Metric::CreateMutations].max, 2u);
+  EXPECT_EQ(snapshot[Metric::CreateMutations].getValueAtPercentile(0), 0u);
+  EXPECT_EQ(snapshot[Metric::InsertMutations].sum, 1u);
+  EXPECT_EQ(snapshot[Metric::UpdateMutations].sum, 1u);
+  EXPECT_EQ(snapshot[Metric::DeleteMutations].sum, 0u);
+
+  // Taking a snapshot starts over
+  EXPECT_EQ(histograms.takeSnapshot()[Metric::MountTime].count, 2u);
+  EXPECT_EQ(histograms.getSnapshot()[Metric::MountTime].count, 0u);
+}
+
+TEST(SurfaceTelemetryHistogramsTest, metricNames) {
+  for (size_t i = 0; i < SurfaceTelemetryHistograms::kMetricCount; i++) {
+    EXPECT_STRNE(
+        SurfaceTelemetryHistograms::getMetricName(static_cast<Metric>(i)),
+        "unknown");
+  }
+}
+
+TEST(SurfaceTelemetryHistogramsTest, clonedNodesIncludeClonesMadeBeforeCommit) {
+  auto builder = simpleComponentBuilder();
+  auto leafShadowNode = std::shared_ptr<ViewShadowNode>{};
+  // clang-format off
+  auto element =
+      Element<RootShadowNode>()
+        .children({
+          Element<ViewShadowNode>()
+            .children({
+              Element<ViewShadowNode>()
+                .reference(leafShadowNode),
+              Element<ViewShadowNode>()
+            })
+        });
+  // clang-format on
+  auto rootShadowNode = builder.build(element);
+
+  ContextContainer contextContainer{};
+  auto shadowTreeDelegate = DummyShadowTreeDelegate{};
+  ShadowTree shadowTree{
+      SurfaceId{11},
+      LayoutConstraints{},
+      LayoutContext{},
+      shadowTreeDelegate,
+      contextContainer};
+  shadowTree.commit(
+      [&](const RootShadowNode& /*oldRootShadowNode*/) {
+        return std::static_pointer_cast<RootShadowNode>(
+            rootShadowNode->ShadowNode::clone({}));
+      },
+      {});
+
+  // Cloned before the commit, as React does on the JS thread
+  auto newRootShadowNode = std::static_pointer_cast<RootShadowNode>(
+      shadowTree.getCurrentRevision().rootShadowNode->cloneTree(
+          leafShadowNode->getFamily(), [](const ShadowNode& oldShadowNode) {
+            return oldShadowNode.clone({});
+          }));
+  shadowTree.commit(
+      [&](const RootShadowNode& /*oldRootShadowNode*/) {
+        return newRootShadowNode;
+      },
+      {});
+
+  // The leaf and its parent, plus the sibling: the parent's clone adopts its
+  // children, and clones the sibling still owned by the old parent's Yoga node
+  EXPECT_EQ(shadowTree.getCurrentRevision().telemetry.getClonedNodesCount(), 3);
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <react/featureflags/ReactNativeFeatureFlags.h>
+#include <react/featureflags/ReactNativeFeatureFlagsDefaults.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/scrollview/ScrollViewComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+#include <react/renderer/mounting/CullingCache.h>
+#include <react/renderer/mounting/Differentiator.h>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr int kItemCount = 20'000;
+constexpr Float kItemHeight = 50;
+constexpr Float kViewportHeight = 800;
+constexpr int kRevisionCount = 64;
+
+class CullingFeatureFlags : public ReactNativeFeatureFlagsDefaults {
+ public:
+  bool enableViewCulling() override {
+    return true;
+  }
+};
+
+/*
+ * Revisions of a non-virtualized ScrollView of 20k views, scrolled down a
+ * viewport at a time.
+ */
+std::vector<std::shared_ptr<const RootShadowNode>> createScrollRevisions() {
+  auto items = std::vector<ElementFragment>{};
+  for (int i = 0; i < kItemCount; i++) {
+    items.push_back(Element<ViewShadowNode>().tag(10 + i).props([] {
+      auto sharedProps = std::make_shared<ViewShadowNodeProps>();
+      sharedProps->yogaStyle.setDimension(
+          yoga::Dimension::Height, yoga::StyleSizeLength::points(kItemHeight));
+      return sharedProps;
+    }));
+  }
+
+  auto rootShadowNode = std::shared_ptr<RootShadowNode>{};
+  auto scrollViewShadowNode = std::shared_ptr<ScrollViewShadowNode>{};
+  // clang-format off
+  auto element =
+      Element<RootShadowNode>()
+        .reference(rootShadowNode)
+        .tag(1)
+        .props([] {
+          auto sharedProps = std::make_shared<RootProps>();
+          sharedProps->layoutConstraints =
+              LayoutConstraints{{0, 0}, {400, kViewportHeight}};
+          return sharedProps;
+        })
+        .children({
+          Element<ScrollViewShadowNode>()
+            .reference(scrollViewShadowNode)
+            .tag(2)
+            .props([] {
+              auto sharedProps = std::make_shared<ScrollViewProps>();
+              sharedProps->yogaStyle.setDimension(
+                  yoga::Dimension::Height,
+                  yoga::StyleSizeLength::points(kViewportHeight));
+              return sharedProps;
+            })
+            .children({
+              Element<ViewShadowNode>()
+                .tag(3)
+                .children(items)
+            })
+        });
+  // clang-format on
+
+  auto builder = simpleComponentBuilder();
+  builder.build(element);
+  rootShadowNode->layoutIfNeeded();
+
+  const auto& componentDescriptor =
+      scrollViewShadowNode->getComponentDescriptor();
+  const auto& family = scrollViewShadowNode->getFamily();
+  auto revisions = std::vector<std::shared_ptr<const RootShadowNode>>{};
+  for (int i = 0; i < kRevisionCount; i++) {
+    auto state = componentDescriptor.createState(
+        family,
+        std::make_shared<const ScrollViewState>(
+            Point{0, i * kViewportHeight}, Rect{}, 0));
+    revisions.push_back(std::static_pointer_cast<const RootShadowNode>(
+        rootShadowNode->cloneTree(family, [&](const ShadowNode& oldShadowNode) {
+          return oldShadowNode.clone({.state = state});
+        })));
+  }
+  return revisions;
+}
+
+void scroll(benchmark::State& state, bool useCullingCache) {
+  ReactNativeFeatureFlags::override(std::make_unique<CullingFeatureFlags>());
+  auto revisions = createScrollRevisions();
+  auto cullingCache = CullingCache{};
+
+  size_t i = 0;
+  for (auto _ : state) {
+    const auto& oldRootShadowNode = *revisions[i % kRevisionCount];
+    const auto& newRootShadowNode = *revisions[(i + 1) % kRevisionCount];
+    auto mutations = calculateShadowViewMutations(
+        oldRootShadowNode,
+        newRootShadowNode,
+        useCullingCache ? &cullingCache : nullptr);
+    benchmark::DoNotOptimize(mutations);
+    i++;
+  }
+
+  ReactNativeFeatureFlags::dangerouslyReset();
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(scroll, withoutCullingCache, false)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(scroll, withCullingCache, true)
+    ->Unit(benchmark::kMicrosecond);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
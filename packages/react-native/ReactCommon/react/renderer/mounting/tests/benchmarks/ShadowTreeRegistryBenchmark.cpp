@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/mounting/ShadowTreeDelegate.h>
+#include <react/renderer/mounting/ShadowTreeRegistry.h>
+
+namespace facebook::react {
+
+namespace {
+
+// A multi-window host.
+constexpr SurfaceId kSurfaceCount = 24;
+
+class DummyShadowTreeDelegate : public ShadowTreeDelegate {
+ public:
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      const ShadowTree& /*shadowTree*/,
+      const RootShadowNode::Shared& /*oldRootShadowNode*/,
+      const RootShadowNode::Unshared& newRootShadowNode,
+      const ShadowTree::CommitOptions& /*commitOptions*/) const override {
+    return newRootShadowNode;
+  };
+
+  void shadowTreeDidFinishTransaction(
+      std::shared_ptr<const MountingCoordinator> /*mountingCoordinator*/,
+      bool /*mountSynchronously*/) const override {};
+};
+
+const DummyShadowTreeDelegate shadowTreeDelegate{};
+const ContextContainer contextContainer{};
+
+std::unique_ptr<ShadowTree> createShadowTree(SurfaceId surfaceId) {
+  return std::make_unique<ShadowTree>(
+      surfaceId,
+      LayoutConstraints{},
+      LayoutContext{},
+      shadowTreeDelegate,
+      contextContainer);
+}
+
+// The registry as it was before, with a reader lock on each visit.
+class SharedMutexShadowTreeRegistry final {
+ public:
+  void add(std::unique_ptr<ShadowTree>&& shadowTree) const {
+    std::unique_lock lock(mutex_);
+    registry_.emplace(shadowTree->getSurfaceId(), std::move(shadowTree));
+  }
+
+  std::unique_ptr<ShadowTree> remove(SurfaceId surfaceId) const {
+    std::unique_lock lock(mutex_);
+    auto iterator = registry_.find(surfaceId);
+    if (iterator == registry_.end()) {
+      return {};
+    }
+    auto shadowTree = std::move(iterator->second);
+    registry_.erase(iterator);
+    return shadowTree;
+  }
+
+  bool visit(
+      SurfaceId surfaceId,
+      const std::function<void(const ShadowTree& shadowTree)>& callback)
+      const {
+    std::shared_lock lock(mutex_);
+    auto iterator = registry_.find(surfaceId);
+    if (iterator == registry_.end()) {
+      return false;
+    }
+    callback(*iterator->second);
+    return true;
+  }
+
+ private:
+  mutable std::shared_mutex mutex_;
+  mutable std::unordered_map<SurfaceId, std::unique_ptr<ShadowTree>>
+      registry_;
+};
+
+template <typename Registry>
+void visit(benchmark::State& state) {
+  static Registry* registry;
+  if (state.thread_index() == 0) {
+    registry = new Registry{};
+    for (SurfaceId surfaceId = 0; surfaceId < kSurfaceCount; surfaceId++) {
+      registry->add(createShadowTree(surfaceId));
+    }
+  }
+
+  auto surfaceId = static_cast<SurfaceId>(state.thread_index());
+  for (auto _ : state) {
+    surfaceId = (surfaceId + 1) % kSurfaceCount;
+    registry->visit(surfaceId, [](const ShadowTree& shadowTree) {
+      benchmark::DoNotOptimize(shadowTree.getSurfaceId());
+    });
+  }
+
+  if (state.thread_index() == 0) {
+    for (SurfaceId surfaceId = 0; surfaceId < kSurfaceCount; surfaceId++) {
+      registry->remove(surfaceId);
+    }
+    delete registry;
+  }
+}
+
+template <typename Registry>
+void addAndRemove(benchmark::State& state) {
+  auto registry = Registry{};
+  for (SurfaceId surfaceId = 1; surfaceId < kSurfaceCount; surfaceId++) {
+    registry.add(createShadowTree(surfaceId));
+  }
+  auto shadowTree = createShadowTree(0);
+  for (auto _ : state) {
+    registry.add(std::move(shadowTree));
+    shadowTree = registry.remove(0);
+  }
+  for (SurfaceId surfaceId = 1; surfaceId < kSurfaceCount; surfaceId++) {
+    registry.remove(surfaceId);
+  }
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(visit, SharedMutexShadowTreeRegistry)->ThreadRange(1, 8);
+BENCHMARK_TEMPLATE(visit, ShadowTreeRegistry)->ThreadRange(1, 8);
+BENCHMARK_TEMPLATE(addAndRemove, SharedMutexShadowTreeRegistry);
+BENCHMARK_TEMPLATE(addAndRemove, ShadowTreeRegistry);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
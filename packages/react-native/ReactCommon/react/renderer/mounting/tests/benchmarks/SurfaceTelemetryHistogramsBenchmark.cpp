@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+#include <react/renderer/mounting/ShadowTree.h>
+#include <react/renderer/mounting/ShadowTreeDelegate.h>
+#include <react/renderer/mounting/SurfaceTelemetryHistograms.h>
+
+namespace facebook::react {
+
+namespace {
+
+class DummyShadowTreeDelegate : public ShadowTreeDelegate {
+ public:
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      const ShadowTree& /*shadowTree*/,
+      const RootShadowNode::Shared& /*oldRootShadowNode*/,
+      const RootShadowNode::Unshared& newRootShadowNode,
+      const ShadowTree::CommitOptions& /*commitOptions*/) const override {
+    return newRootShadowNode;
+  };
+
+  void shadowTreeDidFinishTransaction(
+      std::shared_ptr<const MountingCoordinator> /*mountingCoordinator*/,
+      bool /*mountSynchronously*/) const override {};
+};
+
+std::shared_ptr<const ViewShadowNodeProps> makeViewProps(Float height) {
+  auto sharedProps = std::make_shared<ViewShadowNodeProps>();
+  sharedProps->yogaStyle.setDimension(
+      yoga::Dimension::Height, yoga::StyleSizeLength::points(height));
+  return sharedProps;
+}
+
+TransactionTelemetry makeTelemetry() {
+  auto telemetry = TransactionTelemetry{};
+  telemetry.willCommit();
+  telemetry.willLayout();
+  telemetry.didLayout(100);
+  telemetry.didCommit();
+  telemetry.willDiff();
+  telemetry.didDiff();
+  telemetry.willMount();
+  telemetry.didMount();
+  return telemetry;
+}
+
+ShadowViewMutationList makeMutations(size_t count) {
+  auto mutations = ShadowViewMutationList{};
+  mutations.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    auto shadowView = ShadowView{};
+    shadowView.tag = static_cast<Tag>(i);
+    mutations.push_back(
+        ShadowViewMutation::UpdateMutation(shadowView, shadowView, 1));
+  }
+  return mutations;
+}
+
+// What TelemetryController adds to each transaction
+void incorporateTransaction(benchmark::State& state) {
+  const auto mutations = makeMutations(static_cast<size_t>(state.range(0)));
+  const auto telemetry = makeTelemetry();
+  auto histograms = SurfaceTelemetryHistograms{};
+  for (auto _ : state) {
+    histograms.incorporate(telemetry, mutations);
+  }
+}
+
+/*
+ * A real commit of a flat list of views in which one view changes height,
+ * followed by the diff and mount through TelemetryController, which records
+ * the transaction into the histograms. `telemetryPercent` is the time
+ * recording the same transaction takes on its own, relative to all of it.
+ */
+void commitAndMount(benchmark::State& state) {
+  const auto count = static_cast<int>(state.range(0));
+  auto changedShadowNode = std::shared_ptr<ViewShadowNode>{};
+  auto items = std::vector<ElementFragment>{};
+  for (int i = 0; i < count; i++) {
+    auto item = Element<ViewShadowNode>().tag(10 + i).props(makeViewProps(10));
+    if (i == count / 2) {
+      item.reference(changedShadowNode);
+    }
+    items.push_back(item);
+  }
+  // clang-format off
+  auto element =
+      Element<RootShadowNode>()
+        .tag(1)
+        .children({
+          Element<ViewShadowNode>()
+            .tag(2)
+            .children(items)
+        });
+  // clang-format on
+  auto builder = simpleComponentBuilder();
+  auto rootShadowNode = builder.build(element);
+
+  const auto shadowTreeDelegate = DummyShadowTreeDelegate{};
+  const auto contextContainer = ContextContainer{};
+  ShadowTree shadowTree{
+      SurfaceId{1},
+      LayoutConstraints{{0, 0}, {400, 100'000}},
+      LayoutContext{},
+      shadowTreeDelegate,
+      contextContainer};
+  const auto& telemetryController =
+      shadowTree.getMountingCoordinator()->getTelemetryController();
+  const auto noop = [](const MountingTransaction& /*transaction*/,
+                       const SurfaceTelemetry& /*surfaceTelemetry*/) {};
+
+  // Keeps the layout constraints of the surface
+  shadowTree.commit(
+      [&](const RootShadowNode& oldRootShadowNode) {
+        return std::static_pointer_cast<RootShadowNode>(
+            rootShadowNode->ShadowNode::clone(
+                {.props = oldRootShadowNode.getProps()}));
+      },
+      {});
+  telemetryController.pullTransaction(noop, noop, noop);
+
+  const auto& family = changedShadowNode->getFamily();
+  const std::shared_ptr<const Props> props[] = {
+      makeViewProps(20), makeViewProps(10)};
+  size_t revision = 0;
+  auto commit = [&]() {
+    shadowTree.commit(
+        [&](const RootShadowNode& oldRootShadowNode) {
+          return std::static_pointer_cast<RootShadowNode>(
+              oldRootShadowNode.cloneTree(
+                  family, [&](const ShadowNode& oldShadowNode) {
+                    return oldShadowNode.clone(
+                        {.props = props[revision % 2]});
+                  }));
+        },
+        {});
+    revision++;
+  };
+
+  auto totalTime = std::chrono::steady_clock::duration::zero();
+  for (auto _ : state) {
+    auto start = std::chrono::steady_clock::now();
+    commit();
+    telemetryController.pullTransaction(noop, noop, noop);
+    totalTime += std::chrono::steady_clock::now() - start;
+  }
+
+  auto telemetry = TransactionTelemetry{};
+  auto mutations = ShadowViewMutationList{};
+  commit();
+  telemetryController.pullTransaction(
+      noop,
+      noop,
+      [&](const MountingTransaction& transaction,
+          const SurfaceTelemetry& /*surfaceTelemetry*/) {
+        telemetry = transaction.getTelemetry();
+        mutations = transaction.getMutations();
+      });
+  auto histograms = SurfaceTelemetryHistograms{};
+  auto start = std::chrono::steady_clock::now();
+  for (int64_t i = 0; i < state.iterations(); i++) {
+    histograms.incorporate(telemetry, mutations);
+  }
+  auto telemetryTime = std::chrono::steady_clock::now() - start;
+
+  state.counters["telemetryPercent"] = totalTime.count() > 0
+      ? 100.0 * static_cast<double>(telemetryTime.count()) /
+          static_cast<double>(totalTime.count())
+      : 0.0;
+}
+
+// Surfaces mounted on several threads at once, sharing cache lines
+void recordConcurrently(benchmark::State& state) {
+  static auto histogram = TelemetryHistogram{};
+  uint64_t value = state.thread_index();
+  for (auto _ : state) {
+    histogram.record(value);
+    value = value * 7 + 1'000;
+  }
+}
+
+void takeSnapshot(benchmark::State& state) {
+  auto histograms = SurfaceTelemetryHistograms{};
+  histograms.incorporate(makeTelemetry(), makeMutations(100));
+  for (auto _ : state) {
+    auto snapshot = histograms.takeSnapshot();
+    benchmark::DoNotOptimize(snapshot.histograms.data());
+  }
+}
+
+} // namespace
+
+BENCHMARK(incorporateTransaction)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(commitAndMount)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Arg(10'000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(recordConcurrently)->Threads(1)->Threads(4);
+BENCHMARK(takeSnapshot);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
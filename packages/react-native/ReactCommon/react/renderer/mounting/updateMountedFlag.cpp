@@ -10,7 +10,7 @@
 #include <react/featureflags/ReactNativeFeatureFlags.h>
 
 namespace facebook::react {
-void updateMountedFlag(
+size_t updateMountedFlag(
     const ShadowNode::ListOfShared& oldChildren,
     const ShadowNode::ListOfShared& newChildren) {
   // This is a simplified version of Diffing algorithm that only updates
@@ -20,15 +20,16 @@ void updateMountedFlag(
 
   if (&oldChildren == &newChildren) {
     // Lists are identical, nothing to do.
-    return;
+    return 0;
   }
 
   if (oldChildren.empty() && newChildren.empty()) {
     // Both lists are empty, nothing to do.
-    return;
+    return 0;
   }
 
   size_t index = 0;
+  size_t clonedNodesCount = 0;
 
   // Stage 1: Mount and unmount "updated" children.
   for (index = 0; index < oldChildren.size() && index < newChildren.size();
@@ -53,7 +54,8 @@ void updateMountedFlag(
       newChild->updateRuntimeShadowNodeReference(newChild);
     }
 
-    updateMountedFlag(oldChild->getChildren(), newChild->getChildren());
+    clonedNodesCount += 1 +
+        updateMountedFlag(oldChild->getChildren(), newChild->getChildren());
   }
 
   size_t lastIndexAfterFirstStage = index;
@@ -71,5 +73,7 @@ void updateMountedFlag(
     oldChild->setMounted(false);
     updateMountedFlag(oldChild->getChildren(), {});
   }
+
+  return clonedNodesCount;
 }
 } // namespace facebook::react
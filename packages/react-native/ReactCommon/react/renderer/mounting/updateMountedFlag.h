@@ -12,8 +12,11 @@
 namespace facebook::react {
 /*
  * Traverses the shadow tree and updates the `mounted` flag on all nodes.
+ * Returns the number of new nodes which replace an old node of the same
+ * family, i.e. the clones committed with the new tree, wherever they were
+ * made.
  */
-void updateMountedFlag(
+size_t updateMountedFlag(
     const ShadowNode::ListOfShared& oldChildren,
     const ShadowNode::ListOfShared& newChildren);
 } // namespace facebook::react
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "BatchedCallInvoker.h"
+
+#include <algorithm>
+#include <bit>
+#include <utility>
+#include <vector>
+
+namespace facebook::react {
+
+struct BatchedCallInvoker::Counters {
+  std::atomic<uint64_t> invocationCount{0};
+  std::atomic<uint64_t> batchCount{0};
+  std::atomic<uint64_t> maxBatchSize{0};
+  std::array<std::atomic<uint64_t>, BatchSizeBucketCount> batchSizeHistogram{};
+
+  void recordBatch(uint64_t size) {
+    invocationCount.fetch_add(size, std::memory_order_relaxed);
+    batchCount.fetch_add(1, std::memory_order_relaxed);
+    // Only updated by the JavaScript thread, no need for a CAS loop
+    if (size > maxBatchSize.load(std::memory_order_relaxed)) {
+      maxBatchSize.store(size, std::memory_order_relaxed);
+    }
+    auto bucket = std::min<size_t>(
+        std::bit_width(size) - 1, BatchSizeBucketCount - 1);
+    batchSizeHistogram[bucket].fetch_add(1, std::memory_order_relaxed);
+  }
+};
+
+struct BatchedCallInvoker::Batch {
+  struct Node {
+    CallFunc func;
+    Node* next{nullptr};
+  };
+
+  ~Batch() {
+    auto* node = posted.exchange(nullptr, std::memory_order_acquire);
+    while (node != nullptr) {
+      delete std::exchange(node, node->next);
+    }
+  }
+
+  /*
+   * Pushes `func` and returns whether the caller must schedule a flush.
+   */
+  bool push(CallFunc&& func) {
+    auto* node = new Node{.func = std::move(func)};
+    auto* head = posted.load(std::memory_order_relaxed);
+    do {
+      node->next = head;
+    } while (!posted.compare_exchange_weak(head, node));
+    return !flushScheduled.exchange(true);
+  }
+
+  /*
+   * Runs on the JavaScript thread. If a closure throws, the closures after it
+   * are kept for the next flush.
+   */
+  void flush(jsi::Runtime& runtime, Counters& counters) {
+    // Cleared before taking the posted closures: anything posted afterwards
+    // schedules another flush. Together with `push` this relies on all four
+    // operations being sequentially consistent: a closure whose push found a
+    // flush already scheduled is always taken here.
+    flushScheduled.store(false);
+    auto* node = posted.exchange(nullptr);
+
+    // Restore posting order, after closures left over by a previous flush
+    auto leftoverCount = pending.size() - nextPending;
+    Node* reversed = nullptr;
+    while (node != nullptr) {
+      auto* next = node->next;
+      node->next = reversed;
+      reversed = node;
+      node = next;
+    }
+    while (reversed != nullptr) {
+      pending.push_back(std::move(reversed->func));
+      delete std::exchange(reversed, reversed->next);
+    }
+
+    if (pending.size() - nextPending > leftoverCount) {
+      counters.recordBatch(pending.size() - nextPending - leftoverCount);
+    }
+
+    while (nextPending < pending.size()) {
+      // Advanced first so that a throwing closure is not run again
+      auto func = std::move(pending[nextPending++]);
+      func(runtime);
+    }
+    pending.clear();
+    nextPending = 0;
+  }
+
+  bool hasPending() const {
+    return nextPending < pending.size();
+  }
+
+  std::atomic<Node*> posted{nullptr};
+  std::atomic<bool> flushScheduled{false};
+
+  // Only accessed on the JavaScript thread
+  std::vector<CallFunc> pending;
+  size_t nextPending{0};
+};
+
+BatchedCallInvoker::BatchedCallInvoker(std::shared_ptr<CallInvoker> callInvoker)
+    : callInvoker_(std::move(callInvoker)),
+      counters_(std::make_shared<Counters>()) {
+  for (auto& batch : batches_) {
+    batch = std::make_shared<Batch>();
+  }
+}
+
+void BatchedCallInvoker::invokeAsync(CallFunc&& func) noexcept {
+  enqueue(0, std::move(func));
+}
+
+void BatchedCallInvoker::invokeAsync(
+    SchedulerPriority priority,
+    CallFunc&& func) noexcept {
+  enqueue(static_cast<size_t>(priority), std::move(func));
+}
+
+void BatchedCallInvoker::invokeSync(CallFunc&& func) {
+  callInvoker_->invokeSync(std::move(func));
+}
+
+BatchedCallInvoker::Telemetry BatchedCallInvoker::getTelemetry() const {
+  Telemetry telemetry{
+      .invocationCount =
+          counters_->invocationCount.load(std::memory_order_relaxed),
+      .batchCount = counters_->batchCount.load(std::memory_order_relaxed),
+      .maxBatchSize = counters_->maxBatchSize.load(std::memory_order_relaxed),
+  };
+  for (size_t i = 0; i < BatchSizeBucketCount; i++) {
+    telemetry.batchSizeHistogram[i] =
+        counters_->batchSizeHistogram[i].load(std::memory_order_relaxed);
+  }
+  return telemetry;
+}
+
+void BatchedCallInvoker::enqueue(size_t batchIndex, CallFunc&& func) noexcept {
+  if (batches_[batchIndex]->push(std::move(func))) {
+    scheduleFlush(callInvoker_, batches_[batchIndex], counters_, batchIndex);
+  }
+  // Otherwise a flush is already scheduled and will pick the closure up
+}
+
+void BatchedCallInvoker::scheduleFlush(
+    const std::shared_ptr<CallInvoker>& callInvoker,
+    const std::shared_ptr<Batch>& batch,
+    const std::shared_ptr<Counters>& counters,
+    size_t batchIndex) noexcept {
+  // The flush retains the batch, so closures posted before the invoker is
+  // destroyed still run.
+  auto flush = [callInvoker, batch, counters, batchIndex](
+                   jsi::Runtime& runtime) {
+    try {
+      batch->flush(runtime, *counters);
+    } catch (...) {
+      if (batch->hasPending()) {
+        scheduleFlush(callInvoker, batch, counters, batchIndex);
+      }
+      throw;
+    }
+  };
+  if (batchIndex == 0) {
+    callInvoker->invokeAsync(std::move(flush));
+  } else {
+    callInvoker->invokeAsync(
+        static_cast<SchedulerPriority>(batchIndex), std::move(flush));
+  }
+}
+
+} // namespace facebook::react
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <ReactCommon/CallInvoker.h>
+#include <ReactCommon/SchedulerPriority.h>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace facebook::react {
+
+/*
+ * Decorates a `CallInvoker` so that closures posted from any number of
+ * threads while the JavaScript thread is busy are run together by a single
+ * task of the underlying invoker, instead of one task each. Useful when
+ * native modules resolve many promises or callbacks in a burst.
+ *
+ * Closures posted by the same thread run in posting order. Closures with
+ * different priorities are batched separately and keep their priority.
+ * If a closure throws, the exception propagates out of the task so the
+ * underlying invoker reports it; the rest of the batch runs in a new task.
+ */
+class BatchedCallInvoker : public CallInvoker {
+ public:
+  /*
+   * Batch sizes are bucketed by powers of two: bucket `i` counts batches of
+   * [2^i, 2^(i+1)) closures, and the last bucket every larger batch.
+   */
+  static constexpr size_t BatchSizeBucketCount = 12;
+
+  struct Telemetry {
+    uint64_t invocationCount{0};
+    uint64_t batchCount{0};
+    uint64_t maxBatchSize{0};
+    std::array<uint64_t, BatchSizeBucketCount> batchSizeHistogram{};
+  };
+
+  explicit BatchedCallInvoker(std::shared_ptr<CallInvoker> callInvoker);
+
+  void invokeAsync(CallFunc&& func) noexcept override;
+  void invokeAsync(SchedulerPriority priority, CallFunc&& func) noexcept
+      override;
+  void invokeSync(CallFunc&& func) override;
+
+  /*
+   * Returns counts accumulated since the invoker was created. May be called
+   * from any thread.
+   */
+  Telemetry getTelemetry() const;
+
+ private:
+  struct Batch;
+  struct Counters;
+
+  void enqueue(size_t batchIndex, CallFunc&& func) noexcept;
+
+  static void scheduleFlush(
+      const std::shared_ptr<CallInvoker>& callInvoker,
+      const std::shared_ptr<Batch>& batch,
+      const std::shared_ptr<Counters>& counters,
+      size_t batchIndex) noexcept;
+
+  // Index 0 batches closures posted without a priority, the others one
+  // priority each, indexed by its value.
+  static constexpr size_t BatchCount =
+      static_cast<size_t>(SchedulerPriority::IdlePriority) + 1;
+  static_assert(
+      static_cast<size_t>(SchedulerPriority::ImmediatePriority) > 0,
+      "Index 0 is reserved for closures posted without a priority");
+  static_assert(
+      SchedulerPriority::IdlePriority > SchedulerPriority::LowPriority &&
+          SchedulerPriority::LowPriority > SchedulerPriority::NormalPriority &&
+          SchedulerPriority::NormalPriority >
+              SchedulerPriority::UserBlockingPriority &&
+          SchedulerPriority::UserBlockingPriority >
+              SchedulerPriority::ImmediatePriority,
+      "IdlePriority must have the largest value of all priorities");
+
+  std::shared_ptr<CallInvoker> callInvoker_;
+  std::shared_ptr<Counters> counters_;
+  std::array<std::shared_ptr<Batch>, BatchCount> batches_;
+};
+
+} // namespace facebook::react
@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/renderer/runtimescheduler/BatchedCallInvoker.h>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+/*
+ * Runs posted closures on a dedicated "JavaScript" thread, recording the
+ * priority each was posted with.
+ */
+class ThreadCallInvoker : public CallInvoker {
+ public:
+  explicit ThreadCallInvoker(jsi::Runtime& runtime)
+      : runtime_(runtime), thread_([this]() { loop(); }) {}
+
+  ~ThreadCallInvoker() override {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      quit_ = true;
+    }
+    cv_.notify_one();
+    thread_.join();
+  }
+
+  void invokeAsync(CallFunc&& func) noexcept override {
+    invokeAsync(SchedulerPriority::NormalPriority, std::move(func));
+  }
+
+  void invokeAsync(SchedulerPriority priority, CallFunc&& func) noexcept
+      override {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      queue_.emplace_back(std::move(func));
+      priorities.push_back(priority);
+    }
+    cv_.notify_one();
+  }
+
+  void invokeSync(CallFunc&& func) override {
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool done = false;
+    invokeAsync([&](jsi::Runtime& runtime) {
+      func(runtime);
+      std::lock_guard<std::mutex> lock(mutex);
+      done = true;
+      cv.notify_one();
+    });
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [&]() { return done; });
+  }
+
+  // Accessed under `mutex_` or once the thread is idle
+  std::vector<SchedulerPriority> priorities;
+  size_t errorCount{0};
+
+ private:
+  void loop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      cv_.wait(lock, [&]() { return quit_ || !queue_.empty(); });
+      if (queue_.empty()) {
+        return;
+      }
+      auto func = std::move(queue_.front());
+      queue_.pop_front();
+      lock.unlock();
+      try {
+        func(runtime_);
+      } catch (const std::exception&) {
+        lock.lock();
+        errorCount++;
+        continue;
+      }
+      lock.lock();
+    }
+  }
+
+  jsi::Runtime& runtime_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<CallFunc> queue_;
+  bool quit_{false};
+  std::thread thread_;
+};
+
+class BatchedCallInvokerTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    runtime_ = hermes::makeHermesRuntime();
+    threadCallInvoker_ = std::make_shared<ThreadCallInvoker>(*runtime_);
+    callInvoker_ = std::make_shared<BatchedCallInvoker>(threadCallInvoker_);
+  }
+
+  void TearDown() override {
+    callInvoker_.reset();
+    threadCallInvoker_.reset();
+    runtime_.reset();
+  }
+
+  // Waits until everything posted so far has run
+  void drain() {
+    callInvoker_->invokeSync([](jsi::Runtime&) {});
+  }
+
+  std::unique_ptr<jsi::Runtime> runtime_;
+  std::shared_ptr<ThreadCallInvoker> threadCallInvoker_;
+  std::shared_ptr<BatchedCallInvoker> callInvoker_;
+};
+
+} // namespace
+
+TEST_F(BatchedCallInvokerTest, runsClosuresInPostingOrder) {
+  std::vector<int> order;
+  for (int i = 0; i < 100; i++) {
+    callInvoker_->invokeAsync([&order, i](jsi::Runtime&) {
+      order.push_back(i);
+    });
+  }
+  drain();
+
+  std::vector<int> expected(100);
+  std::iota(expected.begin(), expected.end(), 0);
+  EXPECT_EQ(order, expected);
+}
+
+TEST_F(BatchedCallInvokerTest, keepsPriorities) {
+  std::vector<SchedulerPriority> ran;
+  callInvoker_->invokeAsync(
+      SchedulerPriority::LowPriority,
+      [&](jsi::Runtime&) { ran.push_back(SchedulerPriority::LowPriority); });
+  callInvoker_->invokeAsync(
+      SchedulerPriority::ImmediatePriority, [&](jsi::Runtime&) {
+        ran.push_back(SchedulerPriority::ImmediatePriority);
+      });
+  drain();
+
+  EXPECT_EQ(ran.size(), 2);
+  EXPECT_EQ(
+      threadCallInvoker_->priorities,
+      (std::vector<SchedulerPriority>{
+          SchedulerPriority::LowPriority,
+          SchedulerPriority::ImmediatePriority,
+          SchedulerPriority::NormalPriority}));
+}
+
+TEST_F(BatchedCallInvokerTest, runsRemainingClosuresAfterOneThrows) {
+  std::vector<int> ran;
+  // Block the JavaScript thread so that all closures end up in one batch
+  std::mutex blocker;
+  blocker.lock();
+  threadCallInvoker_->invokeAsync(
+      [&](jsi::Runtime&) { std::lock_guard<std::mutex> lock(blocker); });
+
+  callInvoker_->invokeAsync([&](jsi::Runtime&) { ran.push_back(1); });
+  callInvoker_->invokeAsync(
+      [](jsi::Runtime&) { throw std::runtime_error("Closure failed"); });
+  callInvoker_->invokeAsync([&](jsi::Runtime&) { ran.push_back(3); });
+  blocker.unlock();
+  // The remaining closure is rescheduled behind the first `drain`
+  drain();
+  drain();
+
+  EXPECT_EQ(ran, (std::vector<int>{1, 3}));
+  EXPECT_EQ(threadCallInvoker_->errorCount, 1);
+  // The closure after the throwing one runs from a second flush, but still
+  // counts as part of the original batch
+  auto telemetry = callInvoker_->getTelemetry();
+  EXPECT_EQ(telemetry.batchCount, 1);
+  EXPECT_EQ(telemetry.invocationCount, 3);
+  EXPECT_EQ(telemetry.batchSizeHistogram[1], 1);
+}
+
+TEST_F(BatchedCallInvokerTest, stressConcurrentProducers) {
+  constexpr int ProducerCount = 8;
+  constexpr int ClosuresPerProducer = 20'000;
+
+  // Only accessed on the JavaScript thread
+  std::vector<std::vector<int>> received(ProducerCount);
+  std::vector<std::thread> producers;
+  for (int producer = 0; producer < ProducerCount; producer++) {
+    producers.emplace_back([&, producer]() {
+      for (int i = 0; i < ClosuresPerProducer; i++) {
+        callInvoker_->invokeAsync([&received, producer, i](jsi::Runtime&) {
+          received[producer].push_back(i);
+        });
+        if (i % 1000 == 0) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  drain();
+
+  for (int producer = 0; producer < ProducerCount; producer++) {
+    ASSERT_EQ(received[producer].size(), ClosuresPerProducer);
+    for (int i = 0; i < ClosuresPerProducer; i++) {
+      ASSERT_EQ(received[producer][i], i) << "producer " << producer;
+    }
+  }
+
+  auto telemetry = callInvoker_->getTelemetry();
+  // The closure posted by `drain` goes through `invokeSync`, unbatched
+  EXPECT_EQ(telemetry.invocationCount, ProducerCount * ClosuresPerProducer);
+  EXPECT_EQ(
+      std::accumulate(
+          telemetry.batchSizeHistogram.begin(),
+          telemetry.batchSizeHistogram.end(),
+          uint64_t{0}),
+      telemetry.batchCount);
+  EXPECT_LE(telemetry.batchCount, telemetry.invocationCount);
+  EXPECT_GE(telemetry.maxBatchSize, 1);
+  // One flush per batch, plus the closure posted by `drain` and flushes
+  // which found their closures already taken by the previous one
+  EXPECT_LE(telemetry.batchCount + 1, threadCallInvoker_->priorities.size());
+}
+
+} // namespace facebook::react
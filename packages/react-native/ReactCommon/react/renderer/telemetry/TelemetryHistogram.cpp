@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "TelemetryHistogram.h"
+
+#include <algorithm>
+
+namespace facebook::react {
+
+double TelemetryHistogram::Snapshot::getMean() const {
+  if (count == 0) {
+    return 0.0;
+  }
+  return static_cast<double>(sum) / static_cast<double>(count);
+}
+
+uint64_t TelemetryHistogram::Snapshot::getValueAtPercentile(
+    double percentile) const {
+  if (count == 0) {
+    return 0;
+  }
+  const auto rank = std::min(
+      static_cast<uint64_t>(std::clamp(percentile, 0.0, 100.0) * count / 100),
+      count - 1);
+  if (rank == count - 1 && max > 0) {
+    return max;
+  }
+
+  uint64_t cumulativeCount = 0;
+  for (size_t i = 0; i < kBucketCount; i++) {
+    cumulativeCount += counts[i];
+    if (cumulativeCount > rank) {
+      const auto lowerBound = getBucketLowerBound(i);
+      const auto middle =
+          lowerBound + (getBucketUpperBound(i) - 1 - lowerBound) / 2;
+      // The maximum is exact, and tighter in the last bucket
+      return std::min(middle, std::max(max, lowerBound));
+    }
+  }
+  return max;
+}
+
+TelemetryHistogram::Snapshot TelemetryHistogram::getSnapshot() const {
+  auto snapshot = Snapshot{};
+  for (size_t i = 0; i < kBucketCount; i++) {
+    snapshot.counts[i] = buckets_[i].load(std::memory_order_relaxed);
+    snapshot.count += snapshot.counts[i];
+  }
+  snapshot.sum = sum_.load(std::memory_order_relaxed);
+  snapshot.max = max_.load(std::memory_order_relaxed);
+  return snapshot;
+}
+
+TelemetryHistogram::Snapshot TelemetryHistogram::takeSnapshot() {
+  auto snapshot = Snapshot{};
+  for (size_t i = 0; i < kBucketCount; i++) {
+    snapshot.counts[i] = buckets_[i].exchange(0, std::memory_order_relaxed);
+    snapshot.count += snapshot.counts[i];
+  }
+  snapshot.sum = sum_.exchange(0, std::memory_order_relaxed);
+  snapshot.max = max_.exchange(0, std::memory_order_relaxed);
+  return snapshot;
+}
+
+} // namespace facebook::react
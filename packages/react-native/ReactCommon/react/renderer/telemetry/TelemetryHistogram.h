@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+
+namespace facebook::react {
+
+/*
+ * Distribution of non-negative integer values (durations in nanoseconds,
+ * counts of nodes...) in fixed, log-linear buckets, like an HDR histogram:
+ * each power of two is split in 8 buckets, so that values are recorded
+ * within 12.5% of their magnitude, from 0 to 2^36 (about a minute in
+ * nanoseconds). Larger values are recorded as the largest one.
+ *
+ * Recording is lock-free and wait-free (a few relaxed atomic increments), so
+ * that it can be done on any thread in the middle of the commit pipeline.
+ */
+class TelemetryHistogram final {
+ public:
+  static constexpr int kSubBucketBits = 3;
+  static constexpr int kSubBucketCount = 1 << kSubBucketBits;
+  static constexpr int kMaxValueBits = 36;
+  static constexpr uint64_t kMaxValue = (uint64_t{1} << kMaxValueBits) - 1;
+  static constexpr size_t kBucketCount =
+      (kMaxValueBits - kSubBucketBits + 1) * kSubBucketCount;
+
+  /*
+   * A copy of the histogram at some point, to read or export it.
+   */
+  struct Snapshot {
+    std::array<uint64_t, kBucketCount> counts{};
+    uint64_t count{0};
+    uint64_t sum{0};
+    uint64_t max{0};
+
+    double getMean() const;
+
+    /*
+     * Returns the middle of the bucket of the value of rank
+     * `percentile * count / 100` (or the maximum, for the last one), or 0 if
+     * there are no values.
+     */
+    uint64_t getValueAtPercentile(double percentile) const;
+  };
+
+  static constexpr size_t getBucketIndex(uint64_t value) {
+    if (value > kMaxValue) {
+      value = kMaxValue;
+    }
+    if (value < kSubBucketCount) {
+      return static_cast<size_t>(value);
+    }
+    // The power of two, and the top bits below the leading one
+    const int exponent = std::bit_width(value) - 1;
+    const auto subBucket =
+        (value >> (exponent - kSubBucketBits)) & (kSubBucketCount - 1);
+    return static_cast<size_t>(
+        (exponent - kSubBucketBits + 1) * kSubBucketCount + subBucket);
+  }
+
+  /*
+   * The lowest value in the bucket.
+   */
+  static constexpr uint64_t getBucketLowerBound(size_t index) {
+    if (index < kSubBucketCount) {
+      return index;
+    }
+    const auto exponent =
+        static_cast<int>(index / kSubBucketCount) + kSubBucketBits - 1;
+    const auto subBucket = index % kSubBucketCount;
+    return (kSubBucketCount + subBucket) << (exponent - kSubBucketBits);
+  }
+
+  /*
+   * The lowest value of the next bucket.
+   */
+  static constexpr uint64_t getBucketUpperBound(size_t index) {
+    return index + 1 < kBucketCount ? getBucketLowerBound(index + 1)
+                                    : kMaxValue + 1;
+  }
+
+  void record(uint64_t value) noexcept {
+    buckets_[getBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(value, std::memory_order_relaxed);
+    auto max = max_.load(std::memory_order_relaxed);
+    while (value > max &&
+           !max_.compare_exchange_weak(
+               max, value, std::memory_order_relaxed)) {
+    }
+  }
+
+  /*
+   * Copies the histogram. Values recorded concurrently may or may not be
+   * included, and the sum and maximum may lag behind the buckets.
+   */
+  Snapshot getSnapshot() const;
+
+  /*
+   * Copies the histogram and resets it, without losing values recorded
+   * concurrently, e.g. to export it periodically.
+   */
+  Snapshot takeSnapshot();
+
+ private:
+  std::array<std::atomic<uint64_t>, kBucketCount> buckets_{};
+  std::atomic<uint64_t> sum_{0};
+  std::atomic<uint64_t> max_{0};
+};
+
+} // namespace facebook::react
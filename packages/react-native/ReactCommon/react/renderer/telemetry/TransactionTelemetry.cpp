@@ -105,6 +105,14 @@ void TransactionTelemetry::setRevisionNumber(int revisionNumber) {
   revisionNumber_ = revisionNumber;
 }
 
+void TransactionTelemetry::setClonedNodesCount(int clonedNodesCount) {
+  clonedNodesCount_ = clonedNodesCount;
+}
+
+void TransactionTelemetry::setMeasuredNodesCount(int measuredNodesCount) {
+  measuredNodesCount_ = measuredNodesCount;
+}
+
 TelemetryTimePoint TransactionTelemetry::getDiffStartTime() const {
   react_native_assert(diffStartTime_ != kTelemetryUndefinedTimePoint);
   react_native_assert(diffEndTime_ != kTelemetryUndefinedTimePoint);
@@ -169,4 +177,12 @@ int TransactionTelemetry::getAffectedLayoutNodesCount() const {
   return affectedLayoutNodesCount_;
 }
 
+int TransactionTelemetry::getClonedNodesCount() const {
+  return clonedNodesCount_;
+}
+
+int TransactionTelemetry::getMeasuredNodesCount() const {
+  return measuredNodesCount_;
+}
+
 } // namespace facebook::react
@@ -48,6 +48,13 @@ class TransactionTelemetry final {
   void didMount();
 
   void setRevisionNumber(int revisionNumber);
+  /*
+   * Nodes below the root of the committed tree which replace a node of the
+   * same family in the previous revision, whether cloned by React on the JS
+   * thread or during the commit.
+   */
+  void setClonedNodesCount(int clonedNodesCount);
+  void setMeasuredNodesCount(int measuredNodesCount);
 
   /*
    * Reading
@@ -66,6 +73,8 @@ class TransactionTelemetry final {
   int getRevisionNumber() const;
 
   int getAffectedLayoutNodesCount() const;
+  int getClonedNodesCount() const;
+  int getMeasuredNodesCount() const;
 
  private:
   TelemetryTimePoint diffStartTime_{kTelemetryUndefinedTimePoint};
@@ -85,6 +94,8 @@ class TransactionTelemetry final {
   std::function<TelemetryTimePoint()> now_;
 
   int affectedLayoutNodesCount_{0};
+  int clonedNodesCount_{0};
+  int measuredNodesCount_{0};
 };
 
 } // namespace facebook::react
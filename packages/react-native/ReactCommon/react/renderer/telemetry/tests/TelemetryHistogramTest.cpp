@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <algorithm>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/telemetry/TelemetryHistogram.h>
+
+using namespace facebook::react;
+
+TEST(TelemetryHistogramTest, buckets) {
+  // Small values have a bucket each
+  for (uint64_t value = 0; value < 16; value++) {
+    EXPECT_EQ(TelemetryHistogram::getBucketIndex(value), value);
+    EXPECT_EQ(TelemetryHistogram::getBucketLowerBound(value), value);
+  }
+
+  // Buckets are contiguous, and no wider than 1/8 of their values
+  for (size_t i = 0; i < TelemetryHistogram::kBucketCount; i++) {
+    auto lowerBound = TelemetryHistogram::getBucketLowerBound(i);
+    auto upperBound = TelemetryHistogram::getBucketUpperBound(i);
+    EXPECT_LT(lowerBound, upperBound);
+    EXPECT_LE((upperBound - lowerBound) * 8, std::max<uint64_t>(lowerBound, 8));
+    EXPECT_EQ(TelemetryHistogram::getBucketIndex(lowerBound), i);
+    EXPECT_EQ(TelemetryHistogram::getBucketIndex(upperBound - 1), i);
+  }
+
+  EXPECT_EQ(
+      TelemetryHistogram::getBucketUpperBound(
+          TelemetryHistogram::kBucketCount - 1),
+      TelemetryHistogram::kMaxValue + 1);
+  EXPECT_EQ(
+      TelemetryHistogram::getBucketIndex(UINT64_MAX),
+      TelemetryHistogram::kBucketCount - 1);
+}
+
+TEST(TelemetryHistogramTest, percentiles) {
+  auto histogram = TelemetryHistogram{};
+  EXPECT_EQ(histogram.getSnapshot().getValueAtPercentile(50), 0u);
+
+  // Commit times around 2ms, in nanoseconds, with a long tail
+  std::mt19937 generator(42);
+  std::lognormal_distribution<double> distribution(14.5, 0.7);
+  std::vector<uint64_t> values;
+  for (int i = 0; i < 10'000; i++) {
+    values.push_back(static_cast<uint64_t>(distribution(generator)));
+    histogram.record(values.back());
+  }
+  std::sort(values.begin(), values.end());
+
+  auto snapshot = histogram.getSnapshot();
+  EXPECT_EQ(snapshot.count, values.size());
+  EXPECT_EQ(snapshot.max, values.back());
+  for (double percentile : {1.0, 50.0, 90.0, 99.0, 99.9}) {
+    auto expected =
+        static_cast<double>(values[percentile * values.size() / 100]);
+    auto actual =
+        static_cast<double>(snapshot.getValueAtPercentile(percentile));
+    EXPECT_NEAR(actual, expected, expected / 16) << "p" << percentile;
+  }
+  EXPECT_EQ(snapshot.getValueAtPercentile(100), values.back());
+}
+
+TEST(TelemetryHistogramTest, takeSnapshot) {
+  auto histogram = TelemetryHistogram{};
+  histogram.record(3);
+  histogram.record(1000);
+
+  auto snapshot = histogram.takeSnapshot();
+  EXPECT_EQ(snapshot.count, 2u);
+  EXPECT_EQ(snapshot.sum, 1003u);
+  EXPECT_EQ(snapshot.max, 1000u);
+  EXPECT_DOUBLE_EQ(snapshot.getMean(), 501.5);
+
+  snapshot = histogram.takeSnapshot();
+  EXPECT_EQ(snapshot.count, 0u);
+  EXPECT_EQ(snapshot.sum, 0u);
+  EXPECT_EQ(snapshot.max, 0u);
+}
+
+TEST(TelemetryHistogramTest, concurrentRecording) {
+  auto histogram = TelemetryHistogram{};
+  std::vector<std::thread> threads;
+  for (uint64_t i = 0; i < 4; i++) {
+    threads.emplace_back([&histogram, i]() {
+      for (uint64_t value = 0; value < 10'000; value++) {
+        histogram.record(value * (i + 1));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto snapshot = histogram.getSnapshot();
+  EXPECT_EQ(snapshot.count, 40'000u);
+  EXPECT_EQ(snapshot.sum, 9'999u * 10'000 / 2 * (1 + 2 + 3 + 4));
+  EXPECT_EQ(snapshot.max, 9'999u * 4);
+}
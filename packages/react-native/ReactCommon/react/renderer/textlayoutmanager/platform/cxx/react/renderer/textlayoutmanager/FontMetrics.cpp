@@ -0,0 +1,414 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "FontMetrics.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+// Advances of the printable ASCII characters (U+0020 to U+007E) of Helvetica,
+// in thousandths of an em. Arial and Liberation Sans share these metrics.
+constexpr std::array<uint16_t, 95> kSansSerifAsciiAdvances = {
+    278, 278, 355, 556, 556, 889, 667, 191, 333, 333, 389, 584, 278, 333,
+    278, 278, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 278, 278,
+    584, 584, 584, 556, 1015, 667, 667, 722, 722, 667, 611, 778, 722, 278,
+    500, 667, 556, 833, 722, 778, 667, 778, 722, 667, 611, 722, 667, 944,
+    667, 667, 611, 278, 278, 278, 469, 556, 333, 556, 556, 500, 556, 556,
+    278, 556, 556, 222, 222, 500, 222, 833, 556, 556, 556, 556, 333, 500,
+    278, 556, 500, 722, 500, 500, 500, 334, 260, 334, 584};
+
+bool isZeroWidth(char32_t codePoint) {
+  return codePoint < 0x20 || (codePoint >= 0x7F && codePoint < 0xA0) ||
+      (codePoint >= 0x0300 && codePoint <= 0x036F) ||
+      (codePoint >= 0x1AB0 && codePoint <= 0x1AFF) ||
+      (codePoint >= 0x1DC0 && codePoint <= 0x1DFF) ||
+      (codePoint >= 0x200B && codePoint <= 0x200F) ||
+      (codePoint >= 0x2028 && codePoint <= 0x202E) ||
+      (codePoint >= 0x2060 && codePoint <= 0x2064) ||
+      (codePoint >= 0x20D0 && codePoint <= 0x20FF) ||
+      (codePoint >= 0xFE00 && codePoint <= 0xFE0F) ||
+      (codePoint >= 0xFE20 && codePoint <= 0xFE2F) || codePoint == 0xFEFF ||
+      (codePoint >= 0x1F3FB && codePoint <= 0x1F3FF) ||
+      (codePoint >= 0xE0000 && codePoint <= 0xE01EF);
+}
+
+// Characters which are East Asian Wide or Fullwidth, and emoji, which take a
+// whole em in practically every font.
+bool isWide(char32_t codePoint) {
+  return (codePoint >= 0x1100 && codePoint <= 0x115F) ||
+      (codePoint >= 0x2E80 && codePoint <= 0x303E) ||
+      (codePoint >= 0x3041 && codePoint <= 0x33FF) ||
+      (codePoint >= 0x3400 && codePoint <= 0x4DBF) ||
+      (codePoint >= 0x4E00 && codePoint <= 0x9FFF) ||
+      (codePoint >= 0xA000 && codePoint <= 0xA4CF) ||
+      (codePoint >= 0xAC00 && codePoint <= 0xD7A3) ||
+      (codePoint >= 0xF900 && codePoint <= 0xFAFF) ||
+      (codePoint >= 0xFE30 && codePoint <= 0xFE4F) ||
+      (codePoint >= 0xFF00 && codePoint <= 0xFF60) ||
+      (codePoint >= 0xFFE0 && codePoint <= 0xFFE6) ||
+      (codePoint >= 0x1F000 && codePoint <= 0x1FAFF) ||
+      (codePoint >= 0x20000 && codePoint <= 0x3FFFD);
+}
+
+/*
+ * Bounds-checked reads of the big-endian values of an sfnt font.
+ */
+class FontDataReader {
+ public:
+  explicit FontDataReader(std::span<const uint8_t> data) : data_(data) {}
+
+  std::optional<uint32_t> readUInt(size_t offset, size_t size) const {
+    if (offset > data_.size() || size > data_.size() - offset) {
+      return std::nullopt;
+    }
+    uint32_t value = 0;
+    for (size_t i = 0; i < size; i++) {
+      value = (value << 8) | data_[offset + i];
+    }
+    return value;
+  }
+
+  std::optional<uint16_t> readUInt16(size_t offset) const {
+    auto value = readUInt(offset, 2);
+    return value ? std::optional<uint16_t>(*value) : std::nullopt;
+  }
+
+  std::optional<int16_t> readInt16(size_t offset) const {
+    auto value = readUInt(offset, 2);
+    return value ? std::optional<int16_t>(static_cast<int16_t>(*value))
+                 : std::nullopt;
+  }
+
+  std::optional<uint32_t> readUInt32(size_t offset) const {
+    return readUInt(offset, 4);
+  }
+
+ private:
+  std::span<const uint8_t> data_;
+};
+
+struct FontTable {
+  size_t offset;
+  size_t length;
+};
+
+std::optional<FontTable> findTable(
+    const FontDataReader& reader,
+    size_t fontOffset,
+    std::string_view tag) {
+  auto numTables = reader.readUInt16(fontOffset + 4);
+  if (!numTables) {
+    return std::nullopt;
+  }
+  uint32_t expectedTag = 0;
+  for (char c : tag) {
+    expectedTag = (expectedTag << 8) | static_cast<uint8_t>(c);
+  }
+  for (size_t i = 0; i < *numTables; i++) {
+    size_t record = fontOffset + 12 + i * 16;
+    auto recordTag = reader.readUInt32(record);
+    if (!recordTag) {
+      return std::nullopt;
+    }
+    if (*recordTag == expectedTag) {
+      auto offset = reader.readUInt32(record + 8);
+      auto length = reader.readUInt32(record + 12);
+      if (!offset || !length) {
+        return std::nullopt;
+      }
+      return FontTable{.offset = *offset, .length = *length};
+    }
+  }
+  return std::nullopt;
+}
+
+/*
+ * Calls `callback(codePoint, glyphId)` for every mapping of a format 4 or 12
+ * `cmap` subtable. Returns false if the subtable is malformed.
+ */
+template <typename Callback>
+bool forEachCharacterMapping(
+    const FontDataReader& reader,
+    size_t subtable,
+    Callback&& callback) {
+  auto format = reader.readUInt16(subtable);
+  if (format == 4) {
+    auto segCountX2 = reader.readUInt16(subtable + 6);
+    if (!segCountX2) {
+      return false;
+    }
+    size_t segCount = *segCountX2 / 2;
+    size_t endCodes = subtable + 14;
+    size_t startCodes = endCodes + segCount * 2 + 2;
+    size_t idDeltas = startCodes + segCount * 2;
+    size_t idRangeOffsets = idDeltas + segCount * 2;
+    for (size_t i = 0; i < segCount; i++) {
+      auto endCode = reader.readUInt16(endCodes + i * 2);
+      auto startCode = reader.readUInt16(startCodes + i * 2);
+      auto idDelta = reader.readUInt16(idDeltas + i * 2);
+      auto idRangeOffset = reader.readUInt16(idRangeOffsets + i * 2);
+      if (!endCode || !startCode || !idDelta || !idRangeOffset) {
+        return false;
+      }
+      for (uint32_t c = *startCode; c <= *endCode && c != 0xFFFF; c++) {
+        uint16_t glyphId = 0;
+        if (*idRangeOffset == 0) {
+          glyphId = static_cast<uint16_t>(c + *idDelta);
+        } else {
+          auto glyphIndex = reader.readUInt16(
+              idRangeOffsets + i * 2 + *idRangeOffset +
+              (c - *startCode) * 2);
+          if (!glyphIndex) {
+            return false;
+          }
+          if (*glyphIndex != 0) {
+            glyphId = static_cast<uint16_t>(*glyphIndex + *idDelta);
+          }
+        }
+        callback(static_cast<char32_t>(c), glyphId);
+      }
+    }
+    return true;
+  }
+
+  if (format == 12) {
+    auto numGroups = reader.readUInt32(subtable + 12);
+    if (!numGroups) {
+      return false;
+    }
+    for (size_t i = 0; i < *numGroups; i++) {
+      size_t group = subtable + 16 + i * 12;
+      auto startCharCode = reader.readUInt32(group);
+      auto endCharCode = reader.readUInt32(group + 4);
+      auto startGlyphId = reader.readUInt32(group + 8);
+      if (!startCharCode || !endCharCode || !startGlyphId ||
+          *endCharCode > 0x10FFFF || *startCharCode > *endCharCode) {
+        return false;
+      }
+      for (uint32_t c = *startCharCode; c <= *endCharCode; c++) {
+        callback(
+            static_cast<char32_t>(c),
+            static_cast<uint32_t>(*startGlyphId + (c - *startCharCode)));
+      }
+    }
+    return true;
+  }
+
+  return false;
+}
+
+/*
+ * Finds the best Unicode subtable of a `cmap` table: a full repertoire
+ * (format 12) one if there is one, a BMP (format 4) one otherwise.
+ */
+std::optional<size_t> findCharacterMap(
+    const FontDataReader& reader,
+    const FontTable& cmap) {
+  auto numTables = reader.readUInt16(cmap.offset + 2);
+  if (!numTables) {
+    return std::nullopt;
+  }
+  std::optional<size_t> bmpSubtable;
+  for (size_t i = 0; i < *numTables; i++) {
+    size_t record = cmap.offset + 4 + i * 8;
+    auto platformId = reader.readUInt16(record);
+    auto encodingId = reader.readUInt16(record + 2);
+    auto offset = reader.readUInt32(record + 4);
+    if (!platformId || !encodingId || !offset) {
+      return std::nullopt;
+    }
+    bool isUnicode = *platformId == 0 ||
+        (*platformId == 3 && (*encodingId == 1 || *encodingId == 10));
+    if (!isUnicode) {
+      continue;
+    }
+    size_t subtable = cmap.offset + *offset;
+    auto format = reader.readUInt16(subtable);
+    if (format == 12) {
+      return subtable;
+    }
+    if (format == 4 && !bmpSubtable) {
+      bmpSubtable = subtable;
+    }
+  }
+  return bmpSubtable;
+}
+
+} // namespace
+
+/* static */ FontMetrics::Shared FontMetrics::sansSerif() {
+  static const Shared metrics = [] {
+    auto metrics = std::make_shared<FontMetrics>();
+    metrics->ascender = 0.905f;
+    metrics->descender = 0.212f;
+    metrics->lineGap = 0.033f;
+    metrics->capHeight = 0.716f;
+    metrics->xHeight = 0.519f;
+    for (size_t i = 0; i < kSansSerifAsciiAdvances.size(); i++) {
+      metrics->asciiAdvances_[0x20 + i] =
+          static_cast<Float>(kSansSerifAsciiAdvances[i]) / 1000;
+    }
+    metrics->advances_ = {
+        {0x00A0, 0.278f}, // No-break space
+        {0x2007, 0.556f}, // Figure space
+        {0x2009, 0.2f}, // Thin space
+        {0x2013, 0.556f}, // En dash
+        {0x2014, 1.0f}, // Em dash
+        {0x2018, 0.222f}, // Quotation marks
+        {0x2019, 0.222f},
+        {0x201C, 0.333f},
+        {0x201D, 0.333f},
+        {0x2022, 0.35f}, // Bullet
+        {0x2026, 1.0f}, // Ellipsis
+    };
+    metrics->defaultAdvance_ = 0.556f;
+    return metrics;
+  }();
+  return metrics;
+}
+
+/* static */ FontMetrics::Shared FontMetrics::monospace() {
+  static const Shared metrics = [] {
+    auto metrics = std::make_shared<FontMetrics>();
+    metrics->ascender = 0.833f;
+    metrics->descender = 0.300f;
+    metrics->lineGap = 0;
+    metrics->capHeight = 0.571f;
+    metrics->xHeight = 0.423f;
+    for (size_t i = 0x20; i < 0x7F; i++) {
+      metrics->asciiAdvances_[i] = 0.6f;
+    }
+    metrics->defaultAdvance_ = 0.6f;
+    return metrics;
+  }();
+  return metrics;
+}
+
+/* static */ FontMetrics::Shared FontMetrics::fromData(
+    std::span<const uint8_t> data) {
+  auto reader = FontDataReader(data);
+
+  // TrueType collections start with a list of the fonts they contain
+  size_t fontOffset = 0;
+  if (reader.readUInt32(0) == 0x74746366 /* 'ttcf' */) {
+    auto firstFontOffset = reader.readUInt32(12);
+    if (!firstFontOffset) {
+      return nullptr;
+    }
+    fontOffset = *firstFontOffset;
+  }
+
+  auto head = findTable(reader, fontOffset, "head");
+  auto hhea = findTable(reader, fontOffset, "hhea");
+  auto hmtx = findTable(reader, fontOffset, "hmtx");
+  auto cmap = findTable(reader, fontOffset, "cmap");
+  if (!head || !hhea || !hmtx || !cmap) {
+    return nullptr;
+  }
+
+  auto unitsPerEm = reader.readUInt16(head->offset + 18);
+  auto ascender = reader.readInt16(hhea->offset + 4);
+  auto descender = reader.readInt16(hhea->offset + 6);
+  auto lineGap = reader.readInt16(hhea->offset + 8);
+  auto numberOfHMetrics = reader.readUInt16(hhea->offset + 34);
+  if (!unitsPerEm || *unitsPerEm == 0 || !ascender || !descender ||
+      !lineGap || !numberOfHMetrics || *numberOfHMetrics == 0) {
+    return nullptr;
+  }
+  auto scale = Float{1} / *unitsPerEm;
+
+  std::vector<Float> glyphAdvances;
+  glyphAdvances.reserve(*numberOfHMetrics);
+  for (size_t i = 0; i < *numberOfHMetrics; i++) {
+    auto advanceWidth = reader.readUInt16(hmtx->offset + i * 4);
+    if (!advanceWidth) {
+      return nullptr;
+    }
+    glyphAdvances.push_back(*advanceWidth * scale);
+  }
+
+  auto metrics = std::make_shared<FontMetrics>();
+  metrics->ascender = *ascender * scale;
+  metrics->descender = -*descender * scale;
+  metrics->lineGap = *lineGap * scale;
+  // The notdef glyph is what the font would render for missing characters
+  metrics->defaultAdvance_ = glyphAdvances[0];
+
+  // Cap and x-height are only known from version 2 of the OS/2 table on
+  if (auto os2 = findTable(reader, fontOffset, "OS/2")) {
+    auto version = reader.readUInt16(os2->offset);
+    auto xHeight = reader.readInt16(os2->offset + 86);
+    auto capHeight = reader.readInt16(os2->offset + 88);
+    if (version && *version >= 2 && xHeight && capHeight) {
+      metrics->xHeight = *xHeight * scale;
+      metrics->capHeight = *capHeight * scale;
+    }
+  }
+  if (metrics->capHeight == 0) {
+    metrics->capHeight = metrics->ascender * 0.75f;
+    metrics->xHeight = metrics->ascender * 0.55f;
+  }
+
+  for (char32_t c = 0x20; c < 0x7F; c++) {
+    metrics->asciiAdvances_[c] = metrics->defaultAdvance_;
+  }
+
+  auto characterMap = findCharacterMap(reader, *cmap);
+  if (!characterMap) {
+    return nullptr;
+  }
+  auto hasCharacterMap = forEachCharacterMapping(
+      reader, *characterMap, [&](char32_t codePoint, uint32_t glyphId) {
+        if (glyphId == 0) {
+          return;
+        }
+        // Glyphs past the last horizontal metric share its advance
+        Float advance = glyphAdvances[std::min<size_t>(
+            glyphId, glyphAdvances.size() - 1)];
+        if (codePoint < metrics->asciiAdvances_.size()) {
+          metrics->asciiAdvances_[codePoint] = advance;
+        } else {
+          metrics->advances_.emplace(codePoint, advance);
+        }
+      });
+  if (!hasCharacterMap) {
+    return nullptr;
+  }
+
+  return metrics;
+}
+
+/* static */ FontMetrics::Shared FontMetrics::fromFile(
+    const std::string& path) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return nullptr;
+  }
+  std::vector<uint8_t> data(
+      (std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  return fromData(data);
+}
+
+Float FontMetrics::getFallbackAdvance(char32_t codePoint) const {
+  if (isZeroWidth(codePoint)) {
+    return 0;
+  }
+  if (isWide(codePoint)) {
+    return 1;
+  }
+  return defaultAdvance_;
+}
+
+} // namespace facebook::react
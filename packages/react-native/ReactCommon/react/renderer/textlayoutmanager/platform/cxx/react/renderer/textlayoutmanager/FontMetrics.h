@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/graphics/Float.h>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <unordered_map>
+
+namespace facebook::react {
+
+/*
+ * Horizontal and vertical metrics of a single font face, which is all the
+ * portable text layout engine needs to lay out text with it. All values are
+ * relative to the em square, and have to be multiplied by the font size.
+ */
+class FontMetrics final {
+ public:
+  using Shared = std::shared_ptr<const FontMetrics>;
+
+  /*
+   * Built-in metrics of a sans-serif face, compatible with Helvetica, Arial
+   * and Liberation Sans.
+   */
+  static Shared sansSerif();
+
+  /*
+   * Built-in metrics of a monospace face, compatible with Courier.
+   */
+  static Shared monospace();
+
+  /*
+   * Reads the metrics of a TrueType or OpenType font (or of the first font
+   * of a collection) from its `head`, `hhea`, `OS/2`, `hmtx` and `cmap`
+   * tables.
+   * Returns nullptr if the data is not a font which can be read.
+   */
+  static Shared fromData(std::span<const uint8_t> data);
+
+  /*
+   * Same as above, reading the font from a local file.
+   */
+  static Shared fromFile(const std::string& path);
+
+  /*
+   * Distance from the baseline to the top of the line box.
+   */
+  Float ascender{};
+
+  /*
+   * Distance from the baseline to the bottom of the line box (positive).
+   */
+  Float descender{};
+
+  /*
+   * Additional space to leave between lines.
+   */
+  Float lineGap{};
+
+  Float capHeight{};
+  Float xHeight{};
+
+  /*
+   * Returns the horizontal advance of `codePoint`. Code points which the font
+   * does not cover get an estimate based on their East Asian width.
+   */
+  Float getAdvance(char32_t codePoint) const {
+    if (codePoint < asciiAdvances_.size()) {
+      return asciiAdvances_[codePoint];
+    }
+    auto iterator = advances_.find(codePoint);
+    if (iterator != advances_.end()) {
+      return iterator->second;
+    }
+    return getFallbackAdvance(codePoint);
+  }
+
+ private:
+  Float getFallbackAdvance(char32_t codePoint) const;
+
+  std::array<Float, 128> asciiAdvances_{};
+
+  // Advances of covered code points outside of ASCII
+  std::unordered_map<char32_t, Float> advances_;
+
+  // Advance of characters of normal width which the font doesn't cover
+  Float defaultAdvance_{};
+};
+
+} // namespace facebook::react
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "FontRegistry.h"
+
+#include <cstdlib>
+#include <mutex>
+#include <string_view>
+
+namespace facebook::react {
+
+namespace {
+
+// Faces which are synthesized as bold are about this much wider
+constexpr Float kSyntheticBoldAdvanceScale = 1.07f;
+
+bool isMonospaceFontFamily(std::string_view fontFamily) {
+  return fontFamily == "monospace" || fontFamily == "Courier" ||
+      fontFamily == "Courier New" || fontFamily == "Menlo" ||
+      fontFamily == "Monaco" || fontFamily == "Consolas" ||
+      fontFamily == "RobotoMono";
+}
+
+Float getAdvanceScale(FontWeight faceWeight, FontWeight fontWeight) {
+  bool isBold = static_cast<int>(fontWeight) >= 600;
+  bool isFaceBold = static_cast<int>(faceWeight) >= 600;
+  return isBold && !isFaceBold ? kSyntheticBoldAdvanceScale : 1;
+}
+
+} // namespace
+
+void FontRegistry::registerFont(
+    const std::string& fontFamily,
+    FontMetrics::Shared metrics,
+    FontWeight fontWeight,
+    FontStyle fontStyle) {
+  std::unique_lock lock(mutex_);
+  faces_[fontFamily].push_back(
+      Face{.metrics = std::move(metrics),
+           .fontWeight = fontWeight,
+           .fontStyle = fontStyle});
+}
+
+bool FontRegistry::registerFontFile(
+    const std::string& fontFamily,
+    const std::string& path,
+    FontWeight fontWeight,
+    FontStyle fontStyle) {
+  auto metrics = FontMetrics::fromFile(path);
+  if (!metrics) {
+    return false;
+  }
+  registerFont(fontFamily, std::move(metrics), fontWeight, fontStyle);
+  return true;
+}
+
+ResolvedFont FontRegistry::resolveFont(
+    const TextAttributes& textAttributes) const {
+  auto fontWeight = textAttributes.fontWeight.value_or(FontWeight::Regular);
+  auto fontStyle = textAttributes.fontStyle.value_or(FontStyle::Normal);
+
+  {
+    std::shared_lock lock(mutex_);
+    auto iterator = faces_.find(textAttributes.fontFamily);
+    if (iterator != faces_.end() && !iterator->second.empty()) {
+      // Prefer the face with the requested style, then the closest weight
+      const Face* bestFace = nullptr;
+      int bestDistance = 0;
+      for (const auto& face : iterator->second) {
+        int distance = std::abs(
+            static_cast<int>(face.fontWeight) - static_cast<int>(fontWeight));
+        if (face.fontStyle != fontStyle) {
+          distance += 1000;
+        }
+        if (bestFace == nullptr || distance < bestDistance) {
+          bestFace = &face;
+          bestDistance = distance;
+        }
+      }
+      return ResolvedFont{
+          .metrics = bestFace->metrics,
+          .advanceScale = getAdvanceScale(bestFace->fontWeight, fontWeight)};
+    }
+  }
+
+  return ResolvedFont{
+      .metrics = isMonospaceFontFamily(textAttributes.fontFamily)
+          ? FontMetrics::monospace()
+          : FontMetrics::sansSerif(),
+      .advanceScale = getAdvanceScale(FontWeight::Regular, fontWeight)};
+}
+
+} // namespace facebook::react
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/attributedstring/TextAttributes.h>
+#include <react/renderer/textlayoutmanager/FontMetrics.h>
+
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * A font face resolved for some text attributes.
+ */
+struct ResolvedFont {
+  FontMetrics::Shared metrics;
+
+  /*
+   * Scale applied to advances, to account for a heavier weight than the one
+   * of the face (synthetic bold).
+   */
+  Float advanceScale{1};
+};
+
+/*
+ * Keeps the fonts which text can be laid out with on the cxx platform, by
+ * family, weight and style. Text in families which were not registered is
+ * laid out with built-in metrics (sans-serif, or monospace for well-known
+ * monospace families).
+ *
+ * To use it, register fonts before the first layout and store the registry
+ * in the ContextContainer passed to the TextLayoutManager, under
+ * `FontRegistry::ContextContainerKey`.
+ */
+class FontRegistry final {
+ public:
+  using Shared = std::shared_ptr<const FontRegistry>;
+
+  static constexpr const char* ContextContainerKey = "FontRegistry";
+
+  void registerFont(
+      const std::string& fontFamily,
+      FontMetrics::Shared metrics,
+      FontWeight fontWeight = FontWeight::Regular,
+      FontStyle fontStyle = FontStyle::Normal);
+
+  /*
+   * Registers the font stored in a local TrueType or OpenType file. Returns
+   * false if the file could not be read.
+   */
+  bool registerFontFile(
+      const std::string& fontFamily,
+      const std::string& path,
+      FontWeight fontWeight = FontWeight::Regular,
+      FontStyle fontStyle = FontStyle::Normal);
+
+  /*
+   * Resolves the face closest to `textAttributes` in their family.
+   */
+  ResolvedFont resolveFont(const TextAttributes& textAttributes) const;
+
+ private:
+  struct Face {
+    FontMetrics::Shared metrics;
+    FontWeight fontWeight;
+    FontStyle fontStyle;
+  };
+
+  mutable std::shared_mutex mutex_;
+  std::unordered_map<std::string, std::vector<Face>> faces_;
+};
+
+} // namespace facebook::react
@@ -0,0 +1,330 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "LineBreaker.h"
+
+#include <algorithm>
+#include <array>
+
+namespace facebook::react {
+
+namespace {
+
+/*
+ * The UAX #14 line breaking classes the breaker distinguishes. Classes with
+ * the same behavior for our subset of rules are folded together: EX, IS, SY,
+ * NS and closing quotes into CL, opening quotes into OP, WJ into GL, H2, H3,
+ * JL and CB into ID, EM into CM, and everything else into AL.
+ */
+enum class LineBreakClass : uint8_t {
+  AL, // Alphabetic, and the default
+  BK, // Mandatory break
+  CR, // Carriage return
+  LF, // Line feed
+  SP, // Space
+  ZW, // Zero width space
+  ZWJ, // Zero width joiner
+  GL, // Non-breaking ("glue")
+  BA, // Break after
+  HY, // Hyphen
+  B2, // Break before and after
+  OP, // Opening punctuation
+  CL, // Closing punctuation, and anything which cannot start a line
+  NU, // Numeric
+  ID, // Ideographic, and emoji
+  CM, // Combining mark
+};
+
+// Small kana and other characters which cannot start a line in CJK text
+constexpr std::array<char32_t, 26> kNonStarters = {
+    0x3005, 0x3041, 0x3043, 0x3045, 0x3047, 0x3049, 0x3063, 0x3083, 0x3085,
+    0x3087, 0x308E, 0x3095, 0x3096, 0x30A1, 0x30A3, 0x30A5, 0x30A7, 0x30A9,
+    0x30C3, 0x30E3, 0x30E5, 0x30E7, 0x30EE, 0x30F5, 0x30F6, 0x30FC};
+
+LineBreakClass getAsciiLineBreakClass(char32_t codePoint) {
+  switch (codePoint) {
+    case '\n':
+      return LineBreakClass::LF;
+    case '\r':
+      return LineBreakClass::CR;
+    case 0x0B:
+    case 0x0C:
+      return LineBreakClass::BK;
+    case '\t':
+      return LineBreakClass::BA;
+    case ' ':
+      return LineBreakClass::SP;
+    case '-':
+      return LineBreakClass::HY;
+    case '(':
+    case '[':
+    case '{':
+      return LineBreakClass::OP;
+    case ')':
+    case ']':
+    case '}':
+    case '!':
+    case '?':
+    case ',':
+    case '.':
+    case ':':
+    case ';':
+    case '/':
+      return LineBreakClass::CL;
+    default:
+      break;
+  }
+  if (codePoint >= '0' && codePoint <= '9') {
+    return LineBreakClass::NU;
+  }
+  if (codePoint < 0x20 || codePoint == 0x7F) {
+    return LineBreakClass::CM;
+  }
+  return LineBreakClass::AL;
+}
+
+LineBreakClass getLineBreakClass(char32_t codePoint) {
+  if (codePoint < 0x80) {
+    return getAsciiLineBreakClass(codePoint);
+  }
+
+  switch (codePoint) {
+    case 0x0085:
+    case 0x2028:
+    case 0x2029:
+      return LineBreakClass::BK;
+    case 0x200B:
+      return LineBreakClass::ZW;
+    case 0x200D:
+      return LineBreakClass::ZWJ;
+    case 0x00A0:
+    case 0x0F0C:
+    case 0x2007:
+    case 0x2011:
+    case 0x202F:
+    case 0x2060:
+    case 0xFEFF:
+      return LineBreakClass::GL;
+    case 0x00AD:
+    case 0x058A:
+    case 0x1680:
+    case 0x2010:
+    case 0x2012:
+    case 0x2013:
+    case 0x205F:
+    case 0x3000:
+      return LineBreakClass::BA;
+    case 0x2014:
+      return LineBreakClass::B2;
+    case 0x00A1:
+    case 0x00BF:
+    case 0x2018:
+    case 0x201C:
+    case 0x3008:
+    case 0x300A:
+    case 0x300C:
+    case 0x300E:
+    case 0x3010:
+    case 0x3014:
+    case 0x3016:
+    case 0x3018:
+    case 0x301A:
+    case 0x301D:
+    case 0xFF08:
+    case 0xFF3B:
+    case 0xFF5B:
+    case 0xFF5F:
+    case 0xFF62:
+      return LineBreakClass::OP;
+    case 0x2019:
+    case 0x201D:
+    case 0x2026:
+    case 0x3001:
+    case 0x3002:
+    case 0x3009:
+    case 0x300B:
+    case 0x300D:
+    case 0x300F:
+    case 0x3011:
+    case 0x3015:
+    case 0x3017:
+    case 0x3019:
+    case 0x301B:
+    case 0x301E:
+    case 0x301F:
+    case 0x30FB:
+    case 0xFF01:
+    case 0xFF09:
+    case 0xFF0C:
+    case 0xFF0E:
+    case 0xFF1A:
+    case 0xFF1B:
+    case 0xFF1F:
+    case 0xFF3D:
+    case 0xFF5D:
+    case 0xFF60:
+    case 0xFF61:
+    case 0xFF63:
+    case 0xFF64:
+      return LineBreakClass::CL;
+    default:
+      break;
+  }
+
+  if (codePoint < 0xA0 || (codePoint >= 0x0300 && codePoint <= 0x036F) ||
+      (codePoint >= 0x0483 && codePoint <= 0x0489) ||
+      (codePoint >= 0x0591 && codePoint <= 0x05BD) ||
+      (codePoint >= 0x0610 && codePoint <= 0x061A) ||
+      (codePoint >= 0x064B && codePoint <= 0x065F) ||
+      (codePoint >= 0x0900 && codePoint <= 0x0903) ||
+      (codePoint >= 0x093A && codePoint <= 0x094F) ||
+      (codePoint >= 0x1AB0 && codePoint <= 0x1AFF) ||
+      (codePoint >= 0x1DC0 && codePoint <= 0x1DFF) || codePoint == 0x200C ||
+      (codePoint >= 0x20D0 && codePoint <= 0x20FF) ||
+      (codePoint >= 0xFE00 && codePoint <= 0xFE0F) ||
+      (codePoint >= 0xFE20 && codePoint <= 0xFE2F) ||
+      (codePoint >= 0x1F3FB && codePoint <= 0x1F3FF) ||
+      (codePoint >= 0xE0020 && codePoint <= 0xE007F) ||
+      (codePoint >= 0xE0100 && codePoint <= 0xE01EF)) {
+    return LineBreakClass::CM;
+  }
+
+  if ((codePoint >= 0x2000 && codePoint <= 0x2006) ||
+      (codePoint >= 0x2008 && codePoint <= 0x200A)) {
+    return LineBreakClass::BA;
+  }
+
+  if (codePoint >= 0x3005 && codePoint <= 0x30FC &&
+      std::binary_search(kNonStarters.begin(), kNonStarters.end(), codePoint)) {
+    return LineBreakClass::CL;
+  }
+
+  if ((codePoint >= 0x1100 && codePoint <= 0x115F) ||
+      (codePoint >= 0x2E80 && codePoint <= 0x2FFF) ||
+      (codePoint >= 0x3003 && codePoint <= 0x4DBF) ||
+      (codePoint >= 0x4E00 && codePoint <= 0x9FFF) ||
+      (codePoint >= 0xA000 && codePoint <= 0xA4CF) ||
+      (codePoint >= 0xAC00 && codePoint <= 0xD7A3) ||
+      (codePoint >= 0xF900 && codePoint <= 0xFAFF) ||
+      (codePoint >= 0xFE30 && codePoint <= 0xFE4F) ||
+      (codePoint >= 0xFF00 && codePoint <= 0xFFEF) || codePoint == 0xFFFC ||
+      (codePoint >= 0x1F000 && codePoint <= 0x1FAFF) ||
+      (codePoint >= 0x20000 && codePoint <= 0x3FFFD)) {
+    return LineBreakClass::ID;
+  }
+
+  return LineBreakClass::AL;
+}
+
+bool isHardBreak(LineBreakClass lineBreakClass) {
+  return lineBreakClass == LineBreakClass::BK ||
+      lineBreakClass == LineBreakClass::CR ||
+      lineBreakClass == LineBreakClass::LF;
+}
+
+bool isCombining(LineBreakClass lineBreakClass) {
+  return lineBreakClass == LineBreakClass::CM ||
+      lineBreakClass == LineBreakClass::ZWJ;
+}
+
+} // namespace
+
+void findLineBreakOpportunities(
+    std::span<const char32_t> codePoints,
+    std::vector<LineBreakOpportunity>& opportunities) {
+  opportunities.resize(codePoints.size());
+  if (codePoints.empty()) {
+    return;
+  }
+  opportunities[0] = LineBreakOpportunity::Prohibited;
+
+  // The class of the previous code point, after combining marks were
+  // attached to their base (LB9) or treated as alphabetic (LB10).
+  auto previous = getLineBreakClass(codePoints[0]);
+  // The class of the previous code point, as is
+  auto previousRaw = previous;
+  if (isCombining(previous)) {
+    previous = LineBreakClass::AL;
+  }
+  // The class of the last code point which was not a space
+  auto beforeSpaces = previous;
+
+  for (size_t i = 1; i < codePoints.size(); i++) {
+    auto current = getLineBreakClass(codePoints[i]);
+    auto& opportunity = opportunities[i];
+
+    if (previous == LineBreakClass::CR && current == LineBreakClass::LF) {
+      // LB5: CR × LF
+      opportunity = LineBreakOpportunity::WithinCluster;
+    } else if (isHardBreak(previous)) {
+      // LB4, LB5: BK !, CR !, LF !
+      opportunity = LineBreakOpportunity::Mandatory;
+    } else if (
+        isHardBreak(current) || current == LineBreakClass::SP ||
+        current == LineBreakClass::ZW) {
+      // LB6, LB7: × BK, × SP, × ZW
+      opportunity = LineBreakOpportunity::Prohibited;
+    } else if (beforeSpaces == LineBreakClass::ZW) {
+      // LB8: ZW SP* ÷
+      opportunity = LineBreakOpportunity::Allowed;
+    } else if (previousRaw == LineBreakClass::ZWJ) {
+      // LB8a: ZWJ ×
+      opportunity = LineBreakOpportunity::WithinCluster;
+    } else if (isCombining(current) && previous != LineBreakClass::SP) {
+      // LB9: X CM* → X
+      opportunity = LineBreakOpportunity::WithinCluster;
+      previousRaw = current;
+      continue;
+    } else if (
+        previous == LineBreakClass::GL ||
+        (current == LineBreakClass::GL && previous != LineBreakClass::SP &&
+         previous != LineBreakClass::BA && previous != LineBreakClass::HY)) {
+      // LB12, LB12a: GL ×, [^SP BA HY] × GL
+      opportunity = LineBreakOpportunity::Prohibited;
+    } else if (current == LineBreakClass::CL) {
+      // LB13: × CL, × EX, × IS, × SY
+      opportunity = LineBreakOpportunity::Prohibited;
+    } else if (beforeSpaces == LineBreakClass::OP) {
+      // LB14: OP SP* ×
+      opportunity = LineBreakOpportunity::Prohibited;
+    } else if (
+        beforeSpaces == LineBreakClass::B2 && current == LineBreakClass::B2) {
+      // LB17: B2 SP* × B2
+      opportunity = LineBreakOpportunity::Prohibited;
+    } else if (previous == LineBreakClass::SP) {
+      // LB18: SP ÷
+      opportunity = LineBreakOpportunity::Allowed;
+    } else if (
+        current == LineBreakClass::BA || current == LineBreakClass::HY) {
+      // LB21: × BA, × HY
+      opportunity = LineBreakOpportunity::Prohibited;
+    } else if (
+        previous == LineBreakClass::HY && current == LineBreakClass::NU) {
+      // LB25: HY × NU (e.g. negative numbers)
+      opportunity = LineBreakOpportunity::Prohibited;
+    } else if (
+        previous == LineBreakClass::BA || previous == LineBreakClass::HY ||
+        previous == LineBreakClass::B2 || current == LineBreakClass::B2 ||
+        previous == LineBreakClass::ID || current == LineBreakClass::ID) {
+      // LB31: break everywhere else, which in our subset means after
+      // hyphens, around dashes and between ideographs
+      opportunity = LineBreakOpportunity::Allowed;
+    } else {
+      // LB23 to LB30: no breaks within words and numbers, or between them
+      // and adjacent punctuation
+      opportunity = LineBreakOpportunity::Prohibited;
+    }
+
+    previousRaw = current;
+    previous = isCombining(current) ? LineBreakClass::AL : current;
+    if (current != LineBreakClass::SP) {
+      beforeSpaces = previous;
+    }
+  }
+}
+
+} // namespace facebook::react
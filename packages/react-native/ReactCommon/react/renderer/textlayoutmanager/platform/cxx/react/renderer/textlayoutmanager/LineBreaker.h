@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Whether a line can be broken before a code point.
+ */
+enum class LineBreakOpportunity : uint8_t {
+  // The line must be broken (after a hard line break).
+  Mandatory,
+  // The line can be broken.
+  Allowed,
+  // The line cannot be broken, unless a word is too wide to fit on a line.
+  Prohibited,
+  // Within a character (e.g. before a combining mark); never broken.
+  WithinCluster,
+};
+
+/*
+ * Finds line break opportunities following the Unicode Line Breaking
+ * Algorithm (UAX #14), restricted to the line breaking classes and rules
+ * which matter for common text: hard breaks, spaces, hyphens and dashes,
+ * opening and closing punctuation, numbers, non-breaking characters,
+ * combining marks, and ideographic and emoji characters which can be broken
+ * between. Complex-context scripts (e.g. Thai) are not broken within words.
+ *
+ * `opportunities[i]` describes the position before `codePoints[i]`; the one
+ * before the first code point is always Prohibited.
+ */
+void findLineBreakOpportunities(
+    std::span<const char32_t> codePoints,
+    std::vector<LineBreakOpportunity>& opportunities);
+
+} // namespace facebook::react
@@ -0,0 +1,519 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "TextLayout.h"
+
+#include <react/renderer/textlayoutmanager/LineBreaker.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr Float kDefaultFontSize = 14;
+
+constexpr char32_t kReplacementCharacter = 0xFFFD;
+constexpr char32_t kObjectReplacementCharacter = 0xFFFC;
+constexpr char32_t kEllipsis = 0x2026;
+
+/*
+ * A fragment of the attributed string, with its font resolved.
+ */
+struct Run {
+  const FontMetrics* metrics;
+  Float fontSize;
+  // Font size times the advance scale of the resolved font
+  Float advanceScale;
+  Float lineHeight;
+  bool isAttachment;
+  Size attachmentSize;
+};
+
+struct Glyph {
+  Float advance;
+  // Offset of the code point in the UTF-8 string of the attributed string
+  uint32_t textOffset;
+  uint32_t runIndex;
+  bool isHangingSpace;
+};
+
+struct LineRange {
+  size_t start;
+  size_t end;
+  Float width;
+};
+
+/*
+ * Scratch buffers, reused by all layouts on a thread to save allocations.
+ */
+struct LayoutBuffers {
+  std::vector<Run> runs;
+  std::vector<Glyph> glyphs;
+  std::vector<char32_t> codePoints;
+  std::vector<LineBreakOpportunity> opportunities;
+  std::vector<LineRange> lineRanges;
+
+  void clear() {
+    runs.clear();
+    glyphs.clear();
+    codePoints.clear();
+    opportunities.clear();
+    lineRanges.clear();
+  }
+};
+
+LayoutBuffers& getLayoutBuffers() {
+  thread_local LayoutBuffers buffers;
+  buffers.clear();
+  return buffers;
+}
+
+/*
+ * Decodes the code point at `offset` and moves `offset` past it. Invalid
+ * sequences decode to U+FFFD, one byte at a time.
+ */
+char32_t decodeUtf8(const std::string& string, size_t& offset) {
+  auto byte = static_cast<uint8_t>(string[offset++]);
+  if (byte < 0x80) {
+    return byte;
+  }
+
+  size_t length = 0;
+  char32_t codePoint = 0;
+  if ((byte & 0xE0) == 0xC0) {
+    length = 1;
+    codePoint = byte & 0x1F;
+  } else if ((byte & 0xF0) == 0xE0) {
+    length = 2;
+    codePoint = byte & 0x0F;
+  } else if ((byte & 0xF8) == 0xF0) {
+    length = 3;
+    codePoint = byte & 0x07;
+  } else {
+    return kReplacementCharacter;
+  }
+
+  if (string.size() - offset < length) {
+    return kReplacementCharacter;
+  }
+  for (size_t i = 0; i < length; i++) {
+    auto continuation = static_cast<uint8_t>(string[offset + i]);
+    if ((continuation & 0xC0) != 0x80) {
+      return kReplacementCharacter;
+    }
+    codePoint = (codePoint << 6) | (continuation & 0x3F);
+  }
+  offset += length;
+  return codePoint;
+}
+
+bool isHangingSpace(char32_t codePoint) {
+  return codePoint == ' ' || codePoint == '\t' || codePoint == 0x1680 ||
+      (codePoint >= 0x2000 && codePoint <= 0x200A && codePoint != 0x2007) ||
+      codePoint == 0x205F || codePoint == 0x3000 || codePoint == '\n' ||
+      codePoint == '\r' || codePoint == 0x0B || codePoint == 0x0C ||
+      codePoint == 0x85 || codePoint == 0x2028 || codePoint == 0x2029;
+}
+
+bool isLineTerminator(char32_t codePoint) {
+  return codePoint == '\n' || codePoint == '\r' || codePoint == 0x0B ||
+      codePoint == 0x0C || codePoint == 0x85 || codePoint == 0x2028 ||
+      codePoint == 0x2029;
+}
+
+bool isAsciiLetter(char32_t codePoint) {
+  return (codePoint >= 'a' && codePoint <= 'z') ||
+      (codePoint >= 'A' && codePoint <= 'Z');
+}
+
+/*
+ * Applies a text transform to `codePoint`, for ASCII letters only.
+ */
+char32_t transformCodePoint(
+    char32_t codePoint,
+    TextTransform textTransform,
+    bool isStartOfWord) {
+  bool isLower = codePoint >= 'a' && codePoint <= 'z';
+  bool isUpper = codePoint >= 'A' && codePoint <= 'Z';
+  switch (textTransform) {
+    case TextTransform::Uppercase:
+      return isLower ? codePoint - 'a' + 'A' : codePoint;
+    case TextTransform::Lowercase:
+      return isUpper ? codePoint - 'A' + 'a' : codePoint;
+    case TextTransform::Capitalize:
+      return isLower && isStartOfWord ? codePoint - 'a' + 'A' : codePoint;
+    default:
+      return codePoint;
+  }
+}
+
+Run createRun(
+    const AttributedString::Fragment& fragment,
+    const FontRegistry& fontRegistry) {
+  const auto& textAttributes = fragment.textAttributes;
+
+  Float multiplier = 1;
+  if (textAttributes.allowFontScaling.value_or(true) &&
+      !std::isnan(textAttributes.fontSizeMultiplier)) {
+    multiplier = textAttributes.fontSizeMultiplier;
+    if (!std::isnan(textAttributes.maxFontSizeMultiplier) &&
+        textAttributes.maxFontSizeMultiplier >= 1) {
+      multiplier =
+          std::min(multiplier, textAttributes.maxFontSizeMultiplier);
+    }
+  }
+  Float fontSize = std::isnan(textAttributes.fontSize)
+      ? kDefaultFontSize
+      : textAttributes.fontSize;
+
+  auto font = fontRegistry.resolveFont(textAttributes);
+  return Run{
+      .metrics = font.metrics.get(),
+      .fontSize = fontSize * multiplier,
+      .advanceScale = fontSize * multiplier * font.advanceScale,
+      .lineHeight = textAttributes.lineHeight * multiplier,
+      .isAttachment = fragment.isAttachment(),
+      .attachmentSize = fragment.parentShadowView.layoutMetrics.frame.size};
+}
+
+/*
+ * Breaks glyphs into lines no wider than `maximumWidth`.
+ */
+void breakLines(
+    const std::vector<Glyph>& glyphs,
+    const std::vector<LineBreakOpportunity>& opportunities,
+    Float maximumWidth,
+    std::vector<LineRange>& lineRanges) {
+  size_t start = 0;
+  while (start < glyphs.size()) {
+    Float width = 0;
+    // Width of the line without its trailing spaces
+    Float contentWidth = 0;
+    size_t breakIndex = start;
+    Float breakWidth = 0;
+    auto line = LineRange{.start = start, .end = glyphs.size(), .width = 0};
+
+    size_t i = start;
+    for (; i < glyphs.size(); i++) {
+      auto opportunity = opportunities[i];
+      if (i > start) {
+        if (opportunity == LineBreakOpportunity::Mandatory) {
+          break;
+        }
+        if (opportunity == LineBreakOpportunity::Allowed) {
+          breakIndex = i;
+          breakWidth = contentWidth;
+        }
+      }
+
+      const auto& glyph = glyphs[i];
+      if (glyph.isHangingSpace) {
+        width += glyph.advance;
+        continue;
+      }
+      if (i > start && width + glyph.advance > maximumWidth) {
+        break;
+      }
+      width += glyph.advance;
+      contentWidth = width;
+    }
+
+    if (i == glyphs.size() ||
+        opportunities[i] == LineBreakOpportunity::Mandatory) {
+      line.end = i;
+      line.width = contentWidth;
+    } else if (breakIndex > start) {
+      line.end = breakIndex;
+      line.width = breakWidth;
+    } else {
+      // A word which is wider than a line is broken between characters
+      line.end = i;
+      while (line.end > start + 1 &&
+             opportunities[line.end] == LineBreakOpportunity::WithinCluster) {
+        line.end--;
+      }
+      line.width = 0;
+      for (size_t j = start; j < line.end; j++) {
+        line.width += glyphs[j].advance;
+      }
+    }
+
+    lineRanges.push_back(line);
+    start = line.end;
+  }
+}
+
+/*
+ * Shortens the last line of a paragraph which has more lines than it can
+ * show so that the rest of the text, replaced by an ellipsis, fits in it.
+ */
+void ellipsizeLine(
+    LineRange& line,
+    const std::vector<Glyph>& glyphs,
+    const std::vector<LineBreakOpportunity>& opportunities,
+    const std::vector<Run>& runs,
+    Float maximumWidth) {
+  const auto& run =
+      runs[glyphs[line.end > line.start ? line.end - 1 : line.start].runIndex];
+  Float ellipsisWidth =
+      run.metrics->getAdvance(kEllipsis) * run.advanceScale;
+  Float availableWidth = maximumWidth - ellipsisWidth;
+
+  Float width = 0;
+  Float contentWidth = 0;
+  size_t i = line.start;
+  for (; i < glyphs.size(); i++) {
+    if (i > line.start &&
+        opportunities[i] == LineBreakOpportunity::Mandatory) {
+      break;
+    }
+    const auto& glyph = glyphs[i];
+    if (width + glyph.advance > availableWidth) {
+      break;
+    }
+    width += glyph.advance;
+    if (!glyph.isHangingSpace) {
+      contentWidth = width;
+    }
+  }
+  while (i > line.start + 1 &&
+         i < opportunities.size() &&
+         opportunities[i] == LineBreakOpportunity::WithinCluster) {
+    i--;
+    contentWidth -= glyphs[i].advance;
+  }
+
+  line.end = i;
+  line.width = std::min(contentWidth + ellipsisWidth, maximumWidth);
+}
+
+TextAlignment getTextAlignment(const AttributedString& attributedString) {
+  const auto& fragments = attributedString.getFragments();
+  const auto& textAttributes = fragments.empty()
+      ? attributedString.getBaseTextAttributes()
+      : fragments.front().textAttributes;
+
+  auto alignment = textAttributes.alignment.value_or(TextAlignment::Natural);
+  if (alignment == TextAlignment::Natural) {
+    return textAttributes.baseWritingDirection ==
+            WritingDirection::RightToLeft
+        ? TextAlignment::Right
+        : TextAlignment::Left;
+  }
+  return alignment;
+}
+
+} // namespace
+
+TextLayout layoutText(
+    const AttributedString& attributedString,
+    const ParagraphAttributes& paragraphAttributes,
+    Float maximumWidth,
+    const FontRegistry& fontRegistry) {
+  auto& buffers = getLayoutBuffers();
+  auto& runs = buffers.runs;
+  auto& glyphs = buffers.glyphs;
+  auto& codePoints = buffers.codePoints;
+
+  // Shape: one glyph per code point
+  size_t textOffset = 0;
+  for (const auto& fragment : attributedString.getFragments()) {
+    auto runIndex = static_cast<uint32_t>(runs.size());
+    const auto& run = runs.emplace_back(createRun(fragment, fontRegistry));
+
+    if (run.isAttachment) {
+      glyphs.push_back(Glyph{
+          .advance = run.attachmentSize.width,
+          .textOffset = static_cast<uint32_t>(textOffset),
+          .runIndex = runIndex,
+          .isHangingSpace = false});
+      codePoints.push_back(kObjectReplacementCharacter);
+      textOffset += fragment.string.size();
+      continue;
+    }
+
+    auto textTransform =
+        fragment.textAttributes.textTransform.value_or(TextTransform::None);
+    Float letterSpacing = std::isnan(fragment.textAttributes.letterSpacing)
+        ? 0
+        : fragment.textAttributes.letterSpacing;
+    bool isStartOfWord = true;
+    const auto& string = fragment.string;
+    for (size_t offset = 0; offset < string.size();) {
+      size_t codePointOffset = offset;
+      char32_t codePoint = decodeUtf8(string, offset);
+      char32_t displayedCodePoint =
+          transformCodePoint(codePoint, textTransform, isStartOfWord);
+      isStartOfWord = !isAsciiLetter(codePoint);
+
+      Float advance =
+          run.metrics->getAdvance(displayedCodePoint) * run.advanceScale;
+      if (advance > 0) {
+        advance += letterSpacing;
+      }
+      glyphs.push_back(Glyph{
+          .advance = advance,
+          .textOffset = static_cast<uint32_t>(textOffset + codePointOffset),
+          .runIndex = runIndex,
+          .isHangingSpace = isHangingSpace(codePoint)});
+      codePoints.push_back(codePoint);
+    }
+    textOffset += string.size();
+  }
+
+  TextLayout layout;
+  if (glyphs.empty()) {
+    return layout;
+  }
+
+  findLineBreakOpportunities(codePoints, buffers.opportunities);
+
+  auto& lineRanges = buffers.lineRanges;
+  breakLines(glyphs, buffers.opportunities, maximumWidth, lineRanges);
+  if (isLineTerminator(codePoints.back())) {
+    // A trailing line break starts an empty line
+    lineRanges.push_back(
+        LineRange{.start = glyphs.size(), .end = glyphs.size(), .width = 0});
+  }
+
+  auto maximumNumberOfLines = static_cast<size_t>(
+      std::max(paragraphAttributes.maximumNumberOfLines, 0));
+  bool isEllipsized = false;
+  if (maximumNumberOfLines > 0 && lineRanges.size() > maximumNumberOfLines) {
+    lineRanges.resize(maximumNumberOfLines);
+    if (paragraphAttributes.ellipsizeMode != EllipsizeMode::Clip) {
+      ellipsizeLine(
+          lineRanges.back(), glyphs, buffers.opportunities, runs, maximumWidth);
+      isEllipsized = true;
+    }
+  }
+
+  // Vertical metrics of the lines
+  Float top = 0;
+  Float textWidth = 0;
+  layout.lines.reserve(lineRanges.size());
+  for (const auto& lineRange : lineRanges) {
+    Float ascent = 0;
+    Float descent = 0;
+    Float ascender = 0;
+    Float descender = 0;
+    Float capHeight = 0;
+    Float xHeight = 0;
+
+    auto addRun = [&](const Run& run) {
+      if (run.isAttachment) {
+        // Attachments sit on the baseline
+        ascent = std::max(ascent, run.attachmentSize.height);
+        return;
+      }
+      const auto& metrics = *run.metrics;
+      Float runAscent = metrics.ascender * run.fontSize;
+      Float runDescent = (metrics.descender + metrics.lineGap) * run.fontSize;
+      if (!std::isnan(run.lineHeight)) {
+        // Half of the difference with the line height goes above and below
+        Float halfLeading =
+            (run.lineHeight - metrics.ascender * run.fontSize -
+             metrics.descender * run.fontSize) /
+            2;
+        runAscent = metrics.ascender * run.fontSize + halfLeading;
+        runDescent = metrics.descender * run.fontSize + halfLeading;
+      }
+      ascent = std::max(ascent, runAscent);
+      descent = std::max(descent, runDescent);
+      ascender = std::max(ascender, metrics.ascender * run.fontSize);
+      descender = std::max(descender, metrics.descender * run.fontSize);
+      capHeight = std::max(capHeight, metrics.capHeight * run.fontSize);
+      xHeight = std::max(xHeight, metrics.xHeight * run.fontSize);
+    };
+
+    if (lineRange.start == lineRange.end) {
+      // Empty lines take the height of the text before them
+      addRun(runs[glyphs[std::max(lineRange.start, size_t{1}) - 1].runIndex]);
+    } else {
+      uint32_t previousRunIndex = std::numeric_limits<uint32_t>::max();
+      for (size_t i = lineRange.start; i < lineRange.end; i++) {
+        if (glyphs[i].runIndex != previousRunIndex) {
+          previousRunIndex = glyphs[i].runIndex;
+          addRun(runs[previousRunIndex]);
+        }
+      }
+    }
+
+    size_t lineTextOffset = lineRange.start < glyphs.size()
+        ? glyphs[lineRange.start].textOffset
+        : textOffset;
+    size_t lineTextEnd = lineRange.end < glyphs.size()
+        ? glyphs[lineRange.end].textOffset
+        : textOffset;
+    Float height = ascent + descent;
+    layout.lines.push_back(TextLayout::Line{
+        .textOffset = lineTextOffset,
+        .textLength = lineTextEnd - lineTextOffset,
+        .frame =
+            {.origin = {.x = 0, .y = top},
+             .size = {.width = lineRange.width, .height = height}},
+        .baseline = ascent,
+        .ascender = ascender,
+        .descender = descender,
+        .capHeight = capHeight,
+        .xHeight = xHeight,
+        .isEllipsized = false});
+    top += height;
+    textWidth = std::max(textWidth, lineRange.width);
+  }
+  layout.lines.back().isEllipsized = isEllipsized;
+
+  layout.size = Size{.width = textWidth, .height = top};
+
+  // Horizontal alignment of the lines, within the widest one
+  auto textAlignment = getTextAlignment(attributedString);
+  if (textAlignment == TextAlignment::Center ||
+      textAlignment == TextAlignment::Right) {
+    for (auto& line : layout.lines) {
+      Float space = textWidth - line.frame.size.width;
+      line.frame.origin.x =
+          textAlignment == TextAlignment::Center ? space / 2 : space;
+    }
+  }
+
+  // Attachments, which are clipped if they are on hidden lines
+  size_t lineIndex = 0;
+  for (size_t i = 0; i < glyphs.size(); i++) {
+    const auto& run = runs[glyphs[i].runIndex];
+    if (!run.isAttachment) {
+      continue;
+    }
+    while (lineIndex < lineRanges.size() && lineRanges[lineIndex].end <= i) {
+      lineIndex++;
+    }
+    if (lineIndex == lineRanges.size()) {
+      layout.attachments.push_back(
+          TextMeasurement::Attachment{.frame = Rect{}, .isClipped = true});
+      continue;
+    }
+
+    const auto& line = layout.lines[lineIndex];
+    Float left = line.frame.origin.x;
+    for (size_t j = lineRanges[lineIndex].start; j < i; j++) {
+      left += glyphs[j].advance;
+    }
+    Float attachmentTop =
+        line.frame.origin.y + line.baseline - run.attachmentSize.height;
+    layout.attachments.push_back(TextMeasurement::Attachment{
+        .frame =
+            {.origin = {.x = left, .y = attachmentTop},
+             .size = run.attachmentSize},
+        .isClipped = false});
+  }
+
+  return layout;
+}
+
+} // namespace facebook::react
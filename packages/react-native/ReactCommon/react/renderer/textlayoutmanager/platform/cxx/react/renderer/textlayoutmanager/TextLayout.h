@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/attributedstring/AttributedString.h>
+#include <react/renderer/attributedstring/ParagraphAttributes.h>
+#include <react/renderer/graphics/Float.h>
+#include <react/renderer/graphics/Size.h>
+#include <react/renderer/textlayoutmanager/FontRegistry.h>
+#include <react/renderer/textlayoutmanager/TextMeasureCache.h>
+
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * An attributed string laid out into lines by the portable text layout
+ * engine of the cxx platform.
+ */
+struct TextLayout {
+  struct Line {
+    /*
+     * Range of the line in the UTF-8 string of the attributed string (the
+     * concatenation of its fragments), including trailing spaces and line
+     * breaks.
+     */
+    size_t textOffset;
+    size_t textLength;
+
+    /*
+     * Frame of the line, with the same origin as the text.
+     */
+    Rect frame;
+
+    /*
+     * Distance from the top of the line to its baseline.
+     */
+    Float baseline;
+
+    /*
+     * Largest metrics of the fonts used on the line.
+     */
+    Float ascender;
+    Float descender;
+    Float capHeight;
+    Float xHeight;
+
+    /*
+     * Whether the line ends with an ellipsis because the text didn't fit in
+     * the maximum number of lines.
+     */
+    bool isEllipsized;
+  };
+
+  std::vector<Line> lines;
+
+  /*
+   * Frames of the attachments, in the order of their fragments.
+   */
+  TextMeasurement::Attachments attachments;
+
+  /*
+   * Size of the text: the width of its widest line and the sum of the
+   * heights of its lines.
+   */
+  Size size;
+};
+
+/*
+ * Lays `attributedString` out into lines no wider than `maximumWidth`
+ * (which can be infinite), using the fonts of `fontRegistry`.
+ *
+ * Lines are broken at the opportunities found by findLineBreakOpportunities,
+ * or anywhere within a word which doesn't fit on a line by itself. Spaces at
+ * the end of a line hang and don't count toward its width. When the number
+ * of lines is limited by the paragraph attributes, the last line is
+ * ellipsized unless the ellipsize mode is Clip.
+ */
+TextLayout layoutText(
+    const AttributedString& attributedString,
+    const ParagraphAttributes& paragraphAttributes,
+    Float maximumWidth,
+    const FontRegistry& fontRegistry);
+
+} // namespace facebook::react
@@ -7,28 +7,95 @@
 
 #include "TextLayoutManager.h"
 
+#include <react/renderer/textlayoutmanager/TextLayout.h>
+#include <react/renderer/textlayoutmanager/TextLayoutManagerExtended.h>
+
+#include <cmath>
+
 namespace facebook::react {
 
+static_assert(TextLayoutManagerExtended::supportsLineMeasurement());
+
+namespace {
+
+FontRegistry::Shared getFontRegistry(
+    const ContextContainer::Shared& contextContainer) {
+  if (contextContainer) {
+    auto fontRegistry = contextContainer->find<FontRegistry::Shared>(
+        FontRegistry::ContextContainerKey);
+    if (fontRegistry.has_value() && *fontRegistry) {
+      return *fontRegistry;
+    }
+  }
+  return std::make_shared<const FontRegistry>();
+}
+
+Float ceilToPixel(Float value, Float pointScaleFactor) {
+  return std::ceil(value * pointScaleFactor) / pointScaleFactor;
+}
+
+} // namespace
+
 TextLayoutManager::TextLayoutManager(
-    const ContextContainer::Shared& /*contextContainer*/)
-    : textMeasureCache_(kSimpleThreadSafeCacheSizeCap) {}
+    const ContextContainer::Shared& contextContainer)
+    : contextContainer_(contextContainer),
+      fontRegistry_(getFontRegistry(contextContainer)),
+      textMeasureCache_(kSimpleThreadSafeCacheSizeCap),
+      lineMeasureCache_(kSimpleThreadSafeCacheSizeCap) {}
 
 TextMeasurement TextLayoutManager::measure(
     const AttributedStringBox& attributedStringBox,
-    const ParagraphAttributes& /*paragraphAttributes*/,
-    const TextLayoutContext& /*layoutContext*/,
+    const ParagraphAttributes& paragraphAttributes,
+    const TextLayoutContext& layoutContext,
     const LayoutConstraints& layoutConstraints) const {
-  TextMeasurement::Attachments attachments;
-  for (const auto& fragment : attributedStringBox.getValue().getFragments()) {
-    if (fragment.isAttachment()) {
-      attachments.push_back(
-          TextMeasurement::Attachment{{{0, 0}, {0, 0}}, false});
-    }
-  }
-  return TextMeasurement{
-      {layoutConstraints.minimumSize.width,
-       layoutConstraints.minimumSize.height},
-      attachments};
+  const auto& attributedString = attributedStringBox.getValue();
+
+  auto measurement = textMeasureCache_.get(
+      {attributedString, paragraphAttributes, layoutConstraints},
+      [&](const TextMeasureCacheKey& /*key*/) {
+        auto layout = layoutText(
+            attributedString,
+            paragraphAttributes,
+            layoutConstraints.maximumSize.width,
+            *fontRegistry_);
+
+        auto pointScaleFactor = layoutContext.pointScaleFactor;
+        return TextMeasurement{
+            {ceilToPixel(layout.size.width, pointScaleFactor),
+             ceilToPixel(layout.size.height, pointScaleFactor)},
+            std::move(layout.attachments)};
+      });
+
+  measurement.size = layoutConstraints.clamp(measurement.size);
+  return measurement;
+}
+
+LinesMeasurements TextLayoutManager::measureLines(
+    const AttributedStringBox& attributedStringBox,
+    const ParagraphAttributes& paragraphAttributes,
+    const Size& size) const {
+  const auto& attributedString = attributedStringBox.getValue();
+
+  return lineMeasureCache_.get(
+      {attributedString, paragraphAttributes, size},
+      [&](const LineMeasureCacheKey& /*key*/) {
+        auto layout = layoutText(
+            attributedString, paragraphAttributes, size.width, *fontRegistry_);
+
+        auto string = attributedString.getString();
+        LinesMeasurements lineMeasurements;
+        lineMeasurements.reserve(layout.lines.size());
+        for (const auto& line : layout.lines) {
+          lineMeasurements.emplace_back(
+              string.substr(line.textOffset, line.textLength),
+              line.frame,
+              line.descender,
+              line.capHeight,
+              line.ascender,
+              line.xHeight);
+        }
+        return lineMeasurements;
+      });
 }
 
 } // namespace facebook::react
@@ -10,6 +10,7 @@
 #include <react/renderer/attributedstring/AttributedStringBox.h>
 #include <react/renderer/attributedstring/ParagraphAttributes.h>
 #include <react/renderer/core/LayoutConstraints.h>
+#include <react/renderer/textlayoutmanager/FontRegistry.h>
 #include <react/renderer/textlayoutmanager/TextLayoutContext.h>
 #include <react/renderer/textlayoutmanager/TextMeasureCache.h>
 #include <react/utils/ContextContainer.h>
@@ -22,6 +23,10 @@ class TextLayoutManager;
 /*
  * Cross platform facade for text measurement (e.g. Android-specific
  * TextLayoutManager)
+ *
+ * On the cxx platform, text is laid out by a portable engine (see
+ * TextLayout.h) with the fonts of the FontRegistry stored in the
+ * ContextContainer, or built-in font metrics if there is none.
  */
 class TextLayoutManager {
  public:
@@ -49,9 +54,20 @@ class TextLayoutManager {
       const TextLayoutContext& layoutContext,
       const LayoutConstraints& layoutConstraints) const;
 
+  /*
+   * Measures lines of `attributedString` using native text rendering
+   * infrastructure.
+   */
+  LinesMeasurements measureLines(
+      const AttributedStringBox& attributedStringBox,
+      const ParagraphAttributes& paragraphAttributes,
+      const Size& size) const;
+
  protected:
   std::shared_ptr<const ContextContainer> contextContainer_;
+  FontRegistry::Shared fontRegistry_;
   TextMeasureCache textMeasureCache_;
+  LineMeasureCache lineMeasureCache_;
 };
 
 } // namespace facebook::react
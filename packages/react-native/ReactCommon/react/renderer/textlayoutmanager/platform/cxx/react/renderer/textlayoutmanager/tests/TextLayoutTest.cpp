@@ -0,0 +1,359 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/textlayoutmanager/FontMetrics.h>
+#include <react/renderer/textlayoutmanager/FontRegistry.h>
+#include <react/renderer/textlayoutmanager/LineBreaker.h>
+#include <react/renderer/textlayoutmanager/TextLayout.h>
+
+using namespace facebook::react;
+
+namespace {
+
+constexpr Float kInfinity = std::numeric_limits<Float>::infinity();
+
+AttributedString::Fragment makeFragment(
+    std::string string,
+    Float fontSize = 10,
+    std::string fontFamily = "") {
+  auto fragment = AttributedString::Fragment{};
+  fragment.string = std::move(string);
+  fragment.textAttributes.fontSize = fontSize;
+  fragment.textAttributes.fontFamily = std::move(fontFamily);
+  return fragment;
+}
+
+AttributedString makeAttributedString(
+    std::string string,
+    Float fontSize = 10,
+    std::string fontFamily = "") {
+  auto attributedString = AttributedString{};
+  attributedString.appendFragment(
+      makeFragment(std::move(string), fontSize, std::move(fontFamily)));
+  return attributedString;
+}
+
+std::vector<LineBreakOpportunity> findOpportunities(
+    const std::u32string& string) {
+  std::vector<LineBreakOpportunity> opportunities;
+  findLineBreakOpportunities(
+      std::span<const char32_t>(string.data(), string.size()), opportunities);
+  return opportunities;
+}
+
+std::string getLineText(
+    const AttributedString& attributedString,
+    const TextLayout::Line& line) {
+  return attributedString.getString().substr(
+      line.textOffset, line.textLength);
+}
+
+/*
+ * Writes a minimal TrueType font with the given metrics, where the code
+ * points from `firstCodePoint` to `lastCodePoint` map to a glyph with an
+ * advance of `advance` units.
+ */
+class FontDataWriter {
+ public:
+  std::vector<uint8_t> write(
+      uint16_t unitsPerEm,
+      int16_t ascender,
+      int16_t descender,
+      uint16_t advance,
+      char32_t firstCodePoint,
+      char32_t lastCodePoint) {
+    std::vector<uint8_t> head(54);
+    put16(head, 18, unitsPerEm);
+
+    std::vector<uint8_t> hhea(36);
+    put16(hhea, 4, static_cast<uint16_t>(ascender));
+    put16(hhea, 6, static_cast<uint16_t>(descender));
+    put16(hhea, 34, 2);
+
+    // Glyph 0 (notdef) and glyph 1
+    std::vector<uint8_t> hmtx(8);
+    put16(hmtx, 0, unitsPerEm / 2);
+    put16(hmtx, 4, advance);
+
+    // One format 12 subtable mapping the range to glyphs from 1 on
+    std::vector<uint8_t> cmap(4 + 8 + 16 + 12);
+    put16(cmap, 2, 1);
+    put16(cmap, 4, 3);
+    put16(cmap, 6, 10);
+    put32(cmap, 8, 12);
+    put16(cmap, 12, 12);
+    put32(cmap, 16, static_cast<uint32_t>(cmap.size() - 12));
+    put32(cmap, 24, 1);
+    put32(cmap, 28, firstCodePoint);
+    put32(cmap, 32, lastCodePoint);
+    put32(cmap, 36, 1);
+
+    std::vector<std::pair<std::string, std::vector<uint8_t>>> tables = {
+        {"cmap", cmap}, {"head", head}, {"hhea", hhea}, {"hmtx", hmtx}};
+    std::vector<uint8_t> data(12 + tables.size() * 16);
+    put32(data, 0, 0x00010000);
+    put16(data, 4, static_cast<uint16_t>(tables.size()));
+    for (size_t i = 0; i < tables.size(); i++) {
+      const auto& [tag, table] = tables[i];
+      size_t record = 12 + i * 16;
+      for (size_t j = 0; j < 4; j++) {
+        data[record + j] = static_cast<uint8_t>(tag[j]);
+      }
+      put32(data, record + 8, static_cast<uint32_t>(data.size()));
+      put32(data, record + 12, static_cast<uint32_t>(table.size()));
+      data.insert(data.end(), table.begin(), table.end());
+    }
+    return data;
+  }
+
+ private:
+  static void put16(std::vector<uint8_t>& data, size_t offset, uint16_t value) {
+    data[offset] = static_cast<uint8_t>(value >> 8);
+    data[offset + 1] = static_cast<uint8_t>(value);
+  }
+
+  static void put32(std::vector<uint8_t>& data, size_t offset, uint32_t value) {
+    put16(data, offset, static_cast<uint16_t>(value >> 16));
+    put16(data, offset + 2, static_cast<uint16_t>(value));
+  }
+};
+
+} // namespace
+
+TEST(TextLayoutTest, testLineBreakOpportunities) {
+  using enum LineBreakOpportunity;
+
+  EXPECT_EQ(
+      findOpportunities(U"ab cd"),
+      (std::vector{Prohibited, Prohibited, Prohibited, Allowed, Prohibited}));
+
+  // Hard line breaks, and CR LF as a single one
+  EXPECT_EQ(
+      findOpportunities(U"a\r\nb\nc"),
+      (std::vector{
+          Prohibited, Prohibited, WithinCluster, Mandatory, Prohibited,
+          Mandatory}));
+
+  // No breaks after opening or before closing punctuation, or before the
+  // digits of a negative number
+  EXPECT_EQ(
+      findOpportunities(U"(a) -1"),
+      (std::vector{
+          Prohibited, Prohibited, Prohibited, Prohibited, Allowed,
+          Prohibited}));
+
+  // Breaks after hyphens
+  EXPECT_EQ(
+      findOpportunities(U"a-b c"),
+      (std::vector{Prohibited, Prohibited, Allowed, Prohibited, Prohibited}));
+
+  // Combining marks and emoji sequences are never broken
+  EXPECT_EQ(
+      findOpportunities(U"é\U0001F469‍\U0001F4BB"),
+      (std::vector{
+          Prohibited, WithinCluster, Allowed, WithinCluster, WithinCluster}));
+
+  // Ideographs break between each other, but not before small kana
+  EXPECT_EQ(
+      findOpportunities(U"日本っ"),
+      (std::vector{Prohibited, Allowed, Prohibited}));
+}
+
+TEST(TextLayoutTest, testSingleLine) {
+  auto fontRegistry = FontRegistry{};
+  auto metrics = FontMetrics::sansSerif();
+  auto attributedString = makeAttributedString("Hi there");
+
+  auto layout = layoutText(
+      attributedString, ParagraphAttributes{}, kInfinity, fontRegistry);
+
+  Float width = 0;
+  for (char c : std::string("Hi there")) {
+    width += metrics->getAdvance(static_cast<char32_t>(c)) * 10;
+  }
+  ASSERT_EQ(layout.lines.size(), 1);
+  EXPECT_FLOAT_EQ(layout.size.width, width);
+  EXPECT_FLOAT_EQ(
+      layout.size.height,
+      (metrics->ascender + metrics->descender + metrics->lineGap) * 10);
+  EXPECT_FLOAT_EQ(layout.lines[0].baseline, metrics->ascender * 10);
+  EXPECT_FLOAT_EQ(layout.lines[0].capHeight, metrics->capHeight * 10);
+  EXPECT_EQ(getLineText(attributedString, layout.lines[0]), "Hi there");
+  EXPECT_FALSE(layout.lines[0].isEllipsized);
+}
+
+TEST(TextLayoutTest, testWrapping) {
+  auto fontRegistry = FontRegistry{};
+  auto attributedString = makeAttributedString("aaaa bbbb cccc", 10, "Menlo");
+
+  // Monospace advances are 6 points at this size: "aaaa bbbb" doesn't fit
+  auto layout =
+      layoutText(attributedString, ParagraphAttributes{}, 50, fontRegistry);
+
+  ASSERT_EQ(layout.lines.size(), 3);
+  EXPECT_EQ(getLineText(attributedString, layout.lines[0]), "aaaa ");
+  EXPECT_EQ(getLineText(attributedString, layout.lines[1]), "bbbb ");
+  EXPECT_EQ(getLineText(attributedString, layout.lines[2]), "cccc");
+  // Trailing spaces hang
+  EXPECT_FLOAT_EQ(layout.lines[0].frame.size.width, 24);
+  EXPECT_FLOAT_EQ(layout.size.width, 24);
+  EXPECT_FLOAT_EQ(
+      layout.lines[1].frame.origin.y, layout.lines[0].frame.size.height);
+
+  // Words wider than a line are broken between characters
+  layout = layoutText(
+      makeAttributedString("aaaaaaaaaa", 10, "Menlo"),
+      ParagraphAttributes{},
+      40,
+      fontRegistry);
+  ASSERT_EQ(layout.lines.size(), 2);
+  EXPECT_EQ(layout.lines[0].textLength, 6);
+  EXPECT_EQ(layout.lines[1].textLength, 4);
+}
+
+TEST(TextLayoutTest, testLineBreaks) {
+  auto fontRegistry = FontRegistry{};
+  auto attributedString = makeAttributedString("a\n\nb\n");
+
+  auto layout = layoutText(
+      attributedString, ParagraphAttributes{}, kInfinity, fontRegistry);
+
+  ASSERT_EQ(layout.lines.size(), 4);
+  EXPECT_EQ(getLineText(attributedString, layout.lines[0]), "a\n");
+  EXPECT_EQ(getLineText(attributedString, layout.lines[1]), "\n");
+  EXPECT_EQ(getLineText(attributedString, layout.lines[2]), "b\n");
+  EXPECT_EQ(getLineText(attributedString, layout.lines[3]), "");
+  EXPECT_FLOAT_EQ(
+      layout.size.height, layout.lines[0].frame.size.height * 4);
+}
+
+TEST(TextLayoutTest, testMaximumNumberOfLines) {
+  auto fontRegistry = FontRegistry{};
+  auto attributedString = makeAttributedString("aaaa bbbb cccc", 10, "Menlo");
+  auto paragraphAttributes = ParagraphAttributes{};
+  paragraphAttributes.maximumNumberOfLines = 2;
+  paragraphAttributes.ellipsizeMode = EllipsizeMode::Tail;
+
+  auto layout =
+      layoutText(attributedString, paragraphAttributes, 50, fontRegistry);
+
+  ASSERT_EQ(layout.lines.size(), 2);
+  EXPECT_FALSE(layout.lines[0].isEllipsized);
+  EXPECT_TRUE(layout.lines[1].isEllipsized);
+  // As much of the rest of the text as fits with an ellipsis
+  EXPECT_EQ(getLineText(attributedString, layout.lines[1]), "bbbb cc");
+  EXPECT_LE(layout.lines[1].frame.size.width, 50);
+
+  paragraphAttributes.ellipsizeMode = EllipsizeMode::Clip;
+  layout = layoutText(attributedString, paragraphAttributes, 50, fontRegistry);
+
+  ASSERT_EQ(layout.lines.size(), 2);
+  EXPECT_FALSE(layout.lines[1].isEllipsized);
+  EXPECT_EQ(getLineText(attributedString, layout.lines[1]), "bbbb ");
+}
+
+TEST(TextLayoutTest, testAlignment) {
+  auto fontRegistry = FontRegistry{};
+  auto attributedString = AttributedString{};
+  auto fragment = makeFragment("aaaa bb", 10, "Menlo");
+  fragment.textAttributes.alignment = TextAlignment::Center;
+  attributedString.appendFragment(std::move(fragment));
+
+  auto layout =
+      layoutText(attributedString, ParagraphAttributes{}, 30, fontRegistry);
+
+  ASSERT_EQ(layout.lines.size(), 2);
+  EXPECT_FLOAT_EQ(layout.lines[0].frame.origin.x, 0);
+  EXPECT_FLOAT_EQ(layout.lines[1].frame.origin.x, 6);
+}
+
+TEST(TextLayoutTest, testAttachments) {
+  auto fontRegistry = FontRegistry{};
+  auto attributedString = AttributedString{};
+  attributedString.appendFragment(makeFragment("aa", 10, "Menlo"));
+  auto attachment = AttributedString::Fragment{};
+  attachment.string = AttributedString::Fragment::AttachmentCharacter();
+  attachment.parentShadowView.tag = 1;
+  attachment.parentShadowView.layoutMetrics.frame.size = {20, 30};
+  attributedString.appendFragment(std::move(attachment));
+  attributedString.appendFragment(makeFragment(" bb", 10, "Menlo"));
+
+  auto layout = layoutText(
+      attributedString, ParagraphAttributes{}, kInfinity, fontRegistry);
+
+  ASSERT_EQ(layout.lines.size(), 1);
+  ASSERT_EQ(layout.attachments.size(), 1);
+  // Attachments sit on the baseline, and can make the line taller
+  EXPECT_FLOAT_EQ(layout.lines[0].baseline, 30);
+  EXPECT_FLOAT_EQ(layout.attachments[0].frame.origin.x, 12);
+  EXPECT_FLOAT_EQ(layout.attachments[0].frame.origin.y, 0);
+  EXPECT_FLOAT_EQ(layout.attachments[0].frame.size.width, 20);
+  EXPECT_FALSE(layout.attachments[0].isClipped);
+  EXPECT_FLOAT_EQ(layout.size.width, 12 + 20 + 18);
+
+  // Attachments on lines which are not shown are clipped
+  auto paragraphAttributes = ParagraphAttributes{};
+  paragraphAttributes.maximumNumberOfLines = 1;
+  paragraphAttributes.ellipsizeMode = EllipsizeMode::Clip;
+  layout = layoutText(attributedString, paragraphAttributes, 12, fontRegistry);
+  ASSERT_EQ(layout.attachments.size(), 1);
+  EXPECT_TRUE(layout.attachments[0].isClipped);
+}
+
+TEST(TextLayoutTest, testFontRegistry) {
+  auto fontRegistry = FontRegistry{};
+  auto regular = std::make_shared<FontMetrics>(*FontMetrics::monospace());
+  auto bold = std::make_shared<FontMetrics>(*FontMetrics::monospace());
+  fontRegistry.registerFont("Custom", regular);
+  fontRegistry.registerFont("Custom", bold, FontWeight::Bold);
+
+  auto textAttributes = TextAttributes{};
+  textAttributes.fontFamily = "Custom";
+  EXPECT_EQ(fontRegistry.resolveFont(textAttributes).metrics, regular);
+
+  textAttributes.fontWeight = FontWeight::Black;
+  auto font = fontRegistry.resolveFont(textAttributes);
+  EXPECT_EQ(font.metrics, bold);
+  EXPECT_FLOAT_EQ(font.advanceScale, 1);
+
+  // Families which were not registered use built-in metrics, with a
+  // synthetic bold
+  textAttributes.fontFamily = "Courier";
+  font = fontRegistry.resolveFont(textAttributes);
+  EXPECT_EQ(font.metrics, FontMetrics::monospace());
+  EXPECT_GT(font.advanceScale, 1);
+
+  textAttributes.fontFamily = "Unknown";
+  textAttributes.fontWeight = FontWeight::Regular;
+  EXPECT_EQ(
+      fontRegistry.resolveFont(textAttributes).metrics,
+      FontMetrics::sansSerif());
+}
+
+TEST(TextLayoutTest, testFontMetricsFromData) {
+  auto data = FontDataWriter{}.write(1000, 800, -200, 400, 'a', 'z');
+  auto metrics = FontMetrics::fromData(data);
+
+  ASSERT_NE(metrics, nullptr);
+  EXPECT_FLOAT_EQ(metrics->ascender, 0.8);
+  EXPECT_FLOAT_EQ(metrics->descender, 0.2);
+  EXPECT_FLOAT_EQ(metrics->getAdvance('m'), 0.4);
+  // Characters the font doesn't cover use the advance of the notdef glyph
+  EXPECT_FLOAT_EQ(metrics->getAdvance('M'), 0.5);
+
+  // Malformed fonts are rejected
+  data.resize(data.size() - 20);
+  EXPECT_EQ(FontMetrics::fromData(data), nullptr);
+  EXPECT_EQ(FontMetrics::fromData({}), nullptr);
+}
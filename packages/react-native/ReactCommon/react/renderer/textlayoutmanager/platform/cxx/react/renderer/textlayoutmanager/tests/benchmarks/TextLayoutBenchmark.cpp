@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/textlayoutmanager/TextLayout.h>
+
+#include <array>
+#include <string>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr std::array<const char*, 8> Words = {
+    "Lorem",
+    "ipsum",
+    "dolor",
+    "sit",
+    "amet,",
+    "consectetur",
+    "adipiscing",
+    "elit."};
+
+// A paragraph of `wordCount` words, split in a few differently styled
+// fragments as in a typical <Text> with nested <Text>s.
+AttributedString buildParagraph(size_t wordCount) {
+  auto attributedString = AttributedString{};
+  constexpr size_t fragmentCount = 4;
+  for (size_t fragmentIndex = 0; fragmentIndex < fragmentCount;
+       fragmentIndex++) {
+    auto fragment = AttributedString::Fragment{};
+    fragment.textAttributes.fontSize = 14;
+    fragment.textAttributes.fontWeight =
+        fragmentIndex % 2 == 0 ? FontWeight::Regular : FontWeight::Bold;
+    size_t begin = wordCount * fragmentIndex / fragmentCount;
+    size_t end = wordCount * (fragmentIndex + 1) / fragmentCount;
+    for (size_t i = begin; i < end; i++) {
+      fragment.string += Words[i % Words.size()];
+      fragment.string += ' ';
+    }
+    attributedString.appendFragment(std::move(fragment));
+  }
+  return attributedString;
+}
+
+void layoutParagraph(benchmark::State& state) {
+  auto attributedString = buildParagraph(static_cast<size_t>(state.range(0)));
+  auto paragraphAttributes = ParagraphAttributes{};
+  auto fontRegistry = FontRegistry{};
+  for (auto _ : state) {
+    auto layout =
+        layoutText(attributedString, paragraphAttributes, 320, fontRegistry);
+    benchmark::DoNotOptimize(layout);
+  }
+}
+
+void layoutParagraphWithMaximumNumberOfLines(benchmark::State& state) {
+  auto attributedString = buildParagraph(static_cast<size_t>(state.range(0)));
+  auto paragraphAttributes = ParagraphAttributes{};
+  paragraphAttributes.maximumNumberOfLines = 2;
+  paragraphAttributes.ellipsizeMode = EllipsizeMode::Tail;
+  auto fontRegistry = FontRegistry{};
+  for (auto _ : state) {
+    auto layout =
+        layoutText(attributedString, paragraphAttributes, 320, fontRegistry);
+    benchmark::DoNotOptimize(layout);
+  }
+}
+
+} // namespace
+
+BENCHMARK(layoutParagraph)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(layoutParagraphWithMaximumNumberOfLines)->Arg(10)->Arg(1000);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
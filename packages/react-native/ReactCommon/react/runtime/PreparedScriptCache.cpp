@@ -0,0 +1,342 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "PreparedScriptCache.h"
+
+#include <cxxreact/JSBigString.h>
+#include <folly/FileUtil.h>
+#include <folly/hash/SpookyHashV2.h>
+#include <folly/portability/Fcntl.h>
+#include <folly/portability/SysUio.h>
+#include <glog/logging.h>
+#include <jsireact/JSIExecutor.h>
+#include <cinttypes>
+#include <cstdio>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr uint32_t EntryMagic = 0x53504e52; // "RNPS"
+constexpr uint32_t EntryFormatVersion = 1;
+
+/*
+ * Entries start with this header, followed by `payloadSize` bytes of compiled
+ * script. Its size keeps the payload 8-byte aligned in the mapped file.
+ */
+struct EntryHeader {
+  uint32_t magic;
+  uint32_t formatVersion;
+  uint64_t key;
+  uint64_t payloadSize;
+  uint64_t reserved;
+};
+
+static_assert(sizeof(EntryHeader) == 32);
+
+uint64_t hashString(const std::string& string, uint64_t seed = 0) {
+  return folly::hash::SpookyHashV2::Hash64(string.data(), string.size(), seed);
+}
+
+/*
+ * A thread running tasks in order, started with the first one. Tasks which
+ * have not started when it is stopped are dropped.
+ */
+class Worker {
+ public:
+  Worker() = default;
+  Worker(const Worker&) = delete;
+  Worker& operator=(const Worker&) = delete;
+
+  ~Worker() {
+    stop();
+  }
+
+  void post(std::function<void()>&& task) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (stopping_) {
+        return;
+      }
+      tasks_.push_back(std::move(task));
+      if (!thread_.joinable()) {
+        thread_ = std::thread([this]() { run(); });
+      }
+    }
+    condition_.notify_one();
+  }
+
+  /*
+   * Waits for the task in progress, if any.
+   */
+  void stop() {
+    // Dropped tasks are destroyed outside of the lock, as they may hold
+    // references to the owner of the worker.
+    std::deque<std::function<void()>> dropped;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+      dropped.swap(tasks_);
+    }
+    condition_.notify_one();
+    if (thread_.joinable()) {
+      thread_.join();
+    }
+  }
+
+ private:
+  void run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      condition_.wait(lock, [this]() { return stopping_ || !tasks_.empty(); });
+      if (stopping_) {
+        return;
+      }
+      auto task = std::move(tasks_.front());
+      tasks_.pop_front();
+      lock.unlock();
+      task();
+      lock.lock();
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::deque<std::function<void()>> tasks_;
+  bool stopping_{false};
+  std::thread thread_;
+};
+
+} // namespace
+
+struct PreparedScriptCache::Shared {
+  std::string directory;
+  std::string runtimeVersion;
+  JSRuntime::ScriptCompiler compiler;
+  // Null when tasks run on the owned threads
+  BackgroundExecutor backgroundExecutor;
+
+  // Lookups have their own thread, so that they never wait for a compilation
+  Worker lookupWorker;
+  Worker compileWorker;
+
+  std::string getEntryPath(const std::string& sourceURL) const {
+    char name[32];
+    std::snprintf(
+        name, sizeof(name), "%016" PRIx64 ".jsprepared", hashString(sourceURL));
+    return (std::filesystem::path(directory) / name).string();
+  }
+
+  std::shared_ptr<const jsi::Buffer> getPreparedScript(
+      std::shared_ptr<const jsi::Buffer> source,
+      const std::string& sourceURL) {
+    // Seeding with the runtime version invalidates entries compiled by other
+    // versions of the runtime.
+    auto key = folly::hash::SpookyHashV2::Hash64(
+        source->data(), source->size(), hashString(runtimeVersion));
+    if (auto prepared = readEntry(sourceURL, key)) {
+      return prepared;
+    }
+    compileEntryInBackground(source, sourceURL, key);
+    return source;
+  }
+
+  std::shared_ptr<const jsi::Buffer> getPreparedScriptFromFile(
+      const std::string& path,
+      const std::string& sourceURL) {
+    std::error_code sizeError;
+    std::error_code timeError;
+    auto size = std::filesystem::file_size(path, sizeError);
+    auto modified = std::filesystem::last_write_time(path, timeError);
+    if (!sizeError && !timeError) {
+      uint64_t metadata[] = {
+          size,
+          static_cast<uint64_t>(modified.time_since_epoch().count()),
+          hashString(path)};
+      auto key = folly::hash::SpookyHashV2::Hash64(
+          metadata, sizeof(metadata), hashString(runtimeVersion));
+      if (auto prepared = readEntry(sourceURL, key)) {
+        return prepared;
+      }
+      auto source =
+          std::make_shared<BigStringBuffer>(JSBigFileString::fromPath(path));
+      compileEntryInBackground(source, sourceURL, key);
+      return source;
+    }
+    // Let the caller report missing files as before
+    return std::make_shared<BigStringBuffer>(JSBigFileString::fromPath(path));
+  }
+
+  std::shared_ptr<const jsi::Buffer> readEntry(
+      const std::string& sourceURL,
+      uint64_t key) const {
+    auto entryPath = getEntryPath(sourceURL);
+    int fd = folly::fileops::open(entryPath.c_str(), O_RDONLY);
+    if (fd == -1) {
+      return nullptr;
+    }
+
+    EntryHeader header{};
+    std::error_code error;
+    auto entrySize = std::filesystem::file_size(entryPath, error);
+    bool valid = !error &&
+        folly::preadFull(fd, &header, sizeof(header), 0) == sizeof(header) &&
+        header.magic == EntryMagic &&
+        header.formatVersion == EntryFormatVersion && header.key == key &&
+        header.payloadSize > 0 &&
+        header.payloadSize == entrySize - sizeof(header);
+
+    std::shared_ptr<const jsi::Buffer> prepared;
+    if (valid) {
+      prepared =
+          std::make_shared<BigStringBuffer>(std::make_unique<JSBigFileString>(
+              fd, header.payloadSize, sizeof(header)));
+    }
+    folly::fileops::close(fd);
+    return prepared;
+  }
+
+  void compileEntryInBackground(
+      std::shared_ptr<const jsi::Buffer> source,
+      const std::string& sourceURL,
+      uint64_t key) {
+    if (!compiler) {
+      return;
+    }
+    schedule(
+        [compiler = compiler,
+         source = std::move(source),
+         sourceURL,
+         entryPath = getEntryPath(sourceURL),
+         key]() {
+          std::shared_ptr<const jsi::Buffer> compiled;
+          try {
+            compiled = compiler(*source, sourceURL);
+          } catch (const std::exception& e) {
+            LOG(WARNING) << "Failed to compile " << sourceURL << ": "
+                         << e.what();
+          }
+          if (!compiled || compiled->size() == 0) {
+            return;
+          }
+
+          EntryHeader header{
+              .magic = EntryMagic,
+              .formatVersion = EntryFormatVersion,
+              .key = key,
+              .payloadSize = compiled->size(),
+              .reserved = 0,
+          };
+          iovec iov[] = {
+              {.iov_base = &header, .iov_len = sizeof(header)},
+              {.iov_base = const_cast<uint8_t*>(compiled->data()),
+               .iov_len = compiled->size()},
+          };
+          // Written to a temporary file and renamed, so readers never observe
+          // a partially written entry.
+          if (int error = folly::writeFileAtomicNoThrow(
+                  entryPath, iov, static_cast<int>(std::size(iov)), 0644)) {
+            LOG(WARNING) << "Failed to write prepared script " << entryPath
+                         << ": " << std::strerror(error);
+          }
+        },
+        compileWorker);
+  }
+
+  void schedule(std::function<void()>&& task, Worker& worker) {
+    if (backgroundExecutor) {
+      backgroundExecutor(std::move(task));
+    } else {
+      worker.post(std::move(task));
+    }
+  }
+
+  template <typename Lookup>
+  PreparedScript prepareInBackground(Lookup&& lookup) {
+    auto promise =
+        std::make_shared<std::promise<std::shared_ptr<const jsi::Buffer>>>();
+    PreparedScript prepared = promise->get_future().share();
+    schedule(
+        [promise, lookup = std::forward<Lookup>(lookup)]() mutable {
+          try {
+            promise->set_value(lookup());
+          } catch (...) {
+            promise->set_exception(std::current_exception());
+          }
+        },
+        lookupWorker);
+    return prepared;
+  }
+};
+
+PreparedScriptCache::PreparedScriptCache(
+    std::string directory,
+    std::string runtimeVersion,
+    JSRuntime::ScriptCompiler compiler,
+    BackgroundExecutor backgroundExecutor)
+    : shared_(std::make_shared<Shared>()) {
+  shared_->directory = std::move(directory);
+  shared_->runtimeVersion = std::move(runtimeVersion);
+  shared_->compiler = std::move(compiler);
+  shared_->backgroundExecutor = std::move(backgroundExecutor);
+  std::error_code error;
+  std::filesystem::create_directories(shared_->directory, error);
+  if (error) {
+    LOG(WARNING) << "Failed to create prepared script cache directory "
+                 << shared_->directory << ": " << error.message();
+  }
+}
+
+PreparedScriptCache::~PreparedScriptCache() {
+  // Pending lookups hold references to the shared state. A lookup in progress
+  // may still schedule a compilation, so the compile worker stops last.
+  shared_->lookupWorker.stop();
+  shared_->compileWorker.stop();
+}
+
+std::string PreparedScriptCache::getEntryPath(
+    const std::string& sourceURL) const {
+  return shared_->getEntryPath(sourceURL);
+}
+
+std::shared_ptr<const jsi::Buffer> PreparedScriptCache::getPreparedScript(
+    std::shared_ptr<const jsi::Buffer> source,
+    const std::string& sourceURL) {
+  return shared_->getPreparedScript(std::move(source), sourceURL);
+}
+
+std::shared_ptr<const jsi::Buffer>
+PreparedScriptCache::getPreparedScriptFromFile(
+    const std::string& path,
+    const std::string& sourceURL) {
+  return shared_->getPreparedScriptFromFile(path, sourceURL);
+}
+
+PreparedScriptCache::PreparedScript PreparedScriptCache::prepareScript(
+    std::shared_ptr<const jsi::Buffer> source,
+    const std::string& sourceURL) {
+  return shared_->prepareInBackground(
+      [shared = shared_, source = std::move(source), sourceURL]() {
+        return shared->getPreparedScript(source, sourceURL);
+      });
+}
+
+PreparedScriptCache::PreparedScript PreparedScriptCache::prepareScriptFromFile(
+    const std::string& path,
+    const std::string& sourceURL) {
+  return shared_->prepareInBackground([shared = shared_, path, sourceURL]() {
+    return shared->getPreparedScriptFromFile(path, sourceURL);
+  });
+}
+
+} // namespace facebook::react
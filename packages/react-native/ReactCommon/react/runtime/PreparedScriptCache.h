@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <jsi/jsi.h>
+#include <react/runtime/JSRuntimeFactory.h>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+
+namespace facebook::react {
+
+/*
+ * On-disk cache of precompiled scripts (e.g. bytecode), so that launches after
+ * the first one skip parsing and compiling the bundle and its segments.
+ *
+ * Each script URL owns one cache entry, tagged with a key derived from the
+ * script and with the runtime's compiled script version; an entry whose tag
+ * does not match is ignored and later replaced. On a miss the source is
+ * returned unchanged, and compiled and written in the background.
+ */
+class PreparedScriptCache {
+ public:
+  using BackgroundExecutor = std::function<void(std::function<void()>&&)>;
+  using PreparedScript = std::shared_future<std::shared_ptr<const jsi::Buffer>>;
+
+  /*
+   * `directory` is created if it does not exist. By default lookups and
+   * compilations run on two threads owned by the cache, so that lookups do
+   * not wait for compilations.
+   */
+  PreparedScriptCache(
+      std::string directory,
+      std::string runtimeVersion,
+      JSRuntime::ScriptCompiler compiler,
+      BackgroundExecutor backgroundExecutor = nullptr);
+
+  /*
+   * Waits for the lookup and compilation in progress on the owned threads, if
+   * any. Work which has not started yet is dropped; its entries are filled by
+   * a later launch.
+   */
+  ~PreparedScriptCache();
+
+  PreparedScriptCache(const PreparedScriptCache&) = delete;
+  PreparedScriptCache& operator=(const PreparedScriptCache&) = delete;
+
+  /*
+   * Returns the buffer to evaluate for `source`: its compiled form if cached
+   * by an earlier launch, `source` itself otherwise. The cache key hashes the
+   * whole source.
+   */
+  std::shared_ptr<const jsi::Buffer> getPreparedScript(
+      std::shared_ptr<const jsi::Buffer> source,
+      const std::string& sourceURL);
+
+  /*
+   * Like `getPreparedScript`, for a script stored in a file. The cache key is
+   * derived from the file's size and modification time, so the source is
+   * only read on a cache miss.
+   */
+  std::shared_ptr<const jsi::Buffer> getPreparedScriptFromFile(
+      const std::string& path,
+      const std::string& sourceURL);
+
+  /*
+   * Like `getPreparedScript` and `getPreparedScriptFromFile`, but run in the
+   * background (on the owned lookup thread, which never waits for a
+   * compilation), so that the JS thread neither hashes nor reads the source
+   * and only waits if the lookup is still running when it needs the script.
+   */
+  PreparedScript prepareScript(
+      std::shared_ptr<const jsi::Buffer> source,
+      const std::string& sourceURL);
+  PreparedScript prepareScriptFromFile(
+      const std::string& path,
+      const std::string& sourceURL);
+
+  /*
+   * Path of the cache entry for `sourceURL`.
+   */
+  std::string getEntryPath(const std::string& sourceURL) const;
+
+ private:
+  /*
+   * State shared with lookups, which may outlive the cache when they run on
+   * a `BackgroundExecutor`.
+   */
+  struct Shared;
+
+  std::shared_ptr<Shared> shared_;
+};
+
+} // namespace facebook::react
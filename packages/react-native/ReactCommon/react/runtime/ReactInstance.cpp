@@ -220,11 +220,18 @@ void ReactInstance::loadScript(
     std::function<void(jsi::Runtime& runtime)>&& afterLoad) {
   auto buffer = std::make_shared<BigStringBuffer>(std::move(script));
   std::string scriptName = simpleBasename(sourceURL);
+  // Looked up in the background, so that the JS thread does not hash the
+  // bundle and only waits for the lookup if it is still running.
+  PreparedScriptCache::PreparedScript preparedScript;
+  if (preparedScriptCache_ && !runtime_->isCompiledScript(*buffer)) {
+    preparedScript = preparedScriptCache_->prepareScript(buffer, sourceURL);
+  }
 
   runtimeScheduler_->scheduleWork([this,
                                    scriptName,
                                    sourceURL,
                                    buffer = std::move(buffer),
+                                   preparedScript = std::move(preparedScript),
                                    weakBufferedRuntimeExecuter =
                                        std::weak_ptr<BufferedRuntimeExecutor>(
                                            bufferedRuntimeExecutor_),
@@ -240,7 +247,8 @@ void ReactInstance::loadScript(
           ReactMarker::RUN_JS_BUNDLE_START, scriptName.c_str());
     }
 
-    runtime.evaluateJavaScript(buffer, sourceURL);
+    runtime.evaluateJavaScript(
+        preparedScript.valid() ? preparedScript.get() : buffer, sourceURL);
 
     /**
      * TODO(T183610671): We need a safe/reliable way to enable the js
@@ -334,15 +342,25 @@ void ReactInstance::registerSegment(
     const std::string& segmentPath) {
   LOG(WARNING) << "Starting to run ReactInstance::registerSegment with segment "
                << segmentId;
+  auto sourceURL = JSExecutor::getSyntheticBundlePath(segmentId, segmentPath);
+  // With the prepared script cache, the segment source is only read when it
+  // has not been compiled by an earlier launch, and off the JS thread.
+  PreparedScriptCache::PreparedScript preparedScript;
+  if (preparedScriptCache_) {
+    preparedScript =
+        preparedScriptCache_->prepareScriptFromFile(segmentPath, sourceURL);
+  }
   runtimeScheduler_->scheduleWork([=](jsi::Runtime& runtime) {
     TraceSection s("ReactInstance::registerSegment");
     auto tag = std::to_string(segmentId);
-    auto script = JSBigFileString::fromPath(segmentPath);
-    if (script->size() == 0) {
+    std::shared_ptr<const jsi::Buffer> buffer = preparedScript.valid()
+        ? preparedScript.get()
+        : std::make_shared<BigStringBuffer>(
+              JSBigFileString::fromPath(segmentPath));
+    if (buffer->size() == 0) {
       throw std::invalid_argument(
           "Empty segment registered with ID " + tag + " from " + segmentPath);
     }
-    auto buffer = std::make_shared<BigStringBuffer>(std::move(script));
 
     bool hasLogger(ReactMarker::logTaggedMarkerBridgelessImpl);
     if (hasLogger) {
@@ -351,8 +369,7 @@ void ReactInstance::registerSegment(
     }
     LOG(WARNING) << "Starting to evaluate segment " << segmentId
                  << " in ReactInstance::registerSegment";
-    runtime.evaluateJavaScript(
-        buffer, JSExecutor::getSyntheticBundlePath(segmentId, segmentPath));
+    runtime.evaluateJavaScript(buffer, sourceURL);
     LOG(WARNING) << "Finished evaluating segment " << segmentId
                  << " in ReactInstance::registerSegment";
     if (hasLogger) {
@@ -362,6 +379,17 @@ void ReactInstance::registerSegment(
   });
 }
 
+void ReactInstance::enablePreparedScriptCache(std::string directory) {
+  auto compiler = runtime_->getScriptCompiler();
+  if (!compiler) {
+    return;
+  }
+  preparedScriptCache_ = std::make_shared<PreparedScriptCache>(
+      std::move(directory),
+      runtime_->getCompiledScriptVersion(),
+      std::move(compiler));
+}
+
 namespace {
 void defineReactInstanceFlags(
     jsi::Runtime& runtime,
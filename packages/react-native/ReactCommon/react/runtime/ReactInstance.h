@@ -16,6 +16,7 @@
 #include <react/renderer/runtimescheduler/RuntimeScheduler.h>
 #include <react/runtime/BufferedRuntimeExecutor.h>
 #include <react/runtime/JSRuntimeFactory.h>
+#include <react/runtime/PreparedScriptCache.h>
 #include <react/runtime/TimerManager.h>
 #include <vector>
 
@@ -55,6 +56,14 @@ class ReactInstance final : private jsinspector_modern::InstanceTargetDelegate {
 
   void registerSegment(uint32_t segmentId, const std::string& segmentPath);
 
+  /**
+   * Persists compiled scripts in `directory`, so that later launches evaluate
+   * the bundle and its segments without parsing and compiling them again.
+   * Has no effect if the runtime cannot precompile scripts. Must be called
+   * before `loadScript`.
+   */
+  void enablePreparedScriptCache(std::string directory);
+
   void callFunctionOnModule(
       const std::string& moduleName,
       const std::string& methodName,
@@ -79,6 +88,7 @@ class ReactInstance final : private jsinspector_modern::InstanceTargetDelegate {
       callableModules_;
   std::shared_ptr<RuntimeScheduler> runtimeScheduler_;
   std::shared_ptr<JsErrorHandler> jsErrorHandler_;
+  std::shared_ptr<PreparedScriptCache> preparedScriptCache_;
 
   jsinspector_modern::InstanceTarget* inspectorTarget_{nullptr};
   jsinspector_modern::RuntimeTarget* runtimeInspectorTarget_{nullptr};
@@ -10,13 +10,20 @@
 #include <cxxreact/TraceSection.h>
 #include <react/featureflags/ReactNativeFeatureFlags.h>
 
+#include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <limits>
 #include <utility>
 
 namespace facebook::react {
 
 namespace {
 
+// Longest delay which can be scheduled into the timer wheel (~24.8 days).
+// Browsers clamp delays to a signed 32-bit number of milliseconds as well.
+constexpr double MaxTimerWheelDelay = std::numeric_limits<int32_t>::max();
+
 double coerceNumberTimeout(jsi::Runtime& rt, const jsi::Value& timeout) {
   double delay = 0.0;
 
@@ -62,6 +69,15 @@ void TimerManager::setRuntimeExecutor(
   runtimeExecutor_ = runtimeExecutor;
 }
 
+void TimerManager::enableTimerWheel(std::function<HighResTimeStamp()> now) {
+  now_ = std::move(now);
+  timerWheel_ = std::make_unique<TimerWheel>(now_());
+}
+
+void TimerManager::setTimerSlack(HighResDuration slack) {
+  timerSlack_ = slack;
+}
+
 TimerHandle TimerManager::createReactNativeMicrotask(
     jsi::Function&& callback,
     std::vector<jsi::Value>&& args) {
@@ -121,9 +137,15 @@ TimerHandle TimerManager::createTimer(
           std::move(callback),
           std::move(args),
           /* repeat */ false,
-          source));
+          source,
+          delay));
 
-  platformTimerRegistry_->createTimer(timerID, delay);
+  if (timerWheel_) {
+    scheduleTimer(timerID, delay);
+    updatePlatformTimer();
+  } else {
+    platformTimerRegistry_->createTimer(timerID, delay);
+  }
 
   return timerID;
 }
@@ -149,9 +171,18 @@ TimerHandle TimerManager::createRecurringTimer(
       std::piecewise_construct,
       std::forward_as_tuple(timerID),
       std::forward_as_tuple(
-          std::move(callback), std::move(args), /* repeat */ true, source));
+          std::move(callback),
+          std::move(args),
+          /* repeat */ true,
+          source,
+          delay));
 
-  platformTimerRegistry_->createRecurringTimer(timerID, delay);
+  if (timerWheel_) {
+    scheduleTimer(timerID, delay);
+    updatePlatformTimer();
+  } else {
+    platformTimerRegistry_->createRecurringTimer(timerID, delay);
+  }
 
   return timerID;
 }
@@ -179,7 +210,14 @@ void TimerManager::deleteTimer(jsi::Runtime& runtime, TimerHandle timerHandle) {
     throw jsi::JSError(runtime, "clearTimeout called with an invalid handle");
   }
 
-  platformTimerRegistry_->deleteTimer(timerHandle);
+  if (timerWheel_) {
+    // Re-arms the platform timer if it was armed for this timer
+    if (timerWheel_->cancel(timerHandle)) {
+      updatePlatformTimer();
+    }
+  } else {
+    platformTimerRegistry_->deleteTimer(timerHandle);
+  }
   timers_.erase(timerHandle);
 }
 
@@ -190,11 +228,25 @@ void TimerManager::deleteRecurringTimer(
     throw jsi::JSError(runtime, "clearInterval called with an invalid handle");
   }
 
-  platformTimerRegistry_->deleteTimer(timerHandle);
+  if (timerWheel_) {
+    // Re-arms the platform timer if it was armed for this timer
+    if (timerWheel_->cancel(timerHandle)) {
+      updatePlatformTimer();
+    }
+  } else {
+    platformTimerRegistry_->deleteTimer(timerHandle);
+  }
   timers_.erase(timerHandle);
 }
 
 void TimerManager::callTimer(TimerHandle timerHandle) {
+  if (timerWheel_ &&
+      static_cast<uint32_t>(timerHandle) == TimerWheelPlatformTimerID) {
+    runtimeExecutor_(
+        [this](jsi::Runtime& runtime) { callExpiredTimers(runtime); });
+    return;
+  }
+
   runtimeExecutor_([this, timerHandle](jsi::Runtime& runtime) {
     auto it = timers_.find(timerHandle);
     if (it != timers_.end()) {
@@ -220,6 +272,107 @@ void TimerManager::callTimer(TimerHandle timerHandle) {
   });
 }
 
+void TimerManager::scheduleTimer(TimerHandle timerHandle, double delay) {
+  timerWheel_->schedule(
+      timerHandle,
+      now_() +
+          HighResDuration::fromDOMHighResTimeStamp(
+              std::min(delay, MaxTimerWheelDelay)));
+}
+
+void TimerManager::callExpiredTimers(jsi::Runtime& runtime) {
+  platformTimerDeadline_.reset();
+  expiredTimers_.clear();
+  timerWheel_->advance(now_(), expiredTimers_);
+
+  TraceSection s(
+      "TimerManager::callExpiredTimers", "count", expiredTimers_.size());
+
+  size_t index = 0;
+  try {
+    for (; index < expiredTimers_.size(); index++) {
+      auto timerHandle = expiredTimers_[index];
+      auto it = timers_.find(timerHandle);
+      if (it == timers_.end()) {
+        continue;
+      }
+
+      auto& timerCallback = it->second;
+      bool repeats = timerCallback.repeat;
+      if (repeats) {
+        // Rescheduled before running, so that the callback can clear it
+        scheduleTimer(timerHandle, timerCallback.delay);
+      }
+
+      {
+        TraceSection s(
+            "TimerManager::callTimer",
+            "id",
+            timerHandle,
+            "type",
+            getTimerSourceName(timerCallback.source));
+        timerCallback.invoke(runtime);
+      }
+
+      if (!repeats) {
+        // Invoking a timer has the potential to delete it. Do not re-use the
+        // existing iterator to erase it from the map.
+        timers_.erase(timerHandle);
+      }
+    }
+  } catch (...) {
+    // The runtime executor reports the error. Timers which expired after the
+    // throwing one still run, on the next hop.
+    if (auto it = timers_.find(expiredTimers_[index]);
+        it != timers_.end() && !it->second.repeat) {
+      timers_.erase(it);
+    }
+    auto now = now_();
+    for (index++; index < expiredTimers_.size(); index++) {
+      timerWheel_->schedule(expiredTimers_[index], now);
+    }
+    updatePlatformTimer();
+    throw;
+  }
+
+  updatePlatformTimer();
+}
+
+void TimerManager::updatePlatformTimer() {
+  auto deadline = timerWheel_->nextDeadline();
+  if (!deadline) {
+    if (platformTimerDeadline_) {
+      platformTimerRegistry_->deleteTimer(TimerWheelPlatformTimerID);
+      platformTimerDeadline_.reset();
+    }
+    return;
+  }
+
+  if (timerSlack_ > HighResDuration::zero()) {
+    // Aligning on multiples of the slack lets deadlines close to each other,
+    // including those of other timer managers, share the same wakeup.
+    auto slack = timerSlack_.toNanoseconds();
+    auto time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    deadline->toChronoSteadyClockTimePoint().time_since_epoch())
+                    .count();
+    auto remainder = time % slack;
+    if (remainder != 0) {
+      *deadline += HighResDuration::fromNanoseconds(slack - remainder);
+    }
+  }
+
+  if (platformTimerDeadline_ == deadline) {
+    return;
+  }
+
+  if (platformTimerDeadline_) {
+    platformTimerRegistry_->deleteTimer(TimerWheelPlatformTimerID);
+  }
+  auto delay = std::max(0.0, (*deadline - now_()).toDOMHighResTimeStamp());
+  platformTimerRegistry_->createTimer(TimerWheelPlatformTimerID, delay);
+  platformTimerDeadline_ = deadline;
+}
+
 void TimerManager::attachGlobals(jsi::Runtime& runtime) {
   // Install host functions for timers.
   // TODO (T45786383): Add missing timer functions from JSTimers
@@ -8,16 +8,20 @@
 #pragma once
 
 #include <ReactCommon/RuntimeExecutor.h>
+#include <react/timing/primitives.h>
 #include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
 #include "PlatformTimerRegistry.h"
+#include "TimerWheel.h"
 
 namespace facebook::react {
 
-using TimerHandle = int;
-
 enum class TimerSource {
   Unknown,
   SetTimeout,
@@ -33,11 +37,13 @@ struct TimerCallback {
       jsi::Function callback,
       std::vector<jsi::Value> args,
       bool repeat,
-      TimerSource source = TimerSource::Unknown)
+      TimerSource source = TimerSource::Unknown,
+      double delay = 0.0)
       : callback_(std::move(callback)),
         args_(std::move(args)),
         repeat(repeat),
-        source(source) {}
+        source(source),
+        delay(delay) {}
 
   void invoke(jsi::Runtime& runtime) {
     callback_.call(runtime, args_.data(), args_.size());
@@ -47,15 +53,44 @@ struct TimerCallback {
   const std::vector<jsi::Value> args_;
   bool repeat;
   TimerSource source;
+  double delay;
 };
 
 class TimerManager {
  public:
+  /*
+   * Id of the platform timer driving the timer wheel. JS timer ids count up
+   * from 1 and cannot reach it.
+   */
+  static constexpr uint32_t TimerWheelPlatformTimerID =
+      std::numeric_limits<uint32_t>::max();
+
   explicit TimerManager(
       std::unique_ptr<PlatformTimerRegistry> platformTimerRegistry) noexcept;
 
   void setRuntimeExecutor(RuntimeExecutor runtimeExecutor) noexcept;
 
+  /*
+   * Drives all JS timers from a timer wheel and a single platform timer armed
+   * for the earliest deadline, instead of one platform timer per JS timer.
+   * Timers expiring by the time the platform timer fires run in one runtime
+   * executor hop, ordered by deadline. Intervals are rescheduled relative to
+   * the time they ran.
+   *
+   * Platforms enable it when creating the timer manager. Must be called
+   * before the first timer is created.
+   */
+  void enableTimerWheel(
+      std::function<HighResTimeStamp()> now = HighResTimeStamp::now);
+
+  /*
+   * Allows the platform timer to fire up to `slack` late so that nearby
+   * deadlines share a wakeup, e.g. for surfaces in the background. Only
+   * applies with the timer wheel enabled. Must be called from the runtime
+   * executor.
+   */
+  void setTimerSlack(HighResDuration slack);
+
   void callReactNativeMicrotasks(jsi::Runtime& runtime);
 
   void callTimer(TimerHandle handle);
@@ -85,6 +120,12 @@ class TimerManager {
 
   void deleteRecurringTimer(jsi::Runtime& runtime, TimerHandle handle);
 
+  void scheduleTimer(TimerHandle handle, double delay);
+
+  void callExpiredTimers(jsi::Runtime& runtime);
+
+  void updatePlatformTimer();
+
   RuntimeExecutor runtimeExecutor_;
   std::unique_ptr<PlatformTimerRegistry> platformTimerRegistry_;
 
@@ -101,6 +142,14 @@ class TimerManager {
   // `queueMicrotask`, `clearImmediate`, and `setImmediate` (which is used by
   // the Promise polyfill) when the JSVM microtask mechanism is not used.
   std::vector<TimerHandle> reactNativeMicrotasksQueue_;
+
+  // Set when the timer wheel is enabled. The platform registry then only
+  // holds a single timer, armed for `platformTimerDeadline_`.
+  std::unique_ptr<TimerWheel> timerWheel_;
+  std::function<HighResTimeStamp()> now_;
+  std::optional<HighResTimeStamp> platformTimerDeadline_;
+  HighResDuration timerSlack_{HighResDuration::zero()};
+  std::vector<TimerHandle> expiredTimers_;
 };
 
 } // namespace facebook::react
@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "TimerWheel.h"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr int64_t kNanosecondsPerTick = 1'000'000;
+
+} // namespace
+
+TimerWheel::TimerWheel(HighResTimeStamp origin) noexcept : origin_(origin) {}
+
+int64_t TimerWheel::toTick(HighResTimeStamp time, bool roundUp) const {
+  auto nanoseconds = (time - origin_).toNanoseconds();
+  if (nanoseconds <= 0) {
+    return 0;
+  }
+  auto tick = nanoseconds / kNanosecondsPerTick;
+  if (roundUp && nanoseconds % kNanosecondsPerTick != 0) {
+    tick++;
+  }
+  return tick;
+}
+
+HighResTimeStamp TimerWheel::fromTick(int64_t tick) const {
+  return origin_ + HighResDuration::fromNanoseconds(tick * kNanosecondsPerTick);
+}
+
+bool TimerWheel::isLive(const Entry& entry) const {
+  auto it = scheduled_.find(entry.handle);
+  return it != scheduled_.end() && it->second.sequence == entry.sequence;
+}
+
+void TimerWheel::schedule(TimerHandle handle, HighResTimeStamp deadline) {
+  auto entry = Entry{
+      .handle = handle,
+      .deadlineTick = toTick(deadline, /* roundUp */ true),
+      .sequence = nextSequence_++};
+  // Any previous entry for this handle becomes stale
+  auto timer =
+      Timer{.sequence = entry.sequence, .deadlineTick = entry.deadlineTick};
+  auto [it, inserted] = scheduled_.try_emplace(handle, timer);
+  if (!inserted) {
+    auto previousDeadlineTick = it->second.deadlineTick;
+    it->second = timer;
+    removeFromEarliest(previousDeadlineTick);
+  }
+  insert(entry);
+
+  if (!earliestTick_ || entry.deadlineTick < *earliestTick_) {
+    earliestTick_ = entry.deadlineTick;
+    earliestCount_ = 1;
+  } else if (entry.deadlineTick == *earliestTick_) {
+    earliestCount_++;
+  }
+}
+
+bool TimerWheel::cancel(TimerHandle handle) {
+  auto it = scheduled_.find(handle);
+  if (it == scheduled_.end()) {
+    return false;
+  }
+  auto deadlineTick = it->second.deadlineTick;
+  scheduled_.erase(it);
+  removeFromEarliest(deadlineTick);
+  return true;
+}
+
+void TimerWheel::removeFromEarliest(int64_t deadlineTick) {
+  if (earliestTick_ && deadlineTick == *earliestTick_ &&
+      --earliestCount_ == 0) {
+    updateEarliest();
+  }
+}
+
+void TimerWheel::insert(const Entry& entry) {
+  auto delta = entry.deadlineTick - currentTick_;
+  if (delta <= 0) {
+    due_.push_back(entry);
+    return;
+  }
+
+  for (size_t level = 0; level < kLevels; level++) {
+    auto shift = kSlotBits * static_cast<int64_t>(level);
+    if (delta < (int64_t{1} << (shift + kSlotBits))) {
+      auto slot = (entry.deadlineTick >> shift) & kSlotMask;
+      levels_[level].slots[slot].push_back(entry);
+      levels_[level].occupiedSlots |= uint64_t{1} << slot;
+      return;
+    }
+  }
+
+  overflow_.push_back(entry);
+}
+
+void TimerWheel::cascade(size_t level) {
+  // Only called when the current tick is a multiple of the level's span
+  auto shift = kSlotBits * static_cast<int64_t>(level);
+  auto slot = (currentTick_ >> shift) & kSlotMask;
+
+  if (slot == 0) {
+    if (level + 1 < kLevels) {
+      cascade(level + 1);
+    } else if (!overflow_.empty()) {
+      cascading_.swap(overflow_);
+      for (const auto& entry : cascading_) {
+        if (isLive(entry)) {
+          insert(entry);
+        }
+      }
+      cascading_.clear();
+    }
+  }
+
+  auto& entries = levels_[level].slots[slot];
+  if (entries.empty()) {
+    return;
+  }
+  cascading_.swap(entries);
+  levels_[level].occupiedSlots &= ~(uint64_t{1} << slot);
+  for (const auto& entry : cascading_) {
+    if (isLive(entry)) {
+      insert(entry);
+    }
+  }
+  cascading_.clear();
+}
+
+void TimerWheel::expire(std::vector<Entry>& entries) {
+  for (const auto& entry : entries) {
+    if (isLive(entry)) {
+      expired_.push_back(entry);
+    }
+  }
+  entries.clear();
+}
+
+void TimerWheel::clear() {
+  for (auto& level : levels_) {
+    while (level.occupiedSlots != 0) {
+      auto slot = std::countr_zero(level.occupiedSlots);
+      level.slots[slot].clear();
+      level.occupiedSlots &= level.occupiedSlots - 1;
+    }
+  }
+  overflow_.clear();
+  due_.clear();
+}
+
+int64_t TimerWheel::nextEventTick() const {
+  // The earliest tick at which a bucket is reached: either an occupied slot
+  // later in the current rotation of a level, or the end of that rotation
+  // when the level only has slots for the next one. Jumping straight there
+  // keeps advancing over long idle periods cheap.
+  auto nextTick = std::numeric_limits<int64_t>::max();
+  for (size_t level = 0; level < kLevels; level++) {
+    auto shift = kSlotBits * static_cast<int64_t>(level);
+    auto occupiedSlots = levels_[level].occupiedSlots;
+    if (occupiedSlots == 0) {
+      continue;
+    }
+    auto slot = (currentTick_ >> shift) & kSlotMask;
+    auto rotationStart = (currentTick_ >> (shift + kSlotBits))
+        << (shift + kSlotBits);
+    auto slotsAhead =
+        slot == kSlotMask ? uint64_t{0} : occupiedSlots >> (slot + 1);
+    auto tick = slotsAhead != 0
+        ? rotationStart + ((slot + 1 + std::countr_zero(slotsAhead)) << shift)
+        : rotationStart + (kSlotsPerLevel << shift);
+    nextTick = std::min(nextTick, tick);
+  }
+  if (!overflow_.empty()) {
+    auto span = int64_t{1} << (kSlotBits * static_cast<int64_t>(kLevels));
+    nextTick = std::min(nextTick, (currentTick_ / span + 1) * span);
+  }
+  return nextTick;
+}
+
+void TimerWheel::advance(
+    HighResTimeStamp now,
+    std::vector<TimerHandle>& expired) {
+  auto targetTick = toTick(now, /* roundUp */ false);
+  expire(due_);
+
+  while (currentTick_ < targetTick) {
+    if (scheduled_.empty()) {
+      // Only cancelled entries are left; skip straight to the target
+      clear();
+      currentTick_ = targetTick;
+      break;
+    }
+
+    auto nextTick = nextEventTick();
+    if (nextTick > targetTick) {
+      currentTick_ = targetTick;
+      break;
+    }
+
+    currentTick_ = nextTick;
+    if ((currentTick_ & kSlotMask) == 0) {
+      // Cascades every level whose bucket boundary was reached
+      cascade(1);
+    }
+
+    auto currentSlot = currentTick_ & kSlotMask;
+    expire(levels_[0].slots[currentSlot]);
+    levels_[0].occupiedSlots &= ~(uint64_t{1} << currentSlot);
+    expire(due_);
+  }
+
+  std::stable_sort(
+      expired_.begin(), expired_.end(), [](const Entry& a, const Entry& b) {
+        return a.deadlineTick != b.deadlineTick
+            ? a.deadlineTick < b.deadlineTick
+            : a.sequence < b.sequence;
+      });
+  for (const auto& entry : expired_) {
+    scheduled_.erase(entry.handle);
+    expired.push_back(entry.handle);
+  }
+  if (!expired_.empty()) {
+    // The timers of the earliest deadline are among the expired ones
+    updateEarliest();
+  }
+  expired_.clear();
+}
+
+std::optional<int64_t> TimerWheel::earliestLiveTick(
+    const std::vector<Entry>& entries) const {
+  std::optional<int64_t> earliest;
+  for (const auto& entry : entries) {
+    if ((!earliest || entry.deadlineTick < *earliest) && isLive(entry)) {
+      earliest = entry.deadlineTick;
+    }
+  }
+  return earliest;
+}
+
+std::optional<int64_t> TimerWheel::earliestLiveTick(
+    size_t level,
+    int64_t fromSlot) const {
+  // Slots are visited in the order the wheel reaches them, so the first slot
+  // with a live entry holds the earliest deadlines of this level.
+  for (int64_t i = 0; i < kSlotsPerLevel; i++) {
+    auto slot = (fromSlot + i) & kSlotMask;
+    if ((levels_[level].occupiedSlots & (uint64_t{1} << slot)) == 0) {
+      continue;
+    }
+    if (auto tick = earliestLiveTick(levels_[level].slots[slot])) {
+      return tick;
+    }
+  }
+  return std::nullopt;
+}
+
+void TimerWheel::updateEarliest() {
+  earliestTick_ = std::nullopt;
+  earliestCount_ = 0;
+  if (scheduled_.empty()) {
+    return;
+  }
+
+  // Timers which are due are earlier than any in the wheel
+  auto earliest = earliestLiveTick(due_);
+  if (!earliest) {
+    // Entries of the first level within the current 64 ticks are earlier
+    // than anything in the upper levels, which only cascade at the next
+    // boundary.
+    earliest = earliestLiveTick(/* level */ 0, (currentTick_ & kSlotMask) + 1);
+    if (!earliest || *earliest > (currentTick_ | kSlotMask)) {
+      for (size_t level = 1; level < kLevels; level++) {
+        auto shift = kSlotBits * static_cast<int64_t>(level);
+        auto tick =
+            earliestLiveTick(level, ((currentTick_ >> shift) & kSlotMask) + 1);
+        if (tick && (!earliest || *tick < *earliest)) {
+          earliest = tick;
+        }
+      }
+      if (auto tick = earliestLiveTick(overflow_);
+          tick && (!earliest || *tick < *earliest)) {
+        earliest = tick;
+      }
+    }
+  }
+
+  if (earliest) {
+    earliestTick_ = earliest;
+    earliestCount_ = countLiveAt(*earliest);
+  }
+}
+
+size_t TimerWheel::countLiveAt(int64_t tick) const {
+  auto countIn = [&](const std::vector<Entry>& entries) {
+    return static_cast<size_t>(
+        std::count_if(entries.begin(), entries.end(), [&](const Entry& entry) {
+          return entry.deadlineTick == tick && isLive(entry);
+        }));
+  };
+
+  if (tick <= currentTick_) {
+    return countIn(due_);
+  }
+  // A deadline maps to a single slot of each level
+  size_t count = countIn(overflow_);
+  for (size_t level = 0; level < kLevels; level++) {
+    auto shift = kSlotBits * static_cast<int64_t>(level);
+    count += countIn(levels_[level].slots[(tick >> shift) & kSlotMask]);
+  }
+  return count;
+}
+
+} // namespace facebook::react
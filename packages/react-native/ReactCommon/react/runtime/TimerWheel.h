@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/timing/primitives.h>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace facebook::react {
+
+using TimerHandle = int;
+
+/*
+ * Hierarchical timer wheel with a resolution of one millisecond.
+ *
+ * Timers are bucketed by deadline into four levels of 64 slots each, covering
+ * 64ms, ~4s, ~4.5min and ~4.6h ahead of the current tick; later deadlines
+ * wait in an overflow list. Buckets of a level are redistributed into the
+ * lower levels when the wheel reaches them, so scheduling and cancelling are
+ * O(1) and advancing costs O(expired timers + visited buckets).
+ *
+ * Cancelled timers are dropped lazily when their bucket is reached.
+ * Deadlines are rounded up to the next millisecond, so timers never expire
+ * early. The earliest deadline is kept up to date as timers are scheduled,
+ * and only searched for again when all the timers which had it are gone, so
+ * that `nextDeadline` is O(1). Not thread-safe.
+ */
+class TimerWheel {
+ public:
+  explicit TimerWheel(HighResTimeStamp origin) noexcept;
+
+  /*
+   * Schedules (or reschedules) `handle` to expire at `deadline`.
+   */
+  void schedule(TimerHandle handle, HighResTimeStamp deadline);
+
+  /*
+   * Returns `false` if `handle` was not scheduled.
+   */
+  bool cancel(TimerHandle handle);
+
+  /*
+   * Moves the wheel forward to `now` and appends the timers which expired to
+   * `expired`, ordered by deadline and then by scheduling order. Expired
+   * timers are no longer scheduled.
+   */
+  void advance(HighResTimeStamp now, std::vector<TimerHandle>& expired);
+
+  /*
+   * Earliest time at which `advance` would expire a timer, or `std::nullopt`
+   * if there are no timers.
+   */
+  std::optional<HighResTimeStamp> nextDeadline() const {
+    if (!earliestTick_) {
+      return std::nullopt;
+    }
+    return fromTick(std::max(*earliestTick_, currentTick_));
+  }
+
+  size_t size() const {
+    return scheduled_.size();
+  }
+
+  bool empty() const {
+    return scheduled_.empty();
+  }
+
+ private:
+  static constexpr size_t kLevels = 4;
+  static constexpr int64_t kSlotBits = 6;
+  static constexpr int64_t kSlotsPerLevel = 1 << kSlotBits;
+  static constexpr int64_t kSlotMask = kSlotsPerLevel - 1;
+
+  struct Entry {
+    TimerHandle handle;
+    int64_t deadlineTick;
+    // Scheduling order; also tells live entries apart from cancelled ones
+    uint64_t sequence;
+  };
+
+  struct Timer {
+    uint64_t sequence;
+    int64_t deadlineTick;
+  };
+
+  struct Level {
+    std::array<std::vector<Entry>, kSlotsPerLevel> slots;
+    // Bit `i` is set when `slots[i]` is not empty
+    uint64_t occupiedSlots{0};
+  };
+
+  int64_t toTick(HighResTimeStamp time, bool roundUp) const;
+  HighResTimeStamp fromTick(int64_t tick) const;
+
+  bool isLive(const Entry& entry) const;
+  void insert(const Entry& entry);
+  void cascade(size_t level);
+  void expire(std::vector<Entry>& entries);
+  void clear();
+  int64_t nextEventTick() const;
+  void removeFromEarliest(int64_t deadlineTick);
+  void updateEarliest();
+  size_t countLiveAt(int64_t tick) const;
+
+  std::optional<int64_t> earliestLiveTick(const std::vector<Entry>& entries)
+      const;
+  std::optional<int64_t> earliestLiveTick(size_t level, int64_t fromSlot)
+      const;
+
+  HighResTimeStamp origin_;
+  int64_t currentTick_{0};
+  uint64_t nextSequence_{0};
+
+  std::array<Level, kLevels> levels_;
+  std::vector<Entry> overflow_;
+  // Timers scheduled at or before the current tick
+  std::vector<Entry> due_;
+
+  // Live entry of every scheduled timer
+  std::unordered_map<TimerHandle, Timer> scheduled_;
+
+  // Earliest deadline of the scheduled timers, and how many timers have it
+  std::optional<int64_t> earliestTick_;
+  size_t earliestCount_{0};
+
+  std::vector<Entry> cascading_;
+  std::vector<Entry> expired_;
+};
+
+} // namespace facebook::react
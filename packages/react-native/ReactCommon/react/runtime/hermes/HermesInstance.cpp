@@ -12,6 +12,11 @@
 #include <jsinspector-modern/InspectorFlags.h>
 #include <react/featureflags/ReactNativeFeatureFlags.h>
 
+#if __has_include(<hermes/CompileJS.h>)
+#include <hermes/CompileJS.h>
+#define REACT_NATIVE_HERMES_COMPILE_JS 1
+#endif
+
 #ifdef HERMES_ENABLE_DEBUGGER
 #include <hermes/inspector-modern/chrome/Registration.h>
 #include <hermes/inspector/RuntimeAdapter.h>
@@ -113,6 +118,33 @@ class HermesJSRuntime : public JSRuntime {
     runtime_->registerForProfiling();
   }
 
+#ifdef REACT_NATIVE_HERMES_COMPILE_JS
+  ScriptCompiler getScriptCompiler() override {
+    return [](const jsi::Buffer& source, const std::string& sourceURL)
+               -> std::shared_ptr<const jsi::Buffer> {
+      std::string bytecode;
+      if (!::hermes::compileJS(
+              std::string(
+                  reinterpret_cast<const char*>(source.data()), source.size()),
+              sourceURL,
+              bytecode,
+              /* optimize */ true)) {
+        return nullptr;
+      }
+      return std::make_shared<jsi::StringBuffer>(std::move(bytecode));
+    };
+  }
+#endif
+
+  std::string getCompiledScriptVersion() override {
+    return "hermes-bytecode-" +
+        std::to_string(HermesRuntime::getBytecodeVersion());
+  }
+
+  bool isCompiledScript(const jsi::Buffer& script) override {
+    return HermesRuntime::isHermesBytecode(script.data(), script.size());
+  }
+
  private:
   std::shared_ptr<HermesRuntime> runtime_;
   std::optional<jsinspector_modern::HermesRuntimeTargetDelegate>
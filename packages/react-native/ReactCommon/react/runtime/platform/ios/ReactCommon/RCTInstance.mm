@@ -279,6 +279,7 @@ void RCTInstanceSetRuntimeDiagnosticFlags(NSString *flags)
   auto *objCTimerRegistryRawPtr = objCTimerRegistry.get();
 
   auto timerManager = std::make_shared<TimerManager>(std::move(objCTimerRegistry));
+  timerManager->enableTimerWheel();
   objCTimerRegistryRawPtr->setTimerManager(timerManager);
 
   __weak __typeof(self) weakSelf = self;
@@ -295,6 +296,17 @@ void RCTInstanceSetRuntimeDiagnosticFlags(NSString *flags)
       _parentInspectorTarget);
   _valid = true;
 
+#if !RCT_DEV
+  // No-op unless the runtime can precompile scripts. Dev bundles change on
+  // every reload, so they would only be compiled and written for nothing.
+  NSString *cachesDirectory =
+      NSSearchPathForDirectoriesInDomains(NSCachesDirectory, NSUserDomainMask, YES).firstObject;
+  if (cachesDirectory) {
+    _reactInstance->enablePreparedScriptCache(
+        [cachesDirectory stringByAppendingPathComponent:@"RCTPreparedScripts"].UTF8String);
+  }
+#endif // !RCT_DEV
+
   RuntimeExecutor bufferedRuntimeExecutor = _reactInstance->getBufferedRuntimeExecutor();
   timerManager->setRuntimeExecutor(bufferedRuntimeExecutor);
 
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <hermes/CompileJS.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/runtime/PreparedScriptCache.h>
+
+#include <filesystem>
+#include <memory>
+#include <string>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr int ModuleCount = 5'000;
+
+const std::string bundleURL = "index.bundle";
+
+// Resembles a Metro bundle: many module factories, a few of them executed
+std::shared_ptr<const jsi::Buffer> makeBundle() {
+  std::string source = "var modules = [];\n";
+  for (int i = 0; i < ModuleCount; i++) {
+    auto id = std::to_string(i);
+    source += "modules.push(function (exports) {\n"
+              "  function helper" +
+        id +
+        "(a, b) { return a.map(function (x) { return x * b + " + id +
+        "; }); }\n"
+        "  exports.value = helper" +
+        id + "([1, 2, 3], " + id + ");\n});\n";
+  }
+  source += "var exports = {};\n"
+            "for (var i = 0; i < modules.length; i += 100) {\n"
+            "  modules[i](exports);\n"
+            "}\n";
+  return std::make_shared<jsi::StringBuffer>(std::move(source));
+}
+
+std::shared_ptr<const jsi::Buffer> compileBundle(
+    const jsi::Buffer& source,
+    const std::string& sourceURL) {
+  std::string bytecode;
+  if (!::hermes::compileJS(
+          std::string(
+              reinterpret_cast<const char*>(source.data()), source.size()),
+          sourceURL,
+          bytecode,
+          /* optimize */ true)) {
+    return nullptr;
+  }
+  return std::make_shared<jsi::StringBuffer>(std::move(bytecode));
+}
+
+std::string cacheDirectory() {
+  return (std::filesystem::temp_directory_path() /
+          "PreparedScriptCacheBenchmark")
+      .string();
+}
+
+/*
+ * `compileInline` fills the cache synchronously; otherwise compilation is
+ * skipped, which leaves the cache cold and keeps the background work out of
+ * the measurement. Lookups run synchronously, which bounds how long the JS
+ * thread waits for the lookup `ReactInstance` starts in the background.
+ */
+std::unique_ptr<PreparedScriptCache> makeCache(bool compileInline) {
+  return std::make_unique<PreparedScriptCache>(
+      cacheDirectory(),
+      "hermes-bytecode-" +
+          std::to_string(hermes::HermesRuntime::getBytecodeVersion()),
+      compileBundle,
+      [compileInline](std::function<void()>&& task) {
+        if (compileInline) {
+          task();
+        }
+      });
+}
+
+void evaluateBundle(
+    benchmark::State& state,
+    PreparedScriptCache& cache,
+    const std::shared_ptr<const jsi::Buffer>& bundle) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto runtime = hermes::makeHermesRuntime();
+    state.ResumeTiming();
+
+    runtime->evaluateJavaScript(
+        cache.getPreparedScript(bundle, bundleURL), bundleURL);
+
+    state.PauseTiming();
+    runtime.reset();
+    state.ResumeTiming();
+  }
+}
+
+void coldStart(benchmark::State& state) {
+  std::filesystem::remove_all(cacheDirectory());
+  auto bundle = makeBundle();
+  auto cache = makeCache(/* compileInline */ false);
+  evaluateBundle(state, *cache, bundle);
+}
+
+void warmStart(benchmark::State& state) {
+  std::filesystem::remove_all(cacheDirectory());
+  auto bundle = makeBundle();
+  auto cache = makeCache(/* compileInline */ true);
+  // The first launch fills the cache
+  cache->getPreparedScript(bundle, bundleURL);
+  evaluateBundle(state, *cache, bundle);
+}
+
+void compileInBackground(benchmark::State& state) {
+  auto bundle = makeBundle();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(compileBundle(*bundle, bundleURL));
+  }
+}
+
+} // namespace
+
+BENCHMARK(coldStart)->Unit(benchmark::kMillisecond);
+BENCHMARK(warmStart)->Unit(benchmark::kMillisecond);
+BENCHMARK(compileInBackground)->Unit(benchmark::kMillisecond);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/runtime/TimerManager.h>
+
+#include <memory>
+#include <set>
+#include <unordered_map>
+#include <utility>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr int TimerCount = 10'000;
+
+// Debouncer-like load: timers spread over one second, several per tick
+const std::string scheduleSpreadTimersScript = R"xyz123(
+var fired = 0;
+for (var i = 0; i < 10000; i++) {
+  setTimeout(function () { fired++; }, (i * 7919) % 1000);
+}
+)xyz123";
+
+// Timers scheduled by a loop with the same delay
+const std::string scheduleSameDelayTimersScript = R"xyz123(
+var fired = 0;
+for (var i = 0; i < 10000; i++) {
+  setTimeout(function () { fired++; }, 100);
+}
+)xyz123";
+
+/*
+ * Records platform timers instead of scheduling them; `fireNext` calls back
+ * into the timer manager the way a platform would once they expire.
+ */
+class FakeTimerRegistry : public PlatformTimerRegistry {
+ public:
+  explicit FakeTimerRegistry(HighResTimeStamp& now) : now_(now) {}
+
+  void createTimer(uint32_t timerID, double delayMS) override {
+    createdTimers++;
+    deleteTimer(timerID);
+    auto deadline = now_ + HighResDuration::fromDOMHighResTimeStamp(delayMS);
+    deadlines_.emplace(timerID, deadline);
+    timers_.emplace(deadline, timerID);
+  }
+
+  void deleteTimer(uint32_t timerID) override {
+    if (auto it = deadlines_.find(timerID); it != deadlines_.end()) {
+      timers_.erase({it->second, timerID});
+      deadlines_.erase(it);
+    }
+  }
+
+  void createRecurringTimer(uint32_t timerID, double delayMS) override {
+    createTimer(timerID, delayMS);
+  }
+
+  bool fireNext(TimerManager& timerManager) {
+    if (timers_.empty()) {
+      return false;
+    }
+    auto [deadline, timerID] = *timers_.begin();
+    timers_.erase(timers_.begin());
+    deadlines_.erase(timerID);
+    now_ = std::max(now_, deadline);
+    timerManager.callTimer(timerID);
+    return true;
+  }
+
+  size_t createdTimers{0};
+
+ private:
+  HighResTimeStamp& now_;
+  std::unordered_map<uint32_t, HighResTimeStamp> deadlines_;
+  std::set<std::pair<HighResTimeStamp, uint32_t>> timers_;
+};
+
+void runTimers(
+    benchmark::State& state,
+    const std::string& script,
+    bool useTimerWheel) {
+  auto runtime = hermes::makeHermesRuntime();
+  auto now = HighResTimeStamp::now();
+  size_t createdTimers = 0;
+  size_t hops = 0;
+
+  for (auto _ : state) {
+    auto registry = std::make_unique<FakeTimerRegistry>(now);
+    auto& fakeRegistry = *registry;
+    TimerManager timerManager(std::move(registry));
+    timerManager.setRuntimeExecutor(
+        [&](std::function<void(jsi::Runtime & rt)>&& callback) {
+          hops++;
+          callback(*runtime);
+        });
+    if (useTimerWheel) {
+      timerManager.enableTimerWheel([&now]() { return now; });
+    }
+    timerManager.attachGlobals(*runtime);
+
+    runtime->evaluateJavaScript(
+        std::make_shared<jsi::StringBuffer>(script), "");
+    while (fakeRegistry.fireNext(timerManager)) {
+    }
+    createdTimers += fakeRegistry.createdTimers;
+
+    auto fired = runtime->global().getProperty(*runtime, "fired").asNumber();
+    if (fired != TimerCount) {
+      state.SkipWithError("Not every timer fired");
+    }
+  }
+
+  state.counters["platformTimers"] = benchmark::Counter(
+      static_cast<double>(createdTimers), benchmark::Counter::kAvgIterations);
+  state.counters["hops"] = benchmark::Counter(
+      static_cast<double>(hops), benchmark::Counter::kAvgIterations);
+}
+
+void platformTimerPerJSTimer(benchmark::State& state) {
+  runTimers(state, scheduleSpreadTimersScript, /* useTimerWheel */ false);
+}
+
+void timerWheel(benchmark::State& state) {
+  runTimers(state, scheduleSpreadTimersScript, /* useTimerWheel */ true);
+}
+
+void platformTimerPerJSTimerSameDelay(benchmark::State& state) {
+  runTimers(state, scheduleSameDelayTimersScript, /* useTimerWheel */ false);
+}
+
+void timerWheelSameDelay(benchmark::State& state) {
+  runTimers(state, scheduleSameDelayTimersScript, /* useTimerWheel */ true);
+}
+
+} // namespace
+
+BENCHMARK(platformTimerPerJSTimer);
+BENCHMARK(timerWheel);
+BENCHMARK(platformTimerPerJSTimerSameDelay);
+BENCHMARK(timerWheelSameDelay);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/runtime/TimerWheel.h>
+
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+/*
+ * TimerManager asks for the next deadline after every change to the wheel,
+ * to re-arm its platform timer; these benchmarks do the same.
+ */
+
+// Timers with the same delay, e.g. scheduled by a loop, then all cancelled
+void scheduleAndCancelSameDelay(benchmark::State& state) {
+  const auto timerCount = static_cast<TimerHandle>(state.range(0));
+  const auto origin = HighResTimeStamp::now();
+  const auto deadline = origin + HighResDuration::fromMilliseconds(100);
+  for (auto _ : state) {
+    TimerWheel wheel(origin);
+    for (TimerHandle handle = 0; handle < timerCount; handle++) {
+      wheel.schedule(handle, deadline);
+      benchmark::DoNotOptimize(wheel.nextDeadline());
+    }
+    for (TimerHandle handle = 0; handle < timerCount; handle++) {
+      wheel.cancel(handle);
+      benchmark::DoNotOptimize(wheel.nextDeadline());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * timerCount);
+}
+
+// Timers with the same delay, expiring together
+void scheduleAndExpireSameDelay(benchmark::State& state) {
+  const auto timerCount = static_cast<TimerHandle>(state.range(0));
+  const auto origin = HighResTimeStamp::now();
+  std::vector<TimerHandle> expired;
+  for (auto _ : state) {
+    TimerWheel wheel(origin);
+    for (TimerHandle handle = 0; handle < timerCount; handle++) {
+      wheel.schedule(handle, origin + HighResDuration::fromMilliseconds(100));
+      benchmark::DoNotOptimize(wheel.nextDeadline());
+    }
+    wheel.advance(origin + HighResDuration::fromMilliseconds(100), expired);
+    benchmark::DoNotOptimize(wheel.nextDeadline());
+    expired.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * timerCount);
+}
+
+// Timers spread over one second, expiring one millisecond at a time
+void scheduleAndExpireSpread(benchmark::State& state) {
+  const auto timerCount = static_cast<TimerHandle>(state.range(0));
+  const auto origin = HighResTimeStamp::now();
+  std::vector<TimerHandle> expired;
+  for (auto _ : state) {
+    TimerWheel wheel(origin);
+    for (TimerHandle handle = 0; handle < timerCount; handle++) {
+      wheel.schedule(
+          handle,
+          origin + HighResDuration::fromMilliseconds((handle * 7919) % 1000));
+      benchmark::DoNotOptimize(wheel.nextDeadline());
+    }
+    while (auto deadline = wheel.nextDeadline()) {
+      wheel.advance(*deadline, expired);
+    }
+    expired.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * timerCount);
+}
+
+} // namespace
+
+BENCHMARK(scheduleAndCancelSameDelay)->Arg(1'000)->Arg(10'000)->Arg(20'000);
+BENCHMARK(scheduleAndExpireSameDelay)->Arg(1'000)->Arg(10'000)->Arg(20'000);
+BENCHMARK(scheduleAndExpireSpread)->Arg(1'000)->Arg(10'000)->Arg(20'000);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/runtime/PreparedScriptCache.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <future>
+
+namespace facebook::react {
+
+namespace {
+
+std::string toString(const jsi::Buffer& buffer) {
+  return {reinterpret_cast<const char*>(buffer.data()), buffer.size()};
+}
+
+std::shared_ptr<const jsi::Buffer> makeBuffer(std::string string) {
+  return std::make_shared<jsi::StringBuffer>(std::move(string));
+}
+
+void writeFile(const std::filesystem::path& path, const std::string& string) {
+  std::ofstream(path, std::ios::binary | std::ios::trunc) << string;
+}
+
+class PreparedScriptCacheTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    directory_ = std::filesystem::temp_directory_path() /
+        ("PreparedScriptCacheTest-" +
+         std::string(::testing::UnitTest::GetInstance()
+                         ->current_test_info()
+                         ->name()));
+    std::filesystem::remove_all(directory_);
+  }
+
+  void TearDown() override {
+    std::filesystem::remove_all(directory_);
+  }
+
+  std::unique_ptr<PreparedScriptCache> makeCache(
+      const std::string& runtimeVersion = "1") {
+    return std::make_unique<PreparedScriptCache>(
+        directory_.string(),
+        runtimeVersion,
+        [this](const jsi::Buffer& source, const std::string& sourceURL)
+            -> std::shared_ptr<const jsi::Buffer> {
+          compilations_++;
+          auto string = toString(source);
+          if (string == "throw") {
+            throw std::runtime_error("Compilation failed");
+          }
+          if (string == "invalid") {
+            return nullptr;
+          }
+          return makeBuffer("compiled(" + sourceURL + ":" + string + ")");
+        },
+        [](std::function<void()>&& task) { task(); });
+  }
+
+  std::filesystem::path directory_;
+  int compilations_{0};
+};
+
+} // namespace
+
+TEST_F(PreparedScriptCacheTest, CompilesOnMissAndLoadsOnHit) {
+  auto source = makeBuffer("source");
+
+  auto cache = makeCache();
+  EXPECT_EQ(cache->getPreparedScript(source, "index.js"), source);
+  EXPECT_EQ(compilations_, 1);
+
+  // Simulate a later launch
+  cache = makeCache();
+  auto prepared = cache->getPreparedScript(source, "index.js");
+  EXPECT_EQ(toString(*prepared), "compiled(index.js:source)");
+  EXPECT_EQ(compilations_, 1);
+}
+
+TEST_F(PreparedScriptCacheTest, InvalidatesChangedSource) {
+  auto cache = makeCache();
+  cache->getPreparedScript(makeBuffer("before"), "index.js");
+
+  auto changed = makeBuffer("after");
+  EXPECT_EQ(cache->getPreparedScript(changed, "index.js"), changed);
+  EXPECT_EQ(
+      toString(*cache->getPreparedScript(changed, "index.js")),
+      "compiled(index.js:after)");
+  EXPECT_EQ(compilations_, 2);
+}
+
+TEST_F(PreparedScriptCacheTest, InvalidatesOtherRuntimeVersions) {
+  auto source = makeBuffer("source");
+  makeCache("1")->getPreparedScript(source, "index.js");
+
+  EXPECT_EQ(makeCache("2")->getPreparedScript(source, "index.js"), source);
+  EXPECT_EQ(compilations_, 2);
+}
+
+TEST_F(PreparedScriptCacheTest, KeepsOneEntryPerSourceURL) {
+  auto cache = makeCache();
+  auto source = makeBuffer("source");
+  cache->getPreparedScript(source, "a.js");
+  cache->getPreparedScript(source, "b.js");
+
+  EXPECT_NE(cache->getEntryPath("a.js"), cache->getEntryPath("b.js"));
+  EXPECT_EQ(
+      toString(*cache->getPreparedScript(source, "a.js")),
+      "compiled(a.js:source)");
+  EXPECT_EQ(
+      toString(*cache->getPreparedScript(source, "b.js")),
+      "compiled(b.js:source)");
+}
+
+TEST_F(PreparedScriptCacheTest, IgnoresCorruptedEntries) {
+  auto cache = makeCache();
+  auto source = makeBuffer("source");
+  cache->getPreparedScript(source, "index.js");
+
+  auto entryPath = cache->getEntryPath("index.js");
+  std::filesystem::resize_file(
+      entryPath, std::filesystem::file_size(entryPath) - 1);
+  EXPECT_EQ(cache->getPreparedScript(source, "index.js"), source);
+
+  writeFile(entryPath, "garbage");
+  EXPECT_EQ(cache->getPreparedScript(source, "index.js"), source);
+}
+
+TEST_F(PreparedScriptCacheTest, DoesNotPersistFailedCompilations) {
+  auto cache = makeCache();
+  for (const auto* string : {"throw", "invalid"}) {
+    auto source = makeBuffer(string);
+    cache->getPreparedScript(source, "index.js");
+    EXPECT_EQ(cache->getPreparedScript(source, "index.js"), source);
+  }
+  EXPECT_FALSE(std::filesystem::exists(cache->getEntryPath("index.js")));
+}
+
+TEST_F(PreparedScriptCacheTest, LoadsFilesOnlyOnMiss) {
+  auto cache = makeCache();
+  auto path = directory_ / "segment.js";
+  writeFile(path, "segment");
+
+  auto source = cache->getPreparedScriptFromFile(path.string(), "seg-1.js");
+  EXPECT_EQ(toString(*source), "segment");
+
+  auto prepared = cache->getPreparedScriptFromFile(path.string(), "seg-1.js");
+  EXPECT_EQ(toString(*prepared), "compiled(seg-1.js:segment)");
+  EXPECT_EQ(compilations_, 1);
+
+  writeFile(path, "changed segment");
+  source = cache->getPreparedScriptFromFile(path.string(), "seg-1.js");
+  EXPECT_EQ(toString(*source), "changed segment");
+  EXPECT_EQ(compilations_, 2);
+}
+
+TEST_F(PreparedScriptCacheTest, PreparesScriptsInBackground) {
+  auto cache = makeCache();
+  auto source = makeBuffer("source");
+  EXPECT_EQ(cache->prepareScript(source, "index.js").get(), source);
+  EXPECT_EQ(
+      toString(*cache->prepareScript(source, "index.js").get()),
+      "compiled(index.js:source)");
+
+  auto path = directory_ / "segment.js";
+  writeFile(path, "segment");
+  cache->prepareScriptFromFile(path.string(), "seg-1.js").get();
+  EXPECT_EQ(
+      toString(*cache->prepareScriptFromFile(path.string(), "seg-1.js").get()),
+      "compiled(seg-1.js:segment)");
+  EXPECT_EQ(compilations_, 2);
+
+  auto missing = cache->prepareScriptFromFile(
+      (directory_ / "missing.js").string(), "missing.js");
+  EXPECT_THROW(missing.get(), std::runtime_error);
+}
+
+class BlockingCompilationTest : public PreparedScriptCacheTest {
+ protected:
+  // Compiles on the threads owned by the cache, once released
+  std::unique_ptr<PreparedScriptCache> makeBlockingCache() {
+    return std::make_unique<PreparedScriptCache>(
+        directory_.string(),
+        "1",
+        [this](const jsi::Buffer& source, const std::string& sourceURL)
+            -> std::shared_ptr<const jsi::Buffer> {
+          compilationStarted_.set_value();
+          released_.wait();
+          return makeBuffer(
+              "compiled(" + sourceURL + ":" + toString(source) + ")");
+        });
+  }
+
+  std::promise<void> compilationStarted_;
+  std::promise<void> compilationReleased_;
+  std::shared_future<void> released_{compilationReleased_.get_future()};
+};
+
+TEST_F(BlockingCompilationTest, LooksUpScriptsDuringCompilation) {
+  auto cache = makeBlockingCache();
+  auto source = makeBuffer("source");
+  EXPECT_EQ(cache->prepareScript(source, "index.js").get(), source);
+  compilationStarted_.get_future().wait();
+
+  auto segment = makeBuffer("segment");
+  auto prepared = cache->prepareScript(segment, "seg-1.js");
+  EXPECT_EQ(
+      prepared.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+  EXPECT_EQ(prepared.get(), segment);
+
+  compilationReleased_.set_value();
+}
+
+TEST_F(BlockingCompilationTest, WaitsForCompilationOnDestruction) {
+  auto cache = makeBlockingCache();
+  auto source = makeBuffer("source");
+  auto entryPath = cache->getEntryPath("index.js");
+  EXPECT_EQ(cache->prepareScript(source, "index.js").get(), source);
+  compilationStarted_.get_future().wait();
+
+  auto destroyed = std::async(std::launch::async, [&cache]() { cache.reset(); });
+  EXPECT_EQ(
+      destroyed.wait_for(std::chrono::milliseconds(50)),
+      std::future_status::timeout);
+
+  // The compilation in progress writes its entry before the cache is gone
+  compilationReleased_.set_value();
+  destroyed.get();
+  EXPECT_TRUE(std::filesystem::exists(entryPath));
+  auto prepared = makeCache()->getPreparedScript(source, "index.js");
+  EXPECT_EQ(toString(*prepared), "compiled(index.js:source)");
+  EXPECT_EQ(compilations_, 0);
+}
+
+TEST_F(PreparedScriptCacheTest, ThrowsForMissingFiles) {
+  auto cache = makeCache();
+  EXPECT_THROW(
+      cache->getPreparedScriptFromFile(
+          (directory_ / "missing.js").string(), "missing.js"),
+      std::runtime_error);
+}
+
+} // namespace facebook::react
@@ -19,6 +19,7 @@
 
 using ::testing::_;
 using ::testing::HasSubstr;
+using ::testing::InSequence;
 using ::testing::SaveArg;
 
 namespace facebook::react {
@@ -636,6 +637,92 @@ function getResult() {
   EXPECT_NO_THROW(clear.call(*runtime_));
 }
 
+TEST_F(ReactInstanceTest, testTimerWheelCoalescesPlatformTimers) {
+  auto now = HighResTimeStamp::now();
+  timerManager_->enableTimerWheel([&now]() { return now; });
+  initializeRuntimeWithScript("");
+
+  // Only the earliest deadline is armed on the platform
+  constexpr auto platformTimerID = TimerManager::TimerWheelPlatformTimerID;
+  EXPECT_CALL(*mockRegistry_, createTimer(platformTimerID, 200));
+  EXPECT_CALL(*mockRegistry_, deleteTimer(platformTimerID));
+  EXPECT_CALL(*mockRegistry_, createTimer(platformTimerID, 100));
+  eval(R"xyz123(
+let calls = [];
+setTimeout(() => calls.push('b'), 200);
+setTimeout(() => calls.push('a'), 100);
+setTimeout(() => calls.push('c'), 200);
+function getResult() {
+  return calls.join();
+}
+  )xyz123");
+
+  // All timers expired by the time the platform timer fires run in one hop
+  now += HighResDuration::fromMilliseconds(200);
+  timerManager_->callTimer(platformTimerID);
+  step();
+  auto result = runtime_->global()
+                    .getPropertyAsFunction(*runtime_, "getResult")
+                    .call(*runtime_);
+  EXPECT_EQ(result.asString(*runtime_).utf8(*runtime_), "a,b,c");
+}
+
+TEST_F(ReactInstanceTest, testTimerWheelReschedulesIntervals) {
+  auto now = HighResTimeStamp::now();
+  timerManager_->enableTimerWheel([&now]() { return now; });
+  initializeRuntimeWithScript("");
+
+  constexpr auto platformTimerID = TimerManager::TimerWheelPlatformTimerID;
+  EXPECT_CALL(*mockRegistry_, createTimer(platformTimerID, 100)).Times(2);
+  eval(R"xyz123(
+let result = 0;
+const handle = setInterval(() => {
+  result++;
+}, 100);
+function clear() {
+  clearInterval(handle);
+}
+function getResult() {
+  return result;
+}
+  )xyz123");
+  auto getResult =
+      runtime_->global().getPropertyAsFunction(*runtime_, "getResult");
+
+  now += HighResDuration::fromMilliseconds(100);
+  timerManager_->callTimer(platformTimerID);
+  step();
+  EXPECT_EQ(getResult.call(*runtime_).asNumber(), 1.0);
+
+  // Clearing the last timer deletes the platform timer
+  EXPECT_CALL(*mockRegistry_, deleteTimer(platformTimerID));
+  runtime_->global().getPropertyAsFunction(*runtime_, "clear").call(*runtime_);
+  EXPECT_EQ(getResult.call(*runtime_).asNumber(), 1.0);
+}
+
+TEST_F(ReactInstanceTest, testTimerWheelRearmsPlatformTimerOnClear) {
+  auto now = HighResTimeStamp::now();
+  timerManager_->enableTimerWheel([&now]() { return now; });
+  initializeRuntimeWithScript("");
+
+  constexpr auto platformTimerID = TimerManager::TimerWheelPlatformTimerID;
+  {
+    InSequence sequence;
+    EXPECT_CALL(*mockRegistry_, createTimer(platformTimerID, 100));
+    EXPECT_CALL(*mockRegistry_, deleteTimer(platformTimerID));
+    EXPECT_CALL(*mockRegistry_, createTimer(platformTimerID, 300));
+  }
+  eval(R"xyz123(
+const first = setTimeout(() => {}, 100);
+setTimeout(() => {}, 300);
+const last = setTimeout(() => {}, 500);
+// Not the earliest timer, the platform timer stays armed
+clearTimeout(last);
+// The earliest timer, the platform timer is armed for the next one
+clearTimeout(first);
+  )xyz123");
+}
+
 TEST_F(ReactInstanceTest, testRegisterCallableModule) {
   initializeRuntimeWithScript(R"xyz123(
 let called = false;
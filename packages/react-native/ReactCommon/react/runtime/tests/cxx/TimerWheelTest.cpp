@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/runtime/TimerWheel.h>
+
+#include <map>
+#include <random>
+
+namespace facebook::react {
+
+namespace {
+
+const auto origin = HighResTimeStamp::now();
+
+HighResTimeStamp at(int64_t milliseconds) {
+  return origin + HighResDuration::fromMilliseconds(milliseconds);
+}
+
+std::vector<TimerHandle> advance(TimerWheel& wheel, int64_t milliseconds) {
+  std::vector<TimerHandle> expired;
+  wheel.advance(at(milliseconds), expired);
+  return expired;
+}
+
+} // namespace
+
+TEST(TimerWheelTest, ExpiresTimersInDeadlineOrder) {
+  TimerWheel wheel(origin);
+  wheel.schedule(1, at(30));
+  wheel.schedule(2, at(10));
+  wheel.schedule(3, at(20));
+  wheel.schedule(4, at(10));
+
+  EXPECT_EQ(advance(wheel, 9), std::vector<TimerHandle>{});
+  EXPECT_EQ(advance(wheel, 25), (std::vector<TimerHandle>{2, 4, 3}));
+  EXPECT_EQ(advance(wheel, 30), std::vector<TimerHandle>{1});
+  EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TimerWheelTest, RoundsDeadlinesUp) {
+  TimerWheel wheel(origin);
+  wheel.schedule(1, at(10) + HighResDuration::fromNanoseconds(1));
+
+  std::vector<TimerHandle> expired;
+  wheel.advance(at(10) + HighResDuration::fromNanoseconds(999'999), expired);
+  EXPECT_TRUE(expired.empty());
+  EXPECT_EQ(advance(wheel, 11), std::vector<TimerHandle>{1});
+}
+
+TEST(TimerWheelTest, ExpiresTimersScheduledInThePast) {
+  TimerWheel wheel(origin);
+  advance(wheel, 100);
+  wheel.schedule(1, at(50));
+  wheel.schedule(2, at(100));
+
+  EXPECT_EQ(wheel.nextDeadline(), at(100));
+  EXPECT_EQ(advance(wheel, 100), (std::vector<TimerHandle>{1, 2}));
+}
+
+TEST(TimerWheelTest, CancelsTimers) {
+  TimerWheel wheel(origin);
+  wheel.schedule(1, at(10));
+  wheel.schedule(2, at(20));
+
+  EXPECT_TRUE(wheel.cancel(1));
+  EXPECT_FALSE(wheel.cancel(1));
+  EXPECT_FALSE(wheel.cancel(3));
+  EXPECT_EQ(wheel.size(), 1);
+  EXPECT_EQ(wheel.nextDeadline(), at(20));
+  EXPECT_EQ(advance(wheel, 30), std::vector<TimerHandle>{2});
+}
+
+TEST(TimerWheelTest, ReschedulesTimers) {
+  TimerWheel wheel(origin);
+  wheel.schedule(1, at(10));
+  wheel.schedule(1, at(5000));
+
+  EXPECT_EQ(wheel.size(), 1);
+  EXPECT_EQ(wheel.nextDeadline(), at(5000));
+  EXPECT_EQ(advance(wheel, 4999), std::vector<TimerHandle>{});
+  EXPECT_EQ(advance(wheel, 5000), std::vector<TimerHandle>{1});
+}
+
+TEST(TimerWheelTest, TracksEarliestDeadline) {
+  TimerWheel wheel(origin);
+  wheel.schedule(1, at(10));
+  wheel.schedule(2, at(10));
+  wheel.schedule(3, at(10));
+  wheel.schedule(4, at(20));
+  EXPECT_EQ(wheel.nextDeadline(), at(10));
+
+  wheel.cancel(1);
+  wheel.schedule(2, at(40));
+  EXPECT_EQ(wheel.nextDeadline(), at(10));
+  wheel.cancel(3);
+  EXPECT_EQ(wheel.nextDeadline(), at(20));
+
+  wheel.schedule(4, at(5));
+  EXPECT_EQ(wheel.nextDeadline(), at(5));
+  wheel.schedule(4, at(30));
+  EXPECT_EQ(wheel.nextDeadline(), at(30));
+
+  EXPECT_EQ(advance(wheel, 30), std::vector<TimerHandle>{4});
+  EXPECT_EQ(wheel.nextDeadline(), at(40));
+  EXPECT_EQ(advance(wheel, 40), std::vector<TimerHandle>{2});
+  EXPECT_EQ(wheel.nextDeadline(), std::nullopt);
+}
+
+TEST(TimerWheelTest, CascadesLongDelays) {
+  TimerWheel wheel(origin);
+  wheel.schedule(1, at(100));
+  wheel.schedule(2, at(5'000));
+  wheel.schedule(3, at(300'000));
+  wheel.schedule(4, at(20'000'000));
+  wheel.schedule(5, at(100'000'000));
+
+  EXPECT_EQ(wheel.nextDeadline(), at(100));
+  EXPECT_EQ(advance(wheel, 100), std::vector<TimerHandle>{1});
+  EXPECT_EQ(wheel.nextDeadline(), at(5'000));
+  EXPECT_EQ(advance(wheel, 4'999), std::vector<TimerHandle>{});
+  EXPECT_EQ(advance(wheel, 5'000), std::vector<TimerHandle>{2});
+  EXPECT_EQ(wheel.nextDeadline(), at(300'000));
+  EXPECT_EQ(advance(wheel, 300'000), std::vector<TimerHandle>{3});
+  EXPECT_EQ(wheel.nextDeadline(), at(20'000'000));
+  EXPECT_EQ(advance(wheel, 20'000'000), std::vector<TimerHandle>{4});
+  EXPECT_EQ(wheel.nextDeadline(), at(100'000'000));
+  EXPECT_EQ(advance(wheel, 99'999'999), std::vector<TimerHandle>{});
+  EXPECT_EQ(advance(wheel, 100'000'000), std::vector<TimerHandle>{5});
+  EXPECT_EQ(wheel.nextDeadline(), std::nullopt);
+}
+
+TEST(TimerWheelTest, MatchesSortedReference) {
+  std::mt19937 random(42);
+  // Spread delays and steps over every level of the wheel
+  std::uniform_int_distribution<int> magnitudes(0, 26);
+  auto delay = [&](int64_t minimum) {
+    auto magnitude = int64_t{1} << magnitudes(random);
+    return std::uniform_int_distribution<int64_t>(minimum, magnitude)(random);
+  };
+  std::uniform_int_distribution<int> actions(0, 3);
+
+  TimerWheel wheel(origin);
+  // (deadline, scheduling order) => handle
+  std::map<std::pair<int64_t, int>, TimerHandle> reference;
+  std::unordered_map<TimerHandle, std::pair<int64_t, int>> keys;
+  int64_t now = 0;
+  int order = 0;
+
+  for (TimerHandle handle = 0; handle < 5'000; handle++) {
+    auto deadline = now + delay(0);
+    wheel.schedule(handle, at(deadline));
+    reference[{deadline, order}] = handle;
+    keys[handle] = {deadline, order++};
+
+    if (actions(random) == 0 && !keys.empty()) {
+      auto cancelled = keys.begin()->first;
+      EXPECT_TRUE(wheel.cancel(cancelled));
+      reference.erase(keys[cancelled]);
+      keys.erase(cancelled);
+    }
+
+    auto next = reference.empty()
+        ? std::nullopt
+        : std::optional{at(reference.begin()->first.first)};
+    EXPECT_EQ(wheel.nextDeadline(), next);
+
+    if (actions(random) == 0) {
+      now += delay(1);
+      std::vector<TimerHandle> expected;
+      while (!reference.empty() && reference.begin()->first.first <= now) {
+        expected.push_back(reference.begin()->second);
+        keys.erase(reference.begin()->second);
+        reference.erase(reference.begin());
+      }
+      EXPECT_EQ(advance(wheel, now), expected);
+      EXPECT_EQ(wheel.size(), reference.size());
+    }
+  }
+}
+
+} // namespace facebook::react
@@ -18,6 +18,10 @@ static constexpr double FRAME_STATS_LOGGING_INTERVAL_MS = 1000.0;
 static constexpr int FRAME_STATS_SERIES_CAPACITY = 256;
 
 struct FrameStatsLogger {
+  FrameStatsLogger() {
+    frameTimeSeries.setWindowDuration(FRAME_STATS_LOGGING_INTERVAL_MS);
+  }
+
   bool enablePrinting{false};
   double lastLoggedTimeMs{0.0};
   TimeSeries frameTimeSeries{FRAME_STATS_SERIES_CAPACITY};
@@ -42,19 +46,19 @@ void logFrameStats(double timeStampMs, double durationMs) {
   if (logger.enablePrinting &&
       timeStampMs >=
           logger.lastLoggedTimeMs + FRAME_STATS_LOGGING_INTERVAL_MS) {
+    // The window of the series is the last logging interval, whose
+    // statistics are maintained as frames are logged
     const auto& timeSeries = logger.frameTimeSeries;
-    const auto startTime = timeStampMs - FRAME_STATS_LOGGING_INTERVAL_MS;
-    const auto endTime = timeStampMs;
 
-    const int fps = timeSeries.getCount(startTime, endTime) * 1000.0 /
+    const int fps = timeSeries.getWindowCount() * 1000.0 /
         FRAME_STATS_LOGGING_INTERVAL_MS;
 
-    const auto frameTimeAvg = timeSeries.getAverage(startTime, endTime);
-    const auto frameTimeMax = timeSeries.getMax(startTime, endTime);
-    const auto frameTimeMin = timeSeries.getMin(startTime, endTime);
-    const auto frameTimeP50 = timeSeries.getPercentile(50, startTime, endTime);
-    const auto frameTimeP75 = timeSeries.getPercentile(75, startTime, endTime);
-    const auto frameTimeP95 = timeSeries.getPercentile(95, startTime, endTime);
+    const auto frameTimeAvg = timeSeries.getWindowAverage();
+    const auto frameTimeMax = timeSeries.getWindowMax();
+    const auto frameTimeMin = timeSeries.getWindowMin();
+    const auto frameTimeP50 = timeSeries.getWindowPercentile(50);
+    const auto frameTimeP75 = timeSeries.getWindowPercentile(75);
+    const auto frameTimeP95 = timeSeries.getWindowPercentile(95);
 
     LOG(INFO) << std::fixed << std::setprecision(2) << std::setfill(' ')
               << std::left << "[FRAME STATS] FPS=" << std::setw(2) << fps
@@ -9,6 +9,7 @@
 
 #include <chrono>
 
+#include "FrameTimeline.h"
 #include "perfetto.h"
 
 #define RENDER_FRAME_EVENT()      \
@@ -34,9 +35,12 @@ inline double getTimeStampMs() {
 
 class FrameStatsBlock {
  public:
-  FrameStatsBlock() : startTimeStamp_(getTimeStampMs()) {}
+  FrameStatsBlock() : startTimeStamp_(getTimeStampMs()) {
+    getFrameTimeline().beginFrame();
+  }
 
   ~FrameStatsBlock() {
+    getFrameTimeline().endFrame();
     logFrameStats(startTimeStamp_, getTimeStampMs() - startTimeStamp_);
   }
 
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "FrameTimeline.h"
+#include "perfetto.h"
+
+#include <react/renderer/telemetry/TransactionTelemetry.h>
+
+#include <algorithm>
+
+namespace facebook::react {
+
+namespace {
+
+#if WITH_PERFETTO
+// Arbitrary, but stable across runs so that tracks can be found in traces
+constexpr uint64_t FRAME_TRACK_UUID = 0x52'4e'46'54'00'00'00'00;
+
+perfetto::Track getFrameTrack() {
+  return perfetto::Track(FRAME_TRACK_UUID);
+}
+
+perfetto::Track getPhaseTrack(FrameTimeline::Phase phase) {
+  return perfetto::Track(FRAME_TRACK_UUID + 1 + static_cast<uint64_t>(phase));
+}
+
+uint64_t toPerfettoTimestamp(TelemetryTimePoint timePoint) {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          timePoint.time_since_epoch())
+          .count());
+}
+#endif // WITH_PERFETTO
+
+} // namespace
+
+std::optional<FrameTimeline::Phase> FrameTimeline::Frame::getDominantPhase()
+    const {
+  const auto it =
+      std::max_element(phaseDurations.begin(), phaseDurations.end());
+  if (*it <= TelemetryDuration::zero()) {
+    return std::nullopt;
+  }
+  return static_cast<Phase>(it - phaseDurations.begin());
+}
+
+/* static */ const char* FrameTimeline::getPhaseName(Phase phase) {
+  switch (phase) {
+    case Phase::JSTask:
+      return "jsTask";
+    case Phase::Commit:
+      return "commit";
+    case Phase::Layout:
+      return "layout";
+    case Phase::Diff:
+      return "diff";
+    case Phase::Mount:
+      return "mount";
+    case Phase::AnimationTick:
+      return "animationTick";
+  }
+  return "unknown";
+}
+
+FrameTimeline::FrameTimeline(int capacity)
+    : frames_(static_cast<size_t>(std::max(capacity, 1))) {}
+
+void FrameTimeline::beginFrame(TelemetryTimePoint vsyncTime) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (currentFrameDepth_++ > 0) {
+    return;
+  }
+  currentFrame_ = Frame{};
+  currentFrame_.startTime = vsyncTime;
+  currentFrame_.phaseDurations = pendingPhaseDurations_;
+  pendingPhaseDurations_ = {};
+}
+
+void FrameTimeline::endFrame(TelemetryTimePoint endTime) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (currentFrameDepth_ == 0 || --currentFrameDepth_ > 0) {
+    return;
+  }
+  currentFrame_.number = numberOfFrames_;
+  currentFrame_.endTime = std::max(endTime, currentFrame_.startTime);
+  frames_[numberOfFrames_ % frames_.size()] = currentFrame_;
+  numberOfFrames_++;
+
+#if WITH_PERFETTO
+  const auto dominantPhase = currentFrame_.getDominantPhase();
+  TRACE_EVENT_BEGIN(
+      "rncxx",
+      "FrameTimeline::frame",
+      getFrameTrack(),
+      toPerfettoTimestamp(currentFrame_.startTime),
+      "number",
+      currentFrame_.number,
+      "dominantPhase",
+      dominantPhase ? getPhaseName(*dominantPhase) : "none");
+  TRACE_EVENT_END(
+      "rncxx", getFrameTrack(), toPerfettoTimestamp(currentFrame_.endTime));
+#endif // WITH_PERFETTO
+}
+
+void FrameTimeline::recordPhase(
+    Phase phase,
+    TelemetryTimePoint startTime,
+    TelemetryTimePoint endTime) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  recordPhaseLocked(phase, startTime, endTime);
+}
+
+void FrameTimeline::recordTransaction(const TransactionTelemetry& telemetry) {
+  const auto layoutStartTime = telemetry.getLayoutStartTime();
+  const auto layoutEndTime = telemetry.getLayoutEndTime();
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  recordPhaseLocked(
+      Phase::Commit, telemetry.getCommitStartTime(), layoutStartTime);
+  recordPhaseLocked(Phase::Layout, layoutStartTime, layoutEndTime);
+  recordPhaseLocked(Phase::Commit, layoutEndTime, telemetry.getCommitEndTime());
+  recordPhaseLocked(
+      Phase::Diff, telemetry.getDiffStartTime(), telemetry.getDiffEndTime());
+  recordPhaseLocked(
+      Phase::Mount, telemetry.getMountStartTime(), telemetry.getMountEndTime());
+}
+
+std::vector<FrameTimeline::Frame> FrameTimeline::getFrames() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto capacity = static_cast<uint64_t>(frames_.size());
+  const auto count = std::min(numberOfFrames_, capacity);
+  std::vector<Frame> frames;
+  frames.reserve(count);
+  for (auto number = numberOfFrames_ - count; number < numberOfFrames_;
+       number++) {
+    frames.push_back(frames_[number % capacity]);
+  }
+  return frames;
+}
+
+std::vector<FrameTimeline::Frame> FrameTimeline::getSlowestFrames(
+    size_t count) const {
+  auto frames = getFrames();
+  count = std::min(count, frames.size());
+  std::partial_sort(
+      frames.begin(),
+      frames.begin() + count,
+      frames.end(),
+      [](const Frame& lhs, const Frame& rhs) {
+        return lhs.getDuration() > rhs.getDuration();
+      });
+  frames.resize(count);
+  return frames;
+}
+
+void FrameTimeline::reset() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::fill(frames_.begin(), frames_.end(), Frame{});
+  numberOfFrames_ = 0;
+  currentFrame_ = Frame{};
+  currentFrameDepth_ = 0;
+  pendingPhaseDurations_ = {};
+}
+
+void FrameTimeline::recordPhaseLocked(
+    Phase phase,
+    TelemetryTimePoint startTime,
+    TelemetryTimePoint endTime) {
+  if (endTime <= startTime) {
+    return;
+  }
+  const auto index = static_cast<size_t>(phase);
+  const auto capacity = static_cast<uint64_t>(frames_.size());
+
+  // The part after the last ended frame delays the frame in progress, or the
+  // next one
+  const auto lastEndTime = numberOfFrames_ > 0
+      ? frames_[(numberOfFrames_ - 1) % capacity].endTime
+      : TelemetryTimePoint::min();
+  const auto pendingStartTime = std::max(startTime, lastEndTime);
+  if (endTime > pendingStartTime) {
+    auto& phaseDurations = currentFrameDepth_ > 0
+        ? currentFrame_.phaseDurations
+        : pendingPhaseDurations_;
+    phaseDurations[index] += endTime - pendingStartTime;
+  }
+
+  // Earlier parts go to the ended frames they delayed, from the latest, as
+  // long as they are kept
+  auto remainingEndTime = std::min(endTime, lastEndTime);
+  const auto keptCount = std::min(numberOfFrames_, capacity);
+  for (uint64_t i = 0; i < keptCount && remainingEndTime > startTime; i++) {
+    const auto number = numberOfFrames_ - 1 - i;
+    auto& frame = frames_[number % capacity];
+    TelemetryTimePoint previousEndTime;
+    if (number == 0) {
+      previousEndTime = TelemetryTimePoint::min();
+    } else if (i + 1 < keptCount) {
+      previousEndTime = frames_[(number - 1) % capacity].endTime;
+    } else {
+      // The previous frame is no longer kept
+      previousEndTime = frame.startTime;
+    }
+    const auto frameStartTime = std::max(startTime, previousEndTime);
+    if (remainingEndTime > frameStartTime) {
+      frame.phaseDurations[index] += remainingEndTime - frameStartTime;
+    }
+    remainingEndTime = std::min(remainingEndTime, previousEndTime);
+  }
+
+#if WITH_PERFETTO
+  TRACE_EVENT_BEGIN(
+      "rncxx",
+      perfetto::StaticString{getPhaseName(phase)},
+      getPhaseTrack(phase),
+      toPerfettoTimestamp(startTime));
+  TRACE_EVENT_END("rncxx", getPhaseTrack(phase), toPerfettoTimestamp(endTime));
+#endif // WITH_PERFETTO
+}
+
+FrameTimeline& getFrameTimeline() {
+  static FrameTimeline s_FrameTimeline;
+  return s_FrameTimeline;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include <react/utils/Telemetry.h>
+
+namespace facebook::react {
+
+class TransactionTelemetry;
+
+/*
+ * A timeline of the last frames, which records for each one the time spent
+ * in the phases of the pipeline (JS task, commit, layout, diff, mount,
+ * animation tick) since the previous one, so that a slow frame can be
+ * correlated with the work which delayed it.
+ *
+ * A frame starts at its vsync (`beginFrame`) and ends when it was processed
+ * (`endFrame`). Phases are attributed by their start and end times: each
+ * frame is charged with the part of a phase which ran after the end of the
+ * previous frame and before its own end. A phase recorded late (e.g. a commit
+ * recorded after its mount) still counts against the frames it delayed, and
+ * one which spans several frames is split between them.
+ * Frames are kept in a ring buffer allocated upfront, so recording does not
+ * allocate. Recording can be done on any thread.
+ *
+ * When built with Perfetto, frames and phases are emitted as track events as
+ * well, with their actual times.
+ */
+class FrameTimeline {
+ public:
+  static constexpr int DEFAULT_CAPACITY = 256;
+
+  enum class Phase : uint8_t {
+    // A task run on the JS thread, including the commits it makes
+    JSTask,
+    Commit,
+    Layout,
+    Diff,
+    Mount,
+    AnimationTick,
+  };
+  static constexpr size_t PHASE_COUNT = 6;
+
+  struct Frame {
+    // Number of the frame since the timeline was created, from 0
+    uint64_t number{0};
+    TelemetryTimePoint startTime{};
+    TelemetryTimePoint endTime{};
+    std::array<TelemetryDuration, PHASE_COUNT> phaseDurations{};
+
+    TelemetryDuration getDuration() const {
+      return endTime - startTime;
+    }
+
+    TelemetryDuration getPhaseDuration(Phase phase) const {
+      return phaseDurations[static_cast<size_t>(phase)];
+    }
+
+    /*
+     * The phase which took the most time, or nothing if none was recorded.
+     */
+    std::optional<Phase> getDominantPhase() const;
+  };
+
+  static const char* getPhaseName(Phase phase);
+
+  explicit FrameTimeline(int capacity = DEFAULT_CAPACITY);
+
+  int getCapacity() const {
+    return static_cast<int>(frames_.size());
+  }
+
+  void beginFrame(TelemetryTimePoint vsyncTime = telemetryTimePointNow());
+  void endFrame(TelemetryTimePoint endTime = telemetryTimePointNow());
+
+  void recordPhase(
+      Phase phase,
+      TelemetryTimePoint startTime,
+      TelemetryTimePoint endTime);
+
+  /*
+   * Records the commit, layout, diff and mount of a mounted transaction. The
+   * commit excludes its layout, so that phases do not overlap.
+   */
+  void recordTransaction(const TransactionTelemetry& telemetry);
+
+  /*
+   * The ended frames which are kept, from the oldest to the latest.
+   */
+  std::vector<Frame> getFrames() const;
+
+  /*
+   * The `count` longest ended frames which are kept, from the longest.
+   */
+  std::vector<Frame> getSlowestFrames(size_t count) const;
+
+  void reset();
+
+ private:
+  mutable std::mutex mutex_;
+
+  // Ended frames, the latest one at `(numberOfFrames_ - 1) % capacity`
+  std::vector<Frame> frames_;
+  uint64_t numberOfFrames_{0};
+
+  // The frame in progress, and how many times it was begun, since frame
+  // blocks may be nested
+  Frame currentFrame_{};
+  int currentFrameDepth_{0};
+
+  // Phases which ran after the last frame ended, before the next one began
+  std::array<TelemetryDuration, PHASE_COUNT> pendingPhaseDurations_{};
+
+  void recordPhaseLocked(
+      Phase phase,
+      TelemetryTimePoint startTime,
+      TelemetryTimePoint endTime);
+};
+
+/*
+ * The timeline of the frames of the app.
+ */
+FrameTimeline& getFrameTimeline();
+
+/*
+ * Records the phase for the duration of the block.
+ */
+class FrameTimelinePhaseBlock {
+ public:
+  explicit FrameTimelinePhaseBlock(FrameTimeline::Phase phase)
+      : phase_(phase), startTime_(telemetryTimePointNow()) {}
+
+  ~FrameTimelinePhaseBlock() {
+    getFrameTimeline().recordPhase(
+        phase_, startTime_, telemetryTimePointNow());
+  }
+
+ private:
+  FrameTimeline::Phase phase_;
+  TelemetryTimePoint startTime_;
+};
+
+} // namespace facebook::react
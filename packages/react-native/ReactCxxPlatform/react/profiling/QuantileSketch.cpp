@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "QuantileSketch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace facebook::react {
+
+void QuantileSketch::Store::add(
+    int index,
+    uint64_t count,
+    int maxBucketCount) {
+  index = std::max(index, collapsedIndex);
+  if (counts.empty()) {
+    minIndex = index;
+    counts.push_back(0);
+  }
+
+  const int maxIndex = minIndex + static_cast<int>(counts.size()) - 1;
+  if (index < minIndex) {
+    // Values below the range which can be kept go to its lowest bucket
+    const int newMinIndex = std::max(index, maxIndex - maxBucketCount + 1);
+    counts.insert(counts.begin(), minIndex - newMinIndex, 0);
+    minIndex = newMinIndex;
+    if (index < minIndex) {
+      collapsedIndex = minIndex;
+      index = minIndex;
+    }
+  } else if (index > maxIndex) {
+    const int newMinIndex = index - maxBucketCount + 1;
+    if (newMinIndex > minIndex) {
+      // Collapse the lowest buckets into the lowest one which is kept
+      const auto collapsedSize = std::min(
+          static_cast<size_t>(newMinIndex - minIndex), counts.size());
+      const auto collapsedCount = std::accumulate(
+          counts.begin(), counts.begin() + collapsedSize, uint64_t{0});
+      counts.erase(counts.begin(), counts.begin() + collapsedSize);
+      if (counts.empty()) {
+        counts.push_back(0);
+      }
+      minIndex = newMinIndex;
+      collapsedIndex = newMinIndex;
+      counts[0] += collapsedCount;
+    }
+    counts.resize(index - minIndex + 1, 0);
+  }
+  counts[index - minIndex] += count;
+  totalCount += count;
+}
+
+bool QuantileSketch::Store::remove(int index) {
+  // Same as in add(): values of collapsed buckets were counted in the bucket
+  // they were collapsed into
+  index = std::max(index, collapsedIndex);
+  if (index < minIndex ||
+      index >= minIndex + static_cast<int>(counts.size()) ||
+      counts[index - minIndex] == 0) {
+    return false;
+  }
+  counts[index - minIndex]--;
+  totalCount--;
+  if (totalCount == 0) {
+    // Start over from the next value, so that the range of a sliding window
+    // does not keep buckets (and collapse) for values long gone
+    clear();
+  }
+  return true;
+}
+
+void QuantileSketch::Store::clear() {
+  counts.clear();
+  minIndex = 0;
+  collapsedIndex = std::numeric_limits<int>::min();
+  totalCount = 0;
+}
+
+QuantileSketch::QuantileSketch(double relativeAccuracy, int maxBucketCount)
+    : relativeAccuracy_(relativeAccuracy),
+      gamma_((1 + relativeAccuracy) / (1 - relativeAccuracy)),
+      logGamma_(std::log(gamma_)),
+      maxBucketCount_(maxBucketCount) {}
+
+int QuantileSketch::getIndex(double value) const {
+  return static_cast<int>(std::ceil(std::log(value) / logGamma_));
+}
+
+double QuantileSketch::getValue(int index) const {
+  // The middle of the bucket (gamma^(index - 1), gamma^index], relative to
+  // which both its bounds are within the relative accuracy
+  return 2 * std::pow(gamma_, index) / (gamma_ + 1);
+}
+
+void QuantileSketch::add(double value) {
+  if (value > MIN_INDEXABLE_VALUE) {
+    positiveStore_.add(getIndex(value), 1, maxBucketCount_);
+  } else if (value < -MIN_INDEXABLE_VALUE) {
+    negativeStore_.add(getIndex(-value), 1, maxBucketCount_);
+  } else {
+    zeroCount_++;
+  }
+  count_++;
+}
+
+void QuantileSketch::remove(double value) {
+  bool removed = false;
+  if (value > MIN_INDEXABLE_VALUE) {
+    removed = positiveStore_.remove(getIndex(value));
+  } else if (value < -MIN_INDEXABLE_VALUE) {
+    removed = negativeStore_.remove(getIndex(-value));
+  } else if (zeroCount_ > 0) {
+    zeroCount_--;
+    removed = true;
+  }
+  if (removed) {
+    count_--;
+  }
+}
+
+void QuantileSketch::merge(const QuantileSketch& other) {
+  for (size_t i = 0; i < other.positiveStore_.counts.size(); i++) {
+    if (auto count = other.positiveStore_.counts[i]; count > 0) {
+      positiveStore_.add(
+          other.positiveStore_.minIndex + static_cast<int>(i),
+          count,
+          maxBucketCount_);
+    }
+  }
+  for (size_t i = 0; i < other.negativeStore_.counts.size(); i++) {
+    if (auto count = other.negativeStore_.counts[i]; count > 0) {
+      negativeStore_.add(
+          other.negativeStore_.minIndex + static_cast<int>(i),
+          count,
+          maxBucketCount_);
+    }
+  }
+  zeroCount_ += other.zeroCount_;
+  count_ += other.count_;
+}
+
+void QuantileSketch::clear() {
+  positiveStore_.clear();
+  negativeStore_.clear();
+  zeroCount_ = 0;
+  count_ = 0;
+}
+
+double QuantileSketch::getQuantile(double quantile) const {
+  return getValueAtRank(
+      static_cast<uint64_t>(std::max(quantile, 0.0) * count_));
+}
+
+double QuantileSketch::getValueAtRank(uint64_t rank) const {
+  if (count_ == 0) {
+    return 0.0;
+  }
+  rank = std::min(rank, count_ - 1);
+
+  // Values in ascending order: negative ones by descending magnitude, zeros,
+  // then positive ones
+  uint64_t cumulativeCount = 0;
+  const auto& negativeCounts = negativeStore_.counts;
+  for (auto i = static_cast<int>(negativeCounts.size()) - 1; i >= 0; i--) {
+    cumulativeCount += negativeCounts[i];
+    if (cumulativeCount > rank) {
+      return -getValue(negativeStore_.minIndex + i);
+    }
+  }
+  cumulativeCount += zeroCount_;
+  if (cumulativeCount > rank) {
+    return 0.0;
+  }
+  const auto& positiveCounts = positiveStore_.counts;
+  for (size_t i = 0; i < positiveCounts.size(); i++) {
+    cumulativeCount += positiveCounts[i];
+    if (cumulativeCount > rank) {
+      return getValue(positiveStore_.minIndex + static_cast<int>(i));
+    }
+  }
+  // Only reached if values which were never added were removed
+  return 0.0;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * A sketch of a distribution of values (DDSketch), which answers quantile
+ * queries within a relative accuracy, in bounded memory.
+ *
+ * Values fall into logarithmically sized buckets, so adding or removing a
+ * value is O(1) and a quantile query is O(number of buckets), which does not
+ * depend on the number of values. Values can be removed as well as added, so
+ * that a sketch can summarize a sliding window, and sketches with the same
+ * relative accuracy can be merged.
+ */
+class QuantileSketch {
+  // Counts of values by bucket index, for a contiguous range of indices
+  struct Store {
+    std::vector<uint64_t> counts;
+    int minIndex{0};
+    // Values of lower indices were collapsed into the bucket of this one
+    int collapsedIndex{std::numeric_limits<int>::min()};
+    uint64_t totalCount{0};
+
+    void add(int index, uint64_t count, int maxBucketCount);
+    // Returns false if there is no value to remove in the bucket of `index`
+    bool remove(int index);
+    void clear();
+  };
+
+ public:
+  static constexpr double DEFAULT_RELATIVE_ACCURACY = 0.01;
+  static constexpr int DEFAULT_MAX_BUCKET_COUNT = 2048;
+
+  /*
+   * Values whose magnitude is lower than this are counted as zero.
+   */
+  static constexpr double MIN_INDEXABLE_VALUE = 1e-9;
+
+  /*
+   * Keeps at most `maxBucketCount` buckets for positive and for negative
+   * values each. When that is not enough, the buckets of the smallest
+   * magnitudes are collapsed, which only affects the accuracy of the lowest
+   * quantiles.
+   */
+  explicit QuantileSketch(
+      double relativeAccuracy = DEFAULT_RELATIVE_ACCURACY,
+      int maxBucketCount = DEFAULT_MAX_BUCKET_COUNT);
+
+  void add(double value);
+
+  /*
+   * Removes a value which was added before.
+   */
+  void remove(double value);
+
+  /*
+   * Adds all the values of `other`, which must have the same relative
+   * accuracy.
+   */
+  void merge(const QuantileSketch& other);
+
+  void clear();
+
+  /*
+   * Returns an estimate of the value of rank `quantile * count` (like
+   * `TimeSeries::getPercentile`), within the relative accuracy, or 0 if the
+   * sketch is empty.
+   */
+  double getQuantile(double quantile) const;
+
+  /*
+   * Returns an estimate of the value which would be at index `rank` if all
+   * the values were sorted, or 0 if the sketch is empty.
+   */
+  double getValueAtRank(uint64_t rank) const;
+
+  uint64_t getCount() const {
+    return count_;
+  }
+
+  double getRelativeAccuracy() const {
+    return relativeAccuracy_;
+  }
+
+ private:
+  int getIndex(double value) const;
+  double getValue(int index) const;
+
+  double relativeAccuracy_;
+  double gamma_;
+  double logGamma_;
+  int maxBucketCount_;
+
+  Store positiveStore_;
+  // Indexed by the magnitude of values
+  Store negativeStore_;
+  uint64_t zeroCount_{0};
+  uint64_t count_{0};
+};
+
+} // namespace facebook::react
@@ -38,12 +38,14 @@ void TimeSeries::setCapacity(int capacity) {
 
   values_ = std::vector<double>();
   values_.reserve(capacity);
+  invalidateWindow();
 }
 
 void TimeSeries::reset() {
   times_ = {};
   values_ = {};
   position_ = 0;
+  invalidateWindow();
 }
 
 int TimeSeries::findHistoryPointIndex(double t, TimeSeries::Bound bound) const {
@@ -147,16 +149,34 @@ void TimeSeries::appendValue(double t, double value) {
   }
   if (!times_.empty() && getMaxTime() == t) {
     values_[values_.size() - 1] = value;
-  } else if (times_.size() < times_.capacity()) {
+    // The deques of the window can't take back the latest value
+    invalidateWindow();
+    return;
+  }
+
+  auto& window = window_;
+  const bool updatesWindow = window.has_value() && !window->isStale;
+  if (times_.size() < times_.capacity()) {
     times_.push_back(t);
     values_.push_back(value);
     position_ = times_.size();
   } else {
+    if (updatesWindow &&
+        window->firstSequenceNumber == sequenceNumber_ - times_.size()) {
+      // The oldest point is about to be overwritten
+      popFromWindow(*window);
+    }
     position_ = position_ % times_.size();
     times_[position_] = t;
     values_[position_] = value;
     position_++;
   }
+  sequenceNumber_++;
+
+  if (updatesWindow) {
+    pushToWindow(*window, sequenceNumber_ - 1);
+    expireWindow(*window);
+  }
 }
 
 void TimeSeries::accumulateValue(double timeFrom, double timeTo, double value) {
@@ -208,7 +228,8 @@ double TimeSeries::getPercentile(
       values_.begin() + range.idxTo2,
       values.begin() + (range.idxTo1 - range.idxFrom1));
 
-  const size_t k = percentile * values.size() / 100;
+  const size_t k =
+      std::min(percentile * values.size() / 100, values.size() - 1);
   std::nth_element(values.begin(), values.begin() + k, values.end());
   return *(values.begin() + k);
 }
@@ -318,6 +339,145 @@ double TimeSeries::getMinTime() const {
   return times_[position_ % times_.size()];
 }
 
+void TimeSeries::setWindowDuration(double duration, double relativeAccuracy) {
+  window_ = Window{
+      .duration = duration,
+      .sketch = QuantileSketch(relativeAccuracy),
+      .isStale = true};
+}
+
+double TimeSeries::getWindowPercentile(unsigned int percentile) const {
+  const auto* window = getUpToDateWindow();
+  if (window == nullptr || window->maxima.empty()) {
+    return 0.0;
+  }
+  // Same rank as getPercentile, and exact when it is the minimum or maximum
+  const size_t k =
+      percentile * static_cast<size_t>(getWindowCount()) / 100;
+  return std::clamp(
+      window->sketch.getValueAtRank(k),
+      window->minima.front().value,
+      window->maxima.front().value);
+}
+
+double TimeSeries::getWindowAverage() const {
+  const int count = getWindowCount();
+  if (count == 0) {
+    return 0.0;
+  }
+  return getWindowSum() / count;
+}
+
+double TimeSeries::getWindowMax() const {
+  const auto* window = getUpToDateWindow();
+  if (window == nullptr || window->maxima.empty()) {
+    return 0.0;
+  }
+  return window->maxima.front().value;
+}
+
+double TimeSeries::getWindowMin() const {
+  const auto* window = getUpToDateWindow();
+  if (window == nullptr || window->minima.empty()) {
+    return 0.0;
+  }
+  return window->minima.front().value;
+}
+
+double TimeSeries::getWindowSum() const {
+  const auto* window = getUpToDateWindow();
+  return window == nullptr ? 0.0 : window->sum;
+}
+
+int TimeSeries::getWindowCount() const {
+  const auto* window = getUpToDateWindow();
+  if (window == nullptr) {
+    return 0;
+  }
+  return static_cast<int>(sequenceNumber_ - window->firstSequenceNumber);
+}
+
+const QuantileSketch& TimeSeries::getWindowSketch() const {
+  static const QuantileSketch emptySketch;
+  const auto* window = getUpToDateWindow();
+  return window == nullptr ? emptySketch : window->sketch;
+}
+
+double TimeSeries::valueAtSequenceNumber(size_t sequenceNumber) const {
+  return valueAtIndex(
+      static_cast<int>(sequenceNumber + getNumPoints() - sequenceNumber_));
+}
+
+double TimeSeries::timeAtSequenceNumber(size_t sequenceNumber) const {
+  return timeAtIndex(
+      static_cast<int>(sequenceNumber + getNumPoints() - sequenceNumber_));
+}
+
+void TimeSeries::invalidateWindow() {
+  if (window_.has_value()) {
+    window_->isStale = true;
+  }
+}
+
+const TimeSeries::Window* TimeSeries::getUpToDateWindow() const {
+  if (!window_.has_value()) {
+    return nullptr;
+  }
+  auto& window = *window_;
+  if (window.isStale) {
+    window.sketch.clear();
+    window.sum = 0.0;
+    window.maxima.clear();
+    window.minima.clear();
+    window.firstSequenceNumber = sequenceNumber_ - getNumPoints();
+    for (auto i = window.firstSequenceNumber; i < sequenceNumber_; i++) {
+      pushToWindow(window, i);
+    }
+    expireWindow(window);
+    window.isStale = false;
+  }
+  return &window;
+}
+
+void TimeSeries::pushToWindow(Window& window, size_t sequenceNumber) const {
+  const double value = valueAtSequenceNumber(sequenceNumber);
+  window.sketch.add(value);
+  window.sum += value;
+  while (!window.maxima.empty() && window.maxima.back().value <= value) {
+    window.maxima.pop_back();
+  }
+  window.maxima.push_back({sequenceNumber, value});
+  while (!window.minima.empty() && window.minima.back().value >= value) {
+    window.minima.pop_back();
+  }
+  window.minima.push_back({sequenceNumber, value});
+}
+
+void TimeSeries::popFromWindow(Window& window) const {
+  const auto sequenceNumber = window.firstSequenceNumber++;
+  const double value = valueAtSequenceNumber(sequenceNumber);
+  window.sketch.remove(value);
+  window.sum -= value;
+  if (window.maxima.front().sequenceNumber == sequenceNumber) {
+    window.maxima.pop_front();
+  }
+  if (window.minima.front().sequenceNumber == sequenceNumber) {
+    window.minima.pop_front();
+  }
+  if (window.firstSequenceNumber == sequenceNumber_) {
+    // Don't carry rounding errors over
+    window.sum = 0.0;
+  }
+}
+
+void TimeSeries::expireWindow(Window& window) const {
+  const double timeFrom = getMaxTime() - window.duration;
+  while (window.firstSequenceNumber < sequenceNumber_ &&
+         timeAtSequenceNumber(window.firstSequenceNumber) < timeFrom) {
+    popFromWindow(window);
+  }
+}
+
 double TimeSeries::getValue(double t) const {
   if (times_.empty()) {
     return 0.0;
@@ -7,9 +7,13 @@
 
 #pragma once
 
+#include <deque>
+#include <optional>
 #include <ostream>
 #include <vector>
 
+#include "QuantileSketch.h"
+
 namespace facebook::react {
 
 class TimeSeries {
@@ -33,6 +37,28 @@ class TimeSeries {
     }
   };
 
+  // The points of the last `duration` before the latest point, with the
+  // statistics of their values maintained as points are appended
+  struct Window {
+    struct Entry {
+      size_t sequenceNumber;
+      double value;
+    };
+
+    double duration;
+    QuantileSketch sketch;
+    double sum{0.0};
+    // Sequence number of the oldest point in the window
+    size_t firstSequenceNumber{0};
+    // Monotonic deques: the points which are the maximum (minimum) of all
+    // the points from them to the latest one
+    std::deque<Entry> maxima{};
+    std::deque<Entry> minima{};
+    // Whether values were modified in place since the statistics were
+    // computed
+    bool isStale{false};
+  };
+
  public:
   static constexpr int DEFAULT_CAPACITY = 100;
   enum class Bound { Upper = 0, Lower = 1 };
@@ -55,11 +81,13 @@ class TimeSeries {
   }
 
   double& valueAtIndex(int idx) {
+    invalidateWindow();
     const int numPoints = getNumPoints();
     return values_[(idx + position_) % numPoints];
   }
 
   double& timeAtIndex(int idx) {
+    invalidateWindow();
     const int numPoints = getNumPoints();
     return times_[(idx + position_) % numPoints];
   }
@@ -101,6 +129,30 @@ class TimeSeries {
   double getMaxTime() const;
   double getMinTime() const;
 
+  /*
+   * Maintains the statistics of the points of the last `duration` before
+   * the latest point (i.e. of the range [getMaxTime() - duration,
+   * getMaxTime()]) as values are appended, so that the `getWindow*` queries
+   * do not scan the points. Percentiles are estimated within
+   * `relativeAccuracy`, in memory which does not depend on the capacity.
+   */
+  void setWindowDuration(
+      double duration,
+      double relativeAccuracy = QuantileSketch::DEFAULT_RELATIVE_ACCURACY);
+
+  double getWindowPercentile(unsigned int percentile) const;
+  double getWindowAverage() const;
+  double getWindowMax() const;
+  double getWindowMin() const;
+  double getWindowSum() const;
+  int getWindowCount() const;
+
+  /*
+   * The distribution of the values in the window, e.g. to merge it with the
+   * ones of other series.
+   */
+  const QuantileSketch& getWindowSketch() const;
+
   friend std::ostream& operator<<(std::ostream& os, const TimeSeries& ts);
   friend std::ostream& operator<<(
       std::ostream& os,
@@ -112,6 +164,14 @@ class TimeSeries {
 
   size_t position_{0};
 
+  // Number of points appended so far, of which the last `getNumPoints()`
+  // are kept
+  size_t sequenceNumber_{0};
+
+  // Mutable: brought up to date lazily by queries once values were modified
+  // in place
+  mutable std::optional<Window> window_;
+
   Range findHistoryPointRange(double timeFrom, double timeTo) const;
   Range wholeRange() const;
 
@@ -120,6 +180,15 @@ class TimeSeries {
   double getMax(const Range& range) const;
   double getMin(const Range& range) const;
   double getSum(const Range& range) const;
+
+  double valueAtSequenceNumber(size_t sequenceNumber) const;
+  double timeAtSequenceNumber(size_t sequenceNumber) const;
+
+  void invalidateWindow();
+  const Window* getUpToDateWindow() const;
+  void pushToWindow(Window& window, size_t sequenceNumber) const;
+  void popFromWindow(Window& window) const;
+  void expireWindow(Window& window) const;
 };
 
 } // namespace facebook::react
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <react/profiling/FrameTimeline.h>
+#include <react/renderer/telemetry/TransactionTelemetry.h>
+
+#include <chrono>
+
+namespace facebook::react {
+
+namespace {
+
+using namespace std::chrono_literals;
+using Phase = FrameTimeline::Phase;
+
+TelemetryTimePoint at(std::chrono::milliseconds time) {
+  return TelemetryTimePoint{} + time;
+}
+
+} // namespace
+
+TEST(FrameTimelineTests, attributesPhasesToFrames) {
+  FrameTimeline timeline(4);
+
+  // Work done between frames is attributed to the next one
+  timeline.recordPhase(Phase::JSTask, at(1ms), at(4ms));
+  timeline.beginFrame(at(16ms));
+  timeline.recordPhase(Phase::AnimationTick, at(17ms), at(18ms));
+  timeline.recordPhase(Phase::AnimationTick, at(18ms), at(20ms));
+  timeline.endFrame(at(22ms));
+
+  timeline.beginFrame(at(33ms));
+  timeline.endFrame(at(35ms));
+
+  auto frames = timeline.getFrames();
+  ASSERT_EQ(frames.size(), 2u);
+  EXPECT_EQ(frames[0].number, 0u);
+  EXPECT_EQ(frames[0].getDuration(), 6ms);
+  EXPECT_EQ(frames[0].getPhaseDuration(Phase::JSTask), 3ms);
+  EXPECT_EQ(frames[0].getPhaseDuration(Phase::AnimationTick), 3ms);
+  EXPECT_EQ(frames[0].getDominantPhase(), Phase::JSTask);
+  EXPECT_EQ(frames[1].number, 1u);
+  EXPECT_EQ(frames[1].getDuration(), 2ms);
+  EXPECT_EQ(frames[1].getDominantPhase(), std::nullopt);
+}
+
+TEST(FrameTimelineTests, nestedFrameBlocks) {
+  FrameTimeline timeline;
+
+  timeline.beginFrame(at(0ms));
+  timeline.beginFrame(at(1ms));
+  timeline.endFrame(at(2ms));
+  timeline.recordPhase(Phase::Mount, at(2ms), at(3ms));
+  timeline.endFrame(at(4ms));
+  // Unbalanced ends are ignored
+  timeline.endFrame(at(5ms));
+
+  auto frames = timeline.getFrames();
+  ASSERT_EQ(frames.size(), 1u);
+  EXPECT_EQ(frames[0].getDuration(), 4ms);
+  EXPECT_EQ(frames[0].getDominantPhase(), Phase::Mount);
+}
+
+TEST(FrameTimelineTests, recordTransaction) {
+  auto time = at(100ms);
+  auto telemetry = TransactionTelemetry{[&time]() { return time; }};
+  telemetry.willCommit();
+  time += 1ms;
+  telemetry.willLayout();
+  time += 8ms;
+  telemetry.didLayout();
+  time += 1ms;
+  telemetry.didCommit();
+  telemetry.willDiff();
+  time += 2ms;
+  telemetry.didDiff();
+  telemetry.willMount();
+  time += 3ms;
+  telemetry.didMount();
+
+  FrameTimeline timeline;
+  timeline.beginFrame(at(100ms));
+  timeline.recordTransaction(telemetry);
+  timeline.endFrame(time);
+
+  auto frames = timeline.getFrames();
+  ASSERT_EQ(frames.size(), 1u);
+  // The commit excludes its layout
+  EXPECT_EQ(frames[0].getPhaseDuration(Phase::Commit), 2ms);
+  EXPECT_EQ(frames[0].getPhaseDuration(Phase::Layout), 8ms);
+  EXPECT_EQ(frames[0].getPhaseDuration(Phase::Diff), 2ms);
+  EXPECT_EQ(frames[0].getPhaseDuration(Phase::Mount), 3ms);
+  EXPECT_EQ(frames[0].getDominantPhase(), Phase::Layout);
+}
+
+TEST(FrameTimelineTests, attributesLatePhasesByTime) {
+  FrameTimeline timeline;
+
+  timeline.beginFrame(at(0ms));
+  timeline.endFrame(at(16ms));
+  timeline.beginFrame(at(16ms));
+  timeline.endFrame(at(32ms));
+  timeline.beginFrame(at(33ms));
+
+  // Recorded once mounted, while a later frame is in progress
+  auto time = at(10ms);
+  auto telemetry = TransactionTelemetry{[&time]() { return time; }};
+  telemetry.willCommit();
+  time += 4ms;
+  telemetry.willLayout();
+  time += 8ms;
+  telemetry.didLayout();
+  telemetry.didCommit();
+  telemetry.willDiff();
+  telemetry.didDiff();
+  telemetry.willMount();
+  time += 14ms;
+  telemetry.didMount();
+  timeline.recordTransaction(telemetry);
+  timeline.recordPhase(Phase::AnimationTick, at(30ms), at(34ms));
+  timeline.endFrame(at(40ms));
+
+  auto frames = timeline.getFrames();
+  ASSERT_EQ(frames.size(), 3u);
+  EXPECT_EQ(frames[0].getPhaseDuration(Phase::Commit), 4ms);
+  EXPECT_EQ(frames[0].getPhaseDuration(Phase::Layout), 2ms);
+  EXPECT_EQ(frames[1].getPhaseDuration(Phase::Layout), 6ms);
+  EXPECT_EQ(frames[1].getPhaseDuration(Phase::Mount), 10ms);
+  EXPECT_EQ(frames[1].getPhaseDuration(Phase::AnimationTick), 2ms);
+  EXPECT_EQ(frames[2].getPhaseDuration(Phase::Mount), 4ms);
+  EXPECT_EQ(frames[2].getPhaseDuration(Phase::AnimationTick), 2ms);
+}
+
+TEST(FrameTimelineTests, slowestFramesInRing) {
+  FrameTimeline timeline(8);
+  ASSERT_EQ(timeline.getCapacity(), 8);
+
+  for (int i = 0; i < 20; i++) {
+    const auto start = at(std::chrono::milliseconds(i * 100));
+    // Every fifth frame is slow, because of its commit
+    const auto duration = std::chrono::milliseconds(i % 5 == 0 ? 40 + i : 5);
+    timeline.beginFrame(start);
+    timeline.recordPhase(Phase::Commit, start, start + duration - 1ms);
+    timeline.recordPhase(
+        Phase::Mount, start + duration - 1ms, start + duration);
+    timeline.endFrame(start + duration);
+  }
+
+  // Only the last frames are kept
+  auto frames = timeline.getFrames();
+  ASSERT_EQ(frames.size(), 8u);
+  EXPECT_EQ(frames.front().number, 12u);
+  EXPECT_EQ(frames.back().number, 19u);
+
+  auto slowestFrames = timeline.getSlowestFrames(3);
+  ASSERT_EQ(slowestFrames.size(), 3u);
+  EXPECT_EQ(slowestFrames[0].number, 15u);
+  EXPECT_EQ(slowestFrames[0].getDuration(), 55ms);
+  EXPECT_EQ(slowestFrames[0].getDominantPhase(), Phase::Commit);
+  EXPECT_EQ(slowestFrames[1].getDuration(), 5ms);
+  EXPECT_EQ(slowestFrames[2].getDuration(), 5ms);
+
+  EXPECT_EQ(timeline.getSlowestFrames(100).size(), 8u);
+
+  timeline.reset();
+  EXPECT_TRUE(timeline.getFrames().empty());
+  EXPECT_TRUE(timeline.getSlowestFrames(3).empty());
+}
+
+TEST(FrameTimelineTests, phaseNames) {
+  for (size_t i = 0; i < FrameTimeline::PHASE_COUNT; i++) {
+    EXPECT_STRNE(
+        FrameTimeline::getPhaseName(static_cast<Phase>(i)), "unknown");
+  }
+}
+
+} // namespace facebook::react
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <react/profiling/QuantileSketch.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+double exactQuantile(std::vector<double> values, double quantile) {
+  const auto k = std::min(
+      static_cast<size_t>(quantile * values.size()), values.size() - 1);
+  std::nth_element(values.begin(), values.begin() + k, values.end());
+  return values[k];
+}
+
+void expectWithinRelativeAccuracy(
+    double expected,
+    double actual,
+    double relativeAccuracy) {
+  EXPECT_LE(
+      std::abs(actual - expected),
+      relativeAccuracy * std::abs(expected) + 1e-12)
+      << "expected " << expected << ", got " << actual;
+}
+
+} // namespace
+
+TEST(QuantileSketchTests, emptySketch) {
+  QuantileSketch sketch;
+  EXPECT_EQ(0u, sketch.getCount());
+  EXPECT_EQ(0.0, sketch.getQuantile(0.5));
+}
+
+TEST(QuantileSketchTests, accuracy) {
+  // Frame times are mostly around 16ms, with a long tail
+  std::mt19937 generator(42);
+  std::lognormal_distribution<double> distribution(2.8, 0.5);
+
+  QuantileSketch sketch;
+  std::vector<double> values;
+  for (int i = 0; i < 10'000; i++) {
+    values.push_back(distribution(generator));
+    sketch.add(values.back());
+  }
+
+  EXPECT_EQ(values.size(), sketch.getCount());
+  for (double quantile : {0.0, 0.01, 0.25, 0.5, 0.75, 0.95, 0.99, 1.0}) {
+    expectWithinRelativeAccuracy(
+        exactQuantile(values, quantile),
+        sketch.getQuantile(quantile),
+        sketch.getRelativeAccuracy());
+  }
+}
+
+TEST(QuantileSketchTests, negativeAndZeroValues) {
+  QuantileSketch sketch;
+  std::vector<double> values = {-100.0, -3.0, -0.5, 0.0, 0.0, 1.0, 7.0, 50.0};
+  for (double value : values) {
+    sketch.add(value);
+  }
+
+  for (size_t rank = 0; rank < values.size(); rank++) {
+    expectWithinRelativeAccuracy(
+        values[rank],
+        sketch.getValueAtRank(rank),
+        sketch.getRelativeAccuracy());
+  }
+}
+
+TEST(QuantileSketchTests, remove) {
+  QuantileSketch sketch;
+  for (int i = 1; i <= 100; i++) {
+    sketch.add(i);
+  }
+  for (int i = 1; i <= 50; i++) {
+    sketch.remove(i);
+  }
+
+  EXPECT_EQ(50u, sketch.getCount());
+  expectWithinRelativeAccuracy(
+      51.0, sketch.getQuantile(0.0), sketch.getRelativeAccuracy());
+  expectWithinRelativeAccuracy(
+      76.0, sketch.getQuantile(0.5), sketch.getRelativeAccuracy());
+  expectWithinRelativeAccuracy(
+      100.0, sketch.getQuantile(1.0), sketch.getRelativeAccuracy());
+}
+
+TEST(QuantileSketchTests, removeAbsentValues) {
+  QuantileSketch sketch;
+  sketch.add(10.0);
+
+  // Values which were never added are not counted as removed
+  sketch.remove(1000.0);
+  sketch.remove(0.1);
+  sketch.remove(0.0);
+  sketch.remove(-10.0);
+
+  EXPECT_EQ(1u, sketch.getCount());
+  expectWithinRelativeAccuracy(
+      10.0, sketch.getQuantile(0.5), sketch.getRelativeAccuracy());
+
+  sketch.remove(10.0);
+  EXPECT_EQ(0u, sketch.getCount());
+  sketch.remove(10.0);
+  EXPECT_EQ(0u, sketch.getCount());
+}
+
+TEST(QuantileSketchTests, merge) {
+  QuantileSketch sketch1;
+  QuantileSketch sketch2;
+  std::vector<double> values;
+  for (int i = 1; i <= 1000; i++) {
+    values.push_back(i * 0.1);
+    (i % 3 == 0 ? sketch1 : sketch2).add(values.back());
+  }
+
+  sketch1.merge(sketch2);
+  EXPECT_EQ(values.size(), sketch1.getCount());
+  for (double quantile : {0.1, 0.5, 0.9, 0.99}) {
+    expectWithinRelativeAccuracy(
+        exactQuantile(values, quantile),
+        sketch1.getQuantile(quantile),
+        sketch1.getRelativeAccuracy());
+  }
+}
+
+TEST(QuantileSketchTests, boundedBucketCount) {
+  QuantileSketch sketch(0.01, 64);
+  std::vector<double> values;
+  for (int i = 0; i < 40; i++) {
+    values.push_back(std::pow(2.0, i));
+    sketch.add(values.back());
+  }
+
+  // The lowest values are collapsed, the highest ones are still accurate
+  EXPECT_EQ(values.size(), sketch.getCount());
+  expectWithinRelativeAccuracy(
+      values.back(), sketch.getQuantile(1.0), sketch.getRelativeAccuracy());
+  EXPECT_LE(sketch.getQuantile(0.0), values.back());
+
+  // Values below the kept range are collapsed as well, when added and when
+  // removed
+  sketch.add(0.5);
+  sketch.remove(0.25);
+  EXPECT_EQ(values.size(), sketch.getCount());
+  EXPECT_LE(sketch.getQuantile(0.0), values.back());
+
+  // Removing collapsed values keeps the counts consistent
+  for (double value : values) {
+    sketch.remove(value);
+  }
+  EXPECT_EQ(0u, sketch.getCount());
+  sketch.add(3.0);
+  expectWithinRelativeAccuracy(
+      3.0, sketch.getQuantile(0.5), sketch.getRelativeAccuracy());
+}
+
+} // namespace facebook::react
@@ -9,6 +9,8 @@
 
 #include <react/profiling/TimeSeries.h>
 
+#include <random>
+
 namespace facebook::react {
 
 class TimeSeriesTests : public testing::Test {};
@@ -203,4 +205,82 @@ TEST_F(TimeSeriesTests, accumulateOperations) {
   EXPECT_FLOAT_EQ(7.0, ts.timeAtIndex(4));
 }
 
+TEST_F(TimeSeriesTests, windowOperations) {
+  TimeSeries ts(5);
+  EXPECT_EQ(0, ts.getWindowCount());
+  EXPECT_FLOAT_EQ(0.0, ts.getWindowMax());
+
+  ts.setWindowDuration(2.0);
+  EXPECT_EQ(0, ts.getWindowCount());
+  EXPECT_FLOAT_EQ(0.0, ts.getWindowPercentile(50));
+
+  ts.appendValue(0.0, 4.0);
+  ts.appendValue(1.0, 1.0);
+  ts.appendValue(2.0, 3.0);
+  EXPECT_EQ(3, ts.getWindowCount());
+  EXPECT_FLOAT_EQ(1.0, ts.getWindowMin());
+  EXPECT_FLOAT_EQ(4.0, ts.getWindowMax());
+  EXPECT_FLOAT_EQ(8.0, ts.getWindowSum());
+  // Percentiles are estimates, except for the minimum and maximum
+  EXPECT_NEAR(3.0, ts.getWindowPercentile(50), 3.0 * 0.01);
+  EXPECT_FLOAT_EQ(1.0, ts.getWindowPercentile(0));
+  EXPECT_FLOAT_EQ(4.0, ts.getWindowPercentile(100));
+
+  // The point at 0.0 leaves the window
+  ts.appendValue(3.0, 2.0);
+  EXPECT_EQ(3, ts.getWindowCount());
+  EXPECT_FLOAT_EQ(1.0, ts.getWindowMin());
+  EXPECT_FLOAT_EQ(3.0, ts.getWindowMax());
+  EXPECT_FLOAT_EQ(2.0, ts.getWindowAverage());
+
+  // A gap empties the window of all but the latest point
+  ts.appendValue(10.0, 5.0);
+  EXPECT_EQ(1, ts.getWindowCount());
+  EXPECT_FLOAT_EQ(5.0, ts.getWindowMin());
+  EXPECT_FLOAT_EQ(5.0, ts.getWindowPercentile(95));
+
+  // Values modified in place are taken into account
+  ts.accumulateValue(9.0, 11.0, 4.0);
+  EXPECT_EQ(
+      ts.getCount(ts.getMaxTime() - 2.0, ts.getMaxTime()),
+      ts.getWindowCount());
+  EXPECT_FLOAT_EQ(
+      ts.getSum(ts.getMaxTime() - 2.0, ts.getMaxTime()), ts.getWindowSum());
+}
+
+TEST_F(TimeSeriesTests, windowMatchesRangeOperations) {
+  // Frame times of a long run, in a buffer which wraps around many times and
+  // is sometimes shorter than the window
+  constexpr double windowDuration = 1000.0;
+  TimeSeries ts(256);
+  ts.setWindowDuration(windowDuration);
+
+  std::mt19937 generator(42);
+  std::lognormal_distribution<double> frameTimes(2.8, 0.5);
+  double time = 0.0;
+  for (int i = 0; i < 5000; i++) {
+    const double frameTime = frameTimes(generator);
+    time += frameTime;
+    ts.appendValue(time, frameTime);
+    if (i % 97 != 0) {
+      continue;
+    }
+
+    const double timeFrom = time - windowDuration;
+    const double timeTo = time;
+    ASSERT_EQ(ts.getCount(timeFrom, timeTo), ts.getWindowCount());
+    EXPECT_DOUBLE_EQ(ts.getMin(timeFrom, timeTo), ts.getWindowMin());
+    EXPECT_DOUBLE_EQ(ts.getMax(timeFrom, timeTo), ts.getWindowMax());
+    EXPECT_NEAR(ts.getSum(timeFrom, timeTo), ts.getWindowSum(), 1e-6);
+    for (unsigned int percentile : {0, 50, 75, 95, 99, 100}) {
+      const double expected = ts.getPercentile(percentile, timeFrom, timeTo);
+      EXPECT_NEAR(
+          expected,
+          ts.getWindowPercentile(percentile),
+          expected * QuantileSketch::DEFAULT_RELATIVE_ACCURACY)
+          << "p" << percentile << " at " << time;
+    }
+  }
+}
+
 } // namespace facebook::react
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/profiling/TimeSeries.h>
+#include <random>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr double WindowDuration = 1000.0;
+
+// A series of `capacity` frame times, filled over several windows
+TimeSeries makeFrameTimeSeries(int capacity, bool withWindow) {
+  TimeSeries ts(capacity);
+  if (withWindow) {
+    ts.setWindowDuration(WindowDuration);
+  }
+  std::mt19937 generator(42);
+  std::lognormal_distribution<double> frameTimes(0.0, 0.5);
+  double time = 0.0;
+  for (int i = 0; i < capacity * 2; i++) {
+    const double frameTime = frameTimes(generator);
+    time += frameTime;
+    ts.appendValue(time, frameTime);
+  }
+  return ts;
+}
+
+void appendValue(benchmark::State& state) {
+  auto ts = makeFrameTimeSeries(
+      static_cast<int>(state.range(0)), state.range(1) != 0);
+  double time = ts.getMaxTime();
+  for (auto _ : state) {
+    time += 1.0;
+    ts.appendValue(time, 1.0);
+  }
+}
+
+// What FrameStats reports every second, over the points of the last second
+void exactRangeStats(benchmark::State& state) {
+  const auto ts = makeFrameTimeSeries(static_cast<int>(state.range(0)), false);
+  const double timeTo = ts.getMaxTime();
+  const double timeFrom = timeTo - WindowDuration;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ts.getAverage(timeFrom, timeTo));
+    benchmark::DoNotOptimize(ts.getMin(timeFrom, timeTo));
+    benchmark::DoNotOptimize(ts.getMax(timeFrom, timeTo));
+    benchmark::DoNotOptimize(ts.getPercentile(50, timeFrom, timeTo));
+    benchmark::DoNotOptimize(ts.getPercentile(75, timeFrom, timeTo));
+    benchmark::DoNotOptimize(ts.getPercentile(95, timeFrom, timeTo));
+  }
+}
+
+void windowStats(benchmark::State& state) {
+  const auto ts = makeFrameTimeSeries(static_cast<int>(state.range(0)), true);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ts.getWindowAverage());
+    benchmark::DoNotOptimize(ts.getWindowMin());
+    benchmark::DoNotOptimize(ts.getWindowMax());
+    benchmark::DoNotOptimize(ts.getWindowPercentile(50));
+    benchmark::DoNotOptimize(ts.getWindowPercentile(75));
+    benchmark::DoNotOptimize(ts.getWindowPercentile(95));
+  }
+}
+
+} // namespace
+
+BENCHMARK(appendValue)->Args({256, 0})->Args({256, 1})->Args({4096, 1});
+BENCHMARK(exactRangeStats)->Arg(256)->Arg(4096);
+BENCHMARK(windowStats)->Arg(256)->Arg(4096);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -15,9 +15,12 @@ namespace facebook::react {
 
 AnimatedMountingOverrideDelegate::AnimatedMountingOverrideDelegate(
     std::function<std::optional<folly::dynamic>(Tag)> getAnimatedManagedProps,
-    std::weak_ptr<UIManagerBinding> uiManagerBinding)
+    std::weak_ptr<UIManagerBinding> uiManagerBinding,
+    std::function<std::optional<AnimatedProps>(Tag)>
+        getAnimatedManagedTypedProps)
     : MountingOverrideDelegate(),
       getAnimatedManagedProps_(std::move(getAnimatedManagedProps)),
+      getAnimatedManagedTypedProps_(std::move(getAnimatedManagedTypedProps)),
       uiManagerBinding_(std::move(uiManagerBinding)){};
 
 bool AnimatedMountingOverrideDelegate::shouldOverridePullTransaction() const {
@@ -36,16 +39,24 @@ AnimatedMountingOverrideDelegate::pullTransaction(
   }
 
   std::unordered_map<Tag, folly::dynamic> animatedManagedProps;
+  std::unordered_map<Tag, AnimatedProps> animatedManagedTypedProps;
   for (const auto& mutation : mutations) {
     if (mutation.type == ShadowViewMutation::Update) {
       const auto tag = mutation.newChildShadowView.tag;
+      if (getAnimatedManagedTypedProps_) {
+        if (auto typedProps = getAnimatedManagedTypedProps_(tag);
+            typedProps && !typedProps->empty()) {
+          animatedManagedTypedProps.insert({tag, *typedProps});
+          continue;
+        }
+      }
       if (auto props = getAnimatedManagedProps_(tag)) {
         animatedManagedProps.insert({tag, std::move(*props)});
       }
     }
   }
 
-  if (animatedManagedProps.empty()) {
+  if (animatedManagedProps.empty() && animatedManagedTypedProps.empty()) {
     return MountingTransaction{
         surfaceId, transactionNumber, std::move(mutations), telemetry};
   }
@@ -53,13 +64,18 @@ AnimatedMountingOverrideDelegate::pullTransaction(
   ShadowViewMutation::List filteredMutations;
   for (const auto& mutation : mutations) {
     folly::dynamic modifiedProps = folly::dynamic::object();
+    std::optional<AnimatedProps> modifiedTypedProps;
     if (mutation.type == ShadowViewMutation::Update) {
-      if (auto node =
+      if (auto typedNode = animatedManagedTypedProps.extract(
+              mutation.newChildShadowView.tag)) {
+        modifiedTypedProps = typedNode.mapped();
+      } else if (
+          auto node =
               animatedManagedProps.extract(mutation.newChildShadowView.tag)) {
         modifiedProps = std::move(node.mapped());
       }
     }
-    if (modifiedProps.empty()) {
+    if (!modifiedTypedProps && modifiedProps.empty()) {
       filteredMutations.emplace_back(mutation);
     } else {
       if (auto uiManagerBinding = uiManagerBinding_.lock()) {
@@ -74,10 +90,16 @@ AnimatedMountingOverrideDelegate::pullTransaction(
               mutation.newChildShadowView.surfaceId,
               *scheduler->getContextContainer()};
           auto modifiedNewChildShadowView = mutation.newChildShadowView;
-          modifiedNewChildShadowView.props = componentDescriptor->cloneProps(
-              propsParserContext,
-              mutation.newChildShadowView.props,
-              RawProps(std::move(modifiedProps)));
+          modifiedNewChildShadowView.props = modifiedTypedProps
+              ? cloneViewPropsWithAnimatedProps(
+                    *componentDescriptor,
+                    propsParserContext,
+                    mutation.newChildShadowView.props,
+                    *modifiedTypedProps)
+              : componentDescriptor->cloneProps(
+                    propsParserContext,
+                    mutation.newChildShadowView.props,
+                    RawProps(std::move(modifiedProps)));
           filteredMutations.emplace_back(ShadowViewMutation::UpdateMutation(
               mutation.oldChildShadowView,
               std::move(modifiedNewChildShadowView),
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <folly/dynamic.h>
+#include <react/renderer/animated/AnimatedProps.h>
 #include <react/renderer/mounting/MountingOverrideDelegate.h>
 #include <react/renderer/mounting/MountingTransaction.h>
 #include <react/renderer/mounting/ShadowViewMutation.h>
@@ -23,7 +24,9 @@ class AnimatedMountingOverrideDelegate : public MountingOverrideDelegate {
  public:
   AnimatedMountingOverrideDelegate(
       std::function<std::optional<folly::dynamic>(Tag)> getAnimatedManagedProps,
-      std::weak_ptr<UIManagerBinding> uiManagerBinding);
+      std::weak_ptr<UIManagerBinding> uiManagerBinding,
+      std::function<std::optional<AnimatedProps>(Tag)>
+          getAnimatedManagedTypedProps = nullptr);
 
   bool shouldOverridePullTransaction() const override;
 
@@ -35,6 +38,10 @@ class AnimatedMountingOverrideDelegate : public MountingOverrideDelegate {
 
  private:
   std::function<std::optional<folly::dynamic>(Tag)> getAnimatedManagedProps_;
+  // Preferred over `getAnimatedManagedProps_` when it returns a value, typed
+  // props are applied on the cloned ViewProps without RawProps parsing.
+  std::function<std::optional<AnimatedProps>(Tag)>
+      getAnimatedManagedTypedProps_;
 
   std::weak_ptr<UIManagerBinding> uiManagerBinding_;
 };
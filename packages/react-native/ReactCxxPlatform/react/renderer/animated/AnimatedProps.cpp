@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "AnimatedProps.h"
+
+#include <react/debug/react_native_assert.h>
+#include <react/renderer/components/view/ViewProps.h>
+#include <react/renderer/core/RawProps.h>
+#include <react/renderer/graphics/Color.h>
+#include <cmath>
+#include <utility>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr std::array<std::pair<AnimatedPropName, std::string_view>, 25>
+    sAnimatedPropNames{{
+        {AnimatedPropName::Opacity, "opacity"},
+        {AnimatedPropName::ZIndex, "zIndex"},
+        {AnimatedPropName::ShadowOpacity, "shadowOpacity"},
+        {AnimatedPropName::ShadowRadius, "shadowRadius"},
+        {AnimatedPropName::BackgroundColor, "backgroundColor"},
+        {AnimatedPropName::BorderColor, "borderColor"},
+        {AnimatedPropName::BorderLeftColor, "borderLeftColor"},
+        {AnimatedPropName::BorderTopColor, "borderTopColor"},
+        {AnimatedPropName::BorderRightColor, "borderRightColor"},
+        {AnimatedPropName::BorderBottomColor, "borderBottomColor"},
+        {AnimatedPropName::BorderStartColor, "borderStartColor"},
+        {AnimatedPropName::BorderEndColor, "borderEndColor"},
+        {AnimatedPropName::BorderRadius, "borderRadius"},
+        {AnimatedPropName::BorderTopLeftRadius, "borderTopLeftRadius"},
+        {AnimatedPropName::BorderTopRightRadius, "borderTopRightRadius"},
+        {AnimatedPropName::BorderBottomLeftRadius, "borderBottomLeftRadius"},
+        {AnimatedPropName::BorderBottomRightRadius, "borderBottomRightRadius"},
+        {AnimatedPropName::BorderTopStartRadius, "borderTopStartRadius"},
+        {AnimatedPropName::BorderTopEndRadius, "borderTopEndRadius"},
+        {AnimatedPropName::BorderBottomStartRadius, "borderBottomStartRadius"},
+        {AnimatedPropName::BorderBottomEndRadius, "borderBottomEndRadius"},
+        {AnimatedPropName::BorderEndEndRadius, "borderEndEndRadius"},
+        {AnimatedPropName::BorderEndStartRadius, "borderEndStartRadius"},
+        {AnimatedPropName::BorderStartEndRadius, "borderStartEndRadius"},
+        {AnimatedPropName::BorderStartStartRadius, "borderStartStartRadius"},
+    }};
+
+static_assert(sAnimatedPropNames.size() == AnimatedPropNameCount);
+
+constexpr std::
+    array<std::pair<AnimatedTransformOperationType, std::string_view>, 12>
+        sTransformOperationNames{{
+            {AnimatedTransformOperationType::Perspective, "perspective"},
+            {AnimatedTransformOperationType::Rotate, "rotate"},
+            {AnimatedTransformOperationType::Rotate, "rotateZ"},
+            {AnimatedTransformOperationType::RotateX, "rotateX"},
+            {AnimatedTransformOperationType::RotateY, "rotateY"},
+            {AnimatedTransformOperationType::Scale, "scale"},
+            {AnimatedTransformOperationType::ScaleX, "scaleX"},
+            {AnimatedTransformOperationType::ScaleY, "scaleY"},
+            {AnimatedTransformOperationType::TranslateX, "translateX"},
+            {AnimatedTransformOperationType::TranslateY, "translateY"},
+            {AnimatedTransformOperationType::SkewX, "skewX"},
+            {AnimatedTransformOperationType::SkewY, "skewY"},
+        }};
+
+SharedColor colorFromARGB(int32_t argb) {
+  auto ratio = 255.f;
+  return colorFromComponents(
+      {static_cast<float>((argb >> 16) & 0xFF) / ratio,
+       static_cast<float>((argb >> 8) & 0xFF) / ratio,
+       static_cast<float>(argb & 0xFF) / ratio,
+       static_cast<float>((argb >> 24) & 0xFF) / ratio});
+}
+
+TransformOperation toTransformOperation(
+    const AnimatedTransformOperation& operation) {
+  auto zero = ValueUnit(0, UnitType::Point);
+  auto one = ValueUnit(1, UnitType::Point);
+  auto value = ValueUnit(static_cast<Float>(operation.value), UnitType::Point);
+  switch (operation.type) {
+    case AnimatedTransformOperationType::Perspective:
+      return {TransformOperationType::Perspective, value, zero, zero};
+    case AnimatedTransformOperationType::Rotate:
+      return {TransformOperationType::Rotate, zero, zero, value};
+    case AnimatedTransformOperationType::RotateX:
+      return {TransformOperationType::Rotate, value, zero, zero};
+    case AnimatedTransformOperationType::RotateY:
+      return {TransformOperationType::Rotate, zero, value, zero};
+    case AnimatedTransformOperationType::Scale:
+      return {TransformOperationType::Scale, value, value, value};
+    case AnimatedTransformOperationType::ScaleX:
+      return {TransformOperationType::Scale, value, one, one};
+    case AnimatedTransformOperationType::ScaleY:
+      return {TransformOperationType::Scale, one, value, one};
+    case AnimatedTransformOperationType::TranslateX:
+      return {TransformOperationType::Translate, value, zero, zero};
+    case AnimatedTransformOperationType::TranslateY:
+      return {TransformOperationType::Translate, zero, value, zero};
+    case AnimatedTransformOperationType::SkewX:
+      return {TransformOperationType::Skew, value, zero, zero};
+    case AnimatedTransformOperationType::SkewY:
+      return {TransformOperationType::Skew, zero, value, zero};
+  }
+  return {TransformOperationType::Identity, zero, zero, zero};
+}
+
+} // namespace
+
+void AnimatedProps::merge(const AnimatedProps& other) {
+  for (size_t i = 0; i < AnimatedPropNameCount; i++) {
+    if (other.mask_.test(i)) {
+      mask_.set(i);
+      values_[i] = other.values_[i];
+    }
+  }
+  if (other.hasTransform_) {
+    hasTransform_ = true;
+    transformOperations_ = other.transformOperations_;
+    transformOperationsCount_ = other.transformOperationsCount_;
+  }
+}
+
+std::optional<AnimatedPropName> animatedPropNameFromString(
+    std::string_view name) {
+  for (const auto& [propName, string] : sAnimatedPropNames) {
+    if (string == name) {
+      return propName;
+    }
+  }
+  return std::nullopt;
+}
+
+std::string_view animatedPropNameToString(AnimatedPropName name) {
+  return sAnimatedPropNames[static_cast<size_t>(name)].second;
+}
+
+bool isColorAnimatedPropName(AnimatedPropName name) {
+  return name >= AnimatedPropName::BackgroundColor &&
+      name <= AnimatedPropName::BorderEndColor;
+}
+
+std::optional<AnimatedTransformOperationType>
+animatedTransformOperationTypeFromString(std::string_view name) {
+  for (const auto& [type, string] : sTransformOperationNames) {
+    if (string == name) {
+      return type;
+    }
+  }
+  return std::nullopt;
+}
+
+std::string_view animatedTransformOperationTypeToString(
+    AnimatedTransformOperationType type) {
+  for (const auto& [operationType, string] : sTransformOperationNames) {
+    if (operationType == type) {
+      return string;
+    }
+  }
+  return {};
+}
+
+folly::dynamic animatedPropsToDynamic(const AnimatedProps& animatedProps) {
+  folly::dynamic result = folly::dynamic::object();
+  for (const auto& [name, string] : sAnimatedPropNames) {
+    if (!animatedProps.has(name)) {
+      continue;
+    }
+    auto key = std::string(string);
+    if (isColorAnimatedPropName(name)) {
+      result[key] = static_cast<int32_t>(animatedProps.get(name));
+    } else {
+      result[key] = animatedProps.get(name);
+    }
+  }
+  if (animatedProps.hasTransform()) {
+    auto transform = folly::dynamic::array();
+    for (size_t i = 0; i < animatedProps.transformOperationsCount(); i++) {
+      const auto& operation = animatedProps.transformOperation(i);
+      transform.push_back(folly::dynamic::object(
+          std::string(animatedTransformOperationTypeToString(operation.type)),
+          operation.value));
+    }
+    result["transform"] = std::move(transform);
+  }
+  return result;
+}
+
+void applyAnimatedPropsToViewProps(
+    const AnimatedProps& animatedProps,
+    ViewProps& viewProps) {
+  for (size_t i = 0; i < AnimatedPropNameCount; i++) {
+    auto name = static_cast<AnimatedPropName>(i);
+    if (!animatedProps.has(name)) {
+      continue;
+    }
+    auto value = animatedProps.get(name);
+    auto radius = ValueUnit(static_cast<Float>(value), UnitType::Point);
+    switch (name) {
+      case AnimatedPropName::Opacity:
+        viewProps.opacity = static_cast<Float>(value);
+        break;
+      case AnimatedPropName::ZIndex:
+        viewProps.zIndex = static_cast<int>(value);
+        break;
+      case AnimatedPropName::ShadowOpacity:
+        viewProps.shadowOpacity = static_cast<Float>(value);
+        break;
+      case AnimatedPropName::ShadowRadius:
+        viewProps.shadowRadius = static_cast<Float>(value);
+        break;
+      case AnimatedPropName::BackgroundColor:
+        viewProps.backgroundColor = colorFromARGB(static_cast<int32_t>(value));
+        break;
+      case AnimatedPropName::BorderColor:
+        viewProps.borderColors.all = colorFromARGB(static_cast<int32_t>(value));
+        break;
+      case AnimatedPropName::BorderLeftColor:
+        viewProps.borderColors.left =
+            colorFromARGB(static_cast<int32_t>(value));
+        break;
+      case AnimatedPropName::BorderTopColor:
+        viewProps.borderColors.top = colorFromARGB(static_cast<int32_t>(value));
+        break;
+      case AnimatedPropName::BorderRightColor:
+        viewProps.borderColors.right =
+            colorFromARGB(static_cast<int32_t>(value));
+        break;
+      case AnimatedPropName::BorderBottomColor:
+        viewProps.borderColors.bottom =
+            colorFromARGB(static_cast<int32_t>(value));
+        break;
+      case AnimatedPropName::BorderStartColor:
+        viewProps.borderColors.start =
+            colorFromARGB(static_cast<int32_t>(value));
+        break;
+      case AnimatedPropName::BorderEndColor:
+        viewProps.borderColors.end = colorFromARGB(static_cast<int32_t>(value));
+        break;
+      case AnimatedPropName::BorderRadius:
+        viewProps.borderRadii.all = radius;
+        break;
+      case AnimatedPropName::BorderTopLeftRadius:
+        viewProps.borderRadii.topLeft = radius;
+        break;
+      case AnimatedPropName::BorderTopRightRadius:
+        viewProps.borderRadii.topRight = radius;
+        break;
+      case AnimatedPropName::BorderBottomLeftRadius:
+        viewProps.borderRadii.bottomLeft = radius;
+        break;
+      case AnimatedPropName::BorderBottomRightRadius:
+        viewProps.borderRadii.bottomRight = radius;
+        break;
+      case AnimatedPropName::BorderTopStartRadius:
+        viewProps.borderRadii.topStart = radius;
+        break;
+      case AnimatedPropName::BorderTopEndRadius:
+        viewProps.borderRadii.topEnd = radius;
+        break;
+      case AnimatedPropName::BorderBottomStartRadius:
+        viewProps.borderRadii.bottomStart = radius;
+        break;
+      case AnimatedPropName::BorderBottomEndRadius:
+        viewProps.borderRadii.bottomEnd = radius;
+        break;
+      case AnimatedPropName::BorderEndEndRadius:
+        viewProps.borderRadii.endEnd = radius;
+        break;
+      case AnimatedPropName::BorderEndStartRadius:
+        viewProps.borderRadii.endStart = radius;
+        break;
+      case AnimatedPropName::BorderStartEndRadius:
+        viewProps.borderRadii.startEnd = radius;
+        break;
+      case AnimatedPropName::BorderStartStartRadius:
+        viewProps.borderRadii.startStart = radius;
+        break;
+    }
+  }
+
+  if (animatedProps.hasTransform()) {
+    auto transform = Transform{};
+    transform.operations.reserve(animatedProps.transformOperationsCount());
+    for (size_t i = 0; i < animatedProps.transformOperationsCount(); i++) {
+      transform.operations.push_back(
+          toTransformOperation(animatedProps.transformOperation(i)));
+    }
+    viewProps.transform = std::move(transform);
+  }
+}
+
+Props::Shared cloneViewPropsWithAnimatedProps(
+    const ComponentDescriptor& componentDescriptor,
+    const PropsParserContext& context,
+    const Props::Shared& props,
+    const AnimatedProps& animatedProps) {
+  if (dynamic_cast<const ViewProps*>(props.get()) == nullptr) {
+    // Only `ViewProps` have the typed fields, other props parse the animated
+    // props from `RawProps`
+    return componentDescriptor.cloneProps(
+        context, props, RawProps(animatedPropsToDynamic(animatedProps)));
+  }
+
+  auto clonedProps = componentDescriptor.cloneProps(context, props, {});
+  react_native_assert(clonedProps != nullptr);
+
+  // Same approach as `interpolateViewProps`: the clone is a fresh object owned
+  // only by us, so it is safe to mutate it before it is published.
+  auto* viewProps =
+      const_cast<ViewProps*>(static_cast<const ViewProps*>(clonedProps.get()));
+  applyAnimatedPropsToViewProps(animatedProps, *viewProps);
+
+#ifdef ANDROID
+  // Android mounts from `rawProps`, keep them in sync with the typed fields.
+  if (!viewProps->rawProps.isNull()) {
+    for (const auto& pair : animatedPropsToDynamic(animatedProps).items()) {
+      viewProps->rawProps[pair.first] = pair.second;
+    }
+  }
+#endif
+
+  return clonedProps;
+}
+
+} // namespace facebook::react
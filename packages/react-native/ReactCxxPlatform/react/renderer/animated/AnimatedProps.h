@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <folly/dynamic.h>
+#include <react/renderer/core/ComponentDescriptor.h>
+#include <react/renderer/core/Props.h>
+#include <react/renderer/core/PropsParserContext.h>
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace facebook::react {
+
+class ViewProps;
+
+/*
+ * Props which can be produced by native animated nodes without going through
+ * `folly::dynamic`. This is the subset of the direct manipulation allowlist
+ * (see NativeAnimatedAllowlist.h) which maps onto `ViewProps` fields on every
+ * platform.
+ */
+enum class AnimatedPropName : uint8_t {
+  Opacity,
+  ZIndex,
+  ShadowOpacity,
+  ShadowRadius,
+  // Colors, stored as ARGB integers
+  BackgroundColor,
+  BorderColor,
+  BorderLeftColor,
+  BorderTopColor,
+  BorderRightColor,
+  BorderBottomColor,
+  BorderStartColor,
+  BorderEndColor,
+  // Radii
+  BorderRadius,
+  BorderTopLeftRadius,
+  BorderTopRightRadius,
+  BorderBottomLeftRadius,
+  BorderBottomRightRadius,
+  BorderTopStartRadius,
+  BorderTopEndRadius,
+  BorderBottomStartRadius,
+  BorderBottomEndRadius,
+  BorderEndEndRadius,
+  BorderEndStartRadius,
+  BorderStartEndRadius,
+  BorderStartStartRadius,
+};
+
+constexpr size_t AnimatedPropNameCount =
+    static_cast<size_t>(AnimatedPropName::BorderStartStartRadius) + 1;
+
+enum class AnimatedTransformOperationType : uint8_t {
+  Perspective,
+  Rotate,
+  RotateX,
+  RotateY,
+  Scale,
+  ScaleX,
+  ScaleY,
+  TranslateX,
+  TranslateY,
+  SkewX,
+  SkewY,
+};
+
+struct AnimatedTransformOperation {
+  AnimatedTransformOperationType type{AnimatedTransformOperationType::Scale};
+  double value{0.0};
+};
+
+/*
+ * Fixed-layout container for the output of a Props/Style animated node.
+ * Writing to it never allocates, so it can be filled on every animation frame
+ * and handed to consumers which apply it directly onto `ViewProps`.
+ */
+struct AnimatedProps {
+  static constexpr size_t MaxTransformOperations = 8;
+
+  bool has(AnimatedPropName name) const {
+    return mask_.test(static_cast<size_t>(name));
+  }
+
+  double get(AnimatedPropName name) const {
+    return values_[static_cast<size_t>(name)];
+  }
+
+  void set(AnimatedPropName name, double value) {
+    mask_.set(static_cast<size_t>(name));
+    values_[static_cast<size_t>(name)] = value;
+  }
+
+  bool hasTransform() const {
+    return hasTransform_;
+  }
+
+  /*
+   * Resets the transform list; must be called before pushing the operations
+   * of a new transform.
+   */
+  void beginTransform() {
+    hasTransform_ = true;
+    transformOperationsCount_ = 0;
+  }
+
+  /*
+   * Returns `false` if the operation does not fit into the fixed-size storage.
+   */
+  bool pushTransformOperation(AnimatedTransformOperation operation) {
+    if (transformOperationsCount_ >= MaxTransformOperations) {
+      return false;
+    }
+    transformOperations_[transformOperationsCount_++] = operation;
+    return true;
+  }
+
+  size_t transformOperationsCount() const {
+    return transformOperationsCount_;
+  }
+
+  const AnimatedTransformOperation& transformOperation(size_t index) const {
+    return transformOperations_[index];
+  }
+
+  bool empty() const {
+    return mask_.none() && !hasTransform_;
+  }
+
+  void clear() {
+    mask_.reset();
+    hasTransform_ = false;
+    transformOperationsCount_ = 0;
+  }
+
+  /*
+   * Copies every prop set on `other` into this object, the same way
+   * `folly::dynamic` objects are merged when committing props.
+   */
+  void merge(const AnimatedProps& other);
+
+ private:
+  std::bitset<AnimatedPropNameCount> mask_{};
+  std::array<double, AnimatedPropNameCount> values_{};
+  std::array<AnimatedTransformOperation, MaxTransformOperations>
+      transformOperations_{};
+  uint8_t transformOperationsCount_{0};
+  bool hasTransform_{false};
+};
+
+std::optional<AnimatedPropName> animatedPropNameFromString(
+    std::string_view name);
+
+std::string_view animatedPropNameToString(AnimatedPropName name);
+
+bool isColorAnimatedPropName(AnimatedPropName name);
+
+std::optional<AnimatedTransformOperationType>
+animatedTransformOperationTypeFromString(std::string_view name);
+
+std::string_view animatedTransformOperationTypeToString(
+    AnimatedTransformOperationType type);
+
+/*
+ * Converts typed animated props into the `folly::dynamic` representation
+ * consumed by `RawProps`. Used for consumers which have not adopted the typed
+ * path yet.
+ */
+folly::dynamic animatedPropsToDynamic(const AnimatedProps& animatedProps);
+
+/*
+ * Writes typed animated props onto `viewProps` in place. Produces the same
+ * values `ViewProps` would have parsed from `animatedPropsToDynamic`.
+ */
+void applyAnimatedPropsToViewProps(
+    const AnimatedProps& animatedProps,
+    ViewProps& viewProps);
+
+/*
+ * Clones `props` with the given component descriptor and applies the typed
+ * animated props to the copy, bypassing `RawProps` parsing. Props which are
+ * not `ViewProps` are cloned from the `folly::dynamic` representation instead.
+ */
+Props::Shared cloneViewPropsWithAnimatedProps(
+    const ComponentDescriptor& componentDescriptor,
+    const PropsParserContext& context,
+    const Props::Shared& props,
+    const AnimatedProps& animatedProps);
+
+} // namespace facebook::react
@@ -10,8 +10,10 @@
 #include <folly/json.h>
 #include <glog/logging.h>
 #include <react/debug/react_native_assert.h>
+#include <react/profiling/FrameTimeline.h>
 #include <react/profiling/perfetto.h>
 #include <react/renderer/animated/drivers/AnimationDriver.h>
+#include <react/renderer/animated/drivers/AnimationDriverBatch.h>
 #include <react/renderer/animated/drivers/AnimationDriverUtils.h>
 #include <react/renderer/animated/drivers/DecayAnimationDriver.h>
 #include <react/renderer/animated/drivers/FrameAnimationDriver.h>
@@ -32,16 +34,12 @@
 #include <react/renderer/animated/nodes/TransformAnimatedNode.h>
 #include <react/renderer/animated/nodes/ValueAnimatedNode.h>
 #include <react/renderer/core/EventEmitter.h>
+#include <algorithm>
 
 namespace facebook::react {
 
 namespace {
 
-struct NodesQueueItem {
-  std::shared_ptr<AnimatedNode> node;
-  bool connectedToFinishedAnimation;
-};
-
 void mergeObjects(folly::dynamic& out, const folly::dynamic& objectToMerge) {
   react_native_assert(objectToMerge.isObject());
   if (out.isObject() && !out.empty()) {
@@ -60,11 +58,14 @@ NativeAnimatedNodesManager::NativeAnimatedNodesManager(
     FabricCommitCallback&& fabricCommitCallback,
     StartOnRenderCallback&& startOnRenderCallback,
     StopOnRenderCallback&& stopOnRenderCallback) noexcept
-    : directManipulationCallback_(std::move(directManipulationCallback)),
+    : animationDriverBatch_(std::make_unique<AnimationDriverBatch>()),
+      directManipulationCallback_(std::move(directManipulationCallback)),
       fabricCommitCallback_(std::move(fabricCommitCallback)),
       startOnRenderCallback_(std::move(startOnRenderCallback)),
       stopOnRenderCallback_(std::move(stopOnRenderCallback)) {}
 
+NativeAnimatedNodesManager::~NativeAnimatedNodesManager() = default;
+
 std::optional<double> NativeAnimatedNodesManager::getValue(Tag tag) {
   auto node = getAnimatedNode<ValueAnimatedNode>(tag);
   if (node) {
@@ -147,6 +148,7 @@ void NativeAnimatedNodesManager::createAnimatedNode(
     std::lock_guard<std::mutex> lock(connectedAnimatedNodesMutex_);
     animatedNodes_.emplace(tag, std::move(node));
     updatedNodeTags_.insert(tag);
+    graphGeneration_++;
   }
 }
 
@@ -236,6 +238,7 @@ void NativeAnimatedNodesManager::restoreDefaultValues(Tag tag) {
 void NativeAnimatedNodesManager::dropAnimatedNode(Tag tag) {
   std::lock_guard<std::mutex> lock(connectedAnimatedNodesMutex_);
   animatedNodes_.erase(tag);
+  graphGeneration_++;
 }
 
 // mutations
@@ -258,7 +261,9 @@ void NativeAnimatedNodesManager::stopAnimationsForNode(Tag nodeTag) {
     }
   }
   for (const auto& id : discardedAnimIds) {
-    activeAnimations_.at(id)->stopAnimation();
+    auto& driver = activeAnimations_.at(id);
+    driver->stopAnimation();
+    animationDriverBatch_->removeDriver(*driver);
     activeAnimations_.erase(id);
   }
 }
@@ -316,6 +321,7 @@ void NativeAnimatedNodesManager::startAnimatingNode(
       }
       if (animation) {
         activeAnimations_.insert({animationId, animation});
+        animationDriverBatch_->addDriver(*animation);
         animation->startAnimation();
       }
     } else {
@@ -330,6 +336,7 @@ void NativeAnimatedNodesManager::stopAnimation(
   if (auto iter = activeAnimations_.find(animationId);
       iter != activeAnimations_.end()) {
     iter->second->stopAnimation();
+    animationDriverBatch_->removeDriver(*iter->second);
     activeAnimations_.erase(iter);
   }
 }
@@ -479,7 +486,8 @@ bool NativeAnimatedNodesManager::isAnimationUpdateNeeded() const {
 
 void NativeAnimatedNodesManager::updateNodes(
     const std::set<int>& finishedAnimationValueNodes) {
-  auto nodesQueue = std::deque<NodesQueueItem>{};
+  auto& nodesQueue = nodesQueue_;
+  nodesQueue.clear();
 
   const auto is_node_connected_to_finished_animation =
       [&finishedAnimationValueNodes](
@@ -521,9 +529,9 @@ void NativeAnimatedNodesManager::updateNodes(
     }
   }
 
-  while (!nodesQueue.empty()) {
-    auto nextNode = std::move(nodesQueue.front());
-    nodesQueue.pop_front();
+  for (size_t head = 0; head < nodesQueue.size(); head++) {
+    // Moved out, as appending children may reallocate the queue
+    auto nextNode = std::move(nodesQueue[head]);
     // in Animated, value nodes like RGBA are parents and Color node is child
     // (the opposite of tree structure)
     for (const auto childTag : nextNode.node->children()) {
@@ -558,6 +566,7 @@ void NativeAnimatedNodesManager::updateNodes(
     animatedGraphBFSColor_++;
   }
 
+  nodesQueue.clear();
   for (const auto& nodeTag : updatedNodeTags_) {
     if (auto node = getAnimatedNode<AnimatedNode>(nodeTag)) {
       if (node->activeIncomingNodes == 0 &&
@@ -578,9 +587,8 @@ void NativeAnimatedNodesManager::updateNodes(
 #ifdef REACT_NATIVE_DEBUG
   int cyclesDetected = 0;
 #endif
-  while (!nodesQueue.empty()) {
-    auto nextNode = std::move(nodesQueue.front());
-    nodesQueue.pop_front();
+  for (size_t head = 0; head < nodesQueue.size(); head++) {
+    auto nextNode = std::move(nodesQueue[head]);
     if (nextNode.connectedToFinishedAnimation &&
         nextNode.node->type() == AnimatedNodeType::Props) {
       if (auto propsNode =
@@ -639,16 +647,17 @@ void NativeAnimatedNodesManager::updateNodes(
   }
 #endif
 
+  // Releases the nodes, keeping the capacity for the next frame
+  nodesQueue.clear();
   updatedNodeTags_.clear();
 }
 
 bool NativeAnimatedNodesManager::onAnimationFrame(uint64_t timestamp) {
-  // Run all active animations
+  // Run all active animations, stepping drivers of the same type together
   auto hasFinishedAnimations = false;
   std::set<int> finishedAnimationValueNodes;
+  animationDriverBatch_->runAnimationStep(static_cast<double>(timestamp));
   for (const auto& [_id, driver] : activeAnimations_) {
-    driver->runAnimationStep(timestamp);
-
     if (driver->isComplete()) {
       hasFinishedAnimations = true;
       finishedAnimationValueNodes.insert(driver->animatedValueTag());
@@ -670,6 +679,7 @@ bool NativeAnimatedNodesManager::onAnimationFrame(uint64_t timestamp) {
       }
     }
     for (const auto& id : finishedAnimations) {
+      animationDriverBatch_->removeDriver(*activeAnimations_.at(id));
       activeAnimations_.erase(id);
     }
   }
@@ -690,6 +700,19 @@ std::optional<folly::dynamic> NativeAnimatedNodesManager::managedProps(
   return {};
 }
 
+std::optional<AnimatedProps> NativeAnimatedNodesManager::managedAnimatedProps(
+    Tag tag) {
+  std::lock_guard<std::mutex> lock(connectedAnimatedNodesMutex_);
+  const auto iter = connectedAnimatedNodes_.find(tag);
+  if (iter != connectedAnimatedNodes_.end()) {
+    if (const auto node = getAnimatedNode<PropsAnimatedNode>(iter->second)) {
+      return node->animatedProps();
+    }
+  }
+
+  return {};
+}
+
 bool NativeAnimatedNodesManager::isOnRenderThread() const {
   return isOnRenderThread_;
 }
@@ -736,9 +759,35 @@ void NativeAnimatedNodesManager::schedulePropsCommit(
   }
 }
 
+void NativeAnimatedNodesManager::schedulePropsCommit(
+    Tag viewTag,
+    const AnimatedProps& props,
+    bool layoutStyleUpdated,
+    bool forceFabricCommit) {
+  if (fabricCommitCallback_ != nullptr &&
+      (layoutStyleUpdated || forceFabricCommit ||
+       directManipulationCallback_ == nullptr)) {
+    // Fabric commits go through RawProps, they are infrequent enough (e.g. at
+    // the end of an animation) that the conversion does not matter.
+    mergeObjects(updateViewProps_[viewTag], animatedPropsToDynamic(props));
+  } else if (directManipulationCallback_ != nullptr) {
+    auto it = std::find_if(
+        updateViewAnimatedPropsDirect_.begin(),
+        updateViewAnimatedPropsDirect_.end(),
+        [viewTag](const auto& entry) { return entry.first == viewTag; });
+    if (it != updateViewAnimatedPropsDirect_.end()) {
+      it->second.merge(props);
+    } else {
+      updateViewAnimatedPropsDirect_.emplace_back(viewTag, props);
+    }
+  }
+}
+
 void NativeAnimatedNodesManager::onRender() {
   TRACE_EVENT("rncxx", "NativeAnimatedNodesManager::onRender");
   TRACE_COUNTER("rncxx", "numActiveAnimations", activeAnimations_.size());
+  FrameTimelinePhaseBlock frameTimelinePhase{
+      FrameTimeline::Phase::AnimationTick};
 
   isOnRenderThread_ = true;
 
@@ -775,8 +824,9 @@ void NativeAnimatedNodesManager::onRender() {
 }
 
 bool NativeAnimatedNodesManager::commitProps() {
-  bool containsChange =
-      !updateViewProps_.empty() || !updateViewPropsDirect_.empty();
+  bool containsChange = !updateViewProps_.empty() ||
+      !updateViewPropsDirect_.empty() ||
+      !updateViewAnimatedPropsDirect_.empty();
 
   if (fabricCommitCallback_ != nullptr) {
     if (!updateViewProps_.empty()) {
@@ -793,6 +843,16 @@ bool NativeAnimatedNodesManager::commitProps() {
       directManipulationCallback_(viewTag, folly::dynamic(props));
     }
     updateViewPropsDirect_.clear();
+
+    for (const auto& [viewTag, props] : updateViewAnimatedPropsDirect_) {
+      if (animatedPropsDirectManipulationCallback_ != nullptr) {
+        animatedPropsDirectManipulationCallback_(viewTag, props);
+      } else {
+        directManipulationCallback_(viewTag, animatedPropsToDynamic(props));
+      }
+    }
+    // Keeps the capacity for the next frame
+    updateViewAnimatedPropsDirect_.clear();
   } else {
     LOG(ERROR)
         << "Failed to commit native animation, since direct manipulation callback is not set";
@@ -11,6 +11,7 @@
 #include <folly/dynamic.h>
 #include <react/bridging/Function.h>
 #include <react/debug/flags.h>
+#include <react/renderer/animated/AnimatedProps.h>
 #include <react/renderer/animated/EventEmitterListener.h>
 #include <react/renderer/animated/event_drivers/EventAnimationDriver.h>
 #include <react/renderer/core/ReactPrimitives.h>
@@ -25,6 +26,7 @@ namespace facebook::react {
 
 class AnimatedNode;
 class AnimationDriver;
+class AnimationDriverBatch;
 class Scheduler;
 
 using ValueListenerCallback = std::function<void(double)>;
@@ -46,6 +48,8 @@ class NativeAnimatedNodesManager
  public:
   using DirectManipulationCallback =
       std::function<void(Tag, const folly::dynamic&)>;
+  using AnimatedPropsDirectManipulationCallback =
+      std::function<void(Tag, const AnimatedProps&)>;
   using FabricCommitCallback =
       std::function<void(std::unordered_map<Tag, folly::dynamic>&)>;
   using StartOnRenderCallback = std::function<void(std::function<void()>&&)>;
@@ -57,7 +61,7 @@ class NativeAnimatedNodesManager
       StartOnRenderCallback&& startOnRenderCallback = nullptr,
       StopOnRenderCallback&& stopOnRenderCallback = nullptr) noexcept;
 
-  ~NativeAnimatedNodesManager() = default;
+  ~NativeAnimatedNodesManager();
 
   template <
       typename T,
@@ -73,6 +77,14 @@ class NativeAnimatedNodesManager
 
   std::optional<double> getValue(Tag tag);
 
+  /*
+   * Incremented whenever a node is created or dropped, which changes how
+   * the nodes referencing it by tag resolve their props.
+   */
+  uint64_t getGraphGeneration() const {
+    return graphGeneration_;
+  }
+
   // graph
 
   void createAnimatedNode(Tag tag, const folly::dynamic& config);
@@ -138,6 +150,27 @@ class NativeAnimatedNodesManager
       bool layoutStyleUpdated,
       bool forceFabricCommit);
 
+  /*
+   * Typed counterpart of `schedulePropsCommit`, used by props nodes whose
+   * output is fully covered by `AnimatedProps`. Direct manipulation updates
+   * scheduled this way are buffered without building a `folly::dynamic`.
+   */
+  void schedulePropsCommit(
+      Tag viewTag,
+      const AnimatedProps& props,
+      bool layoutStyleUpdated,
+      bool forceFabricCommit);
+
+  /*
+   * Sets a callback receiving typed direct manipulation updates. When it is
+   * not set, typed updates are converted and passed to the
+   * `DirectManipulationCallback` instead.
+   */
+  void setAnimatedPropsDirectManipulationCallback(
+      AnimatedPropsDirectManipulationCallback&& callback) {
+    animatedPropsDirectManipulationCallback_ = std::move(callback);
+  }
+
   /**
    * Commits all pending animated property updates to their respective views.
    *
@@ -170,6 +203,8 @@ class NativeAnimatedNodesManager
 
   std::optional<folly::dynamic> managedProps(Tag tag);
 
+  std::optional<AnimatedProps> managedAnimatedProps(Tag tag);
+
   bool isOnRenderThread() const;
 
  private:
@@ -195,12 +230,22 @@ class NativeAnimatedNodesManager
   std::unordered_map<Tag, std::shared_ptr<AnimatedNode>> animatedNodes_;
   std::unordered_map<Tag, Tag> connectedAnimatedNodes_;
   std::unordered_map<int, std::shared_ptr<AnimationDriver>> activeAnimations_;
+  std::unique_ptr<AnimationDriverBatch> animationDriverBatch_;
   std::unordered_map<
       EventAnimationDriverKey,
       std::vector<std::unique_ptr<EventAnimationDriver>>,
       std::hash<facebook::react::EventAnimationDriverKey>>
       eventDrivers_;
   std::unordered_set<Tag> updatedNodeTags_;
+  uint64_t graphGeneration_{0};
+
+  struct NodesQueueItem {
+    std::shared_ptr<AnimatedNode> node;
+    bool connectedToFinishedAnimation;
+  };
+  // FIFO of the graph traversals of `updateNodes`, reused across frames so
+  // that they do not allocate
+  std::vector<NodesQueueItem> nodesQueue_;
 
   std::mutex connectedAnimatedNodesMutex_;
 
@@ -211,6 +256,8 @@ class NativeAnimatedNodesManager
 
   // React context required to commit props onto Component View
   DirectManipulationCallback directManipulationCallback_;
+  AnimatedPropsDirectManipulationCallback
+      animatedPropsDirectManipulationCallback_;
   FabricCommitCallback fabricCommitCallback_;
   StartOnRenderCallback startOnRenderCallback_;
   StopOnRenderCallback stopOnRenderCallback_;
@@ -219,6 +266,8 @@ class NativeAnimatedNodesManager
 
   std::unordered_map<Tag, folly::dynamic> updateViewProps_{};
   std::unordered_map<Tag, folly::dynamic> updateViewPropsDirect_{};
+  // Reused across frames so that typed updates do not allocate
+  std::vector<std::pair<Tag, AnimatedProps>> updateViewAnimatedPropsDirect_{};
 
   int animatedGraphBFSColor_ = 0;
 #ifdef REACT_NATIVE_DEBUG
@@ -107,7 +107,18 @@ NativeAnimatedNodesManagerProvider::getOrCreate(jsi::Runtime& runtime) {
                 }
                 return std::nullopt;
               },
-              uiManagerBinding_);
+              uiManagerBinding_,
+              [nativeAnimatedNodesManager =
+                   std::weak_ptr<NativeAnimatedNodesManager>(
+                       nativeAnimatedNodesManager_)](
+                  Tag tag) -> std::optional<AnimatedProps> {
+                if (auto nativeAnimatedNodesManagerStrong =
+                        nativeAnimatedNodesManager.lock()) {
+                  return nativeAnimatedNodesManagerStrong->managedAnimatedProps(
+                      tag);
+                }
+                return std::nullopt;
+              });
 
       // Register on existing surfaces
       uiManagerBinding->getUIManager().getShadowTreeRegistry().enumerate(
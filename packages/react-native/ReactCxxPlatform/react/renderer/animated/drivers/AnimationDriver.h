@@ -30,7 +30,8 @@ class AnimationDriver : public std::enable_shared_from_this<AnimationDriver> {
       Tag animatedValueTag,
       std::optional<AnimationEndCallback> endCallback,
       folly::dynamic config,
-      NativeAnimatedNodesManager* manager);
+      NativeAnimatedNodesManager* manager,
+      AnimationDriverType type);
   virtual ~AnimationDriver() = default;
   void startAnimation();
   void stopAnimation(bool ignoreCompletedHandlers = false);
@@ -43,6 +44,10 @@ class AnimationDriver : public std::enable_shared_from_this<AnimationDriver> {
     return animatedValueTag_;
   }
 
+  AnimationDriverType type() const {
+    return type_;
+  }
+
   inline std::optional<AnimationEndCallback> endCallback() noexcept {
     return endCallback_;
   }
@@ -70,10 +75,24 @@ class AnimationDriver : public std::enable_shared_from_this<AnimationDriver> {
       const std::string& driverTypeName);
 
  protected:
+  struct AnimationStep {
+    double timeDeltaMs;
+    bool restarting;
+  };
+
   virtual bool update(double /*timeDeltaMs*/, bool /*restarting*/) {
     return true;
   }
 
+  /*
+   * `runAnimationStep` split around `update`, so that drivers of the same
+   * type can be stepped together by `AnimationDriverBatch`. Returns
+   * `std::nullopt` if the driver should not be updated on this frame.
+   */
+  std::optional<AnimationStep> beginAnimationStep(double renderingTime);
+
+  void endAnimationStep(bool isComplete);
+
   void markNodeUpdated(Tag tag) {
     manager_->updatedNodeTags_.insert(tag);
   }
@@ -95,6 +114,8 @@ class AnimationDriver : public std::enable_shared_from_this<AnimationDriver> {
 
  private:
   void onConfigChanged();
+
+  AnimationDriverType type_;
 };
 
 } // namespace facebook::react
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace facebook::react {
+
+class AnimationDriver;
+class DecayAnimationDriver;
+class FrameAnimationDriver;
+class SpringAnimationDriver;
+class ValueAnimatedNode;
+
+/*
+ * Steps active animation drivers grouped by type instead of through one
+ * virtual call per driver.
+ *
+ * Spring and decay drivers keep their parameters in structure-of-arrays
+ * rows for as long as they are in the batch. Their parameters only change
+ * when a step restarts (first step, new iteration, new config), so a row is
+ * refreshed on those steps only, and other frames only write the time of
+ * each driver before a branch-light loop evaluates the closed-form
+ * solutions over the rows. The math is shared with the drivers' own
+ * `update`, so results and completion are identical to stepping each driver
+ * individually.
+ *
+ * Stepping does not allocate once the buffers reached the number of active
+ * animations.
+ */
+class AnimationDriverBatch {
+ public:
+  /*
+   * Drivers must be removed before they are destroyed.
+   */
+  void addDriver(AnimationDriver& driver);
+  void removeDriver(AnimationDriver& driver);
+
+  /*
+   * Equivalent to calling `runAnimationStep(renderingTime)` on each driver
+   * of the batch.
+   */
+  void runAnimationStep(double renderingTime);
+
+ private:
+  // One row per driver, in the order of `drivers`
+  struct SpringRows {
+    std::vector<SpringAnimationDriver*> drivers;
+    std::vector<double> startValues;
+    std::vector<double> endValues;
+    std::vector<double> velocities;
+    std::vector<double> dampings;
+    std::vector<double> masses;
+    std::vector<double> stiffnesses;
+    std::vector<double> times;
+    // Whether the driver is updated on the current frame
+    std::vector<uint8_t> stepped;
+
+    void resize(size_t size);
+    void swapRemove(size_t index);
+  };
+
+  struct DecayRows {
+    std::vector<DecayAnimationDriver*> drivers;
+    std::vector<double> startValues;
+    std::vector<double> velocities;
+    std::vector<double> decelerations;
+    std::vector<double> times;
+    std::vector<uint8_t> stepped;
+    std::vector<uint8_t> restarting;
+
+    void resize(size_t size);
+    void swapRemove(size_t index);
+  };
+
+  void runSpringAnimationStep(double renderingTime);
+  void runDecayAnimationStep(double renderingTime);
+  void runFrameAnimationStep(double renderingTime);
+
+  SpringRows springRows_;
+  DecayRows decayRows_;
+  std::vector<FrameAnimationDriver*> frameDrivers_;
+
+  // Animated nodes of the drivers updated on the current frame, by row
+  std::vector<std::shared_ptr<ValueAnimatedNode>> nodes_;
+
+  // Step results, by row
+  std::vector<float> outputValues_;
+  std::vector<double> outputVelocities_;
+};
+
+} // namespace facebook::react
@@ -25,57 +25,72 @@ DecayAnimationDriver::DecayAnimationDriver(
           animatedValueTag,
           std::move(endCallback),
           config,
-          manager),
+          manager,
+          AnimationDriverType::Decay),
       velocity_(config["velocity"].asDouble()),
       deceleration_(config_["deceleration"].asDouble()) {
   react_native_assert(deceleration_ > 0);
 }
 
 std::tuple<float, double> DecayAnimationDriver::getValueAndVelocityForTime(
-    double time) const {
-  const auto value = fromValue_.value() +
-      velocity_ / (1 - deceleration_) *
-          (1 - std::exp(-(1 - deceleration_) * (1000 * time)));
+    double fromValue,
+    double velocity,
+    double deceleration,
+    double time) {
+  const auto value = fromValue +
+      velocity / (1 - deceleration) *
+          (1 - std::exp(-(1 - deceleration) * (1000 * time)));
   return std::make_tuple(
       static_cast<float>(value),
       42.0f); // we don't need the velocity, so set it to a dummy value
 }
 
 bool DecayAnimationDriver::update(double timeDeltaMs, bool restarting) {
-  if (const auto node =
-          manager_->getAnimatedNode<ValueAnimatedNode>(animatedValueTag_)) {
-    if (restarting) {
-      const auto value = node->rawValue();
-      if (!fromValue_.has_value()) {
-        // First iteration, assign fromValue based on AnimatedValue
-        fromValue_ = value;
-      } else {
-        // Not the first iteration, reset AnimatedValue based on
-        // originalValue
-        if (node->setRawValue(fromValue_.value())) {
-          markNodeUpdated(node->tag());
-        }
-      }
+  if (const auto node = prepareStep(restarting)) {
+    const auto [value, velocity] = getValueAndVelocityForTime(
+        fromValue_.value(), velocity_, deceleration_, timeDeltaMs / 1000.0);
+    return finishStep(*node, value, restarting);
+  }
 
-      lastValue_ = value;
-    }
+  return true;
+}
 
-    const auto [value, velocity] =
-        getValueAndVelocityForTime(timeDeltaMs / 1000.0);
-    auto isComplete =
-        lastValue_.has_value() && std::abs(value - lastValue_.value()) < 0.1;
-    if (!restarting && isComplete) {
-      return true;
+std::shared_ptr<ValueAnimatedNode> DecayAnimationDriver::prepareStep(
+    bool restarting) {
+  auto node = manager_->getAnimatedNode<ValueAnimatedNode>(animatedValueTag_);
+  if (node && restarting) {
+    const auto value = node->rawValue();
+    if (!fromValue_.has_value()) {
+      // First iteration, assign fromValue based on AnimatedValue
+      fromValue_ = value;
     } else {
-      lastValue_ = value;
-      if (node->setRawValue(value)) {
+      // Not the first iteration, reset AnimatedValue based on
+      // originalValue
+      if (node->setRawValue(fromValue_.value())) {
         markNodeUpdated(node->tag());
       }
-      return false;
     }
+
+    lastValue_ = value;
   }
+  return node;
+}
 
-  return true;
+bool DecayAnimationDriver::finishStep(
+    ValueAnimatedNode& node,
+    float value,
+    bool restarting) {
+  auto isComplete =
+      lastValue_.has_value() && std::abs(value - lastValue_.value()) < 0.1;
+  if (!restarting && isComplete) {
+    return true;
+  } else {
+    lastValue_ = value;
+    if (node.setRawValue(value)) {
+      markNodeUpdated(node.tag());
+    }
+    return false;
+  }
 }
 
 } // namespace facebook::react
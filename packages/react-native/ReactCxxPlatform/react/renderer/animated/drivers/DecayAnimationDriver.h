@@ -28,7 +28,25 @@ class DecayAnimationDriver : public AnimationDriver {
   bool update(double timeDeltaMs, bool restarting) override;
 
  private:
-  std::tuple<float, double> getValueAndVelocityForTime(double time) const;
+  friend class AnimationDriverBatch;
+
+  static std::tuple<float, double> getValueAndVelocityForTime(
+      double fromValue,
+      double velocity,
+      double deceleration,
+      double time);
+
+  /*
+   * First half of `update`, handling restarts. Returns the animated node, or
+   * `nullptr` if it is gone, in which case the step is complete.
+   */
+  std::shared_ptr<ValueAnimatedNode> prepareStep(bool restarting);
+
+  /*
+   * Second half of `update`: applies `value` to `node` and returns whether the
+   * animation has settled.
+   */
+  bool finishStep(ValueAnimatedNode& node, float value, bool restarting);
 
  private:
   double velocity_{0};
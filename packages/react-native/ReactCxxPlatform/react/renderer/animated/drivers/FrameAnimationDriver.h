@@ -32,6 +32,8 @@ class FrameAnimationDriver : public AnimationDriver {
   void updateConfig(folly::dynamic config) override;
 
  private:
+  friend class AnimationDriverBatch;
+
   void onConfigChanged();
 
   std::vector<double> frames_{};
@@ -28,7 +28,8 @@ SpringAnimationDriver::SpringAnimationDriver(
           animatedValueTag,
           std::move(endCallback),
           config,
-          manager),
+          manager,
+          AnimationDriverType::Spring),
       springStiffness_(config_["stiffness"].asDouble()),
       springDamping_(config_["damping"].asDouble()),
       springMass_(config_["mass"].asDouble()),
@@ -40,13 +41,18 @@ SpringAnimationDriver::SpringAnimationDriver(
       overshootClampingEnabled_(config_["overshootClamping"].asBool()) {}
 
 std::tuple<float, double> SpringAnimationDriver::getValueAndVelocityForTime(
-    double time) const {
-  const auto startValue = fromValue_.value();
-  const auto toValue = endValue_;
-  const auto c = springDamping_;
-  const auto m = springMass_;
-  const auto k = springStiffness_;
-  const auto v0 = -initialVelocity_;
+    double startValue,
+    double endValue,
+    double damping,
+    double mass,
+    double stiffness,
+    double initialVelocity,
+    double time) {
+  const auto toValue = endValue;
+  const auto c = damping;
+  const auto m = mass;
+  const auto k = stiffness;
+  const auto v0 = -initialVelocity;
 
   const auto zeta = c / (2 * std::sqrt(k * m));
   const auto omega0 = std::sqrt(k / m);
@@ -70,7 +76,7 @@ std::tuple<float, double> SpringAnimationDriver::getValueAndVelocityForTime(
   } else {
     const auto envelope = std::exp(-omega0 * time);
     const auto value = static_cast<float>(
-        endValue_ - envelope * (x0 + (v0 + omega0 * x0) * time));
+        endValue - envelope * (x0 + (v0 + omega0 * x0) * time));
     const auto velocity =
         envelope * (v0 * (time * omega0 - 1) + time * x0 * (omega0 * omega0));
     return std::make_tuple(value, velocity);
@@ -78,55 +84,77 @@ std::tuple<float, double> SpringAnimationDriver::getValueAndVelocityForTime(
 }
 
 bool SpringAnimationDriver::update(double timeDeltaMs, bool restarting) {
-  if (const auto node =
-          manager_->getAnimatedNode<ValueAnimatedNode>(animatedValueTag_)) {
-    if (restarting) {
-      if (!fromValue_.has_value()) {
-        fromValue_ = node->rawValue();
-      } else {
-        if (node->setRawValue(fromValue_.value())) {
-          markNodeUpdated(node->tag());
-        }
-      }
+  if (const auto node = prepareStep(timeDeltaMs, restarting)) {
+    auto [value, velocity] = getValueAndVelocityForTime(
+        fromValue_.value(),
+        endValue_,
+        springDamping_,
+        springMass_,
+        springStiffness_,
+        initialVelocity_,
+        timeAccumulator_ / 1000.0);
+    return finishStep(*node, value, velocity);
+  }
 
-      // Spring animations run a frame behind JS driven animations if we do
-      // not start the first frame at 16ms.
-      lastTime_ = timeDeltaMs - SingleFrameIntervalMs;
-      timeAccumulator_ = 0.0;
-    }
+  return true;
+}
 
-    // clamp the amount of timeDeltaMs to avoid stuttering in the UI.
-    // We should be able to catch up in a subsequent advance if necessary.
-    auto adjustedDeltaTime = timeDeltaMs - lastTime_;
-    if (adjustedDeltaTime > MaxDeltaTimeMs) {
-      adjustedDeltaTime = MaxDeltaTimeMs;
-    }
-    timeAccumulator_ += adjustedDeltaTime;
-    lastTime_ = timeDeltaMs;
-
-    auto [value, velocity] =
-        getValueAndVelocityForTime(timeAccumulator_ / 1000.0);
-
-    auto isComplete = false;
-    if (isAtRest(velocity, value, endValue_) ||
-        (overshootClampingEnabled_ && isOvershooting(value))) {
-      if (springStiffness_ > 0) {
-        value = static_cast<float>(endValue_);
-      } else {
-        endValue_ = value;
-      }
+std::shared_ptr<ValueAnimatedNode> SpringAnimationDriver::prepareStep(
+    double timeDeltaMs,
+    bool restarting) {
+  auto node = manager_->getAnimatedNode<ValueAnimatedNode>(animatedValueTag_);
+  if (!node) {
+    return nullptr;
+  }
 
-      isComplete = true;
+  if (restarting) {
+    if (!fromValue_.has_value()) {
+      fromValue_ = node->rawValue();
+    } else {
+      if (node->setRawValue(fromValue_.value())) {
+        markNodeUpdated(node->tag());
+      }
     }
 
-    if (node->setRawValue(value)) {
-      markNodeUpdated(node->tag());
+    // Spring animations run a frame behind JS driven animations if we do
+    // not start the first frame at 16ms.
+    lastTime_ = timeDeltaMs - SingleFrameIntervalMs;
+    timeAccumulator_ = 0.0;
+  }
+
+  // clamp the amount of timeDeltaMs to avoid stuttering in the UI.
+  // We should be able to catch up in a subsequent advance if necessary.
+  auto adjustedDeltaTime = timeDeltaMs - lastTime_;
+  if (adjustedDeltaTime > MaxDeltaTimeMs) {
+    adjustedDeltaTime = MaxDeltaTimeMs;
+  }
+  timeAccumulator_ += adjustedDeltaTime;
+  lastTime_ = timeDeltaMs;
+
+  return node;
+}
+
+bool SpringAnimationDriver::finishStep(
+    ValueAnimatedNode& node,
+    float value,
+    double velocity) {
+  auto isComplete = false;
+  if (isAtRest(velocity, value, endValue_) ||
+      (overshootClampingEnabled_ && isOvershooting(value))) {
+    if (springStiffness_ > 0) {
+      value = static_cast<float>(endValue_);
+    } else {
+      endValue_ = value;
     }
 
-    return isComplete;
+    isComplete = true;
   }
 
-  return true;
+  if (node.setRawValue(value)) {
+    markNodeUpdated(node.tag());
+  }
+
+  return isComplete;
 }
 
 bool SpringAnimationDriver::isAtRest(
@@ -28,7 +28,36 @@ class SpringAnimationDriver : public AnimationDriver {
   bool update(double timeDeltaMs, bool restarting) override;
 
  private:
-  std::tuple<float, double> getValueAndVelocityForTime(double time) const;
+  friend class AnimationDriverBatch;
+
+  /*
+   * Closed-form spring solution, shared by `update` and the batched stepping
+   * in `AnimationDriverBatch` so both produce identical values.
+   */
+  static std::tuple<float, double> getValueAndVelocityForTime(
+      double startValue,
+      double endValue,
+      double damping,
+      double mass,
+      double stiffness,
+      double initialVelocity,
+      double time);
+
+  /*
+   * First half of `update`: handles restarts and advances the time
+   * accumulator. Returns the animated node, or `nullptr` if it is gone, in
+   * which case the step is complete.
+   */
+  std::shared_ptr<ValueAnimatedNode> prepareStep(
+      double timeDeltaMs,
+      bool restarting);
+
+  /*
+   * Second half of `update`: applies `value` to `node` and returns whether the
+   * spring came to rest.
+   */
+  bool finishStep(ValueAnimatedNode& node, float value, double velocity);
+
   bool isAtRest(double currentVelocity, double currentValue, double endValue)
       const;
   bool isOvershooting(double currentValue) const;
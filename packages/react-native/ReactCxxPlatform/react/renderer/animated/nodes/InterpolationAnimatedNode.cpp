@@ -15,6 +15,7 @@
 #include <react/renderer/animated/drivers/AnimationDriverUtils.h>
 #include <react/renderer/animated/primitives.h>
 #include <react/renderer/graphics/HostPlatformColor.h>
+#include <algorithm>
 
 namespace facebook::react {
 
@@ -42,8 +43,59 @@ InterpolationAnimatedNode::InterpolationAnimatedNode(
     }
   }
 
-  extrapolateLeft_ = nodeConfig["extrapolateLeft"].asString();
-  extrapolateRight_ = nodeConfig["extrapolateRight"].asString();
+  extrapolateLeft_ = parseExtrapolateType(nodeConfig["extrapolateLeft"]);
+  extrapolateRight_ = parseExtrapolateType(nodeConfig["extrapolateRight"]);
+
+  compileSegments();
+}
+
+InterpolationAnimatedNode::ExtrapolateType
+InterpolationAnimatedNode::parseExtrapolateType(const folly::dynamic& value) {
+  if (value.isString()) {
+    const auto& type = value.getString();
+    if (type == ExtrapolateTypeIdentity) {
+      return ExtrapolateType::Identity;
+    } else if (type == ExtrapolateTypeClamp) {
+      return ExtrapolateType::Clamp;
+    }
+  }
+  return ExtrapolateType::Extend;
+}
+
+void InterpolationAnimatedNode::compileSegments() {
+  const auto outputCount = isColorValue_ ? colorOutputRanges_.size()
+                                         : defaultOutputRanges_.size();
+  const auto stopCount = std::min(inputRanges_.size(), outputCount);
+  if (stopCount < 2) {
+    return;
+  }
+
+  if (isColorValue_) {
+    colorOutputChannels_.reserve(stopCount);
+    for (size_t i = 0; i < stopCount; i++) {
+      const auto color = colorOutputRanges_[i];
+      colorOutputChannels_.push_back(
+          {static_cast<double>(alphaFromHostPlatformColor(color)),
+           static_cast<double>(redFromHostPlatformColor(color)),
+           static_cast<double>(greenFromHostPlatformColor(color)),
+           static_cast<double>(blueFromHostPlatformColor(color))});
+    }
+  }
+
+  segments_.reserve(stopCount - 1);
+  for (size_t i = 0; i + 1 < stopCount; i++) {
+    auto segment = Segment{
+        .inputMin = inputRanges_[i],
+        .inputMax = inputRanges_[i + 1],
+        .outputMin = isColorValue_ ? 0 : defaultOutputRanges_[i],
+        .outputMax = isColorValue_ ? 0 : defaultOutputRanges_[i + 1],
+        .slope = 0};
+    if (segment.inputMin != segment.inputMax) {
+      segment.slope = (segment.outputMax - segment.outputMin) /
+          (segment.inputMax - segment.inputMin);
+    }
+    segments_.push_back(segment);
+  }
 }
 
 void InterpolationAnimatedNode::update() {
@@ -73,68 +125,107 @@ void InterpolationAnimatedNode::onAttachToNode(Tag animatedNodeTag) {
   parentTag_ = animatedNodeTag;
 }
 
+size_t InterpolationAnimatedNode::findSegment(double value) {
+  // A value belongs to the first segment whose upper bound is not below it;
+  // values past the last bound extrapolate from the last segment.
+  const auto lastIndex = segments_.size() - 1;
+  const auto isInSegment = [&](size_t index) {
+    return (index == 0 || segments_[index - 1].inputMax < value) &&
+        (index == lastIndex || segments_[index].inputMax >= value);
+  };
+
+  if (lastSegment_ <= lastIndex && isInSegment(lastSegment_)) {
+    return lastSegment_;
+  }
+  if (lastSegment_ < lastIndex && isInSegment(lastSegment_ + 1)) {
+    return ++lastSegment_;
+  }
+  if (lastSegment_ > 0 && lastSegment_ <= lastIndex &&
+      isInSegment(lastSegment_ - 1)) {
+    return --lastSegment_;
+  }
+
+  const auto it = std::lower_bound(
+      segments_.begin(),
+      segments_.end() - 1,
+      value,
+      [](const Segment& segment, double target) {
+        return segment.inputMax < target;
+      });
+  lastSegment_ = static_cast<size_t>(it - segments_.begin());
+  return lastSegment_;
+}
+
 double InterpolationAnimatedNode::interpolateValue(double value) {
-  // Compute range index
-  int index = 1;
-  for (; index < inputRanges_.size() - 1; ++index) {
-    if (inputRanges_[index] >= value) {
-      break;
+  if (segments_.empty()) {
+    return value;
+  }
+
+  const auto& segment = segments_[findSegment(value)];
+  auto result = value;
+
+  // Extrapolate
+  if (result < segment.inputMin) {
+    if (extrapolateLeft_ == ExtrapolateType::Identity) {
+      return result;
+    } else if (extrapolateLeft_ == ExtrapolateType::Clamp) {
+      result = segment.inputMin;
     }
   }
-  index--;
 
-  return interpolate(
-      value,
-      inputRanges_[index],
-      inputRanges_[index + 1],
-      defaultOutputRanges_[index],
-      defaultOutputRanges_[index + 1],
-      extrapolateLeft_,
-      extrapolateRight_);
+  if (result > segment.inputMax) {
+    if (extrapolateRight_ == ExtrapolateType::Identity) {
+      return result;
+    } else if (extrapolateRight_ == ExtrapolateType::Clamp) {
+      result = segment.inputMax;
+    }
+  }
+
+  if (segment.inputMin == segment.inputMax) {
+    if (value <= segment.inputMin) {
+      return segment.outputMin;
+    }
+    return segment.outputMax;
+  }
+
+  return segment.outputMin + segment.slope * (result - segment.inputMin);
 }
 
 double InterpolationAnimatedNode::interpolateColor(double value) {
-  // Compute range index
-  int index = 1;
-  for (; index < inputRanges_.size() - 1; ++index) {
-    if (inputRanges_[index] >= value) {
-      break;
-    }
+  if (segments_.empty()) {
+    return value;
   }
-  index--;
 
+  const auto index = findSegment(value);
   const auto outputMin = colorOutputRanges_[index];
   const auto outputMax = colorOutputRanges_[index + 1];
   if (outputMin == outputMax) {
     return outputMin;
   }
 
-  const auto inputMin = inputRanges_[index];
-  const auto inputMax = inputRanges_[index + 1];
-  if (inputMin == inputMax) {
-    if (value <= inputMin) {
+  const auto& segment = segments_[index];
+  if (segment.inputMin == segment.inputMax) {
+    if (value <= segment.inputMin) {
       return static_cast<int32_t>(outputMin);
     } else {
       return static_cast<int32_t>(outputMax);
     }
   }
 
-  auto ratio = (value - inputMin) / (inputMax - inputMin);
-
-  auto outputMinA = alphaFromHostPlatformColor(outputMin);
-  auto outputMinR = redFromHostPlatformColor(outputMin);
-  auto outputMinG = greenFromHostPlatformColor(outputMin);
-  auto outputMinB = blueFromHostPlatformColor(outputMin);
-
-  auto outputMaxA = alphaFromHostPlatformColor(outputMax);
-  auto outputMaxR = redFromHostPlatformColor(outputMax);
-  auto outputMaxG = greenFromHostPlatformColor(outputMax);
-  auto outputMaxB = blueFromHostPlatformColor(outputMax);
-
-  auto outputValueA = ratio * (outputMaxA - outputMinA) + outputMinA;
-  auto outputValueR = ratio * (outputMaxR - outputMinR) + outputMinR;
-  auto outputValueG = ratio * (outputMaxG - outputMinG) + outputMinG;
-  auto outputValueB = ratio * (outputMaxB - outputMinB) + outputMinB;
+  // Colors are truncated to 8 bits per channel, so the ratio is computed
+  // exactly as before rather than through the precomputed slope.
+  auto ratio =
+      (value - segment.inputMin) / (segment.inputMax - segment.inputMin);
+
+  const auto& minChannels = colorOutputChannels_[index];
+  const auto& maxChannels = colorOutputChannels_[index + 1];
+  const auto channel = [&](size_t i) {
+    return ratio * (maxChannels[i] - minChannels[i]) + minChannels[i];
+  };
+  auto outputValueA = channel(0);
+  auto outputValueR = channel(1);
+  auto outputValueG = channel(2);
+  auto outputValueB = channel(3);
 
   return static_cast<int32_t>(hostPlatformColorFromRGBA(
       static_cast<uint8_t>(outputValueR),
@@ -15,6 +15,8 @@
 
 #include <react/renderer/animated/primitives.h>
 #include <react/renderer/graphics/Color.h>
+#include <array>
+#include <vector>
 
 namespace facebook::react {
 
@@ -30,14 +32,41 @@ class InterpolationAnimatedNode final : public ValueAnimatedNode {
   void onAttachToNode(Tag animatedNodeTag) override;
 
  private:
+  enum class ExtrapolateType : uint8_t { Extend, Identity, Clamp };
+
+  /*
+   * One `[inputMin, inputMax]` range of the interpolation, compiled once from
+   * the node config so that updates neither search the config nor divide.
+   */
+  struct Segment {
+    double inputMin;
+    double inputMax;
+    double outputMin;
+    double outputMax;
+    // Output delta per unit of input, 0 for empty input ranges
+    double slope;
+  };
+
+  static ExtrapolateType parseExtrapolateType(const folly::dynamic& value);
+
+  void compileSegments();
+  size_t findSegment(double value);
+
   double interpolateValue(double value);
   double interpolateColor(double value);
 
   std::vector<double> inputRanges_;
   std::vector<double> defaultOutputRanges_;
   std::vector<Color> colorOutputRanges_;
-  std::string extrapolateLeft_;
-  std::string extrapolateRight_;
+  // A, R, G, B channels of each color in `colorOutputRanges_`
+  std::vector<std::array<double, 4>> colorOutputChannels_;
+  std::vector<Segment> segments_;
+  // Segment used by the previous update. Interpolated values are usually
+  // driven by monotonic inputs (e.g. scroll offsets), so the next value
+  // tends to fall into the same or an adjacent segment.
+  size_t lastSegment_{0};
+  ExtrapolateType extrapolateLeft_{ExtrapolateType::Extend};
+  ExtrapolateType extrapolateRight_{ExtrapolateType::Extend};
 
   Tag parentTag_{animated::undefinedAnimatedNodeIdentifier};
 };
@@ -102,6 +102,22 @@ void PropsAnimatedNode::update(bool forceFabricCommit) {
   // Props/StyleAnimatedNode
   std::lock_guard<std::mutex> lock(propsMutex_);
   if (const auto manager = manager_.lock()) {
+    if (!supportsAnimatedProps_.has_value() ||
+        supportsAnimatedPropsGraphGeneration_ !=
+            manager->getGraphGeneration()) {
+      supportsAnimatedProps_ = checkSupportsAnimatedProps(*manager);
+      supportsAnimatedPropsGraphGeneration_ = manager->getGraphGeneration();
+    }
+    if (supportsAnimatedProps_.value()) {
+      updateAnimatedProps(*manager);
+      manager->schedulePropsCommit(
+          connectedViewTag_,
+          animatedProps_,
+          layoutStyleUpdated_,
+          forceFabricCommit);
+      return;
+    }
+
     const auto& configProps = getConfig()["props"];
     for (const auto& entry : configProps.items()) {
       auto propName = entry.first.asString();
@@ -160,4 +176,83 @@ void PropsAnimatedNode::update(bool forceFabricCommit) {
   }
 }
 
+bool PropsAnimatedNode::checkSupportsAnimatedProps(
+    const NativeAnimatedNodesManager& manager) const {
+  if (layoutStyleUpdated_) {
+    return false;
+  }
+  for (const auto& entry : getConfig()["props"].items()) {
+    auto nodeTag = static_cast<Tag>(entry.second.asInt());
+    const auto node = manager.getAnimatedNode<AnimatedNode>(nodeTag);
+    if (!node) {
+      return false;
+    }
+    switch (node->type()) {
+      case AnimatedNodeType::Style: {
+        const auto styleNode =
+            manager.getAnimatedNode<StyleAnimatedNode>(nodeTag);
+        if (!styleNode->supportsAnimatedProps()) {
+          return false;
+        }
+      } break;
+      case AnimatedNodeType::Props:
+      case AnimatedNodeType::Tracking:
+      case AnimatedNodeType::Transform:
+        break;
+      default:
+        if (!animatedPropNameFromString(entry.first.getString())) {
+          return false;
+        }
+        break;
+    }
+  }
+  return true;
+}
+
+void PropsAnimatedNode::updateAnimatedProps(
+    const NativeAnimatedNodesManager& manager) {
+  for (const auto& entry : getConfig()["props"].items()) {
+    auto nodeTag = static_cast<Tag>(entry.second.asInt());
+    if (auto node = manager.getAnimatedNode<AnimatedNode>(nodeTag)) {
+      switch (node->type()) {
+        case AnimatedNodeType::Value:
+        case AnimatedNodeType::Interpolation:
+        case AnimatedNodeType::Modulus:
+        case AnimatedNodeType::Round:
+        case AnimatedNodeType::Diffclamp:
+        // Operators
+        case AnimatedNodeType::Addition:
+        case AnimatedNodeType::Subtraction:
+        case AnimatedNodeType::Multiplication:
+        case AnimatedNodeType::Division: {
+          if (const auto& valueNode =
+                  manager.getAnimatedNode<ValueAnimatedNode>(nodeTag)) {
+            animatedProps_.set(
+                animatedPropNameFromString(entry.first.getString()).value(),
+                valueNode->value());
+          }
+        } break;
+        case AnimatedNodeType::Color: {
+          if (const auto& colorNode =
+                  manager.getAnimatedNode<ColorAnimatedNode>(nodeTag)) {
+            animatedProps_.set(
+                animatedPropNameFromString(entry.first.getString()).value(),
+                static_cast<int32_t>(colorNode->getColor()));
+          }
+        } break;
+        case AnimatedNodeType::Style: {
+          if (const auto& styleNode =
+                  manager.getAnimatedNode<StyleAnimatedNode>(nodeTag)) {
+            styleNode->updateAnimatedProps(animatedProps_);
+          }
+        } break;
+        case AnimatedNodeType::Props:
+        case AnimatedNodeType::Tracking:
+        case AnimatedNodeType::Transform:
+          break;
+      }
+    }
+  }
+}
+
 } // namespace facebook::react
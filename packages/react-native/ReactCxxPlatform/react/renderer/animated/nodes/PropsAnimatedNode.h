@@ -13,8 +13,10 @@
 
 #include "AnimatedNode.h"
 
+#include <react/renderer/animated/AnimatedProps.h>
 #include <react/renderer/animated/primitives.h>
 #include <mutex>
+#include <optional>
 
 namespace facebook::react {
 class PropsAnimatedNode final : public AnimatedNode {
@@ -33,16 +35,41 @@ class PropsAnimatedNode final : public AnimatedNode {
 
   folly::dynamic props() {
     std::lock_guard<std::mutex> lock(propsMutex_);
+    if (supportsAnimatedProps_.value_or(false)) {
+      return animatedPropsToDynamic(animatedProps_);
+    }
     return props_;
   }
 
+  /*
+   * Typed props produced by this node, available when all of its props are
+   * covered by `AnimatedProps`.
+   */
+  std::optional<AnimatedProps> animatedProps() {
+    std::lock_guard<std::mutex> lock(propsMutex_);
+    if (supportsAnimatedProps_.value_or(false)) {
+      return animatedProps_;
+    }
+    return std::nullopt;
+  }
+
   void update() override;
 
   void update(bool forceFabricCommit);
 
  private:
+  bool checkSupportsAnimatedProps(
+      const NativeAnimatedNodesManager& manager) const;
+
+  void updateAnimatedProps(const NativeAnimatedNodesManager& manager);
+
   std::mutex propsMutex_;
   folly::dynamic props_;
+  AnimatedProps animatedProps_;
+  // Resolved on update, and again whenever nodes were created or dropped
+  // since, as the props may then resolve to nodes of other types
+  std::optional<bool> supportsAnimatedProps_;
+  uint64_t supportsAnimatedPropsGraphGeneration_{0};
   const bool layoutStyleUpdated_;
 
   Tag connectedViewTag_{animated::undefinedAnimatedNodeIdentifier};
@@ -22,14 +22,36 @@ StyleAnimatedNode::StyleAnimatedNode(
     const folly::dynamic& config,
     const std::shared_ptr<NativeAnimatedNodesManager>& manager)
     : AnimatedNode(tag, config, manager, AnimatedNodeType::Style),
-      props_(folly::dynamic::object()) {}
+      props_(folly::dynamic::object()) {
+  const auto& style = getConfig()["style"];
+  styleEntries_.reserve(style.size());
+  for (const auto& styleProp : style.items()) {
+    auto propName = styleProp.first.asString();
+    auto animatedPropName = animatedPropNameFromString(propName);
+    styleEntries_.push_back(
+        {std::move(propName),
+         static_cast<Tag>(styleProp.second.asInt()),
+         animatedPropName});
+  }
+}
 
 void StyleAnimatedNode::update() {
+  // The `folly::dynamic` representation is only built when requested through
+  // `getProps`, consumers of the typed path never pay for it.
+  propsDirty_ = true;
+}
+
+const folly::dynamic& StyleAnimatedNode::getProps() {
+  if (propsDirty_) {
+    propsDirty_ = false;
+    updateProps();
+  }
+  return props_;
+}
+
+void StyleAnimatedNode::updateProps() {
   if (const auto manager = manager_.lock()) {
-    const auto& style = getConfig()["style"];
-    for (const auto& styleProp : style.items()) {
-      auto propName = styleProp.first.asString();
-      const auto nodeTag = static_cast<Tag>(styleProp.second.asInt());
+    for (const auto& [propName, nodeTag, _] : styleEntries_) {
       if (auto node = manager->getAnimatedNode<AnimatedNode>(nodeTag)) {
         switch (node->type()) {
           case AnimatedNodeType::Transform: {
@@ -80,4 +102,80 @@ void StyleAnimatedNode::update() {
     }
   }
 }
+
+bool StyleAnimatedNode::supportsAnimatedProps() const {
+  const auto manager = manager_.lock();
+  if (!manager) {
+    return false;
+  }
+  for (const auto& entry : styleEntries_) {
+    const auto node = manager->getAnimatedNode<AnimatedNode>(entry.nodeTag);
+    if (!node) {
+      return false;
+    }
+    switch (node->type()) {
+      case AnimatedNodeType::Transform: {
+        const auto transformNode =
+            manager->getAnimatedNode<TransformAnimatedNode>(entry.nodeTag);
+        if (!transformNode->supportsAnimatedProps()) {
+          return false;
+        }
+      } break;
+      case AnimatedNodeType::Tracking:
+      case AnimatedNodeType::Style:
+      case AnimatedNodeType::Props:
+        break;
+      default:
+        if (!entry.animatedPropName) {
+          return false;
+        }
+        break;
+    }
+  }
+  return true;
+}
+
+void StyleAnimatedNode::updateAnimatedProps(AnimatedProps& animatedProps) {
+  if (const auto manager = manager_.lock()) {
+    for (const auto& [_, nodeTag, animatedPropName] : styleEntries_) {
+      if (auto node = manager->getAnimatedNode<AnimatedNode>(nodeTag)) {
+        switch (node->type()) {
+          case AnimatedNodeType::Transform: {
+            if (const auto transformNode =
+                    manager->getAnimatedNode<TransformAnimatedNode>(nodeTag)) {
+              transformNode->updateAnimatedProps(animatedProps);
+            }
+          } break;
+          case AnimatedNodeType::Value:
+          case AnimatedNodeType::Interpolation:
+          case AnimatedNodeType::Modulus:
+          case AnimatedNodeType::Round:
+          case AnimatedNodeType::Diffclamp:
+          // Operators
+          case AnimatedNodeType::Addition:
+          case AnimatedNodeType::Subtraction:
+          case AnimatedNodeType::Multiplication:
+          case AnimatedNodeType::Division: {
+            if (const auto valueNode =
+                    manager->getAnimatedNode<ValueAnimatedNode>(nodeTag)) {
+              animatedProps.set(animatedPropName.value(), valueNode->value());
+            }
+          } break;
+          case AnimatedNodeType::Color: {
+            if (const auto colorAnimNode =
+                    manager->getAnimatedNode<ColorAnimatedNode>(nodeTag)) {
+              animatedProps.set(
+                  animatedPropName.value(),
+                  static_cast<int32_t>(colorAnimNode->getColor()));
+            }
+          } break;
+          case AnimatedNodeType::Tracking:
+          case AnimatedNodeType::Style:
+          case AnimatedNodeType::Props:
+            break;
+        }
+      }
+    }
+  }
+}
 } // namespace facebook::react
@@ -14,6 +14,9 @@
 #include "AnimatedNode.h"
 
 #include <folly/dynamic.h>
+#include <react/renderer/animated/AnimatedProps.h>
+#include <optional>
+#include <vector>
 
 namespace facebook::react {
 class StyleAnimatedNode final : public AnimatedNode {
@@ -24,11 +27,35 @@ class StyleAnimatedNode final : public AnimatedNode {
       const std::shared_ptr<NativeAnimatedNodesManager>& manager);
   void update() override;
 
-  const folly::dynamic& getProps() const {
-    return props_;
-  }
+  const folly::dynamic& getProps();
+
+  /*
+   * Whether every style prop of this node can be represented in
+   * `AnimatedProps`, so that `updateAnimatedProps` can be used instead of
+   * `update`.
+   */
+  bool supportsAnimatedProps() const;
+
+  /*
+   * Typed counterpart of `update`: writes the current style values into
+   * `animatedProps` without building a `folly::dynamic`.
+   */
+  void updateAnimatedProps(AnimatedProps& animatedProps);
 
  private:
+  struct StyleEntry {
+    std::string propName;
+    Tag nodeTag;
+    std::optional<AnimatedPropName> animatedPropName;
+  };
+
+  void updateProps();
+
+  std::vector<StyleEntry> styleEntries_;
   folly::dynamic props_;
+  // Set by `update` and cleared by `getProps`. Not synchronized: like the
+  // rest of the animated graph, nodes are only updated and read on the UI
+  // thread, where AnimatedModule schedules its operations.
+  bool propsDirty_{false};
 };
 } // namespace facebook::react
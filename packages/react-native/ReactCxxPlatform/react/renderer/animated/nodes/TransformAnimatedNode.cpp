@@ -14,6 +14,7 @@
 #include <react/debug/react_native_assert.h>
 #include <react/renderer/animated/NativeAnimatedNodesManager.h>
 #include <react/renderer/animated/nodes/ValueAnimatedNode.h>
+#include <react/renderer/animated/primitives.h>
 #include <utility>
 
 namespace facebook::react {
@@ -31,34 +32,84 @@ TransformAnimatedNode::TransformAnimatedNode(
     const folly::dynamic& config,
     const std::shared_ptr<NativeAnimatedNodesManager>& manager)
     : AnimatedNode(tag, config, manager, AnimatedNodeType::Transform),
-      props_(folly::dynamic::object()) {}
+      props_(folly::dynamic::object()) {
+  const auto& transformsArray = getConfig()[sTransformsName];
+  react_native_assert(transformsArray.type() == folly::dynamic::ARRAY);
+  transforms_.reserve(transformsArray.size());
+  for (const auto& transform : transformsArray) {
+    auto property = transform[sPropertyName].asString();
+    auto operationType = animatedTransformOperationTypeFromString(property);
+    if (transform[sTypeName].asString() == sAnimatedName) {
+      transforms_.push_back(
+          {std::move(property),
+           static_cast<Tag>(transform[sNodeTagName].asInt()),
+           0,
+           operationType});
+    } else {
+      transforms_.push_back(
+          {std::move(property),
+           animated::undefinedAnimatedNodeIdentifier,
+           transform[sValueName].asDouble(),
+           operationType});
+    }
+  }
+}
 
-void TransformAnimatedNode::update() {
-  folly::dynamic transforms = folly::dynamic::array();
+std::optional<double> TransformAnimatedNode::getTransformValue(
+    const TransformConfig& transform) const {
+  if (transform.nodeTag == animated::undefinedAnimatedNodeIdentifier) {
+    return transform.value;
+  }
   if (const auto manager = manager_.lock()) {
-    auto transformsArray = getConfig()[sTransformsName];
-    react_native_assert(transformsArray.type() == folly::dynamic::ARRAY);
-    for (const auto& transform : transformsArray) {
-      std::optional<double> value;
-      if (transform[sTypeName].asString() == sAnimatedName) {
-        const auto inputTag = static_cast<Tag>(transform[sNodeTagName].asInt());
-        if (const auto node =
-                manager->getAnimatedNode<ValueAnimatedNode>(inputTag)) {
-          value = node->value();
-        }
-      } else {
-        value = transform[sValueName].asDouble();
-      }
-      if (value) {
-        const auto property = transform[sPropertyName].asString();
-        transforms.push_back(folly::dynamic::object(property, value.value()));
-      }
+    if (const auto node =
+            manager->getAnimatedNode<ValueAnimatedNode>(transform.nodeTag)) {
+      return node->value();
+    }
+  }
+  return std::nullopt;
+}
+
+void TransformAnimatedNode::update() {
+  // The `folly::dynamic` representation is only built when requested through
+  // `getProps`, consumers of the typed path never pay for it.
+  propsDirty_ = true;
+}
+
+bool TransformAnimatedNode::supportsAnimatedProps() const {
+  if (transforms_.size() > AnimatedProps::MaxTransformOperations) {
+    return false;
+  }
+  for (const auto& transform : transforms_) {
+    if (!transform.operationType) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void TransformAnimatedNode::updateAnimatedProps(
+    AnimatedProps& animatedProps) const {
+  animatedProps.beginTransform();
+  for (const auto& transform : transforms_) {
+    if (auto value = getTransformValue(transform)) {
+      animatedProps.pushTransformOperation(
+          {transform.operationType.value(), value.value()});
     }
-    props_[sTransformPropName] = std::move(transforms);
   }
 }
 
 const folly::dynamic& TransformAnimatedNode::getProps() {
+  if (propsDirty_ && !manager_.expired()) {
+    propsDirty_ = false;
+    folly::dynamic transforms = folly::dynamic::array();
+    for (const auto& transform : transforms_) {
+      if (auto value = getTransformValue(transform)) {
+        transforms.push_back(
+            folly::dynamic::object(transform.property, value.value()));
+      }
+    }
+    props_[sTransformPropName] = std::move(transforms);
+  }
   return props_;
 }
 
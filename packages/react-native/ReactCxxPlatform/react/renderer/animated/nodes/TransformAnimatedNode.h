@@ -13,6 +13,10 @@
 
 #include "AnimatedNode.h"
 
+#include <react/renderer/animated/AnimatedProps.h>
+#include <optional>
+#include <vector>
+
 namespace facebook::react {
 
 struct TransformConfig {
@@ -20,6 +24,7 @@ struct TransformConfig {
   std::string property;
   Tag nodeTag;
   double value;
+  std::optional<AnimatedTransformOperationType> operationType;
 };
 
 class TransformAnimatedNode final : public AnimatedNode {
@@ -33,7 +38,25 @@ class TransformAnimatedNode final : public AnimatedNode {
 
   const folly::dynamic& getProps();
 
+  /*
+   * Whether every transform operation of this node can be represented in
+   * `AnimatedProps`.
+   */
+  bool supportsAnimatedProps() const;
+
+  /*
+   * Writes the current transform into `animatedProps` without building a
+   * `folly::dynamic`.
+   */
+  void updateAnimatedProps(AnimatedProps& animatedProps) const;
+
  private:
+  std::optional<double> getTransformValue(const TransformConfig& transform)
+      const;
+
+  std::vector<TransformConfig> transforms_;
   folly::dynamic props_;
+  // Only accessed on the UI thread, see StyleAnimatedNode
+  bool propsDirty_{false};
 };
 } // namespace facebook::react
@@ -7,13 +7,114 @@
 
 #include "AnimationTestsBase.h"
 
+#include <react/renderer/animated/AnimatedProps.h>
 #include <react/renderer/animated/nodes/ColorAnimatedNode.h>
 #include <react/renderer/core/ReactRootViewTagGenerator.h>
 #include <react/renderer/graphics/Color.h>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+// Heap allocations are only counted on a thread while it points this at a
+// counter, so the replacement below leaves the other tests of the binary
+// alone.
+thread_local size_t* tAllocationCount = nullptr;
+
+} // namespace
+
+void* operator new(std::size_t size) {
+  if (tAllocationCount != nullptr) {
+    (*tAllocationCount)++;
+  }
+  if (void* pointer = std::malloc(size == 0 ? 1 : size)) {
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t /*size*/) noexcept {
+  std::free(pointer);
+}
 
 namespace facebook::react {
 
-class AnimatedNodeTests : public AnimationTestsBase {};
+class AnimatedNodeTests : public AnimationTestsBase {
+ protected:
+  struct TransformGraph {
+    Tag opacityNodeTag;
+    Tag translateNodeTag;
+    Tag viewTag;
+  };
+
+  // opacity + transform: [{translateX: animated}, {scale: 2}]
+  TransformGraph createTransformGraph() {
+    auto rootTag = getNextRootViewTag();
+
+    auto opacityNodeTag = ++rootTag;
+    nodesManager_->createAnimatedNode(
+        opacityNodeTag,
+        folly::dynamic::object("type", "value")("value", 1)("offset", 0));
+
+    auto translateNodeTag = ++rootTag;
+    nodesManager_->createAnimatedNode(
+        translateNodeTag,
+        folly::dynamic::object("type", "value")("value", 0)("offset", 0));
+
+    auto transformNodeTag = ++rootTag;
+    nodesManager_->createAnimatedNode(
+        transformNodeTag,
+        folly::dynamic::object("type", "transform")(
+            "transforms",
+            folly::dynamic::array(
+                folly::dynamic::object("type", "animated")(
+                    "property", "translateX")("nodeTag", translateNodeTag),
+                folly::dynamic::object("type", "static")("property", "scale")(
+                    "value", 2))));
+    nodesManager_->connectAnimatedNodes(translateNodeTag, transformNodeTag);
+
+    auto styleNodeTag = ++rootTag;
+    nodesManager_->createAnimatedNode(
+        styleNodeTag,
+        folly::dynamic::object("type", "style")(
+            "style",
+            folly::dynamic::object("opacity", opacityNodeTag)(
+                "transform", transformNodeTag)));
+    nodesManager_->connectAnimatedNodes(opacityNodeTag, styleNodeTag);
+    nodesManager_->connectAnimatedNodes(transformNodeTag, styleNodeTag);
+
+    auto propsNodeTag = ++rootTag;
+    nodesManager_->createAnimatedNode(
+        propsNodeTag,
+        folly::dynamic::object("type", "props")(
+            "props", folly::dynamic::object("style", styleNodeTag)));
+    nodesManager_->connectAnimatedNodes(styleNodeTag, propsNodeTag);
+
+    auto viewTag = ++rootTag;
+    nodesManager_->connectAnimatedNodeToView(propsNodeTag, viewTag);
+
+    return {opacityNodeTag, translateNodeTag, viewTag};
+  }
+
+  // Changes the values driving the graph and runs an animation frame, for
+  // each of `frameCount` frames. Returns the number of heap allocations made
+  // by the animation frames.
+  size_t runFramesChangingValues(const TransformGraph& graph, int frameCount) {
+    size_t allocationCount = 0;
+    for (int i = 0; i < frameCount; i++) {
+      nodesManager_->setAnimatedNodeValue(graph.opacityNodeTag, i / 100.0);
+      nodesManager_->setAnimatedNodeValue(graph.translateNodeTag, i);
+      tAllocationCount = &allocationCount;
+      runAnimationFrame(0);
+      tAllocationCount = nullptr;
+    }
+    return allocationCount;
+  }
+};
 
 TEST_F(AnimatedNodeTests, setAnimatedNodeValue) {
   initNodesManager();
@@ -157,6 +258,125 @@ TEST_F(AnimatedNodeTests, updatePropsNode) {
   }
 }
 
+TEST_F(AnimatedNodeTests, typedPropsFastPath) {
+  initNodesManager();
+
+  std::optional<AnimatedProps> lastAnimatedProps;
+  Tag lastAnimatedPropsTag{};
+  nodesManager_->setAnimatedPropsDirectManipulationCallback(
+      [&](Tag viewTag, const AnimatedProps& props) {
+        lastAnimatedPropsTag = viewTag;
+        lastAnimatedProps = props;
+      });
+
+  auto graph = createTransformGraph();
+  runAnimationFrame(0);
+
+  nodesManager_->setAnimatedNodeValue(graph.opacityNodeTag, 0.25);
+  nodesManager_->setAnimatedNodeValue(graph.translateNodeTag, 40);
+  runAnimationFrame(0);
+
+  ASSERT_TRUE(lastAnimatedProps.has_value());
+  EXPECT_EQ(lastAnimatedPropsTag, graph.viewTag);
+  EXPECT_TRUE(lastAnimatedProps->has(AnimatedPropName::Opacity));
+  EXPECT_EQ(lastAnimatedProps->get(AnimatedPropName::Opacity), 0.25);
+  ASSERT_TRUE(lastAnimatedProps->hasTransform());
+  ASSERT_EQ(lastAnimatedProps->transformOperationsCount(), 2u);
+  EXPECT_EQ(
+      lastAnimatedProps->transformOperation(0).type,
+      AnimatedTransformOperationType::TranslateX);
+  EXPECT_EQ(lastAnimatedProps->transformOperation(0).value, 40);
+  EXPECT_EQ(
+      lastAnimatedProps->transformOperation(1).type,
+      AnimatedTransformOperationType::Scale);
+  EXPECT_EQ(lastAnimatedProps->transformOperation(1).value, 2);
+
+  // Managed props are still readable as folly::dynamic for RawProps consumers
+  auto managedProps = nodesManager_->managedProps(graph.viewTag);
+  ASSERT_TRUE(managedProps.has_value());
+  EXPECT_EQ((*managedProps)["opacity"], 0.25);
+  EXPECT_EQ((*managedProps)["transform"][0]["translateX"], 40.0);
+  EXPECT_EQ((*managedProps)["transform"][1]["scale"], 2.0);
+}
+
+TEST_F(AnimatedNodeTests, typedPropsDynamicFallback) {
+  initNodesManager();
+
+  // Without a typed callback, typed updates reach the folly::dynamic callback
+  auto graph = createTransformGraph();
+  runAnimationFrame(0);
+
+  nodesManager_->setAnimatedNodeValue(graph.opacityNodeTag, 0.5);
+  nodesManager_->setAnimatedNodeValue(graph.translateNodeTag, 12);
+  runAnimationFrame(0);
+
+  EXPECT_EQ(lastUpdatedNodeTag, graph.viewTag);
+  EXPECT_EQ(lastCommittedProps["opacity"], 0.5);
+  EXPECT_EQ(lastCommittedProps["transform"][0]["translateX"], 12.0);
+  EXPECT_EQ(lastCommittedProps["transform"][1]["scale"], 2.0);
+}
+
+TEST_F(AnimatedNodeTests, typedPropsAllocationsPerFrame) {
+  initNodesManager();
+  auto dynamicGraph = createTransformGraph();
+  runAnimationFrame(0);
+  auto dynamicAllocationCount = runFramesChangingValues(dynamicGraph, 100);
+
+  initNodesManager();
+  int typedUpdateCount = 0;
+  nodesManager_->setAnimatedPropsDirectManipulationCallback(
+      [&](Tag /*viewTag*/, const AnimatedProps& /*props*/) {
+        typedUpdateCount++;
+      });
+  auto graph = createTransformGraph();
+  runAnimationFrame(0);
+  typedUpdateCount = 0;
+  lastUpdatedNodeTag = {};
+
+  // No frame goes through folly::dynamic props, or allocates at all once the
+  // first frame sized the buffers of the manager
+  auto typedAllocationCount = runFramesChangingValues(graph, 100);
+  EXPECT_EQ(typedUpdateCount, 100);
+  EXPECT_EQ(lastUpdatedNodeTag, Tag{});
+
+  RecordProperty(
+      "dynamicAllocationsPerFrame",
+      std::to_string(dynamicAllocationCount / 100.0));
+  RecordProperty(
+      "typedAllocationsPerFrame", std::to_string(typedAllocationCount / 100.0));
+  EXPECT_GT(dynamicAllocationCount, 0u);
+  EXPECT_EQ(typedAllocationCount, 0u);
+}
+
+TEST_F(AnimatedNodeTests, typedPropsSupportFollowsGraphChanges) {
+  initNodesManager();
+
+  int typedUpdateCount = 0;
+  nodesManager_->setAnimatedPropsDirectManipulationCallback(
+      [&](Tag /*viewTag*/, const AnimatedProps& /*props*/) {
+        typedUpdateCount++;
+      });
+  auto graph = createTransformGraph();
+  runAnimationFrame(0);
+  EXPECT_EQ(typedUpdateCount, 1);
+
+  // Without its opacity node, the style cannot be represented as typed props
+  nodesManager_->dropAnimatedNode(graph.opacityNodeTag);
+  nodesManager_->setAnimatedNodeValue(graph.translateNodeTag, 10);
+  runAnimationFrame(0);
+  EXPECT_EQ(typedUpdateCount, 1);
+  EXPECT_EQ(lastUpdatedNodeTag, graph.viewTag);
+  EXPECT_EQ(lastCommittedProps["transform"][0]["translateX"], 10.0);
+
+  // Once it is created again, typed props are used again
+  nodesManager_->createAnimatedNode(
+      graph.opacityNodeTag,
+      folly::dynamic::object("type", "value")("value", 0.5)("offset", 0));
+  nodesManager_->setAnimatedNodeValue(graph.translateNodeTag, 20);
+  runAnimationFrame(0);
+  EXPECT_EQ(typedUpdateCount, 2);
+}
+
 TEST_F(AnimatedNodeTests, ModulusAnimatedNode) {
   initNodesManager();
 
@@ -216,4 +436,45 @@ TEST_F(AnimatedNodeTests, DiffClampAnimatedNode) {
   EXPECT_EQ(nodesManager_->getValue(diffClampTag), 1);
 }
 
+TEST_F(AnimatedNodeTests, InterpolationAnimatedNode) {
+  initNodesManager();
+
+  auto rootTag = getNextRootViewTag();
+
+  auto valueTag = ++rootTag;
+  auto interpolationTag = ++rootTag;
+
+  nodesManager_->createAnimatedNode(
+      valueTag,
+      folly::dynamic::object("type", "value")("value", 0)("offset", 0));
+  nodesManager_->createAnimatedNode(
+      interpolationTag,
+      folly::dynamic::object("type", "interpolation")(
+          "inputRange", folly::dynamic::array(0, 10, 10, 20, 40))(
+          "outputRange", folly::dynamic::array(0, 100, 200, 0, 50))(
+          "extrapolateLeft", "clamp")("extrapolateRight", "extend"));
+  nodesManager_->connectAnimatedNodes(valueTag, interpolationTag);
+
+  // Forward, backward and jumping inputs exercise both the cached segment and
+  // the binary search.
+  const auto expectations = std::vector<std::pair<double, double>>{
+      {-5, 0},
+      {5, 50},
+      {10, 100},
+      {15, 100},
+      {30, 25},
+      {60, 100},
+      {35, 37.5},
+      {12, 160},
+      {2, 20},
+      {45, 62.5},
+  };
+  for (const auto& [input, output] : expectations) {
+    nodesManager_->setAnimatedNodeValue(valueTag, input);
+    runAnimationFrame(0);
+    EXPECT_DOUBLE_EQ(nodesManager_->getValue(interpolationTag).value(), output)
+        << "input " << input;
+  }
+}
+
 } // namespace facebook::react
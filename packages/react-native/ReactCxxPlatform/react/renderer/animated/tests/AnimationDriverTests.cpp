@@ -7,7 +7,11 @@
 
 #include "AnimationTestsBase.h"
 
+#include <react/renderer/animated/drivers/AnimationDriverBatch.h>
 #include <react/renderer/animated/drivers/AnimationDriverUtils.h>
+#include <react/renderer/animated/drivers/DecayAnimationDriver.h>
+#include <react/renderer/animated/drivers/FrameAnimationDriver.h>
+#include <react/renderer/animated/drivers/SpringAnimationDriver.h>
 #include <react/renderer/core/ReactRootViewTagGenerator.h>
 
 namespace facebook::react {
@@ -18,6 +22,48 @@ class AnimationDriverTests : public AnimationTestsBase {
     // Round to 2 decimal places
     return std::ceil(value * 100) / 100;
   }
+
+  std::shared_ptr<AnimationDriver> createDriver(
+      int animationId,
+      Tag valueNodeTag,
+      const folly::dynamic& config) {
+    auto type = AnimationDriver::getDriverTypeByName(config["type"].asString());
+    switch (type.value()) {
+      case AnimationDriverType::Frames:
+        return std::make_shared<FrameAnimationDriver>(
+            animationId,
+            valueNodeTag,
+            std::nullopt,
+            config,
+            nodesManager_.get());
+      case AnimationDriverType::Spring:
+        return std::make_shared<SpringAnimationDriver>(
+            animationId,
+            valueNodeTag,
+            std::nullopt,
+            config,
+            nodesManager_.get());
+      case AnimationDriverType::Decay:
+        return std::make_shared<DecayAnimationDriver>(
+            animationId,
+            valueNodeTag,
+            std::nullopt,
+            config,
+            nodesManager_.get());
+    }
+    return nullptr;
+  }
+
+  static folly::dynamic springConfig(
+      double stiffness,
+      double damping,
+      bool overshootClamping,
+      double iterations = 1) {
+    return folly::dynamic::object("type", "spring")("stiffness", stiffness)(
+        "damping", damping)("mass", 1)("initialVelocity", 0)("toValue", 100)(
+        "restSpeedThreshold", 0.001)("restDisplacementThreshold", 0.001)(
+        "overshootClamping", overshootClamping)("iterations", iterations);
+  }
 };
 
 TEST_F(AnimationDriverTests, framesAnimation) {
@@ -58,4 +104,76 @@ TEST_F(AnimationDriverTests, framesAnimation) {
   EXPECT_EQ(round(nodesManager_->getValue(valueNodeTag).value()), toValue);
 }
 
+TEST_F(AnimationDriverTests, batchedSteppingMatchesPerDriverStepping) {
+  initNodesManager();
+
+  const auto configs = std::vector<folly::dynamic>{
+      // Under-damped, critically damped and over-damped springs
+      springConfig(100, 10, false),
+      springConfig(100, 20, false),
+      springConfig(100, 40, false),
+      springConfig(200, 5, true),
+      springConfig(150, 12, false, 3),
+      folly::dynamic::object("type", "decay")("velocity", 0.5)(
+          "deceleration", 0.998),
+      folly::dynamic::object("type", "decay")("velocity", -1.2)(
+          "deceleration", 0.99)("iterations", 2),
+      folly::dynamic::object("type", "frames")(
+          "frames", folly::dynamic::array(0.0, 0.2, 0.5, 0.9, 1.0))(
+          "toValue", 50),
+  };
+
+  auto rootTag = getNextRootViewTag();
+  auto animationId = 0;
+  std::vector<std::pair<Tag, std::shared_ptr<AnimationDriver>>> individual;
+  std::vector<std::pair<Tag, std::shared_ptr<AnimationDriver>>> batched;
+  AnimationDriverBatch batch;
+  for (const auto& config : configs) {
+    for (auto* drivers : {&individual, &batched}) {
+      auto valueNodeTag = ++rootTag;
+      nodesManager_->createAnimatedNode(
+          valueNodeTag,
+          folly::dynamic::object("type", "value")("value", 10)("offset", 0));
+      auto driver = createDriver(++animationId, valueNodeTag, config);
+      driver->startAnimation();
+      drivers->emplace_back(valueNodeTag, driver);
+      if (drivers == &batched) {
+        batch.addDriver(*driver);
+      }
+    }
+  }
+
+  // The first spring is stopped midway, which moves the last spring row
+  const size_t removedIndex = 0;
+  const auto startTimeInTick = 12345.0;
+  for (int frame = 0; frame < 600; frame++) {
+    if (frame == 20) {
+      batch.removeDriver(*batched[removedIndex].second);
+    }
+    const auto renderingTime =
+        startTimeInTick + frame * SingleFrameIntervalMs * TicksPerMs;
+    for (size_t i = 0; i < individual.size(); i++) {
+      if (i != removedIndex || frame < 20) {
+        individual[i].second->runAnimationStep(renderingTime);
+      }
+    }
+    batch.runAnimationStep(renderingTime);
+
+    for (size_t i = 0; i < individual.size(); i++) {
+      const auto& [individualTag, individualDriver] = individual[i];
+      const auto& [batchedTag, batchedDriver] = batched[i];
+      EXPECT_EQ(individualDriver->isComplete(), batchedDriver->isComplete())
+          << "config " << i << " frame " << frame;
+      EXPECT_EQ(
+          nodesManager_->getValue(individualTag),
+          nodesManager_->getValue(batchedTag))
+          << "config " << i << " frame " << frame;
+    }
+  }
+
+  for (size_t i = 0; i < individual.size(); i++) {
+    EXPECT_EQ(individual[i].second->isComplete(), i != removedIndex);
+  }
+}
+
 } // namespace facebook::react
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <folly/dynamic.h>
+#include <react/renderer/animated/NativeAnimatedNodesManager.h>
+#include <react/renderer/animated/drivers/AnimationDriverBatch.h>
+#include <react/renderer/animated/drivers/AnimationDriverUtils.h>
+#include <react/renderer/animated/drivers/SpringAnimationDriver.h>
+#include <memory>
+#include <unordered_map>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr int SpringCount = 200;
+
+struct SpringAnimations {
+  std::shared_ptr<NativeAnimatedNodesManager> nodesManager;
+  std::unordered_map<int, std::shared_ptr<AnimationDriver>> drivers;
+};
+
+SpringAnimations createSpringAnimations() {
+  auto animations = SpringAnimations{
+      std::make_shared<NativeAnimatedNodesManager>(
+          [](Tag, const folly::dynamic&) {},
+          [](const std::unordered_map<Tag, folly::dynamic>&) {}),
+      {}};
+  for (int i = 0; i < SpringCount; i++) {
+    auto valueNodeTag = Tag{i + 1};
+    animations.nodesManager->createAnimatedNode(
+        valueNodeTag,
+        folly::dynamic::object("type", "value")("value", 0)("offset", 0));
+    // Loop forever so every iteration steps the same number of drivers
+    auto config = folly::dynamic::object("type", "spring")(
+        "stiffness", 100 + i)("damping", 5 + i % 20)("mass", 1)(
+        "initialVelocity", 0)("toValue", 100)("restSpeedThreshold", 0.001)(
+        "restDisplacementThreshold", 0.001)("overshootClamping", false)(
+        "iterations", -1);
+    auto driver = std::make_shared<SpringAnimationDriver>(
+        i, valueNodeTag, std::nullopt, config, animations.nodesManager.get());
+    driver->startAnimation();
+    animations.drivers.emplace(i, std::move(driver));
+  }
+  return animations;
+}
+
+} // namespace
+
+static void springPerDriverStep(benchmark::State& state) {
+  auto animations = createSpringAnimations();
+  auto renderingTime = 0.0;
+  for (auto _ : state) {
+    renderingTime += SingleFrameIntervalMs * TicksPerMs;
+    for (const auto& [animationId, driver] : animations.drivers) {
+      driver->runAnimationStep(renderingTime);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * SpringCount);
+}
+BENCHMARK(springPerDriverStep);
+
+static void springBatchedStep(benchmark::State& state) {
+  auto animations = createSpringAnimations();
+  auto batch = AnimationDriverBatch{};
+  for (const auto& [_, driver] : animations.drivers) {
+    batch.addDriver(*driver);
+  }
+  auto renderingTime = 0.0;
+  for (auto _ : state) {
+    renderingTime += SingleFrameIntervalMs * TicksPerMs;
+    batch.runAnimationStep(renderingTime);
+  }
+  state.SetItemsProcessed(state.iterations() * SpringCount);
+}
+BENCHMARK(springBatchedStep);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
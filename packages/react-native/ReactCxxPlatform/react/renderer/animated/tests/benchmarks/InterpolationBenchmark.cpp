@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <folly/dynamic.h>
+#include <react/renderer/animated/NativeAnimatedNodesManager.h>
+#include <react/renderer/animated/drivers/AnimationDriverUtils.h>
+#include <react/renderer/animated/nodes/InterpolationAnimatedNode.h>
+#include <memory>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr int SegmentCount = 32;
+constexpr double InputStep = 25.0;
+constexpr double MaxInput = SegmentCount * InputStep;
+
+folly::dynamic createInterpolationConfig() {
+  auto inputRange = folly::dynamic::array();
+  auto outputRange = folly::dynamic::array();
+  for (int i = 0; i <= SegmentCount; i++) {
+    inputRange.push_back(i * InputStep);
+    outputRange.push_back(i % 2 == 0 ? 0.0 : 1.0);
+  }
+  return folly::dynamic::object("type", "interpolation")(
+      "inputRange", inputRange)("outputRange", outputRange)(
+      "extrapolateLeft", "clamp")("extrapolateRight", "clamp");
+}
+
+// Linear range search done on every update before segments were compiled
+double linearSearchInterpolate(
+    double value,
+    const std::vector<double>& inputRanges,
+    const std::vector<double>& outputRanges) {
+  size_t index = 1;
+  for (; index < inputRanges.size() - 1; ++index) {
+    if (inputRanges[index] >= value) {
+      break;
+    }
+  }
+  index--;
+
+  return interpolate(
+      value,
+      inputRanges[index],
+      inputRanges[index + 1],
+      outputRanges[index],
+      outputRanges[index + 1],
+      ExtrapolateTypeClamp,
+      ExtrapolateTypeClamp);
+}
+
+// Scroll-like input sweeping back and forth over the whole range
+double nextInput(double& input, double& direction) {
+  input += direction * 3.7;
+  if (input > MaxInput || input < 0) {
+    direction = -direction;
+  }
+  return input;
+}
+
+} // namespace
+
+static void interpolationLinearSearch(benchmark::State& state) {
+  const auto config = createInterpolationConfig();
+  std::vector<double> inputRanges;
+  std::vector<double> outputRanges;
+  for (const auto& value : config["inputRange"]) {
+    inputRanges.push_back(value.asDouble());
+  }
+  for (const auto& value : config["outputRange"]) {
+    outputRanges.push_back(value.asDouble());
+  }
+
+  auto input = 0.0;
+  auto direction = 1.0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(linearSearchInterpolate(
+        nextInput(input, direction), inputRanges, outputRanges));
+  }
+}
+BENCHMARK(interpolationLinearSearch);
+
+static void interpolationAnimatedNodeUpdate(benchmark::State& state) {
+  auto nodesManager = std::make_shared<NativeAnimatedNodesManager>(
+      [](Tag, const folly::dynamic&) {},
+      [](const std::unordered_map<Tag, folly::dynamic>&) {});
+  const auto valueTag = Tag{1};
+  const auto interpolationTag = Tag{2};
+  nodesManager->createAnimatedNode(
+      valueTag,
+      folly::dynamic::object("type", "value")("value", 0)("offset", 0));
+  nodesManager->createAnimatedNode(
+      interpolationTag, createInterpolationConfig());
+  nodesManager->connectAnimatedNodes(valueTag, interpolationTag);
+
+  auto valueNode = nodesManager->getAnimatedNode<ValueAnimatedNode>(valueTag);
+  auto interpolationNode =
+      nodesManager->getAnimatedNode<InterpolationAnimatedNode>(
+          interpolationTag);
+
+  auto input = 0.0;
+  auto direction = 1.0;
+  for (auto _ : state) {
+    valueNode->setRawValue(nextInput(input, direction));
+    interpolationNode->update();
+    benchmark::DoNotOptimize(interpolationNode->value());
+  }
+}
+BENCHMARK(interpolationAnimatedNodeUpdate);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -7,6 +7,8 @@
 
 #include "SchedulerDelegateImpl.h"
 
+#include <react/profiling/FrameTimeline.h>
+
 namespace facebook::react {
 
 SchedulerDelegateImpl::SchedulerDelegateImpl(
@@ -23,10 +25,16 @@ void SchedulerDelegateImpl::schedulerShouldRenderTransactions(
   auto surfaceId = mountingCoordinator->getSurfaceId();
   if (auto transaction = mountingCoordinator->pullTransaction();
       transaction.has_value()) {
-    if (auto& transactionValue = transaction.value();
-        !transactionValue.getMutations().empty()) {
+    auto& transactionValue = transaction.value();
+    // The transaction is moved into the mounting manager, so the mount is
+    // timed on a copy of its telemetry
+    auto telemetry = transactionValue.getTelemetry();
+    telemetry.willMount();
+    if (!transactionValue.getMutations().empty()) {
       mountingManager_->executeMount(surfaceId, std::move(transactionValue));
     }
+    telemetry.didMount();
+    getFrameTimeline().recordTransaction(telemetry);
   }
 }
 
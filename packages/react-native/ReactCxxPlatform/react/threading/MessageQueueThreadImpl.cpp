@@ -7,6 +7,8 @@
 
 #include "MessageQueueThreadImpl.h"
 
+#include <react/profiling/FrameTimeline.h>
+
 #include <functional>
 
 namespace facebook::react {
@@ -15,8 +17,10 @@ void MessageQueueThreadImpl::runOnQueue(std::function<void()>&& runnable) {
   if (!taskDispatchThread_.isRunning()) {
     return;
   }
-  taskDispatchThread_.runAsync(
-      [runnable = std::move(runnable)]() noexcept { runnable(); });
+  taskDispatchThread_.runAsync([runnable = std::move(runnable)]() noexcept {
+    FrameTimelinePhaseBlock frameTimelinePhase{FrameTimeline::Phase::JSTask};
+    runnable();
+  });
 }
 
 void MessageQueueThreadImpl::runOnQueueSync(std::function<void()>&& runnable) {
@@ -24,10 +28,13 @@ void MessageQueueThreadImpl::runOnQueueSync(std::function<void()>&& runnable) {
     return;
   }
   if (taskDispatchThread_.isOnThread()) {
+    // Already recorded as part of the task running it
     runnable();
   } else {
-    taskDispatchThread_.runSync(
-        [runnable = std::move(runnable)]() noexcept { runnable(); });
+    taskDispatchThread_.runSync([runnable = std::move(runnable)]() noexcept {
+      FrameTimelinePhaseBlock frameTimelinePhase{FrameTimeline::Phase::JSTask};
+      runnable();
+    });
   }
 }
 
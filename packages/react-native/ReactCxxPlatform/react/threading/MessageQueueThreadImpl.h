@@ -20,7 +20,8 @@ constexpr char MessageQueueThreadFactoryKey[] = "MessageQueueThreadFactoryKey";
 
 /**
  * MessageQueueThread implementation that uses a TaskDispatchThread for
- * queueing and threading logic
+ * queueing and threading logic. Each job is recorded as a JS task in the
+ * frame timeline, since this is the queue the JS thread runs on.
  */
 class MessageQueueThreadImpl : public MessageQueueThread {
  public:
@@ -9,8 +9,9 @@
 
 #include <folly/portability/SysResource.h>
 #include <folly/system/ThreadName.h>
+#include <algorithm>
 #include <chrono>
-#include <future>
+#include <memory>
 #include <utility>
 
 #include <glog/logging.h>
@@ -26,6 +27,10 @@ TaskDispatchThread::TaskDispatchThread(
     std::string threadName,
     int priorityOffset) noexcept
     : threadName_(std::move(threadName)) {
+  for (size_t i = 0; i < TaskPoolCapacity; i++) {
+    taskPool_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+
 #ifdef ANDROID
   // Attaches the thread to JVM just in case anything calls out to Java
   thread_ = std::thread([&]() {
@@ -51,6 +56,21 @@ TaskDispatchThread::TaskDispatchThread(
 
 TaskDispatchThread::~TaskDispatchThread() noexcept {
   quit();
+
+  auto* task = postedTasks_.exchange(nullptr, std::memory_order_acquire);
+  while (task != nullptr) {
+    delete std::exchange(task, task->next);
+  }
+  for (auto* readyTask : readyTasks_) {
+    delete readyTask;
+  }
+  while (!delayedTasks_.empty()) {
+    delete delayedTasks_.top();
+    delayedTasks_.pop();
+  }
+  while ((task = popPooledTask()) != nullptr) {
+    delete task;
+  }
 }
 
 bool TaskDispatchThread::isOnThread() noexcept {
@@ -67,21 +87,44 @@ void TaskDispatchThread::runAsync(
   if (!running_) {
     return;
   }
-  std::lock_guard<std::mutex> guard(queueLock_);
-  auto dispatchTime = std::chrono::system_clock::now() + delayMs;
-  queue_.emplace(dispatchTime, std::move(task));
-  loopCv_.notify_one();
+  auto* node = allocateTask();
+  node->fn = std::move(task);
+  node->dispatchTime = delayMs > std::chrono::milliseconds::zero()
+      ? std::chrono::steady_clock::now() + delayMs
+      : TimePoint{};
+
+  auto* head = postedTasks_.load(std::memory_order_relaxed);
+  do {
+    node->next = head;
+  } while (!postedTasks_.compare_exchange_weak(head, node));
+
+  // Only the first task of a batch needs to wake the thread up: until the
+  // thread drains the batch, it checks for posted tasks before sleeping.
+  if (head == nullptr) {
+    wakeUp();
+  }
 }
 
 void TaskDispatchThread::runSync(TaskFn&& task) noexcept {
-  std::promise<void> promise;
-  runAsync([&]() {
+  if (!running_) {
+    return;
+  }
+  if (isOnThread()) {
+    task();
+    return;
+  }
+  // Int-sized so that waiting maps directly onto a futex where available.
+  // Shared with the task, as this thread may return and release its
+  // reference before `notify_one` returns on the looper's thread.
+  auto done = std::make_shared<std::atomic<int>>(0);
+  runAsync([&task, done, this]() {
     if (running_) {
       task();
     }
-    promise.set_value();
+    done->store(1, std::memory_order_release);
+    done->notify_one();
   });
-  promise.get_future().wait();
+  done->wait(0, std::memory_order_acquire);
 }
 
 void TaskDispatchThread::quit() noexcept {
@@ -89,6 +132,10 @@ void TaskDispatchThread::quit() noexcept {
     return;
   }
   running_ = false;
+  {
+    // Synchronizes with the thread checking `running_` before sleeping
+    std::lock_guard<std::mutex> lock(sleepLock_);
+  }
   loopCv_.notify_one();
   if (thread_.joinable()) {
     if (!isOnThread()) {
@@ -104,26 +151,148 @@ void TaskDispatchThread::loop() noexcept {
     folly::setThreadName(threadName_);
   }
   while (running_) {
-    std::unique_lock<std::mutex> lock(queueLock_);
-    loopCv_.wait(lock, [&]() { return !running_ || !queue_.empty(); });
-    while (!queue_.empty()) {
-      auto task = queue_.top();
-      auto now = std::chrono::system_clock::now();
-      if (task.dispatchTime > now) {
-        if (running_) {
-          loopCv_.wait_until(lock, task.dispatchTime);
-        } else {
-          // Shutting down, skip all the delayed tasks that are not to be
-          // executed yet
-          queue_.pop();
-        }
-        continue;
+    takePostedTasks();
+    runDueTasks();
+    if (postedTasks_.load(std::memory_order_relaxed) != nullptr) {
+      continue;
+    }
+    waitForTasks(
+        delayedTasks_.empty() ? nullptr : &delayedTasks_.top()->dispatchTime);
+  }
+
+  // Shutting down: run the tasks which are already due, skip all the delayed
+  // tasks that are not to be executed yet
+  takePostedTasks();
+  runDueTasks();
+}
+
+void TaskDispatchThread::takePostedTasks() noexcept {
+  auto* task = postedTasks_.exchange(nullptr, std::memory_order_acquire);
+
+  // Restore posting order
+  Task* reversed = nullptr;
+  while (task != nullptr) {
+    auto* next = task->next;
+    task->next = reversed;
+    reversed = task;
+    task = next;
+  }
+
+  for (task = reversed; task != nullptr; task = task->next) {
+    if (task->dispatchTime == TimePoint{}) {
+      readyTasks_.push_back(task);
+    } else {
+      task->sequence = delayedTasksSequence_++;
+      delayedTasks_.push(task);
+    }
+  }
+}
+
+void TaskDispatchThread::runDueTasks() noexcept {
+  if (!delayedTasks_.empty()) {
+    auto now = std::chrono::steady_clock::now();
+    while (!delayedTasks_.empty() &&
+           delayedTasks_.top()->dispatchTime <= now) {
+      auto* task = delayedTasks_.top();
+      delayedTasks_.pop();
+      task->fn();
+      recycleTask(task);
+    }
+  }
+
+  // Tasks may post further tasks; those run on the next iteration.
+  for (auto* task : readyTasks_) {
+    task->fn();
+    recycleTask(task);
+  }
+  readyTasks_.clear();
+}
+
+void TaskDispatchThread::waitForTasks(const TimePoint* deadline) noexcept {
+  std::unique_lock<std::mutex> lock(sleepLock_);
+  // Paired with `wakeUp`: either the posting thread observes `sleeping_`, or
+  // this thread observes the posted task. Both are sequentially consistent.
+  sleeping_.store(true);
+  auto hasWork = [&]() {
+    return !running_ || postedTasks_.load() != nullptr;
+  };
+  if (deadline != nullptr) {
+    loopCv_.wait_until(lock, *deadline, hasWork);
+  } else {
+    loopCv_.wait(lock, hasWork);
+  }
+  sleeping_.store(false, std::memory_order_relaxed);
+}
+
+void TaskDispatchThread::wakeUp() noexcept {
+  if (sleeping_.load()) {
+    {
+      // Ensures the thread is either waiting or will see the posted task
+      std::lock_guard<std::mutex> lock(sleepLock_);
+    }
+    loopCv_.notify_one();
+  }
+}
+
+TaskDispatchThread::Task* TaskDispatchThread::allocateTask() noexcept {
+  if (auto* task = popPooledTask()) {
+    return task;
+  }
+  return new Task();
+}
+
+void TaskDispatchThread::recycleTask(Task* task) noexcept {
+  // Release captures on this thread, as soon as the task has run
+  task->fn = nullptr;
+  task->next = nullptr;
+  if (!pushPooledTask(task)) {
+    delete task;
+  }
+}
+
+TaskDispatchThread::Task* TaskDispatchThread::popPooledTask() noexcept {
+  auto position = taskPoolPopPosition_.load(std::memory_order_relaxed);
+  while (true) {
+    auto& cell = taskPool_[position % TaskPoolCapacity];
+    auto sequence = cell.sequence.load(std::memory_order_acquire);
+    auto difference = static_cast<intptr_t>(sequence) -
+        static_cast<intptr_t>(position + 1);
+    if (difference == 0) {
+      if (taskPoolPopPosition_.compare_exchange_weak(
+              position, position + 1, std::memory_order_relaxed)) {
+        auto* task = cell.task;
+        cell.sequence.store(
+            position + TaskPoolCapacity, std::memory_order_release);
+        return task;
       }
+    } else if (difference < 0) {
+      // Empty
+      return nullptr;
+    } else {
+      position = taskPoolPopPosition_.load(std::memory_order_relaxed);
+    }
+  }
+}
 
-      queue_.pop();
-      lock.unlock();
-      task.fn();
-      lock.lock();
+bool TaskDispatchThread::pushPooledTask(Task* task) noexcept {
+  auto position = taskPoolPushPosition_.load(std::memory_order_relaxed);
+  while (true) {
+    auto& cell = taskPool_[position % TaskPoolCapacity];
+    auto sequence = cell.sequence.load(std::memory_order_acquire);
+    auto difference =
+        static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+    if (difference == 0) {
+      if (taskPoolPushPosition_.compare_exchange_weak(
+              position, position + 1, std::memory_order_relaxed)) {
+        cell.task = task;
+        cell.sequence.store(position + 1, std::memory_order_release);
+        return true;
+      }
+    } else if (difference < 0) {
+      // Full
+      return false;
+    } else {
+      position = taskPoolPushPosition_.load(std::memory_order_relaxed);
     }
   }
 }
@@ -7,23 +7,35 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <functional>
 #include <mutex>
 #include <queue>
 #include <thread>
+#include <vector>
 
 namespace facebook::react {
 
 /**
  * Representation of a thread looper which can add tasks to a queue and handle
  * the synchronization of callers.
+ *
+ * Posting a task does not take a lock: tasks are pushed onto a lock-free
+ * list which the thread drains in batches, and delayed tasks are moved from
+ * there into a heap only the thread itself touches. The mutex and condition
+ * variable are only used to put the thread to sleep and wake it up, and a
+ * wakeup is only signalled when the thread is actually sleeping. Task nodes
+ * are recycled through a pool, so posting a task whose callable fits into
+ * `std::function`'s inline storage does not allocate.
  */
 class TaskDispatchThread {
  public:
   using TaskFn = std::function<void()>;
-  using TimePoint = std::chrono::time_point<std::chrono::system_clock>;
+  using TimePoint = std::chrono::steady_clock::time_point;
 
   TaskDispatchThread(
       std::string threadName = "",
@@ -43,7 +55,10 @@ class TaskDispatchThread {
       std::chrono::milliseconds delayMs =
           std::chrono::milliseconds::zero()) noexcept;
 
-  /** Add task to the queue and wait until it has completed. */
+  /**
+   * Add task to the queue and wait until it has completed. Runs the task
+   * inline when called on this looper's thread.
+   */
   void runSync(TaskFn&& task) noexcept;
 
   /** Shut down and clean up the thread. */
@@ -51,23 +66,66 @@ class TaskDispatchThread {
 
  protected:
   struct Task {
-    TimePoint dispatchTime;
+    Task* next{nullptr};
+    // Zero for tasks which should run as soon as possible
+    TimePoint dispatchTime{};
+    // Orders delayed tasks with the same dispatch time
+    uint64_t sequence{0};
     TaskFn fn;
+  };
 
-    Task(TimePoint dispatchTime, TaskFn&& fn)
-        : dispatchTime(dispatchTime), fn(std::move(fn)) {}
-
-    bool operator<(const Task& other) const {
+  struct TaskComparator {
+    bool operator()(const Task* lhs, const Task* rhs) const {
       // Have the earliest tasks be at the front of the queue.
-      return dispatchTime > other.dispatchTime;
+      return lhs->dispatchTime != rhs->dispatchTime
+          ? lhs->dispatchTime > rhs->dispatchTime
+          : lhs->sequence > rhs->sequence;
     }
   };
 
   void loop() noexcept;
 
-  std::mutex queueLock_;
+  /** Moves posted tasks to `readyTasks_` and `delayedTasks_`. */
+  void takePostedTasks() noexcept;
+
+  /** Runs ready tasks and delayed tasks which are due. */
+  void runDueTasks() noexcept;
+
+  /** Waits until a task is posted, `deadline` passes or the thread quits. */
+  void waitForTasks(const TimePoint* deadline) noexcept;
+
+  void wakeUp() noexcept;
+
+  Task* allocateTask() noexcept;
+  void recycleTask(Task* task) noexcept;
+  Task* popPooledTask() noexcept;
+  bool pushPooledTask(Task* task) noexcept;
+
+  // Tasks posted since the thread last drained them, most recent first
+  std::atomic<Task*> postedTasks_{nullptr};
+
+  // Pool of unused task nodes: a bounded queue filled by the looper's thread
+  // and emptied by posting threads. Cell sequence numbers make it safe for
+  // several threads to take nodes concurrently without ABA issues.
+  static constexpr size_t TaskPoolCapacity = 256;
+  struct TaskPoolCell {
+    std::atomic<size_t> sequence;
+    Task* task;
+  };
+  std::array<TaskPoolCell, TaskPoolCapacity> taskPool_;
+  std::atomic<size_t> taskPoolPushPosition_{0};
+  std::atomic<size_t> taskPoolPopPosition_{0};
+
+  // Only accessed on the looper's thread
+  std::vector<Task*> readyTasks_;
+  std::priority_queue<Task*, std::vector<Task*>, TaskComparator>
+      delayedTasks_;
+  uint64_t delayedTasksSequence_{0};
+
+  std::mutex sleepLock_;
   std::condition_variable loopCv_;
-  std::priority_queue<Task> queue_;
+  std::atomic<bool> sleeping_{false};
+
   std::atomic<bool> running_{true};
   std::string threadName_;
   std::thread thread_;
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <react/threading/TaskDispatchThread.h>
+
+#include <atomic>
+#include <future>
+#include <vector>
+
+namespace facebook::react {
+
+using namespace std::chrono_literals;
+
+TEST(TaskDispatchThreadTests, runsTasksInPostingOrder) {
+  TaskDispatchThread thread;
+  std::vector<int> order;
+  for (int i = 0; i < 1000; i++) {
+    thread.runAsync([&order, i]() { order.push_back(i); });
+  }
+  thread.runSync([]() {});
+
+  ASSERT_EQ(order.size(), 1000);
+  for (int i = 0; i < 1000; i++) {
+    EXPECT_EQ(order[i], i);
+  }
+}
+
+TEST(TaskDispatchThreadTests, runsDelayedTasksByDispatchTime) {
+  // Outlive the thread, which may still be signalling them
+  std::promise<void> allTasksPosted;
+  std::promise<void> lastTaskRan;
+  std::vector<int> order;
+  TaskDispatchThread thread;
+
+  // Hold the thread until all tasks are posted, so that they run by dispatch
+  // time rather than by when the thread happened to pick them up
+  thread.runAsync(
+      [allTasksPosted = allTasksPosted.get_future().share()]() {
+        allTasksPosted.wait();
+      });
+  thread.runAsync([&]() { order.push_back(4); }, 30ms);
+  thread.runAsync([&]() { order.push_back(2); }, 10ms);
+  thread.runAsync(
+      [&]() {
+        order.push_back(5);
+        lastTaskRan.set_value();
+      },
+      40ms);
+  thread.runAsync([&]() { order.push_back(1); }, 1ms);
+  thread.runAsync([&]() { order.push_back(3); }, 20ms);
+  allTasksPosted.set_value();
+  lastTaskRan.get_future().wait();
+
+  EXPECT_EQ(order, (std::vector<int>{1, 2, 3, 4, 5}));
+}
+
+TEST(TaskDispatchThreadTests, runsImmediateTasksWhileDelayedTasksWait) {
+  TaskDispatchThread thread;
+  std::atomic<bool> delayedTaskRan{false};
+  thread.runAsync([&]() { delayedTaskRan = true; }, 10s);
+
+  bool immediateTaskRan = false;
+  thread.runSync([&]() { immediateTaskRan = true; });
+  EXPECT_TRUE(immediateTaskRan);
+  EXPECT_FALSE(delayedTaskRan);
+}
+
+TEST(TaskDispatchThreadTests, runSyncRunsInlineOnThread) {
+  TaskDispatchThread thread;
+  bool ranInline = false;
+  thread.runSync([&]() {
+    // Would deadlock if it waited for the thread to pick the task up
+    thread.runSync([&]() { ranInline = thread.isOnThread(); });
+  });
+  EXPECT_TRUE(ranInline);
+}
+
+TEST(TaskDispatchThreadTests, runsTasksFromManyThreads) {
+  constexpr int ThreadCount = 8;
+  constexpr int TasksPerThread = 10'000;
+
+  TaskDispatchThread thread;
+  int count = 0;
+  std::vector<std::thread> posters;
+  for (int i = 0; i < ThreadCount; i++) {
+    posters.emplace_back([&]() {
+      for (int j = 0; j < TasksPerThread; j++) {
+        thread.runAsync([&count]() { count++; });
+      }
+    });
+  }
+  for (auto& poster : posters) {
+    poster.join();
+  }
+  thread.runSync([]() {});
+
+  EXPECT_EQ(count, ThreadCount * TasksPerThread);
+}
+
+TEST(TaskDispatchThreadTests, quitSkipsPendingDelayedTasks) {
+  std::atomic<int> ran{0};
+  {
+    TaskDispatchThread thread;
+    thread.runAsync([&]() { ran++; }, 10s);
+    thread.runSync([&]() { ran++; });
+    thread.quit();
+    EXPECT_FALSE(thread.isRunning());
+
+    thread.runAsync([&]() { ran++; });
+  }
+  EXPECT_EQ(ran, 1);
+}
+
+} // namespace facebook::react
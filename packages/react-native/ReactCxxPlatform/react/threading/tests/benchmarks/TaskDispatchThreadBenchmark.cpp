@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/threading/TaskDispatchThread.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr int BatchSize = 10'000;
+
+// Round trip to an idle thread: post, wake up, run, signal back
+void postAndDispatchLatency(benchmark::State& state) {
+  TaskDispatchThread thread;
+  for (auto _ : state) {
+    thread.runSync([]() {});
+  }
+}
+
+// Tasks posted in a burst, the way CallInvoker::invokeAsync is used
+void singleProducerThroughput(benchmark::State& state) {
+  TaskDispatchThread thread;
+  int count = 0;
+  for (auto _ : state) {
+    for (int i = 0; i < BatchSize; i++) {
+      thread.runAsync([&count]() { count++; });
+    }
+    thread.runSync([]() {});
+  }
+  benchmark::DoNotOptimize(count);
+  state.SetItemsProcessed(state.iterations() * BatchSize);
+}
+
+void multiProducerThroughput(benchmark::State& state) {
+  const auto producerCount = static_cast<int>(state.range(0));
+  TaskDispatchThread thread;
+  int count = 0;
+  for (auto _ : state) {
+    std::vector<std::thread> producers;
+    for (int i = 0; i < producerCount; i++) {
+      producers.emplace_back([&]() {
+        for (int j = 0; j < BatchSize; j++) {
+          thread.runAsync([&count]() { count++; });
+        }
+      });
+    }
+    for (auto& producer : producers) {
+      producer.join();
+    }
+    thread.runSync([]() {});
+  }
+  benchmark::DoNotOptimize(count);
+  state.SetItemsProcessed(state.iterations() * producerCount * BatchSize);
+}
+
+// Delayed tasks interleaved with immediate ones
+void delayedTaskThroughput(benchmark::State& state) {
+  TaskDispatchThread thread;
+  std::atomic<int> count = 0;
+  for (auto _ : state) {
+    for (int i = 0; i < BatchSize; i++) {
+      thread.runAsync(
+          [&count]() { count++; }, std::chrono::milliseconds(i % 2));
+    }
+    while (count.load() < BatchSize) {
+      std::this_thread::yield();
+    }
+    count = 0;
+  }
+  state.SetItemsProcessed(state.iterations() * BatchSize);
+}
+
+void runSyncOnThread(benchmark::State& state) {
+  TaskDispatchThread thread;
+  thread.runSync([&]() {
+    int count = 0;
+    for (auto _ : state) {
+      thread.runSync([&count]() { count++; });
+    }
+    benchmark::DoNotOptimize(count);
+  });
+}
+
+} // namespace
+
+BENCHMARK(postAndDispatchLatency);
+BENCHMARK(singleProducerThroughput);
+BENCHMARK(multiProducerThroughput)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+BENCHMARK(delayedTaskThroughput);
+BENCHMARK(runSyncOnThread);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();